@@ -0,0 +1,67 @@
+/**
+ * @file BatteryMonitor.cpp
+ * @brief バッテリ電圧監視（ADC） 実装
+ */
+
+#include "BatteryMonitor.h"
+
+BatteryMonitor::BatteryMonitor(AdcReadFunc readAdc, float dividerRatio,
+                               float lowThreshold, float hysteresis, float filterAlpha)
+    : readAdc_(readAdc)
+    , dividerRatio_(dividerRatio)
+    , lowThreshold_(lowThreshold)
+    , hysteresis_(hysteresis)
+    , filterAlpha_(filterAlpha)
+    , voltage_(0.0f)
+    , lowVoltage_(false)
+    , hasSample_(false)
+{
+}
+
+void BatteryMonitor::update() {
+    if (readAdc_ == nullptr) {
+        return;
+    }
+    updateRaw(readAdc_());
+}
+
+void BatteryMonitor::updateRaw(uint16_t raw) {
+    float sample = rawToVoltage(raw, dividerRatio_);
+
+    // 1次IIRローパスフィルタ（初回はサンプル値で初期化）
+    if (!hasSample_) {
+        voltage_ = sample;
+        hasSample_ = true;
+    } else {
+        voltage_ += filterAlpha_ * (sample - voltage_);
+    }
+
+    lowVoltage_ = judgeLowVoltage(voltage_, lowVoltage_, lowThreshold_, hysteresis_);
+}
+
+float BatteryMonitor::getVoltage() const {
+    return voltage_;
+}
+
+bool BatteryMonitor::isLowVoltage() const {
+    return lowVoltage_;
+}
+
+bool BatteryMonitor::hasSample() const {
+    return hasSample_;
+}
+
+float BatteryMonitor::rawToVoltage(uint16_t raw, float dividerRatio) {
+    if (raw > ADC_MAX) {
+        raw = ADC_MAX;
+    }
+    return static_cast<float>(raw) * ADC_VREF / static_cast<float>(ADC_MAX) * dividerRatio;
+}
+
+bool BatteryMonitor::judgeLowVoltage(float voltage, bool wasLow, float lowThreshold, float hysteresis) {
+    if (wasLow) {
+        // 解除はしきい値+ヒステリシスを超えたとき
+        return voltage < lowThreshold + hysteresis;
+    }
+    return voltage < lowThreshold;
+}
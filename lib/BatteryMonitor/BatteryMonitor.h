@@ -0,0 +1,114 @@
+/**
+ * @file BatteryMonitor.h
+ * @brief バッテリ電圧監視（ADC）
+ *
+ * 分圧抵抗経由でバス電圧をADCサンプリングし、ローパスフィルタで平滑化する。
+ * 低電圧判定はヒステリシス付き。MotorDriverの電圧補償に使用する。
+ */
+
+#ifndef BATTERY_MONITOR_H
+#define BATTERY_MONITOR_H
+
+#include <stdint.h>
+
+/**
+ * @class BatteryMonitor
+ * @brief バス電圧のサンプリング・フィルタ・低電圧判定
+ *
+ * ADC読み取り関数を注入することで、実機では analogRead()、
+ * ユニットテストでは任意の値を返す関数を使用できる。
+ *
+ * 使用例:
+ * @code
+ * uint16_t readBatteryAdc() { return analogRead(26); }
+ *
+ * BatteryMonitor battery(readBatteryAdc, 11.0f, 21.0f, 0.5f);
+ * battery.update();              // 制御周期ごとに呼び出し
+ * float v = battery.getVoltage();
+ * bool low = battery.isLowVoltage();
+ * @endcode
+ */
+class BatteryMonitor {
+public:
+    /**
+     * @brief ADC読み取り関数の型（生値 0〜ADC_MAX を返す）
+     */
+    typedef uint16_t (*AdcReadFunc)();
+
+    /**
+     * @brief コンストラクタ
+     * @param readAdc ADC読み取り関数（nullptrの場合はupdate()が何もしない）
+     * @param dividerRatio 分圧比（バス電圧 / ADCピン電圧）
+     * @param lowThreshold 低電圧判定しきい値 [V]
+     * @param hysteresis 低電圧解除ヒステリシス [V]
+     * @param filterAlpha ローパスフィルタ係数（0.0〜1.0、大きいほど追従が速い）
+     */
+    BatteryMonitor(AdcReadFunc readAdc, float dividerRatio,
+                   float lowThreshold, float hysteresis, float filterAlpha = 0.1f);
+
+    /**
+     * @brief ADCを1回サンプリングしてフィルタ・低電圧判定を更新
+     */
+    void update();
+
+    /**
+     * @brief ADC生値を直接与えて更新（readAdcを使わない場合）
+     * @param raw ADC生値
+     */
+    void updateRaw(uint16_t raw);
+
+    /**
+     * @brief フィルタ後のバス電圧 [V]（未サンプリング時は0）
+     */
+    float getVoltage() const;
+
+    /**
+     * @brief 低電圧状態か（ヒステリシス付き）
+     */
+    bool isLowVoltage() const;
+
+    /**
+     * @brief 1回以上サンプリング済みか
+     */
+    bool hasSample() const;
+
+    // =========================================================================
+    // 静的ユーティリティ関数（テスト可能なロジック部分）
+    // =========================================================================
+
+    /**
+     * @brief ADC生値をバス電圧に変換
+     * @param raw ADC生値
+     * @param dividerRatio 分圧比
+     * @return バス電圧 [V]
+     */
+    static float rawToVoltage(uint16_t raw, float dividerRatio);
+
+    /**
+     * @brief ヒステリシス付き低電圧判定
+     * @param voltage 現在電圧 [V]
+     * @param wasLow 前回の判定結果
+     * @param lowThreshold しきい値 [V]
+     * @param hysteresis ヒステリシス幅 [V]
+     * @return 新しい判定結果
+     */
+    static bool judgeLowVoltage(float voltage, bool wasLow, float lowThreshold, float hysteresis);
+
+    // =========================================================================
+    // 定数
+    // =========================================================================
+    static constexpr float ADC_VREF = 3.3f;
+    static constexpr uint16_t ADC_MAX = 4095;  // 12bit
+
+private:
+    AdcReadFunc readAdc_;
+    float dividerRatio_;
+    float lowThreshold_;
+    float hysteresis_;
+    float filterAlpha_;
+    float voltage_;
+    bool lowVoltage_;
+    bool hasSample_;
+};
+
+#endif // BATTERY_MONITOR_H
@@ -0,0 +1,57 @@
+/**
+ * @file CommandDeadline.cpp
+ * @brief 速度指令ごとの有効期限と期限切れ時の減速停止 実装
+ */
+
+#include "CommandDeadline.h"
+
+CommandDeadline::CommandDeadline(uint32_t defaultValidityMs, uint32_t maxValidityMs, uint32_t rampTimeMs)
+    : defaultValidityMs_(defaultValidityMs)
+    , maxValidityMs_(maxValidityMs)
+    , rampTimeUs_(rampTimeMs * 1000)
+    , receivedUs_(0)
+    , validityUs_(resolveValidityMs(0, defaultValidityMs, maxValidityMs) * 1000)
+    , expiredCount_(0)
+    , state_(STATE_IDLE)
+{
+}
+
+void CommandDeadline::arm(uint32_t receivedUs, uint16_t validityMs) {
+    receivedUs_ = receivedUs;
+    validityUs_ = resolveValidityMs(validityMs, defaultValidityMs_, maxValidityMs_) * 1000;
+    state_ = STATE_VALID;
+}
+
+void CommandDeadline::disarm() {
+    state_ = STATE_IDLE;
+}
+
+CommandDeadline::State CommandDeadline::update(uint32_t nowUs) {
+    if (state_ == STATE_IDLE || state_ == STATE_STOPPED) {
+        return state_;
+    }
+
+    int32_t elapsed = static_cast<int32_t>(nowUs - receivedUs_);
+    if (elapsed < 0) {
+        elapsed = 0;
+    }
+    uint32_t elapsedUs = static_cast<uint32_t>(elapsed);
+
+    if (elapsedUs <= validityUs_) {
+        return state_;
+    }
+    if (state_ == STATE_VALID) {
+        state_ = STATE_RAMPING;
+        expiredCount_++;
+    }
+    if (elapsedUs - validityUs_ > rampTimeUs_) {
+        state_ = STATE_STOPPED;
+    }
+    return state_;
+}
+
+uint32_t CommandDeadline::resolveValidityMs(uint16_t validityMs, uint32_t defaultValidityMs,
+                                            uint32_t maxValidityMs) {
+    uint32_t resolved = (validityMs == 0) ? defaultValidityMs : validityMs;
+    return (resolved > maxValidityMs) ? maxValidityMs : resolved;
+}
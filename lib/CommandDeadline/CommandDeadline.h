@@ -0,0 +1,108 @@
+/**
+ * @file CommandDeadline.h
+ * @brief 速度指令ごとの有効期限と期限切れ時の減速停止
+ *
+ * MOTOR_COMMANDごとに有効期間（ホストが指定、0でデフォルト）を持たせ、
+ * Core1が制御周期ごとに期限を判定する。Core0の100ms周期のフェイルセーフ判定と違い、
+ * 期限切れから停止開始までの遅れは1制御周期以内になる。
+ *
+ * 期限切れ後は減速（加減速プロファイルで速度0へ）し、減速時間の上限を過ぎても
+ * 止まりきらない場合は停止に移る。新しい指令を受信すると有効に戻る。
+ *
+ * 時刻はすべてuint32 [us]（差分は符号付きで扱い、ラップアラウンドを吸収する）。
+ */
+
+#ifndef COMMAND_DEADLINE_H
+#define COMMAND_DEADLINE_H
+
+#include <stdint.h>
+
+/**
+ * @class CommandDeadline
+ * @brief 指令の有効期限の判定
+ *
+ * 使用例（Core1、制御周期ごと）:
+ * @code
+ * CommandDeadline deadline(500, 500, 300);
+ * if (newCommand) {
+ *     deadline.arm(receivedUs, validityMs);
+ * }
+ * switch (deadline.update(micros())) {
+ *     case CommandDeadline::STATE_RAMPING:  // 速度0を目標に減速
+ *     case CommandDeadline::STATE_STOPPED:  // 停止
+ *     ...
+ * }
+ * @endcode
+ */
+class CommandDeadline {
+public:
+    enum State {
+        STATE_IDLE = 0,     // 期限なし（指令未受信・位置制御・軌道実行中）
+        STATE_VALID = 1,    // 有効期間内
+        STATE_RAMPING = 2,  // 期限切れ、減速中
+        STATE_STOPPED = 3   // 期限切れ、減速時間の上限を超過
+    };
+
+    /**
+     * @brief コンストラクタ
+     * @param defaultValidityMs 有効期間が0（未指定）の指令に使う有効期間 [ms]
+     * @param maxValidityMs 有効期間の上限 [ms]（超える指定は上限に丸める）
+     * @param rampTimeMs 期限切れから停止に移るまでの減速時間の上限 [ms]
+     */
+    CommandDeadline(uint32_t defaultValidityMs, uint32_t maxValidityMs, uint32_t rampTimeMs);
+
+    /**
+     * @brief 指令の受信時に期限を設定
+     * @param receivedUs 指令の受信時刻 [us]
+     * @param validityMs 有効期間 [ms]（0でデフォルト）
+     */
+    void arm(uint32_t receivedUs, uint16_t validityMs);
+
+    /**
+     * @brief 期限を解除（位置制御・軌道など、速度指令以外で動作する場合）
+     */
+    void disarm();
+
+    /**
+     * @brief 現在時刻で状態を更新
+     *
+     * 受信時刻が現在時刻より後（別コアで受信した直後）の場合は経過時間0として扱う。
+     *
+     * @param nowUs 現在時刻 [us]
+     * @return 更新後の状態
+     */
+    State update(uint32_t nowUs);
+
+    State getState() const { return state_; }
+
+    // 期限切れか（減速中・停止）
+    bool isExpired() const { return state_ == STATE_RAMPING || state_ == STATE_STOPPED; }
+
+    // 適用中の有効期間 [ms]（デフォルト・上限の丸め後）
+    uint32_t getValidityMs() const { return validityUs_ / 1000; }
+
+    // 期限切れになった回数
+    uint32_t getExpiredCount() const { return expiredCount_; }
+
+    /**
+     * @brief 指定した有効期間をデフォルト・上限で丸める（ハードウェア非依存、テスト可能）
+     * @param validityMs 指定値 [ms]（0でデフォルト）
+     * @param defaultValidityMs デフォルト [ms]
+     * @param maxValidityMs 上限 [ms]
+     * @return 適用する有効期間 [ms]
+     */
+    static uint32_t resolveValidityMs(uint16_t validityMs, uint32_t defaultValidityMs,
+                                      uint32_t maxValidityMs);
+
+private:
+    uint32_t defaultValidityMs_;
+    uint32_t maxValidityMs_;
+    uint32_t rampTimeUs_;
+
+    uint32_t receivedUs_;
+    uint32_t validityUs_;
+    uint32_t expiredCount_;
+    State state_;
+};
+
+#endif // COMMAND_DEADLINE_H
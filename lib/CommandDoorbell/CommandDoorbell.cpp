@@ -0,0 +1,71 @@
+/**
+ * @file CommandDoorbell.cpp
+ * @brief Core0 → Core1 の指令到着通知（コア間FIFO） 実装
+ */
+
+#include "CommandDoorbell.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+CommandDoorbell::CommandDoorbell()
+    : lastValue_(0)
+#ifndef ARDUINO
+    , ringCount_(0)
+    , takenCount_(0)
+    , pendingValue_(0)
+#endif
+{
+}
+
+void CommandDoorbell::ring(uint32_t value) {
+#ifdef ARDUINO
+    // 満杯の場合は捨てる（未処理のドアベルで起床し、最新の指令を読む）
+    rp2040.fifo.push_nb(value);
+#else
+    pendingValue_ = value;
+    ringCount_ = ringCount_ + 1;
+#endif
+}
+
+bool CommandDoorbell::take() {
+#ifdef ARDUINO
+    bool rang = false;
+    uint32_t value;
+    while (rp2040.fifo.pop_nb(&value)) {
+        lastValue_ = value;
+        rang = true;
+    }
+    return rang;
+#else
+    uint32_t count = ringCount_;
+    if (count == takenCount_) {
+        return false;
+    }
+    takenCount_ = count;
+    lastValue_ = pendingValue_;
+    return true;
+#endif
+}
+
+bool CommandDoorbell::isPending() const {
+#ifdef ARDUINO
+    return rp2040.fifo.available() > 0;
+#else
+    return ringCount_ != takenCount_;
+#endif
+}
+
+bool CommandDoorbell::canRunOutOfCycle(uint32_t minIntervalUs, uint32_t periodUs) {
+    return 2 * minIntervalUs < periodUs;
+}
+
+uint32_t CommandDoorbell::outOfCycleDelayUs(uint32_t sinceLastRunUs, uint32_t sinceTickUs,
+                                            uint32_t minIntervalUs, uint32_t periodUs) {
+    uint32_t delayUs = (sinceLastRunUs >= minIntervalUs) ? 0 : minIntervalUs - sinceLastRunUs;
+    if (static_cast<uint64_t>(sinceTickUs) + delayUs + minIntervalUs > periodUs) {
+        return DEFER_TO_NEXT_TICK;
+    }
+    return delayUs;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file CommandDoorbell.h
+ * @brief Core0 → Core1 の指令到着通知（コア間FIFO）
+ *
+ * MOTOR_COMMANDはcmdVelDataに書き込むだけでは、Core1が次の制御周期（100Hzで最大10ms）まで
+ * 気づかない。Core0は指令の書き込み後にドアベルを鳴らし、制御周期の待機（WFE）中の
+ * Core1を起こす。Core1は周期の途中で指令処理・速度PIDを実行する
+ * （ControlScheduler::advanceOutOfCycle()）。制御周期の位相は変えない。
+ *
+ * 実機ではarduino-picoのコア間FIFO（rp2040.fifo）を使う。SIOのハードウェアFIFOは
+ * arduino-picoがidleOtherCore()（フラッシュ書き込み時のCore1停止）に使用しているため、
+ * rp2040.fifoはスピンロック付きのキューで実装されており、追加時にSEVで相手コアを起こす。
+ *
+ * 値は指令のシーケンス番号（cmdVelData.commandSeq）。FIFOが満杯の場合は捨てる
+ * （Core1は未処理のドアベルで起床し、cmdVelDataから最新の指令を読むため失われない）。
+ */
+
+#ifndef COMMAND_DOORBELL_H
+#define COMMAND_DOORBELL_H
+
+#include <stdint.h>
+
+/**
+ * @class CommandDoorbell
+ * @brief 指令到着のドアベル
+ *
+ * 使用例:
+ * @code
+ * // Core0（MOTOR_COMMAND受信時、cmdVelDataの書き込み後）
+ * commandDoorbell.ring(cmdVelData.commandSeq);
+ *
+ * // Core1
+ * uint32_t ticks = controlTimer.wait(commandDoorbell);
+ * if (commandDoorbell.take()) {
+ *     // 周期の途中で指令を適用
+ * }
+ * @endcode
+ */
+class CommandDoorbell {
+public:
+    CommandDoorbell();
+
+    /**
+     * @brief ドアベルを鳴らす（Core0）
+     * @param value 通知する値（指令のシーケンス番号）
+     */
+    void ring(uint32_t value);
+
+    /**
+     * @brief 未処理のドアベルをすべて取り出す（Core1）
+     * @return 1つ以上鳴っていた場合true
+     */
+    bool take();
+
+    /**
+     * @brief 未処理のドアベルがあるか（取り出さない）
+     */
+    bool isPending() const;
+
+    // 最後に取り出した値
+    uint32_t getLastValue() const { return lastValue_; }
+
+    /**
+     * @brief 周期の途中で指令を適用するか（ハードウェア非依存、テスト可能）
+     *
+     * 速度推定のdtが短すぎないよう、前回の実行と次の周期の両方から最小間隔を空ける。
+     * 制御周期が最小間隔の2倍以下の場合（RPM指令型、500Hz以上など）は次の周期で適用する。
+     *
+     * @param minIntervalUs 前回の実行・次の周期からの最小間隔 [us]
+     * @param periodUs 制御周期 [us]
+     * @return 周期の途中で適用する場合true
+     */
+    static bool canRunOutOfCycle(uint32_t minIntervalUs, uint32_t periodUs);
+
+    /**
+     * @brief 周期の途中で指令を適用するまでの待ち時間（ハードウェア非依存、テスト可能）
+     *
+     * 前回の実行から最小間隔が経っていなければその残りを待つ（ControlTimer::wakeAfterUs()）。
+     * 適用した時点から次の周期まで最小間隔を空けられない場合は次の周期で適用する。
+     *
+     * @param sinceLastRunUs 前回の実行（定期周期・周期の途中）からの経過時間 [us]
+     * @param sinceTickUs 前回の定期周期からの経過時間 [us]
+     * @param minIntervalUs 前回の実行・次の周期からの最小間隔 [us]
+     * @param periodUs 制御周期 [us]
+     * @return 待ち時間 [us]（0は今すぐ適用、DEFER_TO_NEXT_TICKは次の周期で適用）
+     */
+    static uint32_t outOfCycleDelayUs(uint32_t sinceLastRunUs, uint32_t sinceTickUs,
+                                      uint32_t minIntervalUs, uint32_t periodUs);
+
+    static constexpr uint32_t DEFER_TO_NEXT_TICK = 0xFFFFFFFF;
+
+private:
+    uint32_t lastValue_;
+
+#ifndef ARDUINO
+    // ホスト（ユニットテスト）: 鳴らした回数と取り出した回数
+    volatile uint32_t ringCount_;
+    uint32_t takenCount_;
+    volatile uint32_t pendingValue_;
+#endif
+};
+
+#endif // COMMAND_DOORBELL_H
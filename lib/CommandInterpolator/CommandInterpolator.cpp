@@ -0,0 +1,105 @@
+/**
+ * @file CommandInterpolator.cpp
+ * @brief タイムスタンプ付き速度指令の補間・外挿 実装
+ */
+
+#include "CommandInterpolator.h"
+
+namespace {
+    // オフセット推定値の増加率（受信間隔 >> OFFSET_LEAK_SHIFT、約0.1%）
+    constexpr uint8_t OFFSET_LEAK_SHIFT = 10;
+}
+
+CommandInterpolator::CommandInterpolator(uint32_t delayUs, uint32_t maxExtrapolationUs)
+    : delayUs_(delayUs)
+    , maxExtrapolationUs_(maxExtrapolationUs)
+    , count_(0)
+    , hostTimeUs_{0, 0}
+    , linearX_{0.0f, 0.0f}
+    , angularZ_{0.0f, 0.0f}
+    , offsetUs_(0)
+    , lastReceivedUs_(0)
+{
+}
+
+void CommandInterpolator::push(uint32_t hostTimeUs, uint32_t receivedUs, float linearX, float angularZ) {
+    // ホスト時刻が戻った場合は古い指令を捨てて1点から
+    if (count_ > 0 && static_cast<int32_t>(hostTimeUs - hostTimeUs_[1]) <= 0) {
+        count_ = 0;
+    }
+
+    // クロックオフセット推定（受信遅延が最小のサンプルに合わせる）
+    uint32_t sampleOffset = receivedUs - hostTimeUs;
+    if (count_ == 0) {
+        offsetUs_ = sampleOffset;
+    } else {
+        uint32_t leaked = offsetUs_ + ((receivedUs - lastReceivedUs_) >> OFFSET_LEAK_SHIFT);
+        offsetUs_ = (static_cast<int32_t>(sampleOffset - leaked) < 0) ? sampleOffset : leaked;
+    }
+    lastReceivedUs_ = receivedUs;
+
+    if (count_ > 0) {
+        hostTimeUs_[0] = hostTimeUs_[1];
+        linearX_[0] = linearX_[1];
+        angularZ_[0] = angularZ_[1];
+    }
+    hostTimeUs_[1] = hostTimeUs;
+    linearX_[1] = linearX;
+    angularZ_[1] = angularZ;
+    if (count_ < 2) {
+        count_++;
+    }
+}
+
+bool CommandInterpolator::evaluate(uint32_t nowUs, float& linearX, float& angularZ) const {
+    if (count_ == 0) {
+        return false;
+    }
+    if (count_ == 1) {
+        linearX = linearX_[1];
+        angularZ = angularZ_[1];
+        return true;
+    }
+
+    // 評価時刻をホスト時刻系に変換し、最新指令からの経過時間を求める
+    uint32_t evalHostUs = nowUs - delayUs_ - offsetUs_;
+    int32_t sinceLatest = static_cast<int32_t>(evalHostUs - hostTimeUs_[1]);
+    if (sinceLatest > static_cast<int32_t>(maxExtrapolationUs_)) {
+        sinceLatest = static_cast<int32_t>(maxExtrapolationUs_);
+    }
+
+    int32_t span = static_cast<int32_t>(hostTimeUs_[1] - hostTimeUs_[0]);
+    linearX = project(linearX_[0], linearX_[1], span, sinceLatest);
+    angularZ = project(angularZ_[0], angularZ_[1], span, sinceLatest);
+    return true;
+}
+
+void CommandInterpolator::reset() {
+    count_ = 0;
+}
+
+uint8_t CommandInterpolator::getSampleCount() const {
+    return count_;
+}
+
+uint32_t CommandInterpolator::getClockOffset() const {
+    return offsetUs_;
+}
+
+float CommandInterpolator::project(float v0, float v1, int32_t spanUs, int32_t sinceLatestUs) {
+    if (spanUs <= 0) {
+        return v1;
+    }
+    // 古い指令より前は古い指令値で保持
+    if (sinceLatestUs < -spanUs) {
+        return v0;
+    }
+    float ratio = static_cast<float>(sinceLatestUs) / static_cast<float>(spanUs);
+    float value = v1 + (v1 - v0) * ratio;
+
+    // 外挿で0を越えない（停止・減速指令の延長で逆転しない）
+    if (sinceLatestUs > 0 && ((v1 >= 0.0f && value < 0.0f) || (v1 <= 0.0f && value > 0.0f))) {
+        return 0.0f;
+    }
+    return value;
+}
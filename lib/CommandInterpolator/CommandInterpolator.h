@@ -0,0 +1,112 @@
+/**
+ * @file CommandInterpolator.h
+ * @brief タイムスタンプ付き速度指令の補間・外挿
+ *
+ * ホストは20〜30Hzでcmd_velを送るが、Core1は100Hzで制御するため、
+ * 直前の指令を保持するだけでは目標値が階段状になる。
+ * 直近2つの指令をホストのタイムスタンプ付きで保持し、制御周期ごとに
+ *   - 評価時刻が2指令の間なら線形補間
+ *   - 最新指令より後なら傾きを延長して外挿（外挿時間は上限付き）
+ * した値を出力する。外挿は0を越えない（停止指令の後に逆転しない）。
+ *
+ * ホスト時刻とPico時刻の対応（オフセット）は、受信遅延が最小のサンプルに合わせる。
+ * 時計のドリフトに追従するため、推定オフセットは受信間隔の1/1024の割合でゆっくり増やし、
+ * それより遅延の小さいサンプルが来たら置き換える。
+ *
+ * 時刻はすべてuint32 [us]（約71分でラップアラウンド、差分は符号付きで扱う）。
+ */
+
+#ifndef COMMAND_INTERPOLATOR_H
+#define COMMAND_INTERPOLATOR_H
+
+#include <stdint.h>
+
+/**
+ * @class CommandInterpolator
+ * @brief 直近2指令の補間・外挿
+ *
+ * 使用例（Core1、制御周期ごと）:
+ * @code
+ * CommandInterpolator interp(0, 50000);
+ * if (newCommand) {
+ *     interp.push(hostTimeUs, receivedUs, linearX, angularZ);
+ * }
+ * interp.evaluate(micros(), linearX, angularZ);
+ * @endcode
+ */
+class CommandInterpolator {
+public:
+    /**
+     * @brief コンストラクタ
+     * @param delayUs 評価時刻の遅延 [us]（0で最新指令から外挿、指令周期程度で補間主体）
+     * @param maxExtrapolationUs 外挿時間の上限 [us]（超えた分は保持）
+     */
+    CommandInterpolator(uint32_t delayUs, uint32_t maxExtrapolationUs);
+
+    /**
+     * @brief 指令を追加
+     *
+     * ホスト時刻が前回以前（ホスト再起動など）の場合は、古い指令を破棄して1点から始める。
+     *
+     * @param hostTimeUs ホスト側の指令時刻 [us]
+     * @param receivedUs Pico側の受信時刻 [us]
+     * @param linearX 並進速度 [m/s]
+     * @param angularZ 回転速度 [rad/s]
+     */
+    void push(uint32_t hostTimeUs, uint32_t receivedUs, float linearX, float angularZ);
+
+    /**
+     * @brief 指定時刻の指令値を計算
+     * @param nowUs 現在時刻（Pico）[us]
+     * @param[out] linearX 並進速度 [m/s]
+     * @param[out] angularZ 回転速度 [rad/s]
+     * @return 指令が1つもない場合false（出力は変更しない）
+     */
+    bool evaluate(uint32_t nowUs, float& linearX, float& angularZ) const;
+
+    /**
+     * @brief 保持している指令を破棄（タイムスタンプなし指令・フェイルセーフ時）
+     */
+    void reset();
+
+    /**
+     * @brief 保持している指令数（0〜2）
+     */
+    uint8_t getSampleCount() const;
+
+    /**
+     * @brief 推定オフセット（Pico時刻 - ホスト時刻）[us]
+     */
+    uint32_t getClockOffset() const;
+
+    // =========================================================================
+    // 静的ユーティリティ関数（テスト可能なロジック部分）
+    // =========================================================================
+
+    /**
+     * @brief 2点を通る直線上の値（t1からの経過時間で指定）
+     *
+     * 外挿（sinceLatestUs > 0）ではv1と符号が変わる前に0で止める。
+     * 停止（v1=0）や減速指令の延長で逆方向の指令にならないようにするため。
+     * @param v0 古い指令値
+     * @param v1 新しい指令値
+     * @param spanUs 2指令の時間間隔 [us]（> 0）
+     * @param sinceLatestUs 新しい指令からの経過時間 [us]（負で2点の間）
+     * @return 補間・外挿値
+     */
+    static float project(float v0, float v1, int32_t spanUs, int32_t sinceLatestUs);
+
+private:
+    uint32_t delayUs_;
+    uint32_t maxExtrapolationUs_;
+
+    uint8_t count_;
+    uint32_t hostTimeUs_[2];  ///< [0]=古い指令、[1]=新しい指令
+    float linearX_[2];
+    float angularZ_[2];
+
+    uint32_t offsetUs_;
+    uint32_t lastReceivedUs_;
+};
+
+#endif // COMMAND_INTERPOLATOR_H
@@ -0,0 +1,82 @@
+/**
+ * @file ControlScheduler.cpp
+ * @brief Core1のマルチレート制御ループの分周 実装
+ */
+
+#include "ControlScheduler.h"
+
+ControlScheduler::ControlScheduler(uint16_t rateHz, uint16_t maxRateHz,
+                                   uint16_t profileRateHz, uint16_t publishRateHz)
+    : maxRateHz_(maxRateHz)
+    , profileRateHz_((profileRateHz > 0) ? profileRateHz : publishRateHz)
+    , publishRateHz_(publishRateHz)
+    , dt_(0.0f)
+    , profileDt_(0.0f)
+    , publishDt_(0.0f)
+    , profileDue_(false)
+    , publishDue_(false)
+{
+    if (!setRate(rateHz)) {
+        setRate(publishRateHz_);
+    }
+}
+
+bool ControlScheduler::setRate(uint16_t rateHz) {
+    if (!isValidRate(rateHz, maxRateHz_, publishRateHz_)) {
+        return false;
+    }
+    rateHz_ = rateHz;
+    periodUs_ = (1000000UL + rateHz / 2) / rateHz;
+    periodSeconds_ = 1.0f / static_cast<float>(rateHz);
+    profileDivider_ = (rateHz + profileRateHz_ - 1) / profileRateHz_;
+    publishDivider_ = rateHz / publishRateHz_;
+
+    // 次の周期ですべての処理群を実行（経過時間は各処理群の1周期分）
+    profilePending_ = profileDivider_ - 1;
+    publishPending_ = publishDivider_ - 1;
+    profileCarry_ = 0.0f;
+    outOfCycleSeconds_ = 0.0f;
+    return true;
+}
+
+void ControlScheduler::advance(uint32_t ticks, bool forceProfile) {
+    // 前回の定期周期から周期の途中で実行した分は除く
+    dt_ = periodSeconds_ * static_cast<float>(ticks) - outOfCycleSeconds_;
+    outOfCycleSeconds_ = 0.0f;
+
+    profilePending_ += ticks;
+    profileDue_ = forceProfile || (profilePending_ >= profileDivider_);
+    if (profileDue_) {
+        profileDt_ = periodSeconds_ * static_cast<float>(profilePending_) + profileCarry_;
+        profilePending_ = 0;
+        profileCarry_ = 0.0f;
+    }
+
+    publishPending_ += ticks;
+    publishDue_ = (publishPending_ >= publishDivider_);
+    if (publishDue_) {
+        publishDt_ = periodSeconds_ * static_cast<float>(publishPending_);
+        publishPending_ = 0;
+    }
+}
+
+void ControlScheduler::advanceOutOfCycle(float elapsedSeconds) {
+    dt_ = elapsedSeconds;
+    outOfCycleSeconds_ += elapsedSeconds;
+
+    // 次の定期周期は前回の定期周期から数えるため、ここまでの分を差し引いておく
+    profileDue_ = true;
+    profileDt_ = periodSeconds_ * static_cast<float>(profilePending_) + profileCarry_ + outOfCycleSeconds_;
+    profilePending_ = 0;
+    profileCarry_ = -outOfCycleSeconds_;
+
+    // 公開・監視は定期周期のみ（タイマの位相を変えないため、指令が続いても遅れない）
+    publishDue_ = false;
+}
+
+bool ControlScheduler::isValidRate(uint16_t rateHz, uint16_t maxRateHz, uint16_t publishRateHz) {
+    if (publishRateHz == 0 || rateHz < publishRateHz || rateHz > maxRateHz) {
+        return false;
+    }
+    return (rateHz % publishRateHz) == 0;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file ControlScheduler.h
+ * @brief Core1のマルチレート制御ループの分周
+ *
+ * 制御周期（ハードウェアアラーム）ごとに、どの処理群を実行するかを決める。
+ *
+ * - 速度推定・PID: 毎周期（制御周波数、SET_CONFIGで変更可）
+ * - 加減速プロファイル・キネマティクス・指令処理: プロファイル周波数以下になるよう分周
+ * - 共有データの公開・監視（電圧・熱・ストール）: 公開周波数で固定
+ *
+ * 制御周波数は公開周波数の整数倍のみ受け付ける（公開周期が制御周期の整数倍になる）。
+ * プロファイルの分周比は 制御周波数 / プロファイル周波数 の切り上げ。
+ *
+ *   例: 制御1000Hz、プロファイル上限250Hz、公開100Hz → 分周比 4 / 10
+ *
+ * 周期を取りこぼした場合は経過周期数分をまとめて数え、各処理群のdtに含める。
+ *
+ * 周期の途中で指令が届いた場合（Core0からのドアベル）は、advanceOutOfCycle()で
+ * 速度PIDと指令処理・プロファイルをその場で実行する。制御周期のタイマの位相は変えないため、
+ * 公開・監視は指令の間隔に関係なく定期周期で実行される。周期の途中で実行した分の時間は、
+ * 次の定期周期の速度PID・プロファイルのdtから差し引く。
+ */
+
+#ifndef CONTROL_SCHEDULER_H
+#define CONTROL_SCHEDULER_H
+
+#include <stdint.h>
+
+/**
+ * @class ControlScheduler
+ * @brief 制御周期の分周
+ *
+ * 使用例（Core1）:
+ * @code
+ * ControlScheduler scheduler(100, 1000, 250, 100);
+ * uint32_t ticks = controlTimer.wait();
+ * scheduler.advance(ticks);
+ * if (scheduler.isProfileDue()) {
+ *     motorController.updateProfile(scheduler.getProfileDt());
+ * }
+ * motorController.updateWheels(scheduler.getDt());
+ * @endcode
+ */
+class ControlScheduler {
+public:
+    /**
+     * @brief コンストラクタ
+     * @param rateHz 制御周波数 [Hz]（無効な値は公開周波数）
+     * @param maxRateHz 制御周波数の上限 [Hz]
+     * @param profileRateHz プロファイル・キネマティクスの周波数の上限 [Hz]
+     * @param publishRateHz 共有データの公開周波数 [Hz]（> 0）
+     */
+    ControlScheduler(uint16_t rateHz, uint16_t maxRateHz,
+                     uint16_t profileRateHz, uint16_t publishRateHz);
+
+    /**
+     * @brief 制御周波数を変更（次の周期はすべての処理群を実行）
+     * @param rateHz 制御周波数 [Hz]
+     * @return 無効な値の場合false（変更しない）
+     */
+    bool setRate(uint16_t rateHz);
+
+    /**
+     * @brief 経過した制御周期を進め、今回実行する処理群を決める
+     * @param ticks 前回からの経過周期数（ControlTimer::wait()の戻り値）
+     * @param forceProfile 分周に関係なく指令処理・プロファイルを実行（未処理の指令がある場合）
+     */
+    void advance(uint32_t ticks, bool forceProfile = false);
+
+    /**
+     * @brief 周期の途中で速度PIDと指令処理・プロファイルを実行（公開は実行しない）
+     *
+     * 制御周期のタイマはそのまま（次の定期周期のdtは周期の途中で実行した分だけ短くなる）。
+     *
+     * @param elapsedSeconds 前回の実行（定期周期または周期の途中）からの経過時間 [s]
+     */
+    void advanceOutOfCycle(float elapsedSeconds);
+
+    bool isProfileDue() const { return profileDue_; }
+    bool isPublishDue() const { return publishDue_; }
+
+    // 前回実行からの経過時間 [s]（実行する周期のみ有効）
+    float getDt() const { return dt_; }
+    float getProfileDt() const { return profileDt_; }
+    float getPublishDt() const { return publishDt_; }
+
+    uint16_t getRateHz() const { return rateHz_; }
+    uint32_t getPeriodUs() const { return periodUs_; }
+    uint32_t getProfileDivider() const { return profileDivider_; }
+    uint32_t getPublishDivider() const { return publishDivider_; }
+
+    /**
+     * @brief 制御周波数が有効か（ハードウェア非依存、テスト可能）
+     * @param rateHz 制御周波数 [Hz]
+     * @param maxRateHz 上限 [Hz]
+     * @param publishRateHz 公開周波数 [Hz]
+     * @return 公開周波数以上・上限以下で、公開周波数の整数倍ならtrue
+     */
+    static bool isValidRate(uint16_t rateHz, uint16_t maxRateHz, uint16_t publishRateHz);
+
+private:
+    uint16_t maxRateHz_;
+    uint16_t profileRateHz_;
+    uint16_t publishRateHz_;
+
+    uint16_t rateHz_;
+    uint32_t periodUs_;
+    float periodSeconds_;
+    uint32_t profileDivider_;
+    uint32_t publishDivider_;
+
+    uint32_t profilePending_;   // 前回のプロファイル実行からの周期数
+    uint32_t publishPending_;   // 前回の公開からの周期数
+    float profileCarry_;        // 前回のプロファイル実行からの周期数に加える時間 [s]（周期外の実行分は負）
+    float outOfCycleSeconds_;   // 前回の定期周期から周期の途中で実行した分の時間 [s]
+    float dt_;
+    float profileDt_;
+    float publishDt_;
+    bool profileDue_;
+    bool publishDue_;
+};
+
+#endif // CONTROL_SCHEDULER_H
@@ -0,0 +1,158 @@
+/**
+ * @file ControlTimer.cpp
+ * @brief ハードウェアアラームによるCore1の制御周期 実装
+ */
+
+#include "ControlTimer.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "hardware/sync.h"
+#endif
+
+namespace {
+    // 制御周期タイマと起床アラームの2本
+    constexpr uint8_t ALARM_POOL_MAX_TIMERS = 2;
+}
+
+ControlTimer::ControlTimer(uint32_t periodUs)
+    : periodUs_(periodUs)
+    , tickCount_(0)
+    , consumedCount_(0)
+    , missedTicks_(0)
+    , wakePending_(false)
+#ifdef ARDUINO
+    , alarmPool_(nullptr)
+    , wakeAlarm_(0)
+#endif
+{
+}
+
+bool ControlTimer::begin() {
+#ifdef ARDUINO
+    // 割り込みを呼び出し元のコアで処理するため、このコアでプールを作る
+    alarmPool_ = alarm_pool_create_with_unused_hardware_alarm(ALARM_POOL_MAX_TIMERS);
+    if (alarmPool_ == nullptr) {
+        return false;
+    }
+    consumedCount_ = tickCount_;
+    // 負の周期: 前回の予定時刻から数える（コールバックの遅れが累積しない）
+    if (!alarm_pool_add_repeating_timer_us(alarmPool_, -static_cast<int64_t>(periodUs_),
+                                           timerCallback, this, &timer_)) {
+        alarm_pool_destroy(alarmPool_);
+        alarmPool_ = nullptr;
+        return false;
+    }
+    return true;
+#else
+    consumedCount_ = tickCount_;
+    return true;
+#endif
+}
+
+bool ControlTimer::setPeriodUs(uint32_t periodUs) {
+    periodUs_ = periodUs;
+#ifdef ARDUINO
+    if (alarmPool_ == nullptr) {
+        return true;  // begin()前（begin()で新しい周期を使用）
+    }
+    cancel_repeating_timer(&timer_);
+    consumedCount_ = tickCount_;
+    if (!alarm_pool_add_repeating_timer_us(alarmPool_, -static_cast<int64_t>(periodUs_),
+                                           timerCallback, this, &timer_)) {
+        alarm_pool_destroy(alarmPool_);
+        alarmPool_ = nullptr;
+        return false;
+    }
+    return true;
+#else
+    consumedCount_ = tickCount_;
+    return true;
+#endif
+}
+
+uint32_t ControlTimer::wait() {
+    return waitFor(nullptr);
+}
+
+uint32_t ControlTimer::wait(const CommandDoorbell& doorbell) {
+    return waitFor(&doorbell);
+}
+
+uint32_t ControlTimer::waitFor(const CommandDoorbell* doorbell) {
+    uint32_t ticks = poll();
+#ifdef ARDUINO
+    // 開始できなかった場合は待機しない（周期が来ないため0を返し続ける）
+    while (ticks == 0 && alarmPool_ != nullptr && !wakePending_ &&
+           (doorbell == nullptr || !doorbell->isPending())) {
+        __wfe();  // 割り込み（またはSEV、ドアベルの追加時も発行される）で起床
+        ticks = poll();
+    }
+#else
+    (void)doorbell;
+#endif
+    wakePending_ = false;
+    return ticks;
+}
+
+bool ControlTimer::wakeAfterUs(uint32_t delayUs) {
+    cancelWake();
+#ifdef ARDUINO
+    if (alarmPool_ == nullptr) {
+        return false;
+    }
+    // 過ぎていれば即座に発生（0: 予約中に発生済み、負: アラームの空きなし）
+    alarm_id_t id = alarm_pool_add_alarm_in_us(alarmPool_, delayUs, wakeCallback, this, true);
+    if (id < 0) {
+        return false;
+    }
+    wakeAlarm_ = id;
+    return true;
+#else
+    (void)delayUs;
+    return true;
+#endif
+}
+
+void ControlTimer::cancelWake() {
+#ifdef ARDUINO
+    if (wakeAlarm_ > 0 && alarmPool_ != nullptr) {
+        alarm_pool_cancel_alarm(alarmPool_, wakeAlarm_);
+    }
+    wakeAlarm_ = 0;
+#endif
+    wakePending_ = false;
+}
+
+void ControlTimer::onWake() {
+    wakePending_ = true;
+}
+
+uint32_t ControlTimer::poll() {
+    uint32_t count = tickCount_;
+    uint32_t ticks = count - consumedCount_;
+    consumedCount_ = count;
+    if (ticks > 1) {
+        missedTicks_ += ticks - 1;
+    }
+    return ticks;
+}
+
+void ControlTimer::onTick() {
+    tickCount_ = tickCount_ + 1;
+}
+
+#ifdef ARDUINO
+bool ControlTimer::timerCallback(repeating_timer_t* timer) {
+    static_cast<ControlTimer*>(timer->user_data)->onTick();
+    return true;  // 繰り返し
+}
+
+int64_t ControlTimer::wakeCallback(alarm_id_t id, void* userData) {
+    (void)id;
+    ControlTimer* self = static_cast<ControlTimer*>(userData);
+    self->wakeAlarm_ = 0;
+    self->onWake();
+    return 0;  // 1回のみ
+}
+#endif
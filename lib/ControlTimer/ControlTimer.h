@@ -0,0 +1,166 @@
+/**
+ * @file ControlTimer.h
+ * @brief ハードウェアアラームによるCore1の制御周期
+ *
+ * micros()をポーリングして周期を判定すると、ループ1周の処理時間だけ制御周期の開始が
+ * ばらつき、dtも毎回変わる。RP2040のハードウェアアラーム（リピーティングタイマ）で
+ * 周期ごとに割り込みを発生させ、Core1は次の割り込みまでWFEで待機する。
+ *
+ * アラームプールはbegin()を呼んだコア（Core1）に作るため、割り込みもCore1で処理され、
+ * Core0のUSB・シリアル処理の影響を受けない。タイマは予定時刻基準で繰り返すため、
+ * 割り込みの遅れが次の周期に累積しない。
+ *
+ * 処理が周期を超えた場合は、待機中に発生した割り込みの回数（経過周期数）を返す。
+ * dtは「公称周期 × 経過周期数」とし、取りこぼした周期は回数として数える。
+ *
+ * 周期は実行中にsetPeriodUs()で変更できる（制御周波数の設定変更）。
+ * 指令の到着（CommandDoorbell）でも待機から戻り、restart()で周期の位相を今から開始し直せる。
+ * 周期の途中での実行を遅らせる場合は、wakeAfterUs()で1回だけの起床アラームを予約して
+ * WFEのまま待つ（micros()のポーリングで待たない）。
+ */
+
+#ifndef CONTROL_TIMER_H
+#define CONTROL_TIMER_H
+
+#include <stdint.h>
+#include "CommandDoorbell.h"
+
+#ifdef ARDUINO
+#include "pico/time.h"
+#endif
+
+/**
+ * @class ControlTimer
+ * @brief 一定周期の制御ティック
+ *
+ * 使用例（Core1）:
+ * @code
+ * ControlTimer controlTimer(10000);
+ * void setup1() { controlTimer.begin(); }
+ * void loop1() {
+ *     uint32_t ticks = controlTimer.wait();
+ *     float dt = controlTimer.getPeriodSeconds() * ticks;
+ *     ...
+ * }
+ * @endcode
+ */
+class ControlTimer {
+public:
+    /**
+     * @brief コンストラクタ
+     * @param periodUs 制御周期 [us]
+     */
+    explicit ControlTimer(uint32_t periodUs);
+
+    /**
+     * @brief 呼び出したコアにアラームプールを作り、周期割り込みを開始
+     * @return 開始できた場合true（未使用のハードウェアアラームがない場合false）
+     */
+    bool begin();
+
+    /**
+     * @brief 周期を変更（begin()を呼んだコアから呼ぶこと）
+     *
+     * 周期割り込みを新しい周期で開始し直し、未処理の周期は破棄する
+     * （次の周期は呼び出しから新しい周期後）。begin()前は周期の設定のみ。
+     *
+     * @param periodUs 制御周期 [us]
+     * @return 開始し直せなかった場合false（以降は周期が来ない）
+     */
+    bool setPeriodUs(uint32_t periodUs);
+
+    /**
+     * @brief 周期の位相を今から開始し直す（周期の途中で制御を実行した後に呼ぶ）
+     *
+     * 未処理の周期は破棄し、次の周期は呼び出しから1周期後。
+     *
+     * @return 開始し直せなかった場合false（以降は周期が来ない）
+     */
+    bool restart() { return setPeriodUs(periodUs_); }
+
+    /**
+     * @brief 次の周期まで待機（WFE）
+     *
+     * ホスト（ユニットテスト）とbegin()に失敗した場合は待機せず、poll()と同じ値を返す。
+     *
+     * @return 前回のwait()から経過した周期数（2以上は周期の取りこぼし、0は周期が来ていない）
+     */
+    uint32_t wait();
+
+    /**
+     * @brief 次の周期、またはドアベル（指令の到着）まで待機（WFE）
+     *
+     * ドアベルは取り出さない（呼び出し側でCommandDoorbell::take()）。
+     *
+     * @param doorbell 指令到着のドアベル
+     * @return 前回から経過した周期数（0はドアベル・wakeAfterUs()で起床、または周期が来ていない）
+     */
+    uint32_t wait(const CommandDoorbell& doorbell);
+
+    /**
+     * @brief 指定時間後に1回だけwait()から戻す（begin()を呼んだコアから呼ぶこと）
+     *
+     * 周期の途中での実行を最小間隔まで遅らせるために使う。予約済みの場合は置き換える。
+     *
+     * @param delayUs 起床までの時間 [us]
+     * @return 予約できた場合true（begin()前・失敗時、アラームの空きがない場合false）
+     */
+    bool wakeAfterUs(uint32_t delayUs);
+
+    /**
+     * @brief 起床の予約と未処理の起床を取り消す
+     */
+    void cancelWake();
+
+    /**
+     * @brief 起床アラームの処理（割り込みハンドラから呼ぶ。テストでは直接呼ぶ）
+     */
+    void onWake();
+
+    // 起床アラームが発生し、まだwait()で処理していないか
+    bool isWakePending() const { return wakePending_; }
+
+    /**
+     * @brief 待機せずに経過周期数を取得
+     * @return 前回から経過した周期数（0は周期がまだ来ていない）
+     */
+    uint32_t poll();
+
+    /**
+     * @brief 周期割り込みの処理（割り込みハンドラから呼ぶ。テストでは直接呼ぶ）
+     */
+    void onTick();
+
+    uint32_t getPeriodUs() const { return periodUs_; }
+    float getPeriodSeconds() const { return static_cast<float>(periodUs_) / 1000000.0f; }
+
+    // 取りこぼした周期の累計
+    uint32_t getMissedTicks() const { return missedTicks_; }
+
+    // 発生した周期の累計
+    uint32_t getTickCount() const { return tickCount_; }
+
+private:
+    uint32_t periodUs_;
+    volatile uint32_t tickCount_;   // 割り込みで加算
+    uint32_t consumedCount_;        // wait()/poll()で処理済みの周期数
+    uint32_t missedTicks_;
+    volatile bool wakePending_;     // 起床アラームで設定、wait()で解除
+
+    /**
+     * @brief 周期（またはドアベル）まで待機
+     * @param doorbell nullptrの場合は周期のみ
+     */
+    uint32_t waitFor(const CommandDoorbell* doorbell);
+
+#ifdef ARDUINO
+    alarm_pool_t* alarmPool_;
+    repeating_timer_t timer_;
+    alarm_id_t wakeAlarm_;          // 予約中の起床アラーム（0は予約なし）
+
+    static bool timerCallback(repeating_timer_t* timer);
+    static int64_t wakeCallback(alarm_id_t id, void* userData);
+#endif
+};
+
+#endif // CONTROL_TIMER_H
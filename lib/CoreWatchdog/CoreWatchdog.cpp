@@ -0,0 +1,148 @@
+/**
+ * @file CoreWatchdog.cpp
+ * @brief 両コアの生存監視（ハードウェアウォッチドッグ） 実装
+ */
+
+#include "CoreWatchdog.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "hardware/watchdog.h"
+#endif
+
+namespace {
+    // スクラッチレジスタ0: 上位16bitが識別子（"WD"）、下位8bitがリセット理由
+    constexpr uint32_t SCRATCH_MAGIC = 0x57440000;
+    constexpr uint32_t SCRATCH_MAGIC_MASK = 0xFFFF0000;
+    constexpr uint32_t SCRATCH_REASON_MASK = 0x000000FF;
+
+    // スクラッチレジスタの割り当て（4〜7はpico-sdkが使用）
+    constexpr uint8_t SCRATCH_REASON = 0;
+    constexpr uint8_t SCRATCH_RESET_COUNT = 1;
+
+    bool isValidScratch(uint32_t scratch) {
+        return (scratch & SCRATCH_MAGIC_MASK) == SCRATCH_MAGIC;
+    }
+}
+
+CoreWatchdog::CoreWatchdog(uint32_t timeoutMs, uint32_t core0MaxAgeMs, uint32_t core1MaxAgeMs)
+    : timeoutMs_(timeoutMs)
+    , core0MaxAgeMs_(core0MaxAgeMs)
+    , core1MaxAgeMs_(core1MaxAgeMs)
+    , core0ServiceMs_(0)
+    , core1TickMs_(0)
+    , resetReason_(RESET_POWER_ON)
+    , watchdogResetCount_(0)
+    , pendingReason_(RESET_WATCHDOG)
+    , armed_(false)
+{
+}
+
+void CoreWatchdog::begin(uint32_t nowMs) {
+    core0ServiceMs_ = nowMs;
+    core1TickMs_ = nowMs;
+    pendingReason_ = RESET_WATCHDOG;
+
+#ifdef ARDUINO
+    // 前回のリセット理由（スクラッチレジスタは電源投入・RUNピンでのみクリアされる）
+    bool watchdogTimeout = watchdog_enable_caused_reboot();
+    bool softwareReboot = watchdog_caused_reboot() && !watchdogTimeout;
+    uint32_t scratch = watchdog_hw->scratch[SCRATCH_REASON];
+    resetReason_ = decodeResetReason(watchdogTimeout, softwareReboot, scratch);
+
+    uint32_t resetCount = isValidScratch(scratch) ? watchdog_hw->scratch[SCRATCH_RESET_COUNT] : 0;
+    if (watchdogTimeout) {
+        resetCount++;
+    }
+    watchdog_hw->scratch[SCRATCH_RESET_COUNT] = resetCount;
+    watchdogResetCount_ = (resetCount > 0xFFFF) ? 0xFFFF : static_cast<uint16_t>(resetCount);
+
+    // 停止の記録がないままリセットした場合は原因不明のウォッチドッグ
+    watchdog_hw->scratch[SCRATCH_REASON] = encodeScratch(RESET_WATCHDOG);
+    armed_ = true;
+
+    // デバッガで停止中はカウントしない
+    watchdog_enable(timeoutMs_, true);
+#else
+    resetReason_ = RESET_POWER_ON;
+    watchdogResetCount_ = 0;
+    armed_ = true;
+#endif
+}
+
+void CoreWatchdog::core0Serviced(uint32_t nowMs) {
+    core0ServiceMs_ = nowMs;
+}
+
+bool CoreWatchdog::core1TickCompleted(uint32_t nowMs) {
+    core1TickMs_ = nowMs;
+    if (!armed_) {
+        return false;
+    }
+    if (!isAlive(nowMs, core0ServiceMs_, core0MaxAgeMs_)) {
+        recordStall(RESET_CORE0_STALL);
+        return false;
+    }
+
+    // 一時的な遅れから回復した場合は記録を取り消す
+    if (pendingReason_ != RESET_WATCHDOG) {
+        pendingReason_ = RESET_WATCHDOG;
+#ifdef ARDUINO
+        watchdog_hw->scratch[SCRATCH_REASON] = encodeScratch(RESET_WATCHDOG);
+#endif
+    }
+#ifdef ARDUINO
+    watchdog_update();
+#endif
+    return true;
+}
+
+bool CoreWatchdog::checkCore1(uint32_t nowMs) {
+    if (!armed_ || isAlive(nowMs, core1TickMs_, core1MaxAgeMs_)) {
+        return false;
+    }
+    recordStall(RESET_CORE1_STALL);
+    return true;
+}
+
+void CoreWatchdog::recordStall(ResetReason reason) {
+    if (pendingReason_ != RESET_WATCHDOG) {
+        return;  // 先に検出した方を残す
+    }
+    pendingReason_ = reason;
+#ifdef ARDUINO
+    watchdog_hw->scratch[SCRATCH_REASON] = encodeScratch(reason);
+#endif
+}
+
+// =============================================================================
+// 静的ユーティリティ関数
+// =============================================================================
+
+bool CoreWatchdog::isAlive(uint32_t nowMs, uint32_t lastMs, uint32_t maxAgeMs) {
+    // もう一方のコアがnowMsの取得後に更新した場合（lastMsが後）も生存
+    int32_t ageMs = static_cast<int32_t>(nowMs - lastMs);
+    return ageMs <= static_cast<int32_t>(maxAgeMs);
+}
+
+uint32_t CoreWatchdog::encodeScratch(ResetReason reason) {
+    return SCRATCH_MAGIC | static_cast<uint32_t>(reason);
+}
+
+CoreWatchdog::ResetReason CoreWatchdog::decodeResetReason(bool watchdogTimeout, bool softwareReboot,
+                                                          uint32_t scratch) {
+    if (softwareReboot) {
+        return RESET_SOFTWARE;
+    }
+    if (!watchdogTimeout) {
+        return RESET_POWER_ON;
+    }
+    if (!isValidScratch(scratch)) {
+        return RESET_WATCHDOG;
+    }
+    uint32_t reason = scratch & SCRATCH_REASON_MASK;
+    if (reason == RESET_CORE1_STALL || reason == RESET_CORE0_STALL) {
+        return static_cast<ResetReason>(reason);
+    }
+    return RESET_WATCHDOG;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file CoreWatchdog.h
+ * @brief 両コアの生存監視（ハードウェアウォッチドッグ）
+ *
+ * Core1が割り込みや無限ループで止まると、PWMは最後のデューティを出力し続ける。
+ * RP2040のハードウェアウォッチドッグを起動時に開始し、次の2条件がそろう場合のみ更新する。
+ *
+ * - Core1が制御周期の処理を完了した（更新はCore1の制御周期の終わりで行う）
+ * - Core0が最近USB（PacketSerial）を処理した
+ *
+ * どちらかが止まるとウォッチドッグがチップをリセットし、PWM出力のピンはリセット状態（停止）に戻る。
+ *
+ * リセット理由はウォッチドッグのスクラッチレジスタ（ウォッチドッグのリセットでは消えない）に
+ * 記録し、再起動後にGET_STATUSで報告する。止まった側のコアは記録できないため、
+ * もう一方のコアが相手の停止を検出した時点で記録する（記録がない場合は原因不明のウォッチドッグ）。
+ * スクラッチレジスタ4〜7はpico-sdk（watchdog_reboot）が使用するため、0〜1を使う。
+ *
+ * 注意: フラッシュ書き込み（ConfigStorage実装後）はCore1を停止させるため、
+ * 書き込み時間がタイムアウトを超える場合は書き込み前後でウォッチドッグを更新すること。
+ */
+
+#ifndef CORE_WATCHDOG_H
+#define CORE_WATCHDOG_H
+
+#include <stdint.h>
+
+/**
+ * @class CoreWatchdog
+ * @brief ハードウェアウォッチドッグの更新判定とリセット理由の記録
+ *
+ * 使用例:
+ * @code
+ * CoreWatchdog coreWatchdog(200, 100, 50);
+ *
+ * // Core0
+ * void setup() { ...; coreWatchdog.begin(millis()); }
+ * void loop() {
+ *     packetSerial.update();
+ *     coreWatchdog.core0Serviced(millis());
+ *     // 100msごと
+ *     coreWatchdog.checkCore1(millis());
+ * }
+ *
+ * // Core1（制御周期の処理の終わり）
+ * coreWatchdog.core1TickCompleted(millis());
+ * @endcode
+ */
+class CoreWatchdog {
+public:
+    // リセット理由（GET_STATUSのreset_reason）
+    enum ResetReason : uint8_t {
+        RESET_POWER_ON = 0,      // 電源投入・RUNピン・デバッガ
+        RESET_CORE1_STALL = 1,   // ウォッチドッグ: Core1の制御周期が停止
+        RESET_CORE0_STALL = 2,   // ウォッチドッグ: Core0のUSB処理が停止
+        RESET_WATCHDOG = 3,      // ウォッチドッグ: 原因の記録なし
+        RESET_SOFTWARE = 4       // ソフトウェアリセット（watchdog_reboot、書き込み時など）
+    };
+
+    /**
+     * @brief コンストラクタ
+     * @param timeoutMs ウォッチドッグのタイムアウト [ms]
+     * @param core0MaxAgeMs Core0のUSB処理の間隔の上限 [ms]（超えたら更新しない）
+     * @param core1MaxAgeMs Core1の制御周期の間隔の上限 [ms]（超えたら停止として記録）
+     */
+    CoreWatchdog(uint32_t timeoutMs, uint32_t core0MaxAgeMs, uint32_t core1MaxAgeMs);
+
+    /**
+     * @brief 前回のリセット理由を読み出し、ウォッチドッグを開始（Core0、起動時）
+     * @param nowMs 現在時刻 [ms]
+     */
+    void begin(uint32_t nowMs);
+
+    /**
+     * @brief Core0がUSBを処理した（Core0、PacketSerial::update()の後）
+     * @param nowMs 現在時刻 [ms]
+     */
+    void core0Serviced(uint32_t nowMs);
+
+    /**
+     * @brief Core1が制御周期の処理を完了した（Core1）
+     *
+     * Core0が最近USBを処理していればウォッチドッグを更新する。
+     * 止まっていれば更新せず、リセット理由をCore0の停止として記録する。
+     *
+     * @param nowMs 現在時刻 [ms]
+     * @return ウォッチドッグを更新した場合true
+     */
+    bool core1TickCompleted(uint32_t nowMs);
+
+    /**
+     * @brief Core1の制御周期が止まっていないか確認（Core0、定期的に）
+     * @param nowMs 現在時刻 [ms]
+     * @return Core1が停止している場合true（リセット理由を記録済み）
+     */
+    bool checkCore1(uint32_t nowMs);
+
+    // 今回の起動の理由（begin()で読み出し）
+    ResetReason getResetReason() const { return resetReason_; }
+
+    // 電源投入からのウォッチドッグによるリセット回数
+    uint16_t getWatchdogResetCount() const { return watchdogResetCount_; }
+
+    // 今ウォッチドッグがリセットした場合に記録される理由
+    ResetReason getPendingReason() const { return pendingReason_; }
+
+    // =========================================================================
+    // 静的ユーティリティ関数（テスト可能なロジック部分）
+    // =========================================================================
+
+    /**
+     * @brief 最後の処理から上限時間以内か（millis()のラップアラウンドに対応）
+     */
+    static bool isAlive(uint32_t nowMs, uint32_t lastMs, uint32_t maxAgeMs);
+
+    /**
+     * @brief スクラッチレジスタの値（識別子 + 理由）を作る
+     */
+    static uint32_t encodeScratch(ResetReason reason);
+
+    /**
+     * @brief 起動時のハードウェアの状態からリセット理由を決める
+     * @param watchdogTimeout ウォッチドッグのタイムアウトによるリセット（watchdog_enable_caused_reboot()）
+     * @param softwareReboot watchdog_reboot()によるリセット
+     * @param scratch スクラッチレジスタ0の値（識別子がない場合は無効）
+     */
+    static ResetReason decodeResetReason(bool watchdogTimeout, bool softwareReboot, uint32_t scratch);
+
+private:
+    uint32_t timeoutMs_;
+    uint32_t core0MaxAgeMs_;
+    uint32_t core1MaxAgeMs_;
+    volatile uint32_t core0ServiceMs_;  // Core0が最後にUSBを処理した時刻
+    volatile uint32_t core1TickMs_;     // Core1が最後に制御周期を完了した時刻
+    ResetReason resetReason_;
+    uint16_t watchdogResetCount_;
+    volatile ResetReason pendingReason_;
+    volatile bool armed_;               // begin()前のCore1の周期ではスクラッチレジスタに書き込まない
+
+    /**
+     * @brief 停止したコアをリセット理由として記録（最初の1回のみ）
+     */
+    void recordStall(ResetReason reason);
+};
+
+#endif // CORE_WATCHDOG_H
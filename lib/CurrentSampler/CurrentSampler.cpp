@@ -0,0 +1,306 @@
+/**
+ * @file CurrentSampler.cpp
+ * @brief PWM同期ADCサンプリングと過電流高速遮断 実装
+ */
+
+#include "CurrentSampler.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include "hardware/pwm.h"
+#endif
+
+CurrentSampler* CurrentSampler::instance_ = nullptr;
+
+namespace {
+
+static_assert(CurrentSampler::WINDOW_SAMPLES <= CurrentSampler::RING_SAMPLES,
+              "集計窓はリング以下であること");
+
+// DMAのリングモードはバッファがサイズ境界にアラインされている必要がある
+alignas(CurrentSampler::RING_SAMPLES * sizeof(uint16_t))
+volatile uint16_t sampleRingL[CurrentSampler::RING_SAMPLES];
+alignas(CurrentSampler::RING_SAMPLES * sizeof(uint16_t))
+volatile uint16_t sampleRingR[CurrentSampler::RING_SAMPLES];
+volatile uint16_t batterySample = 0;
+
+#ifdef ARDUINO
+// トリガDMAがADC CSへ書き込む値（入力選択+START_ONCE）
+uint32_t triggerWordL;
+uint32_t triggerWordR;
+uint32_t triggerWordBattery;
+#endif
+
+constexpr uint32_t DMA_ENDLESS_COUNT = 0xFFFFFFFF;
+
+/**
+ * @brief 最新サンプルから遡ってWINDOW_SAMPLES分を取り出す
+ */
+void copyWindow(const volatile uint16_t* ring, size_t latest, uint16_t* out) {
+    size_t index = latest;
+    for (size_t i = 0; i < CurrentSampler::WINDOW_SAMPLES; i++) {
+        out[i] = ring[index];
+        index = (index + CurrentSampler::RING_SAMPLES - 1) % CurrentSampler::RING_SAMPLES;
+    }
+}
+
+}  // namespace
+
+// =============================================================================
+// コンストラクタ
+// =============================================================================
+
+CurrentSampler::CurrentSampler(CurrentSensor& sensorL, CurrentSensor& sensorR,
+                               uint8_t pwmPinL, uint8_t pwmPinR,
+                               uint8_t adcPinL, uint8_t adcPinR, uint8_t adcPinBattery)
+    : sensorL_(sensorL)
+    , sensorR_(sensorR)
+    , pwmPinL_(pwmPinL)
+    , pwmPinR_(pwmPinR)
+    , adcPinL_(adcPinL)
+    , adcPinR_(adcPinR)
+    , adcPinBattery_(adcPinBattery)
+    , trigChannelL_(-1)
+    , dataChannelL_(-1)
+    , trigChannelR_(-1)
+    , dataChannelR_(-1)
+    , trigChannelBattery_(-1)
+    , dataChannelBattery_(-1)
+    , savedFunction_{}
+    , tripped_(false)
+    , tripCount_(0)
+{
+}
+
+// =============================================================================
+// 初期化
+// =============================================================================
+
+void CurrentSampler::begin() {
+#ifdef ARDUINO
+    instance_ = this;
+
+    // --- PWM: センターアライン化（周波数を保つため分周比を半分に） ---
+    const uint sliceL = pwm_gpio_to_slice_num(pwmPinL_);
+    const uint sliceR = pwm_gpio_to_slice_num(pwmPinR_);
+    const uint slices[] = {sliceL, sliceR};
+    for (uint slice : slices) {
+        uint32_t div = pwm_hw->slice[slice].div;  // 8.4固定小数点
+        if (div >= (2u << PWM_CH0_DIV_INT_LSB)) {
+            pwm_hw->slice[slice].div = div >> 1;
+        }
+        pwm_set_phase_correct(slice, true);
+    }
+
+    // --- ADC: FIFO+DREQ、1変換ごとにDMAへ ---
+    adc_init();
+    adc_gpio_init(adcPinL_);
+    adc_gpio_init(adcPinR_);
+    adc_gpio_init(adcPinBattery_);
+    adc_set_round_robin(0);
+    adc_set_clkdiv(0);  // 最速（2us/変換）
+    adc_fifo_setup(true, true, 1, false, false);
+
+    // --- トリガ値: CS値（入力選択+START_ONCE） ---
+    triggerWordL = ADC_CS_EN_BITS | ADC_CS_START_ONCE_BITS |
+                   (static_cast<uint32_t>(adcPinL_ - 26) << ADC_CS_AINSEL_LSB);
+    triggerWordR = ADC_CS_EN_BITS | ADC_CS_START_ONCE_BITS |
+                   (static_cast<uint32_t>(adcPinR_ - 26) << ADC_CS_AINSEL_LSB);
+    triggerWordBattery = ADC_CS_EN_BITS | ADC_CS_START_ONCE_BITS |
+                         (static_cast<uint32_t>(adcPinBattery_ - 26) << ADC_CS_AINSEL_LSB);
+
+    trigChannelL_ = dma_claim_unused_channel(true);
+    dataChannelL_ = dma_claim_unused_channel(true);
+    trigChannelR_ = dma_claim_unused_channel(true);
+    dataChannelR_ = dma_claim_unused_channel(true);
+    trigChannelBattery_ = dma_claim_unused_channel(true);
+    dataChannelBattery_ = dma_claim_unused_channel(true);
+
+    // --- DMA(データ): ADC FIFO → L/Rリングバッファ、バス電圧 ---
+    dma_channel_config dataConfig = dma_channel_get_default_config(dataChannelL_);
+    channel_config_set_transfer_data_size(&dataConfig, DMA_SIZE_16);
+    channel_config_set_read_increment(&dataConfig, false);
+    channel_config_set_write_increment(&dataConfig, true);
+    channel_config_set_ring(&dataConfig, true, __builtin_ctz(RING_SAMPLES * sizeof(uint16_t)));
+    channel_config_set_dreq(&dataConfig, DREQ_ADC);
+    channel_config_set_chain_to(&dataConfig, trigChannelR_);
+    dma_channel_configure(dataChannelL_, &dataConfig,
+                          sampleRingL, &adc_hw->fifo, 1, false);
+
+    channel_config_set_chain_to(&dataConfig, trigChannelBattery_);
+    dma_channel_configure(dataChannelR_, &dataConfig,
+                          sampleRingR, &adc_hw->fifo, 1, false);
+
+    dma_channel_config batteryConfig = dma_channel_get_default_config(dataChannelBattery_);
+    channel_config_set_transfer_data_size(&batteryConfig, DMA_SIZE_16);
+    channel_config_set_read_increment(&batteryConfig, false);
+    channel_config_set_write_increment(&batteryConfig, false);
+    channel_config_set_dreq(&batteryConfig, DREQ_ADC);
+    channel_config_set_chain_to(&batteryConfig, dataChannelL_);
+    dma_channel_configure(dataChannelBattery_, &batteryConfig,
+                          &batterySample, &adc_hw->fifo, 1, false);
+
+    // --- DMA(トリガ): R・バス電圧は直前のデータ転送完了からチェーンで起動 ---
+    dma_channel_config trigConfig = dma_channel_get_default_config(trigChannelR_);
+    channel_config_set_transfer_data_size(&trigConfig, DMA_SIZE_32);
+    channel_config_set_read_increment(&trigConfig, false);
+    channel_config_set_write_increment(&trigConfig, false);
+    channel_config_set_chain_to(&trigConfig, dataChannelR_);
+    dma_channel_configure(trigChannelR_, &trigConfig,
+                          &adc_hw->cs, &triggerWordR, 1, false);
+
+    channel_config_set_chain_to(&trigConfig, dataChannelBattery_);
+    dma_channel_configure(trigChannelBattery_, &trigConfig,
+                          &adc_hw->cs, &triggerWordBattery, 1, false);
+
+    // --- 過電流比較: R変換完了のDMA割り込み（このコアで処理） ---
+    dma_hw->ints1 = 1u << dataChannelR_;
+    dma_channel_set_irq1_enabled(dataChannelR_, true);
+    irq_add_shared_handler(DMA_IRQ_1, onSampleComplete,
+                           PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+
+    // --- 開始: dataLを待機させてから、左PWMラップ（ON期間中央）でチェーン起動 ---
+    adc_fifo_drain();
+    dma_channel_start(dataChannelL_);
+
+    dma_channel_config trigLConfig = dma_channel_get_default_config(trigChannelL_);
+    channel_config_set_transfer_data_size(&trigLConfig, DMA_SIZE_32);
+    channel_config_set_read_increment(&trigLConfig, false);
+    channel_config_set_write_increment(&trigLConfig, false);
+    channel_config_set_dreq(&trigLConfig, DREQ_PWM_WRAP0 + sliceL);
+    dma_channel_configure(trigChannelL_, &trigLConfig,
+                          &adc_hw->cs, &triggerWordL, DMA_ENDLESS_COUNT, true);
+#endif
+}
+
+// =============================================================================
+// 過電流比較（PWM周期ごと、L/R両方の変換完了直後）
+// =============================================================================
+
+#ifdef ARDUINO
+void __not_in_flash_func(CurrentSampler::onSampleComplete)() {
+    CurrentSampler* self = instance_;
+    const uint32_t mask = 1u << self->dataChannelR_;
+    if ((dma_hw->ints1 & mask) == 0) {
+        return;  // 共有割り込みの他チャンネル
+    }
+    dma_hw->ints1 = mask;
+
+    // 同じラップで変換したL/Rの最新サンプルを比較
+    uint16_t rawL = sampleRingL[latestIndex(self->currentWriteIndex(CHANNEL_L))];
+    uint16_t rawR = sampleRingR[latestIndex(self->currentWriteIndex(CHANNEL_R))];
+
+    if (isOverCurrent(self->sensorL_, self->sensorR_, rawL, rawR) && !self->tripped_) {
+        self->cutPwm();
+        self->tripped_ = true;
+        self->tripCount_++;
+    }
+}
+#else
+void CurrentSampler::onSampleComplete() {
+}
+#endif
+
+void CurrentSampler::cutPwm() {
+#ifdef ARDUINO
+    // PWMスライスの更新（次ラップで反映）を待たず、ピンをSIOに切り替えて即LOW。
+    // IN1/IN2方式では片側だけ落とすと逆転駆動になるため、スライスの両チャンネルを落とす
+    for (size_t i = 0; i < CUT_PIN_COUNT; i++) {
+        uint8_t pin = cutPin(i);
+        savedFunction_[i] = static_cast<uint8_t>(gpio_get_function(pin));
+        gpio_put(pin, 0);
+        gpio_set_dir(pin, true);
+        gpio_set_function(pin, GPIO_FUNC_SIO);
+    }
+#endif
+}
+
+uint8_t CurrentSampler::cutPin(size_t i) const {
+    // 0,1: 左スライスのA/B、2,3: 右スライスのA/B
+    uint8_t pwmPin = (i < 2) ? pwmPinL_ : pwmPinR_;
+    return static_cast<uint8_t>((pwmPin & ~1u) | (i & 1u));
+}
+
+// =============================================================================
+// 制御周期処理
+// =============================================================================
+
+void CurrentSampler::service() {
+#ifdef ARDUINO
+    // 転送カウント満了（20kHzで約59時間）時に再アーム
+    if (!dma_channel_is_busy(trigChannelL_)) {
+        dma_channel_set_trans_count(trigChannelL_, DMA_ENDLESS_COUNT, true);
+    }
+#endif
+
+    // 直近WINDOW_SAMPLES分をチャンネル別に集計
+    uint16_t samplesL[WINDOW_SAMPLES];
+    uint16_t samplesR[WINDOW_SAMPLES];
+    copyWindow(sampleRingL, latestIndex(currentWriteIndex(CHANNEL_L)), samplesL);
+    copyWindow(sampleRingR, latestIndex(currentWriteIndex(CHANNEL_R)), samplesR);
+    sensorL_.processWindow(samplesL, WINDOW_SAMPLES);
+    sensorR_.processWindow(samplesR, WINDOW_SAMPLES);
+}
+
+// =============================================================================
+// トリップ管理
+// =============================================================================
+
+bool CurrentSampler::isTripped() const {
+    return tripped_;
+}
+
+void CurrentSampler::clearTrip() {
+#ifdef ARDUINO
+    if (tripped_) {
+        for (size_t i = 0; i < CUT_PIN_COUNT; i++) {
+            gpio_set_function(cutPin(i), static_cast<decltype(GPIO_FUNC_PWM)>(savedFunction_[i]));
+        }
+    }
+#endif
+    tripped_ = false;
+}
+
+uint32_t CurrentSampler::getTripCount() const {
+    return tripCount_;
+}
+
+uint16_t CurrentSampler::getLatestRaw(Channel channel) const {
+    if (channel == CHANNEL_BATTERY) {
+        return batterySample;
+    }
+    const volatile uint16_t* ring = (channel == CHANNEL_L) ? sampleRingL : sampleRingR;
+    return ring[latestIndex(currentWriteIndex(channel))];
+}
+
+size_t CurrentSampler::currentWriteIndex(Channel channel) const {
+#ifdef ARDUINO
+    const int dataChannel = (channel == CHANNEL_L) ? dataChannelL_ : dataChannelR_;
+    const volatile uint16_t* ring = (channel == CHANNEL_L) ? sampleRingL : sampleRingR;
+    if (dataChannel >= 0) {
+        uintptr_t offset = dma_hw->ch[dataChannel].write_addr - reinterpret_cast<uintptr_t>(ring);
+        return (offset / sizeof(uint16_t)) % RING_SAMPLES;
+    }
+#else
+    (void)channel;
+#endif
+    return 0;
+}
+
+// =============================================================================
+// 静的ユーティリティ関数
+// =============================================================================
+
+size_t CurrentSampler::latestIndex(size_t writeIndex) {
+    return (writeIndex + RING_SAMPLES - 1) % RING_SAMPLES;
+}
+
+bool CurrentSampler::isOverCurrent(const CurrentSensor& sensorL, const CurrentSensor& sensorR,
+                                   uint16_t rawL, uint16_t rawR) {
+    return sensorL.isOverCurrentRaw(rawL) || sensorR.isOverCurrentRaw(rawR);
+}
@@ -0,0 +1,161 @@
+/**
+ * @file CurrentSampler.h
+ * @brief PWM同期ADCサンプリング（DMAリングバッファ）と過電流高速遮断
+ *
+ * ハードウェア構成（RP2040）:
+ * - モータPWMスライスを位相補正（センターアライン）モードにする。
+ *   カウンタが0に戻るラップ時点がON期間の中央になる。
+ * - DMAチェーンで1PWM周期ごとに L → R → バス電圧 の順に3変換する
+ *   （各2us、20kHz周期50usに対して計約6us）。
+ *   1. trigL: 左PWMスライスのラップDREQでADC CSにL入力+START_ONCEを書き込む
+ *   2. dataL: ADC FIFO → Lリングバッファ、完了でtrigRへチェーン
+ *   3. trigR: ADC CSにR入力+START_ONCEを書き込み、dataRへチェーン
+ *   4. dataR: ADC FIFO → Rリングバッファ、完了でDMA割り込み・trigBへチェーン
+ *   5. trigB: ADC CSにバス電圧入力+START_ONCEを書き込み、dataBへチェーン
+ *   6. dataB: ADC FIFO → バス電圧（1ワード）、完了でdataLへチェーン（再アーム）
+ * - CPUはdataR完了のDMA割り込みでL/R両方の最新サンプルを整数比較するだけ。
+ *   過電流ならPWMスライスの両チャンネル（DIR/PWM、IN1/IN2）を即座にSIO LOWへ
+ *   切り替える（次のPWM周期を待たない）。
+ *
+ * 両モータとも毎周期変換・比較するため、過電流発生から遮断までの最悪遅延は
+ * 1PWM周期+約4us（20kHzで約54us）。バス電圧の変換は比較の後に行うため、
+ * 遮断判定を遅らせない。
+ *
+ * PwmPhaseで右モータの位相をずらした場合、右の変換は右のON期間中央ではなくなる
+ * （180°ならOFF期間中央）。インライン（相電流）センサではリップルが三角波のため
+ * ON/OFF期間いずれの中央でも平均電流が得られる。ローサイドシャントの場合は0°とすること。
+ */
+
+#ifndef CURRENT_SAMPLER_H
+#define CURRENT_SAMPLER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "CurrentSensor.h"
+
+/**
+ * @class CurrentSampler
+ * @brief 電流・バス電圧のPWM同期サンプリング
+ *
+ * 使用例（Core1）:
+ * @code
+ * CurrentSampler sampler(sensorL, sensorR, pwmPinL, pwmPinR, 27, 28, 26);
+ * driverL.begin(); driverR.begin();
+ * sampler.begin();                 // MotorDriver::begin()の後に呼ぶ
+ *
+ * // 制御周期ごと
+ * sampler.service();
+ * if (sampler.isTripped()) { ... }
+ * @endcode
+ */
+class CurrentSampler {
+public:
+    /**
+     * @brief サンプリングチャンネル
+     */
+    enum Channel : uint8_t {
+        CHANNEL_L = 0,
+        CHANNEL_R = 1,
+        CHANNEL_BATTERY = 2
+    };
+
+    /**
+     * @brief コンストラクタ
+     * @param sensorL 左電流センサ（トリップしきい値・集計に使用）
+     * @param sensorR 右電流センサ
+     * @param pwmPinL 左モータPWMピン（同期元、スライスの両チャンネルが遮断対象）
+     * @param pwmPinR 右モータPWMピン（スライスの両チャンネルが遮断対象）
+     * @param adcPinL 左電流センサADCピン（GPIO26〜29）
+     * @param adcPinR 右電流センサADCピン
+     * @param adcPinBattery バス電圧ADCピン
+     */
+    CurrentSampler(CurrentSensor& sensorL, CurrentSensor& sensorR,
+                   uint8_t pwmPinL, uint8_t pwmPinR,
+                   uint8_t adcPinL, uint8_t adcPinR, uint8_t adcPinBattery);
+
+    /**
+     * @brief ADC・DMAチェーン・DMA割り込みを設定して開始
+     */
+    void begin();
+
+    /**
+     * @brief 制御周期ごとの処理（RMS/ピーク集計、DMA再アーム）
+     */
+    void service();
+
+    /**
+     * @brief 過電流トリップ中か
+     */
+    bool isTripped() const;
+
+    /**
+     * @brief トリップを解除してPWM出力を復帰
+     */
+    void clearTrip();
+
+    /**
+     * @brief 起動からのトリップ回数
+     */
+    uint32_t getTripCount() const;
+
+    /**
+     * @brief チャンネルの最新ADC生値
+     */
+    uint16_t getLatestRaw(Channel channel) const;
+
+    // =========================================================================
+    // 静的ユーティリティ関数（テスト可能なロジック部分）
+    // =========================================================================
+
+    /**
+     * @brief DMA書き込み位置から最新（変換完了済み）サンプルの位置を取得
+     * @param writeIndex DMAの次の書き込みインデックス
+     * @return 最新サンプルのインデックス
+     */
+    static size_t latestIndex(size_t writeIndex);
+
+    /**
+     * @brief L/Rの最新サンプルのいずれかが過電流か判定（ISRから呼ぶ）
+     * @param sensorL 左電流センサ
+     * @param sensorR 右電流センサ
+     * @param rawL 左の最新ADC生値
+     * @param rawR 右の最新ADC生値
+     * @return true=過電流
+     */
+    static bool isOverCurrent(const CurrentSensor& sensorL, const CurrentSensor& sensorR,
+                              uint16_t rawL, uint16_t rawR);
+
+    // =========================================================================
+    // 定数
+    // =========================================================================
+    static constexpr size_t RING_SAMPLES = 64;       // チャンネルごとのリングバッファサンプル数（2のべき乗）
+    static constexpr size_t WINDOW_SAMPLES = 32;     // RMS/ピーク集計の窓（各モータ32サンプル = 1.6ms@20kHz）
+    static constexpr size_t CUT_PIN_COUNT = 4;       // 遮断対象ピン数（2スライス × A/B）
+
+private:
+    static void onSampleComplete();
+    void cutPwm();
+    uint8_t cutPin(size_t i) const;
+    size_t currentWriteIndex(Channel channel) const;
+
+    CurrentSensor& sensorL_;
+    CurrentSensor& sensorR_;
+    uint8_t pwmPinL_;
+    uint8_t pwmPinR_;
+    uint8_t adcPinL_;
+    uint8_t adcPinR_;
+    uint8_t adcPinBattery_;
+    int trigChannelL_;                      // DMA: PWMラップでL変換開始
+    int dataChannelL_;                      // DMA: ADC FIFO → Lリング
+    int trigChannelR_;                      // DMA: R変換開始
+    int dataChannelR_;                      // DMA: ADC FIFO → Rリング（完了で比較割り込み）
+    int trigChannelBattery_;                // DMA: バス電圧変換開始
+    int dataChannelBattery_;                // DMA: ADC FIFO → バス電圧
+    uint8_t savedFunction_[CUT_PIN_COUNT];  // 遮断前のピン機能（復帰用）
+    volatile bool tripped_;
+    volatile uint32_t tripCount_;
+
+    static CurrentSampler* instance_;
+};
+
+#endif // CURRENT_SAMPLER_H
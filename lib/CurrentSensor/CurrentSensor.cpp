@@ -0,0 +1,64 @@
+/**
+ * @file CurrentSensor.cpp
+ * @brief モータ電流センサ 実装
+ */
+
+#include "CurrentSensor.h"
+#include <cmath>
+
+CurrentSensor::CurrentSensor(float ampsPerVolt, uint16_t zeroOffsetRaw, float tripAmps)
+    : ampsPerCount_(ampsPerVolt * ADC_VREF / static_cast<float>(ADC_MAX))
+    , zeroOffsetRaw_(zeroOffsetRaw)
+    , tripDeltaRaw_(ampsToDeltaRaw(tripAmps, ampsPerVolt))
+    , rmsAmps_(0.0f)
+    , peakAmps_(0.0f)
+{
+}
+
+void CurrentSensor::processWindow(const uint16_t* samples, size_t count) {
+    if (samples == nullptr || count == 0) {
+        rmsAmps_ = 0.0f;
+        peakAmps_ = 0.0f;
+        return;
+    }
+
+    // 整数で集計し、最後に1回だけ浮動小数点変換
+    uint64_t sumSquares = 0;
+    int32_t peakDelta = 0;
+    for (size_t i = 0; i < count; i++) {
+        int32_t delta = static_cast<int32_t>(samples[i]) - zeroOffsetRaw_;
+        int32_t absDelta = delta < 0 ? -delta : delta;
+        sumSquares += static_cast<uint64_t>(absDelta) * static_cast<uint64_t>(absDelta);
+        if (absDelta > peakDelta) {
+            peakDelta = absDelta;
+        }
+    }
+
+    float meanSquare = static_cast<float>(sumSquares) / static_cast<float>(count);
+    rmsAmps_ = std::sqrt(meanSquare) * ampsPerCount_;
+    peakAmps_ = static_cast<float>(peakDelta) * ampsPerCount_;
+}
+
+float CurrentSensor::rawToAmps(uint16_t raw) const {
+    return static_cast<float>(static_cast<int32_t>(raw) - zeroOffsetRaw_) * ampsPerCount_;
+}
+
+float CurrentSensor::getRmsAmps() const {
+    return rmsAmps_;
+}
+
+float CurrentSensor::getPeakAmps() const {
+    return peakAmps_;
+}
+
+int32_t CurrentSensor::getTripDeltaRaw() const {
+    return tripDeltaRaw_;
+}
+
+int32_t CurrentSensor::ampsToDeltaRaw(float tripAmps, float ampsPerVolt) {
+    if (ampsPerVolt <= 0.0f || tripAmps <= 0.0f) {
+        return 0;
+    }
+    float volts = tripAmps / ampsPerVolt;
+    return static_cast<int32_t>(volts / ADC_VREF * static_cast<float>(ADC_MAX));
+}
@@ -0,0 +1,91 @@
+/**
+ * @file CurrentSensor.h
+ * @brief モータ電流センサ（ADC生値の変換・過電流判定・RMS/ピーク集計）
+ *
+ * ハードウェア非依存のロジック部分。ADCサンプルの取得はCurrentSamplerが
+ * DMAでリングバッファに書き込み、本クラスは制御周期ごとに集計する。
+ */
+
+#ifndef CURRENT_SENSOR_H
+#define CURRENT_SENSOR_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @class CurrentSensor
+ * @brief 1モータ分の電流センサ
+ *
+ * 双方向電流センサ（ゼロ電流でADC中点付近を出力）を想定。
+ *
+ * 使用例:
+ * @code
+ * CurrentSensor sensor(10.0f, 2048, 15.0f);   // 10A/V、中点2048、15Aでトリップ
+ * if (sensor.isOverCurrentRaw(raw)) { ... }   // PWM周期ごと（ISR）
+ * sensor.processWindow(samples, count);       // 制御周期ごと
+ * float rms = sensor.getRmsAmps();
+ * @endcode
+ */
+class CurrentSensor {
+public:
+    /**
+     * @brief コンストラクタ
+     * @param ampsPerVolt センサ感度の逆数 [A/V]（ADCピン電圧1Vあたりの電流）
+     * @param zeroOffsetRaw 電流0AのときのADC生値
+     * @param tripAmps 過電流トリップ電流 [A]（絶対値）
+     */
+    CurrentSensor(float ampsPerVolt, uint16_t zeroOffsetRaw, float tripAmps);
+
+    /**
+     * @brief ADC生値が過電流か判定（ISRから呼ぶため整数比較のみ）
+     * @param raw ADC生値
+     * @return true=過電流
+     */
+    inline bool isOverCurrentRaw(uint16_t raw) const {
+        int32_t delta = static_cast<int32_t>(raw) - zeroOffsetRaw_;
+        return delta > tripDeltaRaw_ || delta < -tripDeltaRaw_;
+    }
+
+    /**
+     * @brief サンプル列からRMS・ピーク電流を計算
+     * @param samples ADC生値の配列
+     * @param count 集計するサンプル数
+     */
+    void processWindow(const uint16_t* samples, size_t count);
+
+    /**
+     * @brief ADC生値を電流に変換 [A]（符号付き）
+     */
+    float rawToAmps(uint16_t raw) const;
+
+    float getRmsAmps() const;
+    float getPeakAmps() const;
+    int32_t getTripDeltaRaw() const;
+
+    // =========================================================================
+    // 静的ユーティリティ関数（テスト可能なロジック部分）
+    // =========================================================================
+
+    /**
+     * @brief トリップ電流をADC生値の差分に変換（切り捨て）
+     * @param tripAmps トリップ電流 [A]
+     * @param ampsPerVolt センサ感度の逆数 [A/V]
+     * @return ゼロ点からの差分しきい値 [count]
+     */
+    static int32_t ampsToDeltaRaw(float tripAmps, float ampsPerVolt);
+
+    // =========================================================================
+    // 定数
+    // =========================================================================
+    static constexpr float ADC_VREF = 3.3f;
+    static constexpr uint16_t ADC_MAX = 4095;  // 12bit
+
+private:
+    float ampsPerCount_;
+    int32_t zeroOffsetRaw_;
+    int32_t tripDeltaRaw_;
+    float rmsAmps_;
+    float peakAmps_;
+};
+
+#endif // CURRENT_SENSOR_H
@@ -6,26 +6,85 @@
 #include "DifferentialKinematics.h"
 
 namespace {
-    constexpr float PI = 3.14159f;
+    constexpr float PI = 3.14159265358979f;
 }
 
 DifferentialKinematics::DifferentialKinematics(float wheelDiameter, float trackWidth, float gearRatio)
-    : wheelDiameter_(wheelDiameter)
-    , trackWidth_(trackWidth)
-    , gearRatio_(gearRatio)
+    : wheelDiameter_{0.0f, 0.0f}
+    , trackWidth_(0.0f)
+    , gearRatio_{0.0f, 0.0f}
+    , halfTrack_(0.0f)
+    , invTrack_(0.0f)
+    , velToRpm_{0.0f, 0.0f}
+    , rpmToVel_{0.0f, 0.0f}
 {
+    setGeometry(wheelDiameter, trackWidth, gearRatio);
 }
 
-void DifferentialKinematics::calculate(float linearX, float angularZ, float& leftRpm, float& rightRpm) const {
-    float wheelRadius = wheelDiameter_ / 2.0f;
+void DifferentialKinematics::setGeometry(float wheelDiameter, float trackWidth, float gearRatio) {
+    setGeometry(wheelDiameter, wheelDiameter, trackWidth, gearRatio, gearRatio);
+}
+
+void DifferentialKinematics::setGeometry(float wheelDiameterL, float wheelDiameterR, float trackWidth,
+                                         float gearRatioL, float gearRatioR) {
+    wheelDiameter_[SIDE_L] = wheelDiameterL;
+    wheelDiameter_[SIDE_R] = wheelDiameterR;
+    trackWidth_ = trackWidth;
+    gearRatio_[SIDE_L] = gearRatioL;
+    gearRatio_[SIDE_R] = gearRatioR;
+
+    halfTrack_ = trackWidth * 0.5f;
+    invTrack_ = (trackWidth > 0.0f) ? 1.0f / trackWidth : 0.0f;
 
+    // RPM = vel / (2 * PI * r) * 60 * gear_ratio = vel * 60 * gear_ratio / (PI * d)
+    for (size_t side = 0; side < SIDE_COUNT; side++) {
+        float circumference = PI * wheelDiameter_[side];
+        if (circumference > 0.0f && gearRatio_[side] > 0.0f) {
+            velToRpm_[side] = 60.0f * gearRatio_[side] / circumference;
+            rpmToVel_[side] = circumference / (60.0f * gearRatio_[side]);
+        } else {
+            velToRpm_[side] = 0.0f;
+            rpmToVel_[side] = 0.0f;
+        }
+    }
+}
+
+void DifferentialKinematics::calculate(float linearX, float angularZ, float& leftRpm, float& rightRpm) const {
     // 左右ホイールの速度 [m/s]
-    float leftVel = linearX - angularZ * trackWidth_ / 2.0f;
-    float rightVel = linearX + angularZ * trackWidth_ / 2.0f;
-
-    // ホイール速度 [m/s] → モータRPM
-    // RPM = vel / (2 * PI * r) * 60 * gear_ratio
-    float velToRpm = 60.0f / (2.0f * PI * wheelRadius) * gearRatio_;
-    leftRpm = leftVel * velToRpm;
-    rightRpm = rightVel * velToRpm;
+    float turn = angularZ * halfTrack_;
+    leftRpm = (linearX - turn) * velToRpm_[SIDE_L];
+    rightRpm = (linearX + turn) * velToRpm_[SIDE_R];
+}
+
+void DifferentialKinematics::inverse(float leftRpm, float rightRpm, float& linearX, float& angularZ) const {
+    float leftVel = leftRpm * rpmToVel_[SIDE_L];
+    float rightVel = rightRpm * rpmToVel_[SIDE_R];
+    linearX = (leftVel + rightVel) * 0.5f;
+    angularZ = (rightVel - leftVel) * invTrack_;
+}
+
+void DifferentialKinematics::calculateBatch(const float* linearX, const float* angularZ,
+                                            float* leftRpm, float* rightRpm, size_t count) const {
+    // メンバをローカルに取り出し、出力配列とのエイリアスによる再ロードを防ぐ
+    const float halfTrack = halfTrack_;
+    const float velToRpmL = velToRpm_[SIDE_L];
+    const float velToRpmR = velToRpm_[SIDE_R];
+    for (size_t i = 0; i < count; i++) {
+        float turn = angularZ[i] * halfTrack;
+        leftRpm[i] = (linearX[i] - turn) * velToRpmL;
+        rightRpm[i] = (linearX[i] + turn) * velToRpmR;
+    }
+}
+
+void DifferentialKinematics::inverseBatch(const float* leftRpm, const float* rightRpm,
+                                          float* linearX, float* angularZ, size_t count) const {
+    const float rpmToVelL = rpmToVel_[SIDE_L];
+    const float rpmToVelR = rpmToVel_[SIDE_R];
+    const float invTrack = invTrack_;
+    for (size_t i = 0; i < count; i++) {
+        float leftVel = leftRpm[i] * rpmToVelL;
+        float rightVel = rightRpm[i] * rpmToVelR;
+        linearX[i] = (leftVel + rightVel) * 0.5f;
+        angularZ[i] = (rightVel - leftVel) * invTrack;
+    }
 }
@@ -2,12 +2,25 @@
  * @file DifferentialKinematics.h
  * @brief 差動二輪キネマティクス計算
  *
- * cmd_vel（linear_x, angular_z）から左右ホイールRPMを計算する
+ * cmd_vel（linear_x, angular_z）から左右ホイールRPMを計算する（順変換）。
+ * 逆に左右ホイールRPMから並進・回転速度を求める逆変換も提供する
+ * （オドメトリ・テレメトリ用）。
+ *
+ * ジオメトリから導かれる定数（トレッド半幅、速度→RPM係数など）は
+ * コンストラクタ / setGeometry() で事前計算し、calculate() / inverse() は
+ * 乗算と加減算のみで完結させる（RP2040はFPUを持たないため、
+ * 毎周期のソフトウェア除算を避ける）。
+ *
+ * ホイール直径・減速比は左右別に設定できる（摩耗したクローラなど、
+ * 左右の実効直径が数%違う場合のオドメトリ・方位誤差の補正用）。
+ * 左右共通のコンストラクタ / setGeometry() は同じ値を両側に設定する。
  */
 
 #ifndef DIFFERENTIAL_KINEMATICS_H
 #define DIFFERENTIAL_KINEMATICS_H
 
+#include <stddef.h>
+
 /**
  * @class DifferentialKinematics
  * @brief 差動二輪ロボットのキネマティクス計算クラス
@@ -17,6 +30,9 @@
  * DifferentialKinematics kinematics(0.1f, 0.3f, 1.0f);
  * float leftRpm, rightRpm;
  * kinematics.calculate(0.1f, 0.5f, leftRpm, rightRpm);
+ *
+ * float linearX, angularZ;
+ * kinematics.inverse(leftRpm, rightRpm, linearX, angularZ);
  * @endcode
  */
 class DifferentialKinematics {
@@ -29,6 +45,28 @@ public:
      */
     DifferentialKinematics(float wheelDiameter, float trackWidth, float gearRatio);
 
+    /**
+     * @brief ジオメトリを変更し、変換係数を再計算する（左右共通）
+     * @param wheelDiameter ホイール直径 [m]
+     * @param trackWidth トレッド幅 [m]
+     * @param gearRatio 減速比
+     *
+     * 直径・トレッド幅・減速比が0以下の場合、対応する係数は0になる
+     * （ゼロ除算で非数を出力しない）。
+     */
+    void setGeometry(float wheelDiameter, float trackWidth, float gearRatio);
+
+    /**
+     * @brief ジオメトリを変更し、変換係数を再計算する（左右別）
+     * @param wheelDiameterL 左ホイール直径 [m]
+     * @param wheelDiameterR 右ホイール直径 [m]
+     * @param trackWidth トレッド幅 [m]
+     * @param gearRatioL 左減速比
+     * @param gearRatioR 右減速比
+     */
+    void setGeometry(float wheelDiameterL, float wheelDiameterR, float trackWidth,
+                     float gearRatioL, float gearRatioR);
+
     /**
      * @brief cmd_velから左右ホイールRPMを計算
      * @param linearX 並進速度 [m/s]
@@ -38,10 +76,74 @@ public:
      */
     void calculate(float linearX, float angularZ, float& leftRpm, float& rightRpm) const;
 
+    /**
+     * @brief 左右ホイールRPMから並進・回転速度を計算（逆変換）
+     * @param leftRpm 左ホイールRPM
+     * @param rightRpm 右ホイールRPM
+     * @param[out] linearX 並進速度 [m/s]
+     * @param[out] angularZ 回転速度 [rad/s]（正で左旋回）
+     */
+    void inverse(float leftRpm, float rightRpm, float& linearX, float& angularZ) const;
+
+    /**
+     * @brief calculate() の一括版（ホスト側ログ再生用）
+     * @param linearX 並進速度配列 [m/s]
+     * @param angularZ 回転速度配列 [rad/s]
+     * @param[out] leftRpm 左ホイールRPM配列
+     * @param[out] rightRpm 右ホイールRPM配列
+     * @param count 要素数
+     */
+    void calculateBatch(const float* linearX, const float* angularZ,
+                        float* leftRpm, float* rightRpm, size_t count) const;
+
+    /**
+     * @brief inverse() の一括版（ホスト側ログ再生用）
+     * @param leftRpm 左ホイールRPM配列
+     * @param rightRpm 右ホイールRPM配列
+     * @param[out] linearX 並進速度配列 [m/s]
+     * @param[out] angularZ 回転速度配列 [rad/s]
+     * @param count 要素数
+     */
+    void inverseBatch(const float* leftRpm, const float* rightRpm,
+                      float* linearX, float* angularZ, size_t count) const;
+
+    // 左右共通で設定した場合の値（左右別の場合は左側）
+    float getWheelDiameter() const { return wheelDiameter_[SIDE_L]; }
+    float getTrackWidth() const { return trackWidth_; }
+    float getGearRatio() const { return gearRatio_[SIDE_L]; }
+
+    float getWheelDiameterL() const { return wheelDiameter_[SIDE_L]; }
+    float getWheelDiameterR() const { return wheelDiameter_[SIDE_R]; }
+    float getGearRatioL() const { return gearRatio_[SIDE_L]; }
+    float getGearRatioR() const { return gearRatio_[SIDE_R]; }
+
+    /** @brief ホイール速度 [m/s] → モータRPM 係数（左右別の場合は左側） */
+    float getVelToRpm() const { return velToRpm_[SIDE_L]; }
+
+    /** @brief モータRPM → ホイール速度 [m/s] 係数（左右別の場合は左側） */
+    float getRpmToVel() const { return rpmToVel_[SIDE_L]; }
+
+    float getVelToRpmL() const { return velToRpm_[SIDE_L]; }
+    float getVelToRpmR() const { return velToRpm_[SIDE_R]; }
+    float getRpmToVelL() const { return rpmToVel_[SIDE_L]; }
+    float getRpmToVelR() const { return rpmToVel_[SIDE_R]; }
+
 private:
-    float wheelDiameter_;
+    enum Side : size_t {
+        SIDE_L = 0,
+        SIDE_R = 1,
+        SIDE_COUNT = 2
+    };
+
+    float wheelDiameter_[SIDE_COUNT];
     float trackWidth_;
-    float gearRatio_;
+    float gearRatio_[SIDE_COUNT];
+
+    // 事前計算した変換係数
+    float halfTrack_;             ///< trackWidth / 2 [m]
+    float invTrack_;              ///< 1 / trackWidth [1/m]
+    float velToRpm_[SIDE_COUNT];  ///< 60 * gearRatio / (π * wheelDiameter)
+    float rpmToVel_[SIDE_COUNT];  ///< π * wheelDiameter / (60 * gearRatio)
 };
 
 #endif // DIFFERENTIAL_KINEMATICS_H
@@ -0,0 +1,145 @@
+#include "HBridgeDriver.h"
+#include "MotorDriver.h"
+#include "RamFunc.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "HardwareConfig.h"
+#endif
+
+// =============================================================================
+// コンストラクタ
+// =============================================================================
+
+HBridgeDriver::HBridgeDriver(uint8_t pinIn1, uint8_t pinIn2, bool inverted,
+                             DecayMode decayMode)
+    : pinIn1_(pinIn1)
+    , pinIn2_(pinIn2)
+    , inverted_(inverted)
+    , decayMode_(decayMode)
+    , currentSpeed_(0.0f)
+    , nominalVoltage_(0.0f)
+    , voltageScale_(1.0f)
+{
+}
+
+// =============================================================================
+// 初期化
+// =============================================================================
+
+void HBridgeDriver::begin() {
+#ifdef ARDUINO
+    analogWriteFreq(HardwareConfig::PWM_FREQUENCY);
+    // ピン機能・PWM周波数はanalogWrite()で設定し、以降の出力は比較値のみ書き換える
+    analogWrite(pinIn1_, 0);
+    analogWrite(pinIn2_, 0);
+    stop();
+#endif
+}
+
+// =============================================================================
+// 速度設定・停止
+// =============================================================================
+
+// 制御周期ごとに呼ぶため、出力計算・ピン出力まで含めてSRAMに配置（RamFunc.h）
+void RAM_FUNC(HBridgeDriver::setSpeed)(float speed) {
+    currentSpeed_ = MotorDriver::clampSpeed(speed * voltageScale_);
+    applyOutput(calculateOutput(currentSpeed_, decayMode_, inverted_));
+}
+
+void HBridgeDriver::stop() {
+    currentSpeed_ = 0.0f;
+    applyOutput(calculateStopOutput());
+}
+
+void HBridgeDriver::brake() {
+    currentSpeed_ = 0.0f;
+    applyOutput(calculateBrakeOutput());
+}
+
+// =============================================================================
+// ディケイモード
+// =============================================================================
+
+void HBridgeDriver::setDecayMode(DecayMode decayMode) {
+    decayMode_ = decayMode;
+}
+
+HBridgeDriver::DecayMode HBridgeDriver::getDecayMode() const {
+    return decayMode_;
+}
+
+// =============================================================================
+// 電圧補償
+// =============================================================================
+
+void HBridgeDriver::setNominalVoltage(float nominalVoltage) {
+    nominalVoltage_ = nominalVoltage;
+    voltageScale_ = 1.0f;
+}
+
+void HBridgeDriver::setSupplyVoltage(float supplyVoltage) {
+    voltageScale_ = MotorDriver::calculateVoltageScale(nominalVoltage_, supplyVoltage);
+}
+
+float HBridgeDriver::getVoltageScale() const {
+    return voltageScale_;
+}
+
+float HBridgeDriver::getOutputSpeed() const {
+    return currentSpeed_;
+}
+
+// =============================================================================
+// ピン出力
+// =============================================================================
+
+void RAM_FUNC(HBridgeDriver::applyOutput)(const PinOutput& output) {
+#ifdef ARDUINO
+    MotorDriver::writePwm(pinIn1_, output.in1Duty);
+    MotorDriver::writePwm(pinIn2_, output.in2Duty);
+#else
+    (void)output;
+#endif
+}
+
+// =============================================================================
+// 静的ユーティリティ関数
+// =============================================================================
+
+HBridgeDriver::PinOutput RAM_FUNC(HBridgeDriver::calculateOutput)(float speed, DecayMode mode, bool inverted) {
+    float clamped = MotorDriver::clampSpeed(speed);
+    bool reverse = MotorDriver::getDirection(clamped, inverted);
+    uint8_t duty = MotorDriver::calculatePwmDuty(clamped);
+
+    // 正転時のIN1/IN2デューティ（逆転時は入れ替え）
+    uint8_t forwardIn1;
+    uint8_t forwardIn2;
+    if (mode == DECAY_SLOW) {
+        // IN1=HIGH固定、IN2のLOW期間が通電になるため反転デューティ
+        forwardIn1 = PWM_MAX;
+        forwardIn2 = PWM_MAX - duty;
+    } else {
+        forwardIn1 = duty;
+        forwardIn2 = 0;
+    }
+
+    PinOutput output;
+    output.in1Duty = reverse ? forwardIn2 : forwardIn1;
+    output.in2Duty = reverse ? forwardIn1 : forwardIn2;
+    return output;
+}
+
+HBridgeDriver::PinOutput HBridgeDriver::calculateStopOutput() {
+    PinOutput output;
+    output.in1Duty = 0;
+    output.in2Duty = 0;
+    return output;
+}
+
+HBridgeDriver::PinOutput HBridgeDriver::calculateBrakeOutput() {
+    PinOutput output;
+    output.in1Duty = PWM_MAX;
+    output.in2Duty = PWM_MAX;
+    return output;
+}
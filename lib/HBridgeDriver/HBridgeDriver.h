@@ -0,0 +1,136 @@
+#ifndef HBRIDGE_DRIVER_H
+#define HBRIDGE_DRIVER_H
+
+#include <stdint.h>
+
+/**
+ * HBridgeDriver - 2PWM入力Hブリッジドライバ（IN1/IN2方式）
+ *
+ * DRV8871、TB67H450、BTS7960等、方向ピンを持たず
+ * 2本の入力のPWMで回転方向とディケイを決めるドライバ用。
+ *
+ * 入力の真理値表:
+ * - IN1=PWM, IN2=L:   正転（OFF期間は惰性、ファストディケイ）
+ * - IN1=H,   IN2=PWM: 正転（OFF期間は短絡、スローディケイ。IN2は反転デューティ）
+ * - IN1=L,   IN2=L:   惰性停止
+ * - IN1=H,   IN2=H:   ブレーキ
+ *
+ * IN1/IN2は同一PWMスライスのA/Bチャンネルに配線すること
+ * （CurrentSamplerの過電流遮断がスライス単位で両ピンを落とすため）。
+ */
+class HBridgeDriver {
+public:
+    /**
+     * ディケイモード
+     */
+    enum DecayMode : uint8_t {
+        DECAY_FAST = 0,  // OFF期間は惰性（IN1/IN2の片方をLOW）
+        DECAY_SLOW = 1   // OFF期間は短絡（IN1/IN2の片方をHIGH）
+    };
+
+    /**
+     * ピン出力状態（テスト可能な計算結果）
+     */
+    struct PinOutput {
+        uint8_t in1Duty;  // IN1 デューティ（0〜255）
+        uint8_t in2Duty;  // IN2 デューティ（0〜255）
+    };
+
+    /**
+     * コンストラクタ
+     * @param pinIn1 IN1ピン番号
+     * @param pinIn2 IN2ピン番号
+     * @param inverted 反転フラグ（trueでモータ回転方向を反転、デフォルトfalse）
+     * @param decayMode ディケイモード（デフォルト: ファストディケイ）
+     */
+    HBridgeDriver(uint8_t pinIn1, uint8_t pinIn2, bool inverted = false,
+                  DecayMode decayMode = DECAY_FAST);
+
+    /**
+     * 初期化（ピンモード設定、PWM周波数設定）
+     */
+    void begin();
+
+    /**
+     * 速度設定
+     * @param speed 速度（-1.0〜1.0、負で逆転）
+     */
+    void setSpeed(float speed);
+
+    /**
+     * 停止（惰性停止、IN1=IN2=LOW）
+     */
+    void stop();
+
+    /**
+     * ブレーキ（短絡制動、IN1=IN2=HIGH）
+     */
+    void brake();
+
+    void setDecayMode(DecayMode decayMode);
+    DecayMode getDecayMode() const;
+
+    /**
+     * 電圧補償の公称電圧を設定（0以下で補償無効）
+     * @param nominalVoltage 公称電圧 [V]
+     */
+    void setNominalVoltage(float nominalVoltage);
+
+    /**
+     * 現在の電源電圧を設定（次回setSpeed()から反映）
+     * @param supplyVoltage 電源電圧 [V]
+     */
+    void setSupplyVoltage(float supplyVoltage);
+
+    float getVoltageScale() const;
+
+    /**
+     * 最後に出力した速度（電圧補償・クランプ後、-1.0〜1.0）
+     */
+    float getOutputSpeed() const;
+
+    // =========================================================================
+    // 静的ユーティリティ関数（テスト可能なロジック部分）
+    // =========================================================================
+
+    /**
+     * 速度指令時のピン出力を計算
+     * @param speed 速度（-1.0〜1.0、範囲外はクランプ）
+     * @param mode ディケイモード
+     * @param inverted 反転フラグ
+     * @return ピン出力状態
+     */
+    static PinOutput calculateOutput(float speed, DecayMode mode, bool inverted);
+
+    /**
+     * 惰性停止時のピン出力を計算
+     */
+    static PinOutput calculateStopOutput();
+
+    /**
+     * ブレーキ時のピン出力を計算
+     */
+    static PinOutput calculateBrakeOutput();
+
+    // =========================================================================
+    // 定数
+    // =========================================================================
+    static constexpr bool RPM_COMMAND = false;  // MotorControllerT: デューティ出力型
+    static constexpr uint8_t PWM_MAX = 255;
+
+private:
+    /**
+     * ピン出力を実機に反映
+     */
+    void applyOutput(const PinOutput& output);
+
+    uint8_t pinIn1_;
+    uint8_t pinIn2_;
+    bool inverted_;
+    DecayMode decayMode_;
+    float currentSpeed_;
+    float nominalVoltage_;
+    float voltageScale_;
+};
+
+#endif // HBRIDGE_DRIVER_H
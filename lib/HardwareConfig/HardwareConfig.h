@@ -3,6 +3,17 @@
 
 #include <stdint.h>
 
+// =============================================================================
+// モータドライババックエンド（ビルドフラグ -DMOTOR_BACKEND=... で選択）
+// =============================================================================
+#define MOTOR_BACKEND_DIR_PWM 0  // 方向+PWM（MotorDriver）
+#define MOTOR_BACKEND_IN1_IN2 1  // 2PWM入力Hブリッジ（HBridgeDriver）
+#define MOTOR_BACKEND_LD2     2  // CuGo LD-2 シリアルRPM指令（Ld2Driver）
+
+#ifndef MOTOR_BACKEND
+#define MOTOR_BACKEND MOTOR_BACKEND_DIR_PWM
+#endif
+
 namespace HardwareConfig {
 
 // =============================================================================
@@ -21,24 +32,140 @@ constexpr uint8_t MOTOR_L_PWM = 7;
 constexpr uint8_t MOTOR_R_DIR = 8;
 constexpr uint8_t MOTOR_R_PWM = 9;
 
+// ブレーキ/ディケイ選択ピン（未接続の場合はPIN_NONE）
+constexpr uint8_t PIN_NONE = 0xFF;
+constexpr uint8_t MOTOR_L_BRAKE = PIN_NONE;
+constexpr uint8_t MOTOR_R_BRAKE = PIN_NONE;
+
+// =============================================================================
+// Hブリッジピン（IN1/IN2、MOTOR_BACKEND_IN1_IN2時）
+// 同一PWMスライスのA/Bチャンネル（DIR/PWMと同じコネクタ位置）
+// =============================================================================
+constexpr uint8_t MOTOR_L_IN1 = 6;
+constexpr uint8_t MOTOR_L_IN2 = 7;
+constexpr uint8_t MOTOR_R_IN1 = 8;
+constexpr uint8_t MOTOR_R_IN2 = 9;
+
+// =============================================================================
+// LD-2 シリアル（MOTOR_BACKEND_LD2時、Serial1はデバッグ用のためSerial2を使用）
+// =============================================================================
+constexpr uint8_t LD2_UART_TX = 20;  // GPIO20 (UART1 TX)
+constexpr uint8_t LD2_UART_RX = 21;  // GPIO21 (UART1 RX)
+constexpr uint32_t LD2_UART_BAUD = 115200;
+
 // =============================================================================
 // PWM設定
 // =============================================================================
 constexpr uint32_t PWM_FREQUENCY = 20000;  // 20kHz（可聴域外）
+constexpr float PWM_PHASE_OFFSET_DEG = 180.0f;  // 右モータPWMの位相オフセット（バスリップル低減、0で同相）
+
+// =============================================================================
+// バッテリ電圧監視（ADC）
+// =============================================================================
+constexpr uint8_t BATTERY_ADC_PIN = 26;              // GPIO26 (ADC0)
+constexpr float BATTERY_DIVIDER_RATIO = 11.0f;       // 100kΩ/10kΩ 分圧
+constexpr float BATTERY_NOMINAL_VOLTAGE = 24.0f;     // PID調整時の公称電圧 [V]
+constexpr float BATTERY_LOW_VOLTAGE = 21.0f;         // 低電圧判定しきい値 [V]
+constexpr float BATTERY_LOW_HYSTERESIS = 0.5f;       // 低電圧解除ヒステリシス [V]
+constexpr float BATTERY_FILTER_ALPHA = 0.05f;        // ローパス係数（100Hzで時定数約0.2s）
+
+// =============================================================================
+// モータ電流センサ（ADC、PWM同期サンプリング）
+// =============================================================================
+constexpr uint8_t CURRENT_L_ADC_PIN = 27;              // GPIO27 (ADC1)
+constexpr uint8_t CURRENT_R_ADC_PIN = 28;              // GPIO28 (ADC2)
+constexpr float CURRENT_AMPS_PER_VOLT = 10.0f;         // 100mV/A 双方向センサ
+constexpr uint16_t CURRENT_ZERO_OFFSET_RAW = 2048;     // 0A = 1.65V
+constexpr float OVERCURRENT_TRIP_AMPS = 15.0f;         // PWM遮断電流 [A]
+constexpr uint32_t OVERCURRENT_COOLDOWN_MS = 500;      // 遮断から自動復帰までの時間
+constexpr bool CURRENT_SENSOR_INSTALLED = true;        // false: 熱推定はデューティから行う
+
+// =============================================================================
+// モータ熱保護（I²t推定）
+// =============================================================================
+constexpr float THERMAL_TIME_CONSTANT_S = 60.0f;   // 巻線の熱時定数 [s]
+constexpr float THERMAL_RATED_CURRENT = 5.0f;      // 連続定格電流 [A]（θ=1.0の基準）
+constexpr float THERMAL_RATED_DUTY = 0.5f;         // 電流計測なし時の定格デューティ（拘束時の安全側推定）
+constexpr float THERMAL_DERATE_START = 0.7f;       // ディレーティング開始・過熱フラグ（θ）
+constexpr float THERMAL_MIN_SCALE = 0.2f;          // 過熱時の出力上限倍率
+constexpr float THERMAL_CLEAR_LEVEL = 0.6f;        // 過熱フラグ解除（θ）
+
+// =============================================================================
+// ストール検出（高デューティ・低回転の継続）
+// =============================================================================
+constexpr float STALL_DUTY_THRESHOLD = 0.6f;       // 判定デューティ（|duty|以上）
+constexpr float STALL_RPM_THRESHOLD = 5.0f;        // 判定回転数（|RPM|未満）
+constexpr float STALL_DETECT_TIME_S = 0.5f;        // 判定時間（加速時の誤検出防止）
+constexpr float STALL_COOLDOWN_S = 2.0f;           // 出力停止から再試行までの時間
+
+// =============================================================================
+// 加減速制限（S字加減速、加速度0以下で制限なし）
+// =============================================================================
+constexpr float PROFILE_MAX_LINEAR_ACCEL = 1.0f;    // 最大並進加速度 [m/s²]
+constexpr float PROFILE_MAX_LINEAR_JERK = 5.0f;     // 最大並進ジャーク [m/s³]
+constexpr float PROFILE_MAX_ANGULAR_ACCEL = 3.0f;   // 最大角加速度 [rad/s²]
+constexpr float PROFILE_MAX_ANGULAR_JERK = 15.0f;   // 最大角ジャーク [rad/s³]
+
+// 目標RPMが上限を越えた場合の飽和処理
+// false: 回転優先（並進速度を削る）、true: 曲率保持（v・ωを同じ倍率で縮小、経路の形を保つ）
+constexpr bool SATURATION_PRESERVE_CURVATURE = false;
+
+// =============================================================================
+// タイムスタンプ付き指令の補間
+// =============================================================================
+constexpr uint32_t CMD_INTERP_DELAY_US = 0;             // 評価遅延（0: 最新指令から外挿）
+constexpr uint32_t CMD_MAX_EXTRAPOLATION_US = 50000;    // 外挿上限（指令周期 + 受信遅延程度）
+
+// =============================================================================
+// 位置制御（MOTOR_POSITION、台形プロファイル + 位置ループ）
+// =============================================================================
+constexpr float POSITION_KP = 4.0f;                 // 位置ループゲイン [1/s]
+constexpr float POSITION_MAX_RPM = 60.0f;           // 速度省略時の最高速度 [RPM]
+constexpr float POSITION_MAX_ACCEL = 120.0f;        // 加速度省略時の最大加速度 [RPM/s]
+constexpr int32_t POSITION_TOLERANCE_COUNTS = 10;   // 到着判定の許容偏差 [カウント]
+constexpr float POSITION_SETTLE_S = 0.1f;           // 到着判定の継続時間 [s]
 
 // =============================================================================
 // 制御ループタイミング
 // =============================================================================
-constexpr uint32_t CONTROL_PERIOD_US = 10000;  // 10ms（100Hz）
+// 制御周期はCore1のハードウェアアラームで生成。制御周波数（速度推定・PID）はSET_CONFIGで変更可、
+// プロファイル・キネマティクス・指令処理は分周、共有データの公開・監視は100Hz固定
+constexpr uint16_t CONTROL_RATE_DEFAULT_HZ = 100;   // 10ms
+constexpr uint16_t CONTROL_RATE_MAX_HZ = 1000;      // 公開周波数の整数倍のみ
+constexpr uint16_t CONTROL_PROFILE_RATE_HZ = 250;   // プロファイル・キネマティクスの上限
+constexpr uint16_t CONTROL_PUBLISH_RATE_HZ = 100;   // 共有データの公開・電圧/熱/ストール監視
+
+// MOTOR_COMMAND受信時は周期の途中で指令を適用（コア間FIFOのドアベル）。
+// 速度推定のdtが短くなりすぎないよう、前回の周期から最小間隔を空ける
+constexpr uint32_t COMMAND_DOORBELL_MIN_INTERVAL_US = 1000;
+
+// 時間計測のヒストグラム（GET_TIMING、16ビン、制御周期の変更時に設定し直す）
+constexpr uint32_t TIMING_PERIOD_BUCKET_DIV = 200;  // 周期: ビン幅 = 公称周期/200（公称 ± 4%）
+constexpr uint32_t TIMING_EXEC_BUCKET_DIV = 16;     // 処理時間: ビン幅 = 公称周期/16（0〜公称周期）
 
 // =============================================================================
 // フェイルセーフ設定
 // =============================================================================
 constexpr uint32_t FAILSAFE_TIMEOUT_MS = 500;  // 通信途絶時にモータ停止
 
+// MOTOR_COMMANDごとの有効期間（Core1が制御周期ごとに判定、期限切れで減速停止）
+constexpr uint32_t COMMAND_VALIDITY_DEFAULT_MS = FAILSAFE_TIMEOUT_MS;  // 有効期間の指定なし（0）の指令
+constexpr uint32_t COMMAND_VALIDITY_MAX_MS = FAILSAFE_TIMEOUT_MS;      // 指定値の上限（Core0のフェイルセーフより長くしない）
+constexpr uint32_t COMMAND_EXPIRED_RAMP_MS = 300;  // 期限切れ後の減速時間の上限（超えたら停止）
+// 停止・フェイルセーフ時に短絡ブレーキ（坂道での転がり防止）。
+// 方向+PWM（符号-絶対値方式）は左右ともBRAKEピンが必要（未接続では惰性停止になるため無効）
+constexpr bool BRAKE_ON_STOP = (MOTOR_BACKEND != MOTOR_BACKEND_DIR_PWM) ||
+                               (MOTOR_L_BRAKE != PIN_NONE && MOTOR_R_BRAKE != PIN_NONE);
+
+// ハードウェアウォッチドッグ（Core1の制御周期ごとに更新、Core0のUSB処理が止まっていれば更新しない）
+constexpr uint32_t WATCHDOG_TIMEOUT_MS = 200;         // 更新が途絶えたらチップをリセット（PWM停止）
+constexpr uint32_t WATCHDOG_CORE0_MAX_AGE_MS = 100;   // Core0のUSB処理の間隔の上限
+constexpr uint32_t WATCHDOG_CORE1_MAX_AGE_MS = 50;    // Core1の制御周期の間隔の上限（停止理由の記録用）
+
 // =============================================================================
 // デフォルト設定値
 // =============================================================================
+// 左右別の項目は無印が左側（左右共通の場合は両側）、_Rが右側
 namespace Defaults {
     constexpr float PID_KP = 1.0f;
     constexpr float PID_KI = 0.1f;
@@ -46,6 +173,16 @@ namespace Defaults {
     constexpr float MAX_RPM = 200.0f;
     constexpr uint16_t ENCODER_PPR = 1024;
     constexpr float GEAR_RATIO = 1.0f;
+    constexpr float WHEEL_DIAMETER = 0.1f;  // [m]
+    constexpr float TRACK_WIDTH = 0.3f;     // [m]
+
+    // 右側（摩耗・個体差で左右が異なる場合に変更）
+    constexpr float PID_KP_R = PID_KP;
+    constexpr float PID_KI_R = PID_KI;
+    constexpr float PID_KD_R = PID_KD;
+    constexpr uint16_t ENCODER_PPR_R = ENCODER_PPR;
+    constexpr float GEAR_RATIO_R = GEAR_RATIO;
+    constexpr float WHEEL_DIAMETER_R = WHEEL_DIAMETER;  // [m]
 }
 
 // =============================================================================
@@ -0,0 +1,113 @@
+/**
+ * @file Ld2Driver.cpp
+ * @brief CuGo LD-2 BLDCドライバ（シリアルRPM指令） 実装
+ */
+
+#include "Ld2Driver.h"
+#include <string.h>
+
+// =============================================================================
+// Ld2Link
+// =============================================================================
+
+Ld2Link::Ld2Link(WriteFunc write)
+    : write_(write)
+    , rpm_{0.0f, 0.0f}
+    , pending_(0)
+    , frameId_(0)
+{
+}
+
+void Ld2Link::begin() {
+    uint8_t cmd[CMD_LENGTH];
+    buildControlModeCommand(CONTROL_MODE_CMD, cmd);
+    send(cmd);
+}
+
+void Ld2Link::setRpm(Side side, float rpm) {
+    rpm_[side] = rpm;
+    pending_ |= static_cast<uint8_t>(1u << side);
+
+    // 左右揃ったら1フレームで送信
+    if (pending_ == 0x03) {
+        uint8_t cmd[CMD_LENGTH];
+        buildRpmCommand(rpm_[SIDE_L], rpm_[SIDE_R], cmd);
+        send(cmd);
+        pending_ = 0;
+    }
+}
+
+float Ld2Link::getRpm(Side side) const {
+    return rpm_[side];
+}
+
+uint8_t Ld2Link::getFrameId() const {
+    return frameId_;
+}
+
+void Ld2Link::send(const uint8_t* cmd) {
+    uint8_t frame[FRAME_LENGTH];
+    buildFrame(cmd, frameId_, frame);
+    frameId_++;
+
+    if (write_ != nullptr) {
+        write_(frame, FRAME_LENGTH);
+    }
+}
+
+void Ld2Link::buildRpmCommand(float leftRpm, float rightRpm, uint8_t* cmd) {
+    memset(cmd, 0, CMD_LENGTH);
+    cmd[0] = CMD_HEADER;
+    cmd[1] = CMD_RPM;
+    memcpy(&cmd[2], &leftRpm, sizeof(float));
+    memcpy(&cmd[6], &rightRpm, sizeof(float));
+}
+
+void Ld2Link::buildControlModeCommand(uint8_t mode, uint8_t* cmd) {
+    memset(cmd, 0, CMD_LENGTH);
+    cmd[0] = CMD_HEADER;
+    cmd[1] = CMD_CONTROL_MODE;
+    cmd[2] = mode;
+}
+
+void Ld2Link::buildFrame(const uint8_t* cmd, uint8_t frameId, uint8_t* frame) {
+    uint8_t checksum = frameId;
+    for (size_t i = 0; i < CMD_LENGTH; i++) {
+        frame[i] = cmd[i];
+        checksum += cmd[i];
+    }
+    frame[CMD_LENGTH] = frameId;
+    frame[CMD_LENGTH + 1] = checksum;
+}
+
+// =============================================================================
+// Ld2Driver
+// =============================================================================
+
+Ld2Driver::Ld2Driver(Ld2Link& link, Ld2Link::Side side, bool inverted)
+    : link_(link)
+    , side_(side)
+    , inverted_(inverted)
+    , commandRpm_(0.0f)
+{
+}
+
+void Ld2Driver::begin() {
+}
+
+void Ld2Driver::setRpm(float rpm) {
+    commandRpm_ = rpm;
+    link_.setRpm(side_, inverted_ ? -rpm : rpm);
+}
+
+void Ld2Driver::stop() {
+    setRpm(0.0f);
+}
+
+void Ld2Driver::brake() {
+    setRpm(0.0f);
+}
+
+float Ld2Driver::getCommandRpm() const {
+    return commandRpm_;
+}
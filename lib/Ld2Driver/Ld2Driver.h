@@ -0,0 +1,176 @@
+/**
+ * @file Ld2Driver.h
+ * @brief CuGo LD-2 BLDCドライバ（シリアルRPM指令）
+ *
+ * LD-2は左右2軸分の目標RPMを1フレームで受け取り、ドライバ内部で速度制御する。
+ * MotorControllerTのRPM指令型バックエンドとして、車輪ごとのLd2Driverが
+ * 共有のLd2Linkに目標RPMを書き込み、左右が揃った時点で1フレーム送信する。
+ *
+ * フレーム形式（12バイト）:
+ * - [0..9]  コマンド（0xFF, コマンド種別, データ8バイト）
+ * - [10]    フレームID（送信ごとに+1）
+ * - [11]    チェックサム（フレームID + コマンド10バイトの総和、下位8bit）
+ */
+
+#ifndef LD2_DRIVER_H
+#define LD2_DRIVER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @class Ld2Link
+ * @brief LD-2とのシリアルリンク（左右共有）
+ *
+ * 送信関数を注入することで、実機ではSerial2.write()、
+ * ユニットテストではバッファへの記録を使用できる。
+ *
+ * 使用例:
+ * @code
+ * void writeLd2(const uint8_t* data, size_t length) { Serial2.write(data, length); }
+ *
+ * Ld2Link link(writeLd2);
+ * Ld2Driver driverL(link, Ld2Link::SIDE_L);
+ * Ld2Driver driverR(link, Ld2Link::SIDE_R);
+ * link.begin();          // CMDモードへ切り替え
+ * driverL.setRpm(30.0f);
+ * driverR.setRpm(30.0f); // 左右揃ったのでここで送信
+ * @endcode
+ */
+class Ld2Link {
+public:
+    /**
+     * @brief 送信関数の型
+     */
+    typedef void (*WriteFunc)(const uint8_t* data, size_t length);
+
+    enum Side : uint8_t {
+        SIDE_L = 0,
+        SIDE_R = 1
+    };
+
+    /**
+     * @brief コンストラクタ
+     * @param write 送信関数（nullptrの場合は送信しない）
+     */
+    explicit Ld2Link(WriteFunc write);
+
+    /**
+     * @brief LD-2をCMDモード（シリアル指令）に切り替え
+     */
+    void begin();
+
+    /**
+     * @brief 片側の目標RPMを設定
+     *
+     * 左右両方が設定された時点でRPM指令フレームを送信する。
+     *
+     * @param side 車輪
+     * @param rpm 目標RPM
+     */
+    void setRpm(Side side, float rpm);
+
+    float getRpm(Side side) const;
+
+    /**
+     * @brief 次に送信するフレームID
+     */
+    uint8_t getFrameId() const;
+
+    // =========================================================================
+    // 静的ユーティリティ関数（テスト可能なロジック部分）
+    // =========================================================================
+
+    /**
+     * @brief RPM指令コマンドを作成
+     * @param leftRpm 左目標RPM
+     * @param rightRpm 右目標RPM
+     * @param cmd 出力先（CMD_LENGTHバイト）
+     */
+    static void buildRpmCommand(float leftRpm, float rightRpm, uint8_t* cmd);
+
+    /**
+     * @brief 制御モード切り替えコマンドを作成
+     * @param mode CONTROL_MODE_RC / CONTROL_MODE_CMD
+     * @param cmd 出力先（CMD_LENGTHバイト）
+     */
+    static void buildControlModeCommand(uint8_t mode, uint8_t* cmd);
+
+    /**
+     * @brief コマンドにフレームIDとチェックサムを付加
+     * @param cmd コマンド（CMD_LENGTHバイト）
+     * @param frameId フレームID
+     * @param frame 出力先（FRAME_LENGTHバイト）
+     */
+    static void buildFrame(const uint8_t* cmd, uint8_t frameId, uint8_t* frame);
+
+    // =========================================================================
+    // 定数
+    // =========================================================================
+    static constexpr size_t CMD_LENGTH = 10;
+    static constexpr size_t FRAME_LENGTH = 12;
+    static constexpr uint8_t CMD_HEADER = 0xFF;
+    static constexpr uint8_t CMD_CONTROL_MODE = 0x00;
+    static constexpr uint8_t CMD_RPM = 0x02;
+    static constexpr uint8_t CONTROL_MODE_RC = 0x00;
+    static constexpr uint8_t CONTROL_MODE_CMD = 0x01;
+
+private:
+    void send(const uint8_t* cmd);
+
+    WriteFunc write_;
+    float rpm_[2];
+    uint8_t pending_;   // 前回送信後に設定された車輪（bit0=L, bit1=R）
+    uint8_t frameId_;
+};
+
+/**
+ * @class Ld2Driver
+ * @brief LD-2の1軸分（MotorControllerTのRPM指令型バックエンド）
+ */
+class Ld2Driver {
+public:
+    /**
+     * @brief コンストラクタ
+     * @param link 左右共有のLd2Link
+     * @param side 車輪
+     * @param inverted 反転フラグ（trueで指令RPMの符号を反転）
+     */
+    Ld2Driver(Ld2Link& link, Ld2Link::Side side, bool inverted = false);
+
+    /**
+     * @brief 初期化（リンクの初期化はLd2Link::begin()で行う）
+     */
+    void begin();
+
+    /**
+     * @brief 目標RPMを設定
+     * @param rpm 目標RPM（正:前進）
+     */
+    void setRpm(float rpm);
+
+    /**
+     * @brief 停止（目標0RPM）
+     */
+    void stop();
+
+    /**
+     * @brief ブレーキ（LD-2は0RPM指令で速度制御による保持となるためstop()と同じ）
+     */
+    void brake();
+
+    /**
+     * @brief 最後に指令したRPM（反転前）
+     */
+    float getCommandRpm() const;
+
+    static constexpr bool RPM_COMMAND = true;  // MotorControllerT: RPM指令型
+
+private:
+    Ld2Link& link_;
+    Ld2Link::Side side_;
+    bool inverted_;
+    float commandRpm_;
+};
+
+#endif // LD2_DRIVER_H
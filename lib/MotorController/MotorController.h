@@ -2,27 +2,74 @@
  * @file MotorController.h
  * @brief モータ制御統合クラス
  *
- * DifferentialKinematics、QuadratureEncoder、PIDController、MotorDriverを統合し、
+ * DifferentialKinematics、QuadratureEncoder、PIDController、モータドライバを統合し、
  * Core1で制御ループを実行する。
+ *
+ * setMotionLimits()で加減速制限を設定すると、setCmdVel()の指令は即座に目標RPMへ
+ * 反映されず、update()ごとにS字加減速プロファイル（SCurveProfile）を通して
+ * 並進・回転速度を追従させる。未設定時は従来どおりsetCmdVel()で目標RPMが確定する。
+ *
+ * update()はプロファイル（updateProfile()）と速度推定・PID（updateWheels()）を続けて実行する。
+ * マルチレートの制御ループでは、updateWheels()を制御周期ごと、updateProfile()を分周した周期で呼ぶ。
+ * updateWheels()とその呼び出し先（エンコーダ・PID・ドライバ出力）はSRAMに配置する（RamFunc.h）。
+ * updateWheels()は常にインライン展開されるため、実機ではRAM_FUNCの関数から呼ぶこと。
+ *
+ * 目標RPMが上限を越える場合の飽和処理はsetSaturationMode()で選択する。
+ * - 回転優先（デフォルト）: 回転速度を残して並進速度を削る。その場旋回の応答を優先する
+ * - 曲率保持: 並進・回転速度を同じ倍率で縮小する。プランナの円弧がきつい旋回にならない
+ *
+ * モータドライバはテンプレート引数（バックエンドポリシー）で指定する。
+ * 制御ループ内の呼び出しはコンパイル時に解決され、仮想関数呼び出しは発生しない。
+ *
+ * バックエンドポリシーの要件:
+ * - static constexpr bool RPM_COMMAND
+ *     false: PID出力を正規化した速度（-1.0〜1.0）を setSpeed(float) で出力
+ *     true:  目標RPMを setRpm(float) でそのまま出力（ドライバ側で速度制御、PIDは使用しない）
+ * - void stop()  惰性停止
+ * - void brake() 制動停止（非対応ならstop()相当）
+ *
+ * 対応バックエンド:
+ * - MotorDriver:    方向+PWM（DIR/PWM）
+ * - HBridgeDriver:  2PWM入力Hブリッジ（IN1/IN2）
+ * - Ld2Driver:      CuGo LD-2 BLDCドライバ（シリアルRPM指令）
+ *
+ * 片側の車輪数もテンプレート引数で指定する（2WD: 1、4WD: 2、6WD: 3のスキッドステア）。
+ * 同じ側の車輪は共通の目標RPMに対し、車輪ごとのエンコーダ・PID・ドライバで追従する。
+ * エンコーダ・ドライバ・PIDは [側][車輪] の配列で保持し、制御ループは分岐なしで回す。
  */
 
 #ifndef MOTOR_CONTROLLER_H
 #define MOTOR_CONTROLLER_H
 
 #include "DifferentialKinematics.h"
+#include "QuadratureEncoder.h"
+#include "MotorDriver.h"
+#include "PidController.h"
+#include "SCurveProfile.h"
+#include "RpmClamp.h"
+#include "RamFunc.h"
+#include <algorithm>
+#include <cmath>
+#include <stddef.h>
+#include <stdint.h>
 
-// 前方宣言（実機用）
-class QuadratureEncoder;
-class MotorDriver;
-class PidController;
+/**
+ * @brief 目標RPMの飽和処理
+ */
+enum SaturationMode : uint8_t {
+    SATURATION_ROTATION_PRIORITY = 0,  // 回転優先（並進成分を削る）
+    SATURATION_PRESERVE_CURVATURE = 1  // 曲率保持（v・ωを同じ倍率で縮小）
+};
 
 /**
- * @class MotorController
- * @brief 差動二輪モータ制御クラス
+ * @class MotorControllerT
+ * @brief 差動（スキッドステア）モータ制御クラス
+ * @tparam Driver モータドライバ（バックエンドポリシー）
+ * @tparam WheelsPerSide 片側の車輪数（2WD: 1、4WD: 2、6WD: 3）
  *
- * 使用例（実機用）:
+ * 使用例（実機用、2WD）:
  * @code
- * MotorController controller(
+ * MotorControllerT<HBridgeDriver> controller(
  *     encoderL, encoderR, driverL, driverR, pidL, pidR,
  *     0.1f, 0.3f, 1.0f, 200.0f
  * );
@@ -30,6 +77,20 @@ class PidController;
  * controller.update(0.01f);
  * @endcode
  *
+ * 使用例（実機用、4WD）:
+ * @code
+ * QuadratureEncoder* encodersL[2] = { &encoderFL, &encoderRL };
+ * QuadratureEncoder* encodersR[2] = { &encoderFR, &encoderRR };
+ * HBridgeDriver* driversL[2] = { &driverFL, &driverRL };
+ * HBridgeDriver* driversR[2] = { &driverFR, &driverRR };
+ * PidController* pidsL[2] = { &pidFL, &pidRL };
+ * PidController* pidsR[2] = { &pidFR, &pidRR };
+ * MotorControllerT<HBridgeDriver, 2> controller(
+ *     encodersL, encodersR, driversL, driversR, pidsL, pidsR,
+ *     0.1f, 0.45f, 1.0f, 200.0f
+ * );
+ * @endcode
+ *
  * 使用例（テスト用、ロジックのみ）:
  * @code
  * MotorController controller(0.1f, 0.3f, 1.0f, 200.0f);
@@ -37,10 +98,15 @@ class PidController;
  * float leftRpm = controller.getTargetRpmL();
  * @endcode
  */
-class MotorController {
+template <typename Driver, size_t WheelsPerSide = 1>
+class MotorControllerT {
+    static_assert(WheelsPerSide >= 1, "WheelsPerSide must be at least 1");
+
 public:
+    static constexpr size_t WHEELS_PER_SIDE = WheelsPerSide;
+
     /**
-     * @brief コンストラクタ（実機用、ハードウェア統合）
+     * @brief コンストラクタ（実機用、2WD）
      * @param encoderL 左エンコーダ
      * @param encoderR 右エンコーダ
      * @param driverL 左モータドライバ
@@ -52,13 +118,39 @@ public:
      * @param gearRatio 減速比
      * @param maxRpm 最大RPM
      */
-    MotorController(
+    MotorControllerT(
         QuadratureEncoder& encoderL, QuadratureEncoder& encoderR,
-        MotorDriver& driverL, MotorDriver& driverR,
+        Driver& driverL, Driver& driverR,
         PidController& pidL, PidController& pidR,
         float wheelDiameter, float trackWidth, float gearRatio, float maxRpm
     );
 
+    /**
+     * @brief コンストラクタ（実機用、片側N輪）
+     *
+     * 各配列は同じ側の車輪を同じ順序で並べること（例: 前輪、後輪）。
+     *
+     * @param encodersL 左側エンコーダ
+     * @param encodersR 右側エンコーダ
+     * @param driversL 左側モータドライバ
+     * @param driversR 右側モータドライバ
+     * @param pidsL 左側PIDコントローラ
+     * @param pidsR 右側PIDコントローラ
+     * @param wheelDiameter ホイール直径 [m]
+     * @param trackWidth トレッド幅 [m]（スキッドステアでは実効値）
+     * @param gearRatio 減速比
+     * @param maxRpm 最大RPM
+     */
+    MotorControllerT(
+        QuadratureEncoder* const (&encodersL)[WheelsPerSide],
+        QuadratureEncoder* const (&encodersR)[WheelsPerSide],
+        Driver* const (&driversL)[WheelsPerSide],
+        Driver* const (&driversR)[WheelsPerSide],
+        PidController* const (&pidsL)[WheelsPerSide],
+        PidController* const (&pidsR)[WheelsPerSide],
+        float wheelDiameter, float trackWidth, float gearRatio, float maxRpm
+    );
+
     /**
      * @brief コンストラクタ（テスト用、ロジックのみ）
      * @param wheelDiameter ホイール直径 [m]
@@ -66,60 +158,509 @@ public:
      * @param gearRatio 減速比
      * @param maxRpm 最大RPM
      */
-    MotorController(float wheelDiameter, float trackWidth, float gearRatio, float maxRpm);
+    MotorControllerT(float wheelDiameter, float trackWidth, float gearRatio, float maxRpm);
 
     /**
-     * @brief cmd_velから目標RPMを計算（回転優先クランプ適用）
+     * @brief cmd_velから目標RPMを計算（飽和処理を適用）
+     *
+     * 加減速制限が有効な場合は指令値として保持し、目標RPMはupdate()で更新する。
+     * 指令は飽和処理後の到達可能な速度に変換してから保持する。
+     *
      * @param linearX 並進速度 [m/s]
      * @param angularZ 回転速度 [rad/s]
      */
     void setCmdVel(float linearX, float angularZ);
 
+    /**
+     * @brief 左右の目標RPMを直接設定（位置制御など、キネマティクスを通さない指令）
+     *
+     * 加減速プロファイルは通さず、どちらかが上限（maxRpm×ディレーティング）を越える場合は
+     * 左右の比率を保ったまま縮小する。次にsetCmdVel()を呼ぶと速度指令に戻り、
+     * プロファイルはその時点の速度から再開する。
+     *
+     * @param leftRpm 左目標RPM
+     * @param rightRpm 右目標RPM
+     */
+    void setWheelRpm(float leftRpm, float rightRpm);
+
+    /**
+     * @brief ジオメトリを左右別に設定（次回setCmdVel()/update()から反映）
+     *
+     * 左右で実効直径・減速比が異なる場合（摩耗したクローラなど）に、
+     * 同じ指令で左右の車輪速度が揃うよう目標RPMを側ごとに換算する。
+     *
+     * @param wheelDiameterL 左ホイール直径 [m]
+     * @param wheelDiameterR 右ホイール直径 [m]
+     * @param trackWidth トレッド幅 [m]
+     * @param gearRatioL 左減速比
+     * @param gearRatioR 右減速比
+     */
+    void setGeometry(float wheelDiameterL, float wheelDiameterR, float trackWidth,
+                     float gearRatioL, float gearRatioR);
+
     /**
      * @brief 制御ループを1回実行
      *
-     * エンコーダから現在RPMを取得し、PID制御で出力を計算し、
-     * モータドライバに出力する。
+     * 加減速制限が有効な場合はプロファイルを1周期進めて目標RPMを更新する。
+     * 各車輪のエンコーダから現在RPMを取得し、PID制御で出力を計算し、
+     * モータドライバに出力する。RPM指令型バックエンドでは目標RPMをそのまま出力する。
      *
      * @param dt 前回からの経過時間 [s]
      */
     void update(float dt);
 
+    /**
+     * @brief 加減速プロファイルを1周期進めて目標RPMを更新（update()の前半）
+     * @param dt 前回のupdateProfile()からの経過時間 [s]
+     */
+    void updateProfile(float dt);
+
+    /**
+     * @brief 速度推定・PID制御・ドライバ出力（update()の後半）
+     * @param dt 前回のupdateWheels()からの経過時間 [s]
+     */
+    RAM_FUNC_INLINE void updateWheels(float dt);
+
+    /**
+     * @brief 並進・回転の加減速制限を設定
+     *
+     * 加速度が0以下の軸は制限なし、ジャークが0以下の軸は台形加減速になる。
+     *
+     * @param maxLinearAccel 最大並進加速度 [m/s²]
+     * @param maxLinearJerk 最大並進ジャーク [m/s³]
+     * @param maxAngularAccel 最大角加速度 [rad/s²]
+     * @param maxAngularJerk 最大角ジャーク [rad/s³]
+     */
+    void setMotionLimits(float maxLinearAccel, float maxLinearJerk,
+                         float maxAngularAccel, float maxAngularJerk);
+
+    /**
+     * @brief 加減速制限が有効か（いずれかの軸で有効）
+     */
+    bool isProfileEnabled() const;
+
+    // --- プロファイル後の速度（制限なしの場合は指令値）---
+    float getProfiledLinearX() const;
+    float getProfiledAngularZ() const;
+
     /**
      * @brief モータを停止
+     *
+     * setBrakeOnStop(true)の場合は短絡ブレーキ、falseの場合は惰性停止。
+     * 加減速プロファイルも停止状態（速度・加速度0）に戻す。
      */
     void stop();
 
-    // --- 目標値 ---
+    /**
+     * @brief 停止時（フェイルセーフ含む）にブレーキを使用するか設定
+     * @param enabled true=Driver::brake()、false=Driver::stop()
+     */
+    void setBrakeOnStop(bool enabled);
+    bool getBrakeOnStop() const;
+
+    /**
+     * @brief 目標RPMが上限を越える場合の飽和処理を設定（次回setCmdVel()/update()から反映）
+     * @param mode SATURATION_ROTATION_PRIORITY（デフォルト）またはSATURATION_PRESERVE_CURVATURE
+     */
+    void setSaturationMode(SaturationMode mode);
+    SaturationMode getSaturationMode() const;
+
+    /**
+     * @brief 熱保護などによる出力上限倍率を設定（次回setCmdVel()/update()から反映）
+     *
+     * 目標RPMの上限（飽和処理のmaxRpm）は左右の小さい方で、
+     * デューティ上限は側ごとに制限する。
+     *
+     * @param scaleL 左側モータの上限倍率（0.0〜1.0）
+     * @param scaleR 右側モータの上限倍率（0.0〜1.0）
+     */
+    void setDerating(float scaleL, float scaleR);
+    float getDeratingL() const;
+    float getDeratingR() const;
+
+    // --- 目標値（同じ側の全車輪で共通）---
     float getTargetRpmL() const;
     float getTargetRpmR() const;
 
-    // --- 現在値（エンコーダから取得）---
+    // --- 現在値（エンコーダから取得、片側複数輪の場合は平均）---
     float getCurrentRpmL() const;
     float getCurrentRpmR() const;
     long getEncoderCountL() const;
     long getEncoderCountR() const;
 
+    /**
+     * @brief 車輪ごとの現在RPM
+     * @param side 0=左、1=右
+     * @param wheel 車輪番号（0〜WheelsPerSide-1）
+     */
+    float getWheelRpm(size_t side, size_t wheel) const;
+
 private:
+    enum Side : size_t {
+        SIDE_L = 0,
+        SIDE_R = 1,
+        SIDE_COUNT = 2
+    };
+
     /**
-     * @brief 回転優先クランプ
+     * @brief 並進・回転速度から目標RPMを計算（飽和処理を適用）
      */
-    void clampRpmRotationPriority(float& leftRpm, float& rightRpm);
+    void calculateTargetRpm(float linearX, float angularZ);
+
+    /**
+     * @brief 片側のエンコーダ累積カウント（複数輪の場合は平均）
+     */
+    long getEncoderCount(size_t side) const;
 
     DifferentialKinematics kinematics_;
+    SCurveProfile linearProfile_;
+    SCurveProfile angularProfile_;
+    float cmdLinearX_;
+    float cmdAngularZ_;
+    bool wheelRpmMode_;   // setWheelRpm()による直接指令中
     float maxRpm_;
-    float targetRpmL_;
-    float targetRpmR_;
-    float currentRpmL_;
-    float currentRpmR_;
-
-    // ハードウェア参照（nullptrの場合はテストモード）
-    QuadratureEncoder* encoderL_;
-    QuadratureEncoder* encoderR_;
-    MotorDriver* driverL_;
-    MotorDriver* driverR_;
-    PidController* pidL_;
-    PidController* pidR_;
+    float targetRpm_[SIDE_COUNT];
+    float currentRpm_[SIDE_COUNT];
+    float wheelRpm_[SIDE_COUNT][WheelsPerSide];
+    bool brakeOnStop_;
+    SaturationMode saturationMode_;
+    float derating_[SIDE_COUNT];
+
+    // ハードウェア参照（hasHardware_がfalseの場合はテストモード）
+    bool hasHardware_;
+    QuadratureEncoder* encoders_[SIDE_COUNT][WheelsPerSide];
+    Driver* drivers_[SIDE_COUNT][WheelsPerSide];
+    PidController* pids_[SIDE_COUNT][WheelsPerSide];
 };
 
+// =============================================================================
+// テンプレート実装
+// =============================================================================
+
+// 実機用コンストラクタ（2WD）
+template <typename Driver, size_t WheelsPerSide>
+MotorControllerT<Driver, WheelsPerSide>::MotorControllerT(
+    QuadratureEncoder& encoderL, QuadratureEncoder& encoderR,
+    Driver& driverL, Driver& driverR,
+    PidController& pidL, PidController& pidR,
+    float wheelDiameter, float trackWidth, float gearRatio, float maxRpm
+)
+    : MotorControllerT(wheelDiameter, trackWidth, gearRatio, maxRpm)
+{
+    static_assert(WheelsPerSide == 1, "Use the array constructor for multiple wheels per side");
+    encoders_[SIDE_L][0] = &encoderL;
+    encoders_[SIDE_R][0] = &encoderR;
+    drivers_[SIDE_L][0] = &driverL;
+    drivers_[SIDE_R][0] = &driverR;
+    pids_[SIDE_L][0] = &pidL;
+    pids_[SIDE_R][0] = &pidR;
+    hasHardware_ = true;
+}
+
+// 実機用コンストラクタ（片側N輪）
+template <typename Driver, size_t WheelsPerSide>
+MotorControllerT<Driver, WheelsPerSide>::MotorControllerT(
+    QuadratureEncoder* const (&encodersL)[WheelsPerSide],
+    QuadratureEncoder* const (&encodersR)[WheelsPerSide],
+    Driver* const (&driversL)[WheelsPerSide],
+    Driver* const (&driversR)[WheelsPerSide],
+    PidController* const (&pidsL)[WheelsPerSide],
+    PidController* const (&pidsR)[WheelsPerSide],
+    float wheelDiameter, float trackWidth, float gearRatio, float maxRpm
+)
+    : MotorControllerT(wheelDiameter, trackWidth, gearRatio, maxRpm)
+{
+    bool complete = true;
+    for (size_t i = 0; i < WheelsPerSide; i++) {
+        encoders_[SIDE_L][i] = encodersL[i];
+        encoders_[SIDE_R][i] = encodersR[i];
+        drivers_[SIDE_L][i] = driversL[i];
+        drivers_[SIDE_R][i] = driversR[i];
+        pids_[SIDE_L][i] = pidsL[i];
+        pids_[SIDE_R][i] = pidsR[i];
+        complete = complete &&
+            encodersL[i] != nullptr && encodersR[i] != nullptr &&
+            driversL[i] != nullptr && driversR[i] != nullptr &&
+            pidsL[i] != nullptr && pidsR[i] != nullptr;
+    }
+    // 1つでも欠けていればハードウェアには出力しない（テストモードと同じ扱い）
+    hasHardware_ = complete;
+}
+
+// テスト用コンストラクタ（ロジックのみ）
+template <typename Driver, size_t WheelsPerSide>
+MotorControllerT<Driver, WheelsPerSide>::MotorControllerT(float wheelDiameter, float trackWidth, float gearRatio, float maxRpm)
+    : kinematics_(wheelDiameter, trackWidth, gearRatio)
+    , linearProfile_()
+    , angularProfile_()
+    , cmdLinearX_(0.0f)
+    , cmdAngularZ_(0.0f)
+    , wheelRpmMode_(false)
+    , maxRpm_(maxRpm)
+    , targetRpm_{0.0f, 0.0f}
+    , currentRpm_{0.0f, 0.0f}
+    , wheelRpm_{}
+    , brakeOnStop_(false)
+    , saturationMode_(SATURATION_ROTATION_PRIORITY)
+    , derating_{1.0f, 1.0f}
+    , hasHardware_(false)
+    , encoders_{}
+    , drivers_{}
+    , pids_{}
+{
+}
+
+template <typename Driver, size_t WheelsPerSide>
+void MotorControllerT<Driver, WheelsPerSide>::setCmdVel(float linearX, float angularZ) {
+    if (wheelRpmMode_) {
+        // 直接指令から戻る場合は、その時点の速度からプロファイルを再開
+        wheelRpmMode_ = false;
+        float linearNow;
+        float angularNow;
+        kinematics_.inverse(targetRpm_[SIDE_L], targetRpm_[SIDE_R], linearNow, angularNow);
+        linearProfile_.reset(linearNow);
+        angularProfile_.reset(angularNow);
+    }
+
+    // キネマティクス計算・回転優先クランプで目標RPMを算出
+    calculateTargetRpm(linearX, angularZ);
+
+    if (isProfileEnabled()) {
+        // クランプ後の到達可能な速度を指令値とし、目標RPMはupdate()でプロファイルから更新
+        kinematics_.inverse(targetRpm_[SIDE_L], targetRpm_[SIDE_R], cmdLinearX_, cmdAngularZ_);
+        calculateTargetRpm(linearProfile_.getVelocity(), angularProfile_.getVelocity());
+    } else {
+        cmdLinearX_ = linearX;
+        cmdAngularZ_ = angularZ;
+    }
+}
+
+template <typename Driver, size_t WheelsPerSide>
+void MotorControllerT<Driver, WheelsPerSide>::setWheelRpm(float leftRpm, float rightRpm) {
+    wheelRpmMode_ = true;
+
+    // 比率を保ったまま上限に収める（位置制御の左右同期を崩さない）
+    float rpmLimit = maxRpm_ * std::min(derating_[SIDE_L], derating_[SIDE_R]);
+    targetRpm_[SIDE_L] = leftRpm;
+    targetRpm_[SIDE_R] = rightRpm;
+    RpmClamp::proportional(targetRpm_[SIDE_L], targetRpm_[SIDE_R], rpmLimit);
+}
+
+template <typename Driver, size_t WheelsPerSide>
+void MotorControllerT<Driver, WheelsPerSide>::setGeometry(float wheelDiameterL, float wheelDiameterR,
+                                                          float trackWidth,
+                                                          float gearRatioL, float gearRatioR) {
+    kinematics_.setGeometry(wheelDiameterL, wheelDiameterR, trackWidth, gearRatioL, gearRatioR);
+}
+
+template <typename Driver, size_t WheelsPerSide>
+void MotorControllerT<Driver, WheelsPerSide>::update(float dt) {
+    updateProfile(dt);
+    updateWheels(dt);
+}
+
+template <typename Driver, size_t WheelsPerSide>
+void MotorControllerT<Driver, WheelsPerSide>::updateProfile(float dt) {
+    // 加減速プロファイルを1周期進める（プロファイル軌道上でも上限を越えないよう再クランプ）
+    if (isProfileEnabled() && !wheelRpmMode_) {
+        float linearX = linearProfile_.update(cmdLinearX_, dt);
+        float angularZ = angularProfile_.update(cmdAngularZ_, dt);
+        calculateTargetRpm(linearX, angularZ);
+    }
+}
+
+template <typename Driver, size_t WheelsPerSide>
+void MotorControllerT<Driver, WheelsPerSide>::updateWheels(float dt) {
+    // ハードウェアが接続されていない場合は何もしない
+    if (!hasHardware_) {
+        return;
+    }
+
+    // エンコーダから現在RPMを取得（側ごとの平均も求める）
+    constexpr float INV_WHEELS = 1.0f / static_cast<float>(WheelsPerSide);
+    for (size_t side = 0; side < SIDE_COUNT; side++) {
+        float sum = 0.0f;
+        for (size_t i = 0; i < WheelsPerSide; i++) {
+            wheelRpm_[side][i] = encoders_[side][i]->getRpm(dt);
+            sum += wheelRpm_[side][i];
+        }
+        currentRpm_[side] = sum * INV_WHEELS;
+    }
+
+    for (size_t side = 0; side < SIDE_COUNT; side++) {
+        const float target = targetRpm_[side];
+        const float limit = derating_[side];
+        for (size_t i = 0; i < WheelsPerSide; i++) {
+            if constexpr (Driver::RPM_COMMAND) {
+                // ドライバ側で速度制御するため目標RPMをそのまま出力
+                drivers_[side][i]->setRpm(target);
+            } else {
+                // PID制御で出力を計算し、-1.0〜1.0に正規化（ディレーティング中は上限を制限）
+                float output = pids_[side][i]->compute(target, wheelRpm_[side][i], dt);
+                float normalized = std::max(-limit, std::min(limit, output / maxRpm_));
+                drivers_[side][i]->setSpeed(normalized);
+            }
+        }
+    }
+}
+
+template <typename Driver, size_t WheelsPerSide>
+void MotorControllerT<Driver, WheelsPerSide>::stop() {
+    targetRpm_[SIDE_L] = 0.0f;
+    targetRpm_[SIDE_R] = 0.0f;
+
+    if (hasHardware_) {
+        for (size_t side = 0; side < SIDE_COUNT; side++) {
+            for (size_t i = 0; i < WheelsPerSide; i++) {
+                if (brakeOnStop_) {
+                    drivers_[side][i]->brake();
+                } else {
+                    drivers_[side][i]->stop();
+                }
+                pids_[side][i]->reset();
+            }
+        }
+    }
+
+    cmdLinearX_ = 0.0f;
+    cmdAngularZ_ = 0.0f;
+    wheelRpmMode_ = false;
+    linearProfile_.reset();
+    angularProfile_.reset();
+}
+
+template <typename Driver, size_t WheelsPerSide>
+void MotorControllerT<Driver, WheelsPerSide>::setMotionLimits(float maxLinearAccel, float maxLinearJerk,
+                                                              float maxAngularAccel, float maxAngularJerk) {
+    linearProfile_.setLimits(maxLinearAccel, maxLinearJerk);
+    angularProfile_.setLimits(maxAngularAccel, maxAngularJerk);
+}
+
+template <typename Driver, size_t WheelsPerSide>
+bool MotorControllerT<Driver, WheelsPerSide>::isProfileEnabled() const {
+    return linearProfile_.isEnabled() || angularProfile_.isEnabled();
+}
+
+template <typename Driver, size_t WheelsPerSide>
+float MotorControllerT<Driver, WheelsPerSide>::getProfiledLinearX() const {
+    return isProfileEnabled() ? linearProfile_.getVelocity() : cmdLinearX_;
+}
+
+template <typename Driver, size_t WheelsPerSide>
+float MotorControllerT<Driver, WheelsPerSide>::getProfiledAngularZ() const {
+    return isProfileEnabled() ? angularProfile_.getVelocity() : cmdAngularZ_;
+}
+
+template <typename Driver, size_t WheelsPerSide>
+void MotorControllerT<Driver, WheelsPerSide>::setBrakeOnStop(bool enabled) {
+    brakeOnStop_ = enabled;
+}
+
+template <typename Driver, size_t WheelsPerSide>
+bool MotorControllerT<Driver, WheelsPerSide>::getBrakeOnStop() const {
+    return brakeOnStop_;
+}
+
+template <typename Driver, size_t WheelsPerSide>
+void MotorControllerT<Driver, WheelsPerSide>::setSaturationMode(SaturationMode mode) {
+    saturationMode_ = mode;
+}
+
+template <typename Driver, size_t WheelsPerSide>
+SaturationMode MotorControllerT<Driver, WheelsPerSide>::getSaturationMode() const {
+    return saturationMode_;
+}
+
+template <typename Driver, size_t WheelsPerSide>
+void MotorControllerT<Driver, WheelsPerSide>::setDerating(float scaleL, float scaleR) {
+    derating_[SIDE_L] = scaleL;
+    derating_[SIDE_R] = scaleR;
+}
+
+template <typename Driver, size_t WheelsPerSide>
+float MotorControllerT<Driver, WheelsPerSide>::getDeratingL() const {
+    return derating_[SIDE_L];
+}
+
+template <typename Driver, size_t WheelsPerSide>
+float MotorControllerT<Driver, WheelsPerSide>::getDeratingR() const {
+    return derating_[SIDE_R];
+}
+
+template <typename Driver, size_t WheelsPerSide>
+float MotorControllerT<Driver, WheelsPerSide>::getTargetRpmL() const {
+    return targetRpm_[SIDE_L];
+}
+
+template <typename Driver, size_t WheelsPerSide>
+float MotorControllerT<Driver, WheelsPerSide>::getTargetRpmR() const {
+    return targetRpm_[SIDE_R];
+}
+
+template <typename Driver, size_t WheelsPerSide>
+float MotorControllerT<Driver, WheelsPerSide>::getCurrentRpmL() const {
+    return currentRpm_[SIDE_L];
+}
+
+template <typename Driver, size_t WheelsPerSide>
+float MotorControllerT<Driver, WheelsPerSide>::getCurrentRpmR() const {
+    return currentRpm_[SIDE_R];
+}
+
+template <typename Driver, size_t WheelsPerSide>
+long MotorControllerT<Driver, WheelsPerSide>::getEncoderCountL() const {
+    return getEncoderCount(SIDE_L);
+}
+
+template <typename Driver, size_t WheelsPerSide>
+long MotorControllerT<Driver, WheelsPerSide>::getEncoderCountR() const {
+    return getEncoderCount(SIDE_R);
+}
+
+template <typename Driver, size_t WheelsPerSide>
+float MotorControllerT<Driver, WheelsPerSide>::getWheelRpm(size_t side, size_t wheel) const {
+    if (side >= SIDE_COUNT || wheel >= WheelsPerSide) {
+        return 0.0f;
+    }
+    return wheelRpm_[side][wheel];
+}
+
+template <typename Driver, size_t WheelsPerSide>
+long MotorControllerT<Driver, WheelsPerSide>::getEncoderCount(size_t side) const {
+    if (!hasHardware_) {
+        return 0;
+    }
+    if (WheelsPerSide == 1) {
+        return encoders_[side][0]->getCount();
+    }
+    // 複数輪の平均（スリップした車輪の影響は残るが、車体の移動量の推定として使う）
+    int64_t sum = 0;
+    for (size_t i = 0; i < WheelsPerSide; i++) {
+        sum += encoders_[side][i]->getCount();
+    }
+    return static_cast<long>(sum / static_cast<int64_t>(WheelsPerSide));
+}
+
+template <typename Driver, size_t WheelsPerSide>
+void MotorControllerT<Driver, WheelsPerSide>::calculateTargetRpm(float linearX, float angularZ) {
+    // キネマティクス計算で目標RPMを算出
+    kinematics_.calculate(linearX, angularZ, targetRpm_[SIDE_L], targetRpm_[SIDE_R]);
+
+    // 飽和処理を適用（ディレーティング中は上限を下げる）
+    float rpmLimit = maxRpm_ * std::min(derating_[SIDE_L], derating_[SIDE_R]);
+    if (saturationMode_ == SATURATION_PRESERVE_CURVATURE) {
+        RpmClamp::proportional(targetRpm_[SIDE_L], targetRpm_[SIDE_R], rpmLimit);
+    } else {
+        RpmClamp::rotationPriority(targetRpm_[SIDE_L], targetRpm_[SIDE_R], rpmLimit);
+    }
+}
+
+/**
+ * 方向+PWMドライバ・2WD構成（従来のMotorController）
+ */
+typedef MotorControllerT<MotorDriver> MotorController;
+
+// 方向+PWM構成はMotorController.cppで実体化済み
+extern template class MotorControllerT<MotorDriver>;
+
 #endif // MOTOR_CONTROLLER_H
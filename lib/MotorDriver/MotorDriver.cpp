@@ -1,19 +1,27 @@
 #include "MotorDriver.h"
+#include "RamFunc.h"
 
 #ifdef ARDUINO
 #include <Arduino.h>
 #include "HardwareConfig.h"
+#include "hardware/gpio.h"
+#include "hardware/pwm.h"
 #endif
 
 // =============================================================================
 // コンストラクタ
 // =============================================================================
 
-MotorDriver::MotorDriver(uint8_t pinDir, uint8_t pinPwm, bool inverted)
+MotorDriver::MotorDriver(uint8_t pinDir, uint8_t pinPwm, bool inverted,
+                         DecayMode decayMode, uint8_t pinBrake)
     : pinDir_(pinDir)
     , pinPwm_(pinPwm)
+    , pinBrake_(pinBrake)
     , inverted_(inverted)
+    , decayMode_(decayMode)
     , currentSpeed_(0.0f)
+    , nominalVoltage_(0.0f)
+    , voltageScale_(1.0f)
 {
 }
 
@@ -23,9 +31,11 @@ MotorDriver::MotorDriver(uint8_t pinDir, uint8_t pinPwm, bool inverted)
 
 void MotorDriver::begin() {
 #ifdef ARDUINO
-    pinMode(pinDir_, OUTPUT);
-    pinMode(pinPwm_, OUTPUT);
+    if (pinBrake_ != PIN_NONE) {
+        pinMode(pinBrake_, OUTPUT);
+    }
     analogWriteFreq(HardwareConfig::PWM_FREQUENCY);
+    configurePins();
     stop();
 #endif
 }
@@ -34,16 +44,11 @@ void MotorDriver::begin() {
 // 速度設定
 // =============================================================================
 
-void MotorDriver::setSpeed(float speed) {
-    currentSpeed_ = clampSpeed(speed);
-
-#ifdef ARDUINO
-    // 方向設定（LOW=正転、HIGH=逆転）、反転フラグ考慮
-    digitalWrite(pinDir_, getDirection(currentSpeed_, inverted_) ? HIGH : LOW);
-
-    // PWM設定
-    analogWrite(pinPwm_, calculatePwmDuty(currentSpeed_));
-#endif
+// 制御周期ごとに呼ぶため、出力計算・ピン出力まで含めてSRAMに配置（RamFunc.h）
+void RAM_FUNC(MotorDriver::setSpeed)(float speed) {
+    // 電圧低下分だけデューティを上げて、同じ指令で同じ平均電圧を得る
+    currentSpeed_ = clampSpeed(speed * voltageScale_);
+    applyOutput(calculateOutput(currentSpeed_, decayMode_, inverted_));
 }
 
 // =============================================================================
@@ -52,10 +57,7 @@ void MotorDriver::setSpeed(float speed) {
 
 void MotorDriver::stop() {
     currentSpeed_ = 0.0f;
-
-#ifdef ARDUINO
-    analogWrite(pinPwm_, 0);
-#endif
+    applyOutput(calculateStopOutput(decayMode_));
 }
 
 // =============================================================================
@@ -63,16 +65,102 @@ void MotorDriver::stop() {
 // =============================================================================
 
 void MotorDriver::brake() {
-    // 現在の実装では通常停止と同じ
-    // 将来的にブレーキ対応ドライバを使用する場合に拡張
+    currentSpeed_ = 0.0f;
+    applyOutput(calculateBrakeOutput(decayMode_, pinBrake_ != PIN_NONE));
+}
+
+// =============================================================================
+// ディケイモード
+// =============================================================================
+
+void MotorDriver::setDecayMode(DecayMode decayMode) {
+    decayMode_ = decayMode;
+
+#ifdef ARDUINO
+    // PWM出力⇔デジタル出力の切り替えのためピン機能を再設定
+    configurePins();
     stop();
+#endif
+}
+
+MotorDriver::DecayMode MotorDriver::getDecayMode() const {
+    return decayMode_;
+}
+
+bool MotorDriver::canBrake() const {
+    return decayMode_ == DECAY_LOCKED_ANTIPHASE || pinBrake_ != PIN_NONE;
+}
+
+// =============================================================================
+// 電圧補償
+// =============================================================================
+
+void MotorDriver::setNominalVoltage(float nominalVoltage) {
+    nominalVoltage_ = nominalVoltage;
+    voltageScale_ = 1.0f;
+}
+
+void MotorDriver::setSupplyVoltage(float supplyVoltage) {
+    voltageScale_ = calculateVoltageScale(nominalVoltage_, supplyVoltage);
+}
+
+float MotorDriver::getVoltageScale() const {
+    return voltageScale_;
+}
+
+float MotorDriver::getOutputSpeed() const {
+    return currentSpeed_;
+}
+
+// =============================================================================
+// ピン出力
+// =============================================================================
+
+void MotorDriver::configurePins() {
+#ifdef ARDUINO
+    // ピン機能・PWM周波数はanalogWrite()で設定し、以降の出力は比較値・出力レベルのみ書き換える
+    if (decayMode_ == DECAY_LOCKED_ANTIPHASE) {
+        analogWrite(pinDir_, 0);
+    } else {
+        pinMode(pinDir_, OUTPUT);
+    }
+    analogWrite(pinPwm_, 0);
+#endif
+}
+
+void RAM_FUNC(MotorDriver::applyOutput)(const PinOutput& output) {
+#ifdef ARDUINO
+    if (decayMode_ == DECAY_LOCKED_ANTIPHASE) {
+        // DIRピンをPWM駆動
+        writePwm(pinDir_, output.dirDuty);
+    } else {
+        gpio_put(pinDir_, output.dirDuty != 0);
+    }
+    writePwm(pinPwm_, output.pwmDuty);
+    if (pinBrake_ != PIN_NONE) {
+        gpio_put(pinBrake_, output.brake);
+    }
+#else
+    (void)output;
+#endif
+}
+
+void RAM_FUNC(MotorDriver::writePwm)(uint8_t pin, uint8_t duty) {
+#ifdef ARDUINO
+    uint16_t top = static_cast<uint16_t>(pwm_hw->slice[pwm_gpio_to_slice_num(pin)].top);
+    uint32_t level = calculatePwmLevel(duty, top);
+    pwm_set_gpio_level(pin, static_cast<uint16_t>(level > 0xFFFF ? 0xFFFF : level));
+#else
+    (void)pin;
+    (void)duty;
+#endif
 }
 
 // =============================================================================
 // 静的ユーティリティ関数
 // =============================================================================
 
-float MotorDriver::clampSpeed(float speed) {
+float RAM_FUNC(MotorDriver::clampSpeed)(float speed) {
     if (speed > 1.0f) {
         return 1.0f;
     }
@@ -82,13 +170,13 @@ float MotorDriver::clampSpeed(float speed) {
     return speed;
 }
 
-bool MotorDriver::getDirection(float speed) {
+bool RAM_FUNC(MotorDriver::getDirection)(float speed) {
     // 負の速度で逆転（DIR = HIGH = true）
     // 正の速度・0で正転（DIR = LOW = false）
     return speed < 0.0f;
 }
 
-bool MotorDriver::getDirection(float speed, bool inverted) {
+bool RAM_FUNC(MotorDriver::getDirection)(float speed, bool inverted) {
     // 基本の方向判定
     bool direction = getDirection(speed);
 
@@ -100,10 +188,90 @@ bool MotorDriver::getDirection(float speed, bool inverted) {
     return direction;
 }
 
-uint8_t MotorDriver::calculatePwmDuty(float speed) {
+uint8_t RAM_FUNC(MotorDriver::calculatePwmDuty)(float speed) {
     // 絶対値を取ってPWM値に変換
     float absSpeed = speed < 0.0f ? -speed : speed;
 
     // 0.0〜1.0 → 0〜255
     return static_cast<uint8_t>(absSpeed * PWM_MAX + 0.5f);
 }
+
+float MotorDriver::calculateVoltageScale(float nominalVoltage, float supplyVoltage) {
+    // 補償無効、または電圧未計測
+    if (nominalVoltage <= 0.0f || supplyVoltage <= 0.0f) {
+        return 1.0f;
+    }
+
+    float scale = nominalVoltage / supplyVoltage;
+
+    // 計測異常時の過補償を防ぐため範囲制限
+    if (scale < VOLTAGE_SCALE_MIN) {
+        return VOLTAGE_SCALE_MIN;
+    }
+    if (scale > VOLTAGE_SCALE_MAX) {
+        return VOLTAGE_SCALE_MAX;
+    }
+    return scale;
+}
+
+uint8_t RAM_FUNC(MotorDriver::calculateAntiphaseDuty)(float speed, bool inverted) {
+    float signedSpeed = inverted ? -clampSpeed(speed) : clampSpeed(speed);
+
+    // DIR HIGH期間が逆転側: -1.0 → 255, 0.0 → 128, 1.0 → 0
+    return static_cast<uint8_t>((1.0f - signedSpeed) * 0.5f * PWM_MAX + 0.5f);
+}
+
+MotorDriver::PinOutput RAM_FUNC(MotorDriver::calculateOutput)(float speed, DecayMode mode, bool inverted) {
+    float clamped = clampSpeed(speed);
+    PinOutput output;
+
+    if (mode == DECAY_LOCKED_ANTIPHASE) {
+        output.dirDuty = calculateAntiphaseDuty(clamped, inverted);
+        output.pwmDuty = PWM_MAX;
+        output.brake = false;
+        return output;
+    }
+
+    output.dirDuty = getDirection(clamped, inverted) ? PWM_MAX : 0;
+    output.pwmDuty = calculatePwmDuty(clamped);
+    output.brake = (mode == DECAY_SIGN_MAGNITUDE_BRAKE);
+    return output;
+}
+
+MotorDriver::PinOutput MotorDriver::calculateStopOutput(DecayMode mode) {
+    // 全モード共通: イネーブル（PWM）を落として惰性停止
+    (void)mode;
+    PinOutput output;
+    output.dirDuty = 0;
+    output.pwmDuty = 0;
+    output.brake = false;
+    return output;
+}
+
+MotorDriver::PinOutput MotorDriver::calculateBrakeOutput(DecayMode mode, bool hasBrakePin) {
+    PinOutput output;
+
+    if (mode == DECAY_LOCKED_ANTIPHASE) {
+        // 50%デューティで平均電圧0、両端を交互に短絡して制動
+        output.dirDuty = calculateAntiphaseDuty(0.0f, false);
+        output.pwmDuty = PWM_MAX;
+        output.brake = false;
+        return output;
+    }
+
+    if (mode == DECAY_SIGN_MAGNITUDE_COAST && !hasBrakePin) {
+        // ブレーキ手段なし: 惰性停止
+        return calculateStopOutput(mode);
+    }
+
+    // PWM=0 + BRAKE=HIGH でローサイド短絡
+    output.dirDuty = 0;
+    output.pwmDuty = 0;
+    output.brake = true;
+    return output;
+}
+
+uint32_t RAM_FUNC(MotorDriver::calculatePwmLevel)(uint8_t duty, uint16_t top) {
+    // duty / PWM_MAX × (TOP + 1)。PWM_MAXでTOP + 1（比較値 > TOPで常時HIGH）
+    return (static_cast<uint32_t>(duty) * (static_cast<uint32_t>(top) + 1) + PWM_MAX / 2) / PWM_MAX;
+}
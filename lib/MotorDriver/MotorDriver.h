@@ -9,16 +9,44 @@
  * モータドライバの仕様:
  * - DIRピン: LOW=正転、HIGH=逆転
  * - PWMピン: 0〜255（8bit）でデューティサイクル制御
+ * - BRAKEピン（任意）: HIGH=ブレーキ/スローディケイ
+ *
+ * ディケイモード:
+ * - DECAY_SIGN_MAGNITUDE_COAST: DIR=方向、PWM=|速度|、OFF期間は惰性（ファストディケイ）
+ * - DECAY_SIGN_MAGNITUDE_BRAKE: DIR=方向、PWM=|速度|、OFF期間は短絡（スローディケイ）
+ * - DECAY_LOCKED_ANTIPHASE:     DIRピンにPWM出力（50%で停止）、PWMピンはイネーブル固定
  */
 class MotorDriver {
 public:
+    /**
+     * ディケイモード
+     */
+    enum DecayMode : uint8_t {
+        DECAY_SIGN_MAGNITUDE_COAST = 0,
+        DECAY_SIGN_MAGNITUDE_BRAKE = 1,
+        DECAY_LOCKED_ANTIPHASE = 2
+    };
+
+    /**
+     * ピン出力状態（テスト可能な計算結果）
+     */
+    struct PinOutput {
+        uint8_t dirDuty;   // DIRピン（符号-絶対値方式: 0=LOW / PWM_MAX=HIGH、ロックドアンチフェーズ: デューティ）
+        uint8_t pwmDuty;   // PWMピン デューティ（0〜255）
+        bool brake;        // BRAKEピン（true=HIGH）
+    };
+
     /**
      * コンストラクタ
      * @param pinDir 方向ピン番号
      * @param pinPwm PWMピン番号
      * @param inverted 反転フラグ（trueでモータ回転方向を反転、デフォルトfalse）
+     * @param decayMode ディケイモード（デフォルト: 符号-絶対値/惰性）
+     * @param pinBrake ブレーキピン番号（PIN_NONEで未接続）
      */
-    MotorDriver(uint8_t pinDir, uint8_t pinPwm, bool inverted = false);
+    MotorDriver(uint8_t pinDir, uint8_t pinPwm, bool inverted = false,
+                DecayMode decayMode = DECAY_SIGN_MAGNITUDE_COAST,
+                uint8_t pinBrake = PIN_NONE);
 
     /**
      * 初期化（ピンモード設定、PWM周波数設定）
@@ -32,15 +60,54 @@ public:
     void setSpeed(float speed);
 
     /**
-     * 停止（PWMを0に）
+     * 停止（惰性停止、PWMを0に）
      */
     void stop();
 
     /**
-     * ブレーキ（ドライバ対応時のみ）
+     * ブレーキ（短絡制動）
+     *
+     * ブレーキ非対応構成（符号-絶対値方式でBRAKEピンなし）ではstop()と同じ。
      */
     void brake();
 
+    /**
+     * ディケイモードを設定（次回出力から反映）
+     * @param decayMode ディケイモード
+     */
+    void setDecayMode(DecayMode decayMode);
+
+    DecayMode getDecayMode() const;
+
+    /**
+     * 短絡ブレーキが可能な構成か
+     * 符号-絶対値方式はBRAKEピンで短絡するため、ピン未接続ではディケイモードに関係なくfalse。
+     * @return true=brake()で短絡制動、false=brake()は惰性停止
+     */
+    bool canBrake() const;
+
+    /**
+     * 電圧補償の公称電圧を設定（0以下で補償無効）
+     * @param nominalVoltage 公称電圧 [V]（PIDゲイン調整時の電圧）
+     */
+    void setNominalVoltage(float nominalVoltage);
+
+    /**
+     * 現在の電源電圧を設定（次回setSpeed()から反映）
+     * @param supplyVoltage 電源電圧 [V]（フィルタ済みの値を渡すこと）
+     */
+    void setSupplyVoltage(float supplyVoltage);
+
+    /**
+     * 現在の電圧補償倍率（公称/実電圧）
+     */
+    float getVoltageScale() const;
+
+    /**
+     * 最後に出力した速度（電圧補償・クランプ後、-1.0〜1.0）
+     */
+    float getOutputSpeed() const;
+
     // =========================================================================
     // 静的ユーティリティ関数（テスト可能なロジック部分）
     // =========================================================================
@@ -74,16 +141,93 @@ public:
      */
     static uint8_t calculatePwmDuty(float speed);
 
+    /**
+     * 電圧補償倍率を計算
+     * @param nominalVoltage 公称電圧 [V]（0以下で補償無効）
+     * @param supplyVoltage 電源電圧 [V]
+     * @return 公称/実電圧（VOLTAGE_SCALE_MIN〜VOLTAGE_SCALE_MAX、無効時は1.0）
+     */
+    static float calculateVoltageScale(float nominalVoltage, float supplyVoltage);
+
+    /**
+     * ロックドアンチフェーズ時のDIRピンデューティを計算
+     * @param speed 速度（-1.0〜1.0）
+     * @param inverted 反転フラグ
+     * @return DIRピンデューティ（0=正転全速、128=停止、255=逆転全速）
+     */
+    static uint8_t calculateAntiphaseDuty(float speed, bool inverted);
+
+    /**
+     * 速度指令時のピン出力を計算
+     * @param speed 速度（-1.0〜1.0、範囲外はクランプ）
+     * @param mode ディケイモード
+     * @param inverted 反転フラグ
+     * @return ピン出力状態
+     */
+    static PinOutput calculateOutput(float speed, DecayMode mode, bool inverted);
+
+    /**
+     * 惰性停止時のピン出力を計算
+     * @param mode ディケイモード
+     * @return ピン出力状態
+     */
+    static PinOutput calculateStopOutput(DecayMode mode);
+
+    /**
+     * ブレーキ時のピン出力を計算
+     * @param mode ディケイモード
+     * @param hasBrakePin BRAKEピン接続有無
+     * @return ピン出力状態（ブレーキ非対応構成では惰性停止と同じ）
+     */
+    static PinOutput calculateBrakeOutput(DecayMode mode, bool hasBrakePin);
+
+    /**
+     * デューティ（0〜255）をPWMスライスの比較値に換算
+     * @param duty デューティ（0〜PWM_MAX）
+     * @param top PWMスライスのTOP（周期 = TOP + 1カウント）
+     * @return 比較値（PWM_MAXでTOP + 1 = 常時HIGH）
+     */
+    static uint32_t calculatePwmLevel(uint8_t duty, uint16_t top);
+
+    /**
+     * PWMピンのデューティを設定（実機のみ）
+     *
+     * 制御周期ごとの出力はanalogWrite()（フラッシュ上、ピン機能の設定を含む）を通さず、
+     * 比較値のみを書き換える。ピン機能・周波数はbegin()のanalogWrite()で設定済みであること。
+     *
+     * @param pin PWMピン番号
+     * @param duty デューティ（0〜PWM_MAX）
+     */
+    static void writePwm(uint8_t pin, uint8_t duty);
+
     // =========================================================================
     // 定数
     // =========================================================================
+    static constexpr bool RPM_COMMAND = false;  // MotorControllerT: デューティ出力型
     static constexpr uint8_t PWM_MAX = 255;
+    static constexpr uint8_t PIN_NONE = 0xFF;
+    static constexpr float VOLTAGE_SCALE_MIN = 0.5f;  // 電圧補償の下限倍率
+    static constexpr float VOLTAGE_SCALE_MAX = 1.5f;  // 電圧補償の上限倍率
 
 private:
+    /**
+     * ピン機能を設定（PWMピン、ロックドアンチフェーズ時はDIRピンもPWM）
+     */
+    void configurePins();
+
+    /**
+     * ピン出力を実機に反映
+     */
+    void applyOutput(const PinOutput& output);
+
     uint8_t pinDir_;
     uint8_t pinPwm_;
+    uint8_t pinBrake_;
     bool inverted_;
+    DecayMode decayMode_;
     float currentSpeed_;
+    float nominalVoltage_;
+    float voltageScale_;
 };
 
 #endif // MOTOR_DRIVER_H
@@ -0,0 +1,98 @@
+/**
+ * @file Odometry.cpp
+ * @brief 差動二輪オドメトリ 実装
+ */
+
+#include "Odometry.h"
+#include <cmath>
+
+namespace {
+    constexpr float PI = 3.14159265358979f;
+    constexpr float TWO_PI = 2.0f * PI;
+}
+
+Odometry::Odometry(float wheelDiameter, float trackWidth, float gearRatio, uint16_t countsPerRev)
+    : kinematics_(wheelDiameter, trackWidth, gearRatio)
+    , countToRevMinuteL_(0.0f)
+    , countToRevMinuteR_(0.0f)
+    , prevCountL_(0)
+    , prevCountR_(0)
+    , hasPrevCount_(false)
+    , x_(0.0f)
+    , y_(0.0f)
+    , theta_(0.0f)
+    , linearX_(0.0f)
+    , angularZ_(0.0f)
+{
+    setGeometry(wheelDiameter, trackWidth, gearRatio, countsPerRev);
+}
+
+void Odometry::setGeometry(float wheelDiameter, float trackWidth, float gearRatio, uint16_t countsPerRev) {
+    setGeometry(wheelDiameter, wheelDiameter, trackWidth, gearRatio, gearRatio, countsPerRev, countsPerRev);
+}
+
+void Odometry::setGeometry(float wheelDiameterL, float wheelDiameterR, float trackWidth,
+                           float gearRatioL, float gearRatioR,
+                           uint16_t countsPerRevL, uint16_t countsPerRevR) {
+    kinematics_.setGeometry(wheelDiameterL, wheelDiameterR, trackWidth, gearRatioL, gearRatioR);
+    countToRevMinuteL_ = (countsPerRevL > 0) ? 60.0f / static_cast<float>(countsPerRevL) : 0.0f;
+    countToRevMinuteR_ = (countsPerRevR > 0) ? 60.0f / static_cast<float>(countsPerRevR) : 0.0f;
+}
+
+void Odometry::update(int32_t countL, int32_t countR, float dt) {
+    if (!hasPrevCount_) {
+        prevCountL_ = countL;
+        prevCountR_ = countR;
+        hasPrevCount_ = true;
+        return;
+    }
+
+    // ラップアラウンドを考慮した差分（符号なし減算で2の補数として扱う）
+    int32_t diffL = static_cast<int32_t>(static_cast<uint32_t>(countL) - static_cast<uint32_t>(prevCountL_));
+    int32_t diffR = static_cast<int32_t>(static_cast<uint32_t>(countR) - static_cast<uint32_t>(prevCountR_));
+    prevCountL_ = countL;
+    prevCountR_ = countR;
+
+    // inverse() は線形なので、変位を「1分あたりの回転数」として渡すと
+    // 戻り値は1分間ではなくこの区間の移動量 [m]・回転量 [rad] になる
+    float distance;
+    float deltaTheta;
+    kinematics_.inverse(static_cast<float>(diffL) * countToRevMinuteL_,
+                        static_cast<float>(diffR) * countToRevMinuteR_,
+                        distance, deltaTheta);
+
+    integrate(x_, y_, theta_, distance, deltaTheta);
+
+    if (dt > 0.0f) {
+        float invDt = 1.0f / dt;
+        linearX_ = distance * invDt;
+        angularZ_ = deltaTheta * invDt;
+    }
+}
+
+void Odometry::reset(float x, float y, float theta) {
+    x_ = x;
+    y_ = y;
+    theta_ = normalizeAngle(theta);
+    linearX_ = 0.0f;
+    angularZ_ = 0.0f;
+}
+
+void Odometry::integrate(float& x, float& y, float& theta, float distance, float deltaTheta) {
+    float midTheta = theta + deltaTheta * 0.5f;
+    x += distance * std::cos(midTheta);
+    y += distance * std::sin(midTheta);
+    theta = normalizeAngle(theta + deltaTheta);
+}
+
+float Odometry::normalizeAngle(float angle) {
+    // 1周期分の積算では高々1回の折り返しで済むが、reset()の任意入力にも対応する
+    if (angle > PI || angle < -PI) {
+        angle = std::fmod(angle + PI, TWO_PI);
+        if (angle < 0.0f) {
+            angle += TWO_PI;
+        }
+        angle -= PI;
+    }
+    return angle;
+}
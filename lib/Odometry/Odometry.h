@@ -0,0 +1,117 @@
+/**
+ * @file Odometry.h
+ * @brief 差動二輪オドメトリ（エンコーダ積算による自己位置推定）
+ *
+ * Core1の制御周期ごとに左右エンコーダの累積カウントを受け取り、
+ * DifferentialKinematics の逆変換で移動量・回転量を求めて
+ * 姿勢（x, y, θ）と速度（v, ω）を積算する。
+ *
+ * 姿勢はカウント差分から直接求めるため、dtの揺らぎは速度にのみ影響し、
+ * 位置の積算には影響しない。
+ */
+
+#ifndef ODOMETRY_H
+#define ODOMETRY_H
+
+#include <stdint.h>
+#include "DifferentialKinematics.h"
+
+/**
+ * @class Odometry
+ * @brief エンコーダ積算オドメトリ
+ *
+ * 使用例:
+ * @code
+ * Odometry odometry(0.1f, 0.3f, 1.0f, 1024);
+ * // 制御周期ごと（左右カウントは同じ周期で取得したもの）
+ * odometry.update(encoderL.getCount(), encoderR.getCount(), 0.01f);
+ * float x = odometry.getX();
+ * @endcode
+ */
+class Odometry {
+public:
+    /**
+     * @brief コンストラクタ
+     * @param wheelDiameter ホイール直径 [m]
+     * @param trackWidth トレッド幅 [m]
+     * @param gearRatio 減速比（モータ軸→ホイール軸）
+     * @param countsPerRev モータ1回転あたりのエンコーダカウント（QuadratureEncoderのPPR）
+     */
+    Odometry(float wheelDiameter, float trackWidth, float gearRatio, uint16_t countsPerRev);
+
+    /**
+     * @brief ジオメトリを変更（姿勢は維持）
+     */
+    void setGeometry(float wheelDiameter, float trackWidth, float gearRatio, uint16_t countsPerRev);
+
+    /**
+     * @brief ジオメトリを左右別に変更（姿勢は維持）
+     *
+     * 左右の実効直径の違い（摩耗など）は直進時の方位ドリフトになるため、
+     * UMBmark等で推定した左右別の値を設定する。
+     */
+    void setGeometry(float wheelDiameterL, float wheelDiameterR, float trackWidth,
+                     float gearRatioL, float gearRatioR,
+                     uint16_t countsPerRevL, uint16_t countsPerRevR);
+
+    /**
+     * @brief 制御周期ごとの積算
+     *
+     * 初回呼び出しはカウントの基準を記録するのみ。
+     * カウントのint32ラップアラウンドは差分計算で吸収する。
+     *
+     * @param countL 左エンコーダ累積カウント
+     * @param countR 右エンコーダ累積カウント
+     * @param dt 前回からの経過時間 [s]（速度計算のみに使用）
+     */
+    void update(int32_t countL, int32_t countR, float dt);
+
+    /**
+     * @brief 姿勢を指定値にリセット（速度は0、カウント基準は維持）
+     * @param x X座標 [m]
+     * @param y Y座標 [m]
+     * @param theta 方位 [rad]
+     */
+    void reset(float x = 0.0f, float y = 0.0f, float theta = 0.0f);
+
+    float getX() const { return x_; }
+    float getY() const { return y_; }
+    float getTheta() const { return theta_; }
+    float getLinearX() const { return linearX_; }
+    float getAngularZ() const { return angularZ_; }
+
+    /**
+     * @brief 移動量・回転量から姿勢を更新（ハードウェア非依存、テスト可能）
+     *
+     * 区間中点の方位で進む2次精度の積算（Runge-Kutta 2次）。
+     *
+     * @param[in,out] x X座標 [m]
+     * @param[in,out] y Y座標 [m]
+     * @param[in,out] theta 方位 [rad]（-π〜πに正規化される）
+     * @param distance 並進移動量 [m]
+     * @param deltaTheta 回転量 [rad]
+     */
+    static void integrate(float& x, float& y, float& theta, float distance, float deltaTheta);
+
+    /**
+     * @brief 角度を -π〜π に正規化
+     */
+    static float normalizeAngle(float angle);
+
+private:
+    DifferentialKinematics kinematics_;
+    float countToRevMinuteL_;  ///< カウント → 「1分あたりの回転数」換算係数（60 / countsPerRev）
+    float countToRevMinuteR_;
+
+    int32_t prevCountL_;
+    int32_t prevCountR_;
+    bool hasPrevCount_;
+
+    float x_;
+    float y_;
+    float theta_;
+    float linearX_;
+    float angularZ_;
+};
+
+#endif // ODOMETRY_H
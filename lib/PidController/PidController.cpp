@@ -1,4 +1,5 @@
 #include "PidController.h"
+#include "RamFunc.h"
 
 PidController::PidController(float kp, float ki, float kd)
     : kp_(kp), ki_(ki), kd_(kd),
@@ -6,7 +7,8 @@ PidController::PidController(float kp, float ki, float kd)
       outputMin_(0.0f), outputMax_(0.0f), hasOutputLimits_(false) {
 }
 
-float PidController::compute(float setpoint, float measured, float dt) {
+// 制御周期ごとに呼ぶためSRAMに配置（RamFunc.h）
+float RAM_FUNC(PidController::compute)(float setpoint, float measured, float dt) {
     // dtのガード: 0以下なら計算不可
     if (dt <= 0.0f) {
         return 0.0f;
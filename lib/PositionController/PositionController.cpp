@@ -0,0 +1,174 @@
+/**
+ * @file PositionController.cpp
+ * @brief 左右ホイールの位置制御 実装
+ */
+
+#include "PositionController.h"
+#include <cmath>
+
+namespace {
+    /**
+     * 開始時からの移動量（ラップアラウンドを考慮）
+     */
+    float relativeCount(int32_t count, int32_t start) {
+        return static_cast<float>(
+            static_cast<int32_t>(static_cast<uint32_t>(count) - static_cast<uint32_t>(start)));
+    }
+}
+
+PositionController::PositionController(float kp, uint16_t countsPerRev,
+                                       int32_t toleranceCounts, float settleTime)
+    : kp_(0.0f)
+    , countToRpmL_(0.0f)
+    , countToRpmR_(0.0f)
+    , toleranceCounts_(static_cast<float>(toleranceCounts))
+    , settleTime_(settleTime)
+    , startL_(0)
+    , startR_(0)
+    , deltaL_(0.0f)
+    , deltaR_(0.0f)
+    , distance_(0.0f)
+    , accelTime_(0.0f)
+    , cruiseTime_(0.0f)
+    , peakVelocity_(0.0f)
+    , elapsed_(0.0f)
+    , settledTime_(0.0f)
+    , active_(false)
+    , reached_(false)
+{
+    setParameters(kp, countsPerRev);
+}
+
+void PositionController::setParameters(float kp, uint16_t countsPerRev) {
+    setParameters(kp, countsPerRev, countsPerRev);
+}
+
+void PositionController::setParameters(float kp, uint16_t countsPerRevL, uint16_t countsPerRevR) {
+    kp_ = kp;
+    countToRpmL_ = (countsPerRevL > 0) ? 60.0f / static_cast<float>(countsPerRevL) : 0.0f;
+    countToRpmR_ = (countsPerRevR > 0) ? 60.0f / static_cast<float>(countsPerRevR) : 0.0f;
+}
+
+bool PositionController::start(int32_t startL, int32_t startR, int32_t deltaL, int32_t deltaR,
+                               float maxRpm, float maxAccel) {
+    if (!(maxRpm > 0.0f) || countToRpmL_ <= 0.0f || countToRpmR_ <= 0.0f) {
+        return false;
+    }
+
+    startL_ = startL;
+    startR_ = startR;
+    deltaL_ = static_cast<float>(deltaL);
+    deltaR_ = static_cast<float>(deltaR);
+    // 回転数（RPM×s）で移動量の大きい方の車輪を基準に計画
+    // （左右のカウント数が同じなら、カウントで計画するのと同じ時間になる）
+    distance_ = std::fmax(std::fabs(deltaL_) * countToRpmL_, std::fabs(deltaR_) * countToRpmR_);
+
+    if (distance_ > 0.0f) {
+        planTrapezoid(distance_, maxRpm, maxAccel, accelTime_, cruiseTime_, peakVelocity_);
+    } else {
+        accelTime_ = 0.0f;
+        cruiseTime_ = 0.0f;
+        peakVelocity_ = 0.0f;
+    }
+
+    elapsed_ = 0.0f;
+    settledTime_ = 0.0f;
+    active_ = true;
+    reached_ = false;
+    return true;
+}
+
+void PositionController::update(int32_t countL, int32_t countR, float dt, float& rpmL, float& rpmR) {
+    if (!active_) {
+        rpmL = 0.0f;
+        rpmR = 0.0f;
+        return;
+    }
+
+    elapsed_ += dt;
+
+    // 進捗率（0〜1）とその変化率を左右共通で使う
+    float progress = 1.0f;
+    float progressRate = 0.0f;
+    if (distance_ > 0.0f) {
+        float velocity;
+        float position = sampleTrapezoid(elapsed_, distance_, accelTime_, cruiseTime_,
+                                         peakVelocity_, velocity);
+        progress = position / distance_;
+        progressRate = velocity / distance_;
+    }
+
+    float errorL = deltaL_ * progress - relativeCount(countL, startL_);
+    float errorR = deltaR_ * progress - relativeCount(countR, startR_);
+
+    rpmL = (deltaL_ * progressRate + kp_ * errorL) * countToRpmL_;
+    rpmR = (deltaR_ * progressRate + kp_ * errorR) * countToRpmR_;
+
+    // プロファイル終了後、両輪が許容偏差内に留まったら到着
+    if (!reached_ && elapsed_ >= getDuration()) {
+        if (std::fabs(errorL) <= toleranceCounts_ && std::fabs(errorR) <= toleranceCounts_) {
+            settledTime_ += dt;
+            if (settledTime_ >= settleTime_) {
+                reached_ = true;
+            }
+        } else {
+            settledTime_ = 0.0f;
+        }
+    }
+}
+
+void PositionController::abort() {
+    active_ = false;
+    reached_ = false;
+}
+
+void PositionController::planTrapezoid(float distance, float maxVelocity, float maxAccel,
+                                       float& accelTime, float& cruiseTime, float& peakVelocity) {
+    if (!(maxAccel > 0.0f)) {
+        // 加減速なし（矩形速度）
+        accelTime = 0.0f;
+        peakVelocity = maxVelocity;
+        cruiseTime = distance / maxVelocity;
+        return;
+    }
+
+    float rampDistance = maxVelocity * maxVelocity / maxAccel;  // 加速＋減速の距離
+    if (distance >= rampDistance) {
+        peakVelocity = maxVelocity;
+        accelTime = maxVelocity / maxAccel;
+        cruiseTime = (distance - rampDistance) / maxVelocity;
+    } else {
+        // 最高速度に届かない: 三角形プロファイル
+        peakVelocity = std::sqrt(distance * maxAccel);
+        accelTime = peakVelocity / maxAccel;
+        cruiseTime = 0.0f;
+    }
+}
+
+float PositionController::sampleTrapezoid(float t, float distance, float accelTime, float cruiseTime,
+                                          float peakVelocity, float& velocity) {
+    float decelStart = accelTime + cruiseTime;
+    float endTime = decelStart + accelTime;
+
+    if (t <= 0.0f) {
+        velocity = 0.0f;
+        return 0.0f;
+    }
+    if (t >= endTime) {
+        velocity = 0.0f;
+        return distance;
+    }
+
+    float accel = (accelTime > 0.0f) ? peakVelocity / accelTime : 0.0f;
+    if (t < accelTime) {
+        velocity = accel * t;
+        return 0.5f * accel * t * t;
+    }
+    if (t < decelStart) {
+        velocity = peakVelocity;
+        return 0.5f * peakVelocity * accelTime + peakVelocity * (t - accelTime);
+    }
+    float remaining = endTime - t;
+    velocity = accel * remaining;
+    return distance - 0.5f * accel * remaining * remaining;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file PositionController.h
+ * @brief 左右ホイールの位置制御（台形プロファイル + 位置ループ）
+ *
+ * 「左 +N カウント、右 +M カウント」の相対移動指令に対し、
+ * 台形速度プロファイルで位置目標を生成し、位置ループの出力を
+ * 既存の速度PID（MotorController）への目標RPMとして渡すカスケード制御。
+ *
+ * 目標RPM = プロファイル速度（フィードフォワード）+ Kp × 位置偏差
+ *
+ * 移動量の大きい方の車輪でプロファイルを計画し、もう一方は同じ時間軸で
+ * 移動量の比率だけ縮めて追従させる。左右は常に同じ進捗率になるため、
+ * 直進（N=M）・その場旋回（N=-M）を含め、両輪が同時に到着する。
+ *
+ * プロファイル終了後、両輪の偏差が許容値以内で一定時間続いたら到着とし、
+ * 以降も位置ループで保持する。
+ */
+
+#ifndef POSITION_CONTROLLER_H
+#define POSITION_CONTROLLER_H
+
+#include <stdint.h>
+
+/**
+ * @class PositionController
+ * @brief 左右同期の相対位置制御
+ *
+ * 使用例（Core1、制御周期ごと）:
+ * @code
+ * PositionController position(4.0f, 1024, 10, 0.1f);
+ * position.start(encoderL.getCount(), encoderR.getCount(), 2048, 2048, 60.0f, 200.0f);
+ * // 制御周期ごと
+ * float rpmL, rpmR;
+ * position.update(encoderL.getCount(), encoderR.getCount(), 0.01f, rpmL, rpmR);
+ * motorController.setWheelRpm(rpmL, rpmR);
+ * @endcode
+ */
+class PositionController {
+public:
+    /**
+     * @brief コンストラクタ
+     * @param kp 位置ループゲイン [1/s]（偏差1回転あたり kp×60 RPM）
+     * @param countsPerRev モータ1回転あたりのエンコーダカウント
+     * @param toleranceCounts 到着判定の許容偏差 [カウント]
+     * @param settleTime 到着判定に必要な許容偏差内の継続時間 [s]
+     */
+    PositionController(float kp, uint16_t countsPerRev, int32_t toleranceCounts, float settleTime);
+
+    /**
+     * @brief 位置ループゲイン・カウント数を変更
+     */
+    void setParameters(float kp, uint16_t countsPerRev);
+
+    /**
+     * @brief 位置ループゲイン・カウント数を変更（左右でエンコーダが異なる場合）
+     */
+    void setParameters(float kp, uint16_t countsPerRevL, uint16_t countsPerRevR);
+
+    /**
+     * @brief 相対移動を開始
+     * @param startL 現在の左エンコーダ累積カウント
+     * @param startR 現在の右エンコーダ累積カウント
+     * @param deltaL 左の移動量 [カウント]
+     * @param deltaR 右の移動量 [カウント]
+     * @param maxRpm 移動量の大きい方の車輪の最高速度 [RPM]（正の値）
+     * @param maxAccel 最大加速度 [RPM/s]（0以下で加減速なしの矩形速度）
+     * @return 開始した場合true（maxRpmが0以下の場合false、状態は変更しない）
+     */
+    bool start(int32_t startL, int32_t startR, int32_t deltaL, int32_t deltaR,
+               float maxRpm, float maxAccel);
+
+    /**
+     * @brief 制御周期ごとの更新
+     *
+     * 動作中でない場合は出力を0にする。
+     * カウントのint32ラップアラウンドは差分計算で吸収する。
+     *
+     * @param countL 左エンコーダ累積カウント
+     * @param countR 右エンコーダ累積カウント
+     * @param dt 前回からの経過時間 [s]
+     * @param[out] rpmL 左の目標RPM
+     * @param[out] rpmR 右の目標RPM
+     */
+    void update(int32_t countL, int32_t countR, float dt, float& rpmL, float& rpmR);
+
+    /**
+     * @brief 位置制御を終了（速度指令・フェイルセーフ・異常停止時）
+     */
+    void abort();
+
+    // 位置制御中か（移動中・到着後の保持中）
+    bool isActive() const { return active_; }
+    // 移動中か（到着判定前）
+    bool isMoving() const { return active_ && !reached_; }
+    // 到着したか（次のstart()/abort()まで保持）
+    bool isReached() const { return active_ && reached_; }
+
+    // プロファイルの所要時間 [s]
+    float getDuration() const { return 2.0f * accelTime_ + cruiseTime_; }
+
+    /**
+     * @brief 台形速度プロファイルの計画（ハードウェア非依存、テスト可能）
+     *
+     * 最高速度に届かない距離では三角形プロファイルになる。
+     *
+     * @param distance 移動距離（正の値）
+     * @param maxVelocity 最高速度（正の値）
+     * @param maxAccel 最大加速度（0以下で加減速なし）
+     * @param[out] accelTime 加速（＝減速）時間
+     * @param[out] cruiseTime 等速時間
+     * @param[out] peakVelocity 到達する最高速度
+     */
+    static void planTrapezoid(float distance, float maxVelocity, float maxAccel,
+                              float& accelTime, float& cruiseTime, float& peakVelocity);
+
+    /**
+     * @brief 台形速度プロファイルの時刻tでの位置・速度（ハードウェア非依存、テスト可能）
+     * @param t 開始からの時間
+     * @param distance 移動距離
+     * @param accelTime 加速時間
+     * @param cruiseTime 等速時間
+     * @param peakVelocity 最高速度
+     * @param[out] velocity 速度
+     * @return 位置（0〜distance）
+     */
+    static float sampleTrapezoid(float t, float distance, float accelTime, float cruiseTime,
+                                 float peakVelocity, float& velocity);
+
+private:
+    float kp_;
+    float countToRpmL_;         // カウント/s → RPM
+    float countToRpmR_;
+    float toleranceCounts_;
+    float settleTime_;
+
+    int32_t startL_;
+    int32_t startR_;
+    float deltaL_;
+    float deltaR_;
+    float distance_;            // 移動量の大きい方 [回転×60]（RPM×s）
+    float accelTime_;
+    float cruiseTime_;
+    float peakVelocity_;        // [RPM]
+    float elapsed_;
+    float settledTime_;
+    bool active_;
+    bool reached_;
+};
+
+#endif // POSITION_CONTROLLER_H
@@ -47,12 +47,55 @@ bool isValidRequestType(uint8_t requestType) {
         case REQUEST_GET_CONFIG:
         case REQUEST_SET_CONFIG:
         case REQUEST_GET_DEBUG_OUTPUT:
+        case REQUEST_GET_ODOMETRY:
+        case REQUEST_RESET_ODOMETRY:
+        case REQUEST_MOTOR_POSITION:
+        case REQUEST_TRAJECTORY_UPLOAD:
+        case REQUEST_TRAJECTORY_START:
+        case REQUEST_TRAJECTORY_ABORT:
+        case REQUEST_GET_TRAJECTORY_STATUS:
+        case REQUEST_GET_TIMING:
             return true;
         default:
             return false;
     }
 }
 
+/**
+ * 結果コードのみのレスポンスを作成
+ */
+uint8_t createResultResponse(uint8_t responseType, uint8_t result, uint8_t* buffer, size_t bufferSize) {
+    constexpr uint8_t PAYLOAD_LENGTH = 1;
+    constexpr uint8_t PACKET_LENGTH = HEADER_SIZE + PAYLOAD_LENGTH;
+
+    if (bufferSize < PACKET_LENGTH) {
+        return 0;
+    }
+
+    uint8_t* payload = buffer + HEADER_SIZE;
+    payload[0] = result;
+
+    uint16_t checksum = calculateChecksum(payload, PAYLOAD_LENGTH);
+    writeHeader(buffer, responseType, PAYLOAD_LENGTH, checksum);
+
+    return PACKET_LENGTH;
+}
+
+/**
+ * 時間の集計をペイロードに書き込み
+ * @return 書き込んだバイト数
+ */
+size_t writeTimingSummary(const TimingSummaryData& data, uint8_t* payload) {
+    memcpy(payload, &data.count, 4);
+    memcpy(payload + 4, &data.minUs, 4);
+    memcpy(payload + 8, &data.maxUs, 4);
+    memcpy(payload + 12, &data.meanUs, 4);
+    memcpy(payload + 16, &data.bucketOriginUs, 4);
+    memcpy(payload + 20, &data.bucketWidthUs, 4);
+    memcpy(payload + 24, data.buckets, 4 * TIMING_BUCKET_COUNT);
+    return 24 + 4 * TIMING_BUCKET_COUNT;
+}
+
 }  // namespace
 
 // =============================================================================
@@ -93,14 +136,27 @@ ParseResult parseRequest(const uint8_t* packet, size_t packetLength, ParsedReque
     // リクエストタイプに応じてペイロードをパース
     switch (requestType) {
         case REQUEST_MOTOR_COMMAND:
+            // 8: 速度のみ / 10: +有効期間 / 12: +タイムスタンプ / 14: +タイムスタンプ+有効期間
+            result.motorCommand.timestampUs = 0;
+            result.motorCommand.hasTimestamp = false;
+            result.motorCommand.validityMs = 0;
             if (payloadLength >= 8) {
                 memcpy(&result.motorCommand.linearX, payload, 4);
                 memcpy(&result.motorCommand.angularZ, payload + 4, 4);
             }
+            if (payloadLength >= 12) {
+                memcpy(&result.motorCommand.timestampUs, payload + 8, 4);
+                result.motorCommand.hasTimestamp = true;
+                if (payloadLength >= 14) {
+                    memcpy(&result.motorCommand.validityMs, payload + 12, 2);
+                }
+            } else if (payloadLength >= 10) {
+                memcpy(&result.motorCommand.validityMs, payload + 8, 2);
+            }
             break;
 
         case REQUEST_SET_CONFIG:
-            if (payloadLength >= 30) {
+            if (payloadLength >= CONFIG_PAYLOAD_SIZE) {
                 memcpy(&result.setConfig.pidKp, payload, 4);
                 memcpy(&result.setConfig.pidKi, payload + 4, 4);
                 memcpy(&result.setConfig.pidKd, payload + 8, 4);
@@ -110,6 +166,89 @@ ParseResult parseRequest(const uint8_t* packet, size_t packetLength, ParsedReque
                 memcpy(&result.setConfig.wheelDiameter, payload + 22, 4);
                 memcpy(&result.setConfig.trackWidth, payload + 26, 4);
             }
+            if (payloadLength >= CONFIG_PAYLOAD_SIZE_PER_SIDE) {
+                memcpy(&result.setConfig.pidKpR, payload + 30, 4);
+                memcpy(&result.setConfig.pidKiR, payload + 34, 4);
+                memcpy(&result.setConfig.pidKdR, payload + 38, 4);
+                memcpy(&result.setConfig.encoderPprR, payload + 42, 2);
+                memcpy(&result.setConfig.gearRatioR, payload + 44, 4);
+                memcpy(&result.setConfig.wheelDiameterR, payload + 48, 4);
+                result.setConfig.hasPerSide = true;
+            } else {
+                // 30バイト版（従来）は左右共通
+                result.setConfig.pidKpR = result.setConfig.pidKp;
+                result.setConfig.pidKiR = result.setConfig.pidKi;
+                result.setConfig.pidKdR = result.setConfig.pidKd;
+                result.setConfig.encoderPprR = result.setConfig.encoderPpr;
+                result.setConfig.gearRatioR = result.setConfig.gearRatio;
+                result.setConfig.wheelDiameterR = result.setConfig.wheelDiameter;
+                result.setConfig.hasPerSide = false;
+            }
+            if (payloadLength >= CONFIG_PAYLOAD_SIZE_WITH_RATE) {
+                memcpy(&result.setConfig.controlRateHz, payload + 52, 2);
+                result.setConfig.hasControlRate = true;
+            } else {
+                // 制御周波数は変更しない
+                result.setConfig.controlRateHz = 0;
+                result.setConfig.hasControlRate = false;
+            }
+            break;
+
+        case REQUEST_RESET_ODOMETRY:
+            // ペイロード省略時は原点にリセット
+            result.resetOdometry.x = 0.0f;
+            result.resetOdometry.y = 0.0f;
+            result.resetOdometry.theta = 0.0f;
+            if (payloadLength >= 12) {
+                memcpy(&result.resetOdometry.x, payload, 4);
+                memcpy(&result.resetOdometry.y, payload + 4, 4);
+                memcpy(&result.resetOdometry.theta, payload + 8, 4);
+            }
+            break;
+
+        case REQUEST_MOTOR_POSITION:
+            // 速度・加速度の省略時（8バイト版）はデフォルト
+            result.motorPosition.deltaL = 0;
+            result.motorPosition.deltaR = 0;
+            result.motorPosition.maxRpm = 0.0f;
+            result.motorPosition.maxAccel = 0.0f;
+            if (payloadLength >= 8) {
+                memcpy(&result.motorPosition.deltaL, payload, 4);
+                memcpy(&result.motorPosition.deltaR, payload + 4, 4);
+            }
+            if (payloadLength >= 16) {
+                memcpy(&result.motorPosition.maxRpm, payload + 8, 4);
+                memcpy(&result.motorPosition.maxAccel, payload + 12, 4);
+            }
+            break;
+
+        case REQUEST_TRAJECTORY_UPLOAD:
+            // 宣言したセグメント数分のペイロードがなければエラー
+            if (payloadLength < 2) {
+                return PARSE_ERROR_SIZE;
+            }
+            result.trajectoryUpload.startIndex = payload[0];
+            result.trajectoryUpload.count = payload[1];
+            if (payload[1] > TRAJECTORY_SEGMENTS_PER_PACKET ||
+                payloadLength < 2 + payload[1] * TRAJECTORY_SEGMENT_SIZE) {
+                return PARSE_ERROR_SIZE;
+            }
+            for (uint8_t i = 0; i < payload[1]; i++) {
+                const uint8_t* segment = payload + 2 + i * TRAJECTORY_SEGMENT_SIZE;
+                TrajectorySegmentData& out = result.trajectoryUpload.segments[i];
+                memcpy(&out.durationMs, segment, 2);
+                out.mode = segment[2];
+                memcpy(&out.linearX, segment + 4, 4);
+                memcpy(&out.angularZ, segment + 8, 4);
+            }
+            break;
+
+        case REQUEST_TRAJECTORY_START:
+            result.trajectoryStart.queued = (payloadLength >= 1) && (payload[0] != 0);
+            break;
+
+        case REQUEST_GET_TIMING:
+            result.getTiming.reset = (payloadLength >= 1) && (payload[0] != 0);
             break;
 
         default:
@@ -168,7 +307,7 @@ uint8_t createVersionResponse(const VersionResponse& data, uint8_t* buffer, size
 }
 
 uint8_t createStatusResponse(const StatusResponse& data, uint8_t* buffer, size_t bufferSize) {
-    constexpr uint8_t PAYLOAD_LENGTH = 12;
+    constexpr uint8_t PAYLOAD_LENGTH = 16;
     constexpr uint8_t PACKET_LENGTH = HEADER_SIZE + PAYLOAD_LENGTH;
 
     if (bufferSize < PACKET_LENGTH) {
@@ -179,11 +318,11 @@ uint8_t createStatusResponse(const StatusResponse& data, uint8_t* buffer, size_t
     uint8_t* payload = buffer + HEADER_SIZE;
     memcpy(payload, &data.status, 2);
     payload[2] = data.errorCode;
-    payload[3] = 0;  // reserved
+    payload[3] = data.resetReason;
     memcpy(payload + 4, &data.commErrorCount, 2);
-    payload[6] = 0;  // reserved
-    payload[7] = 0;  // reserved
+    memcpy(payload + 6, &data.watchdogResetCount, 2);
     memcpy(payload + 8, &data.uptimeMs, 4);
+    memcpy(payload + 12, &data.firstTickUs, 4);
 
     // ヘッダ作成
     uint16_t checksum = calculateChecksum(payload, PAYLOAD_LENGTH);
@@ -193,7 +332,7 @@ uint8_t createStatusResponse(const StatusResponse& data, uint8_t* buffer, size_t
 }
 
 uint8_t createConfigResponse(const ConfigData& data, uint8_t* buffer, size_t bufferSize) {
-    constexpr uint8_t PAYLOAD_LENGTH = 30;
+    constexpr uint8_t PAYLOAD_LENGTH = CONFIG_PAYLOAD_SIZE_WITH_RATE;
     constexpr uint8_t PACKET_LENGTH = HEADER_SIZE + PAYLOAD_LENGTH;
 
     if (bufferSize < PACKET_LENGTH) {
@@ -210,6 +349,13 @@ uint8_t createConfigResponse(const ConfigData& data, uint8_t* buffer, size_t buf
     memcpy(payload + 18, &data.gearRatio, 4);
     memcpy(payload + 22, &data.wheelDiameter, 4);
     memcpy(payload + 26, &data.trackWidth, 4);
+    memcpy(payload + 30, &data.pidKpR, 4);
+    memcpy(payload + 34, &data.pidKiR, 4);
+    memcpy(payload + 38, &data.pidKdR, 4);
+    memcpy(payload + 42, &data.encoderPprR, 2);
+    memcpy(payload + 44, &data.gearRatioR, 4);
+    memcpy(payload + 48, &data.wheelDiameterR, 4);
+    memcpy(payload + 52, &data.controlRateHz, 2);
 
     // ヘッダ作成
     uint16_t checksum = calculateChecksum(payload, PAYLOAD_LENGTH);
@@ -219,7 +365,7 @@ uint8_t createConfigResponse(const ConfigData& data, uint8_t* buffer, size_t buf
 }
 
 uint8_t createDebugOutputResponse(const DebugOutputResponse& data, uint8_t* buffer, size_t bufferSize) {
-    constexpr uint8_t PAYLOAD_LENGTH = 32;
+    constexpr uint8_t PAYLOAD_LENGTH = 48;
     constexpr uint8_t PACKET_LENGTH = HEADER_SIZE + PAYLOAD_LENGTH;
 
     if (bufferSize < PACKET_LENGTH) {
@@ -236,6 +382,10 @@ uint8_t createDebugOutputResponse(const DebugOutputResponse& data, uint8_t* buff
     memcpy(payload + 20, &data.currentRpmR, 4);
     memcpy(payload + 24, &data.pwmDutyL, 4);
     memcpy(payload + 28, &data.pwmDutyR, 4);
+    memcpy(payload + 32, &data.currentRmsL, 4);
+    memcpy(payload + 36, &data.currentRmsR, 4);
+    memcpy(payload + 40, &data.currentPeakL, 4);
+    memcpy(payload + 44, &data.currentPeakR, 4);
 
     // ヘッダ作成
     uint16_t checksum = calculateChecksum(payload, PAYLOAD_LENGTH);
@@ -244,8 +394,45 @@ uint8_t createDebugOutputResponse(const DebugOutputResponse& data, uint8_t* buff
     return PACKET_LENGTH;
 }
 
-uint8_t createSetConfigResponse(uint8_t result, uint8_t* buffer, size_t bufferSize) {
-    constexpr uint8_t PAYLOAD_LENGTH = 1;
+uint8_t createOdometryResponse(const OdometryResponse& data, uint8_t* buffer, size_t bufferSize) {
+    constexpr uint8_t PAYLOAD_LENGTH = 24;
+    constexpr uint8_t PACKET_LENGTH = HEADER_SIZE + PAYLOAD_LENGTH;
+
+    if (bufferSize < PACKET_LENGTH) {
+        return 0;
+    }
+
+    // ペイロード作成
+    uint8_t* payload = buffer + HEADER_SIZE;
+    memcpy(payload, &data.x, 4);
+    memcpy(payload + 4, &data.y, 4);
+    memcpy(payload + 8, &data.theta, 4);
+    memcpy(payload + 12, &data.linearX, 4);
+    memcpy(payload + 16, &data.angularZ, 4);
+    memcpy(payload + 20, &data.timestampUs, 4);
+
+    // ヘッダ作成
+    uint16_t checksum = calculateChecksum(payload, PAYLOAD_LENGTH);
+    writeHeader(buffer, REQUEST_GET_ODOMETRY, PAYLOAD_LENGTH, checksum);
+
+    return PACKET_LENGTH;
+}
+
+uint8_t createOdometryResultResponse(uint8_t result, uint8_t* buffer, size_t bufferSize) {
+    return createResultResponse(REQUEST_GET_ODOMETRY, result, buffer, bufferSize);
+}
+
+uint8_t createResetOdometryResponse(uint8_t result, uint8_t* buffer, size_t bufferSize) {
+    return createResultResponse(REQUEST_RESET_ODOMETRY, result, buffer, bufferSize);
+}
+
+uint8_t createMotorPositionResponse(uint8_t result, uint8_t* buffer, size_t bufferSize) {
+    return createResultResponse(REQUEST_MOTOR_POSITION, result, buffer, bufferSize);
+}
+
+uint8_t createTrajectoryUploadResponse(uint8_t result, uint8_t loadedCount,
+                                       uint8_t* buffer, size_t bufferSize) {
+    constexpr uint8_t PAYLOAD_LENGTH = 2;
     constexpr uint8_t PACKET_LENGTH = HEADER_SIZE + PAYLOAD_LENGTH;
 
     if (bufferSize < PACKET_LENGTH) {
@@ -255,12 +442,87 @@ uint8_t createSetConfigResponse(uint8_t result, uint8_t* buffer, size_t bufferSi
     // ペイロード作成
     uint8_t* payload = buffer + HEADER_SIZE;
     payload[0] = result;
+    payload[1] = loadedCount;
 
     // ヘッダ作成
     uint16_t checksum = calculateChecksum(payload, PAYLOAD_LENGTH);
-    writeHeader(buffer, REQUEST_SET_CONFIG, PAYLOAD_LENGTH, checksum);
+    writeHeader(buffer, REQUEST_TRAJECTORY_UPLOAD, PAYLOAD_LENGTH, checksum);
 
     return PACKET_LENGTH;
 }
 
+uint8_t createTrajectoryStartResponse(uint8_t result, uint8_t* buffer, size_t bufferSize) {
+    return createResultResponse(REQUEST_TRAJECTORY_START, result, buffer, bufferSize);
+}
+
+uint8_t createTrajectoryAbortResponse(uint8_t result, uint8_t* buffer, size_t bufferSize) {
+    return createResultResponse(REQUEST_TRAJECTORY_ABORT, result, buffer, bufferSize);
+}
+
+uint8_t createTrajectoryStatusResponse(const TrajectoryStatusResponse& data,
+                                       uint8_t* buffer, size_t bufferSize) {
+    constexpr uint8_t PAYLOAD_LENGTH = 12;
+    constexpr uint8_t PACKET_LENGTH = HEADER_SIZE + PAYLOAD_LENGTH;
+
+    if (bufferSize < PACKET_LENGTH) {
+        return 0;
+    }
+
+    // ペイロード作成
+    uint8_t* payload = buffer + HEADER_SIZE;
+    payload[0] = data.state;
+    payload[1] = data.segmentIndex;
+    payload[2] = data.loadedCount;
+    payload[3] = data.queued;
+    memcpy(payload + 4, &data.elapsedMs, 4);
+    memcpy(payload + 8, &data.durationMs, 4);
+
+    // ヘッダ作成
+    uint16_t checksum = calculateChecksum(payload, PAYLOAD_LENGTH);
+    writeHeader(buffer, REQUEST_GET_TRAJECTORY_STATUS, PAYLOAD_LENGTH, checksum);
+
+    return PACKET_LENGTH;
+}
+
+uint8_t createTimingResponse(const TimingResponse& data, uint8_t* buffer, size_t bufferSize) {
+    constexpr uint8_t SUMMARY_LENGTH = 24 + 4 * TIMING_BUCKET_COUNT;
+    constexpr uint8_t PAYLOAD_LENGTH = 12 + 2 * SUMMARY_LENGTH + 8 + 20;
+    constexpr uint8_t PACKET_LENGTH = HEADER_SIZE + PAYLOAD_LENGTH;
+
+    if (bufferSize < PACKET_LENGTH) {
+        return 0;
+    }
+
+    // ペイロード作成
+    uint8_t* payload = buffer + HEADER_SIZE;
+    memcpy(payload, &data.nominalPeriodUs, 4);
+    memcpy(payload + 4, &data.overrunCount, 4);
+    memcpy(payload + 8, &data.missedTicks, 4);
+    size_t offset = 12;
+    offset += writeTimingSummary(data.period, payload + offset);
+    offset += writeTimingSummary(data.execution, payload + offset);
+    memcpy(payload + offset, &data.xipAccessCount, 4);
+    memcpy(payload + offset + 4, &data.xipHitCount, 4);
+    offset += 8;
+    memcpy(payload + offset, &data.commandLatencyCount, 4);
+    memcpy(payload + offset + 4, &data.commandLatencyMinUs, 4);
+    memcpy(payload + offset + 8, &data.commandLatencyMaxUs, 4);
+    memcpy(payload + offset + 12, &data.commandLatencyMeanUs, 4);
+    memcpy(payload + offset + 16, &data.outOfCycleCount, 4);
+
+    // ヘッダ作成
+    uint16_t checksum = calculateChecksum(payload, PAYLOAD_LENGTH);
+    writeHeader(buffer, REQUEST_GET_TIMING, PAYLOAD_LENGTH, checksum);
+
+    return PACKET_LENGTH;
+}
+
+uint8_t createTimingResultResponse(uint8_t result, uint8_t* buffer, size_t bufferSize) {
+    return createResultResponse(REQUEST_GET_TIMING, result, buffer, bufferSize);
+}
+
+uint8_t createSetConfigResponse(uint8_t result, uint8_t* buffer, size_t bufferSize) {
+    return createResultResponse(REQUEST_SET_CONFIG, result, buffer, bufferSize);
+}
+
 }  // namespace Protocol
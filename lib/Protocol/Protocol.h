@@ -25,6 +25,14 @@ constexpr uint8_t REQUEST_GET_STATUS = 0x02;
 constexpr uint8_t REQUEST_GET_CONFIG = 0x03;
 constexpr uint8_t REQUEST_SET_CONFIG = 0x04;
 constexpr uint8_t REQUEST_GET_DEBUG_OUTPUT = 0x05;
+constexpr uint8_t REQUEST_GET_ODOMETRY = 0x06;
+constexpr uint8_t REQUEST_RESET_ODOMETRY = 0x07;
+constexpr uint8_t REQUEST_MOTOR_POSITION = 0x08;
+constexpr uint8_t REQUEST_TRAJECTORY_UPLOAD = 0x09;
+constexpr uint8_t REQUEST_TRAJECTORY_START = 0x0A;
+constexpr uint8_t REQUEST_TRAJECTORY_ABORT = 0x0B;
+constexpr uint8_t REQUEST_GET_TRAJECTORY_STATUS = 0x0C;
+constexpr uint8_t REQUEST_GET_TIMING = 0x0D;
 
 // ヘッダオフセット
 constexpr uint8_t HEADER_REQUEST_TYPE = 0;
@@ -44,6 +52,9 @@ constexpr uint16_t STATUS_FLASH_ERROR = (1 << 6);
 constexpr uint16_t STATUS_OVERTEMP = (1 << 7);
 constexpr uint16_t STATUS_OVERCURRENT = (1 << 8);
 constexpr uint16_t STATUS_LOW_VOLTAGE = (1 << 9);
+constexpr uint16_t STATUS_POSITION_ACTIVE = (1 << 10);   // 位置制御で移動中
+constexpr uint16_t STATUS_POSITION_REACHED = (1 << 11);  // 位置制御の目標に到着（保持中）
+constexpr uint16_t STATUS_TRAJECTORY_ACTIVE = (1 << 12); // 軌道を実行中
 constexpr uint16_t STATUS_CONFIG_MODE = (1 << 15);
 
 // エラーコード
@@ -52,6 +63,7 @@ constexpr uint8_t ERROR_CHECKSUM = 0x01;
 constexpr uint8_t ERROR_INVALID_COMMAND = 0x02;
 constexpr uint8_t ERROR_PAYLOAD = 0x03;
 constexpr uint8_t ERROR_ENCODER_TIMEOUT = 0x10;
+constexpr uint8_t ERROR_MOTOR_STALL = 0x11;
 constexpr uint8_t ERROR_FLASH = 0x20;
 
 // SET_CONFIG結果
@@ -59,6 +71,33 @@ constexpr uint8_t CONFIG_RESULT_SUCCESS = 0x00;
 constexpr uint8_t CONFIG_RESULT_FLASH_ERROR = 0x01;
 constexpr uint8_t CONFIG_RESULT_INVALID_VALUE = 0x02;
 
+// SET_CONFIG / GET_CONFIGのペイロード長 [バイト]（左右共通 / 左右別 / 制御周波数付き）
+constexpr uint8_t CONFIG_PAYLOAD_SIZE = 30;
+constexpr uint8_t CONFIG_PAYLOAD_SIZE_PER_SIDE = 52;
+constexpr uint8_t CONFIG_PAYLOAD_SIZE_WITH_RATE = 54;
+
+// MOTOR_POSITION結果
+constexpr uint8_t POSITION_RESULT_ACCEPTED = 0x00;
+constexpr uint8_t POSITION_RESULT_INVALID_VALUE = 0x01;
+
+// TRAJECTORY_UPLOAD / TRAJECTORY_START / TRAJECTORY_ABORT結果
+constexpr uint8_t TRAJECTORY_RESULT_ACCEPTED = 0x00;
+constexpr uint8_t TRAJECTORY_RESULT_INVALID_VALUE = 0x01;
+constexpr uint8_t TRAJECTORY_RESULT_BUSY = 0x02;         // 開始待ちの軌道があり、アップロード先が使用中
+
+// TRAJECTORY_UPLOADの1パケットあたりのセグメント数・セグメントサイズ [バイト]
+constexpr uint8_t TRAJECTORY_SEGMENTS_PER_PACKET = 16;
+constexpr uint8_t TRAJECTORY_SEGMENT_SIZE = 12;
+
+// GET_TIMINGのヒストグラムのビン数
+constexpr uint8_t TIMING_BUCKET_COUNT = 16;
+
+// GET_ODOMETRY結果（姿勢を読み出せなかった場合のみ結果コードだけを返す）
+constexpr uint8_t ODOMETRY_RESULT_BUSY = 0x01;      // Core1の更新と競合、再要求すること
+
+// GET_TIMING結果（集計を読み出せなかった場合のみ結果コードだけを返す）
+constexpr uint8_t TIMING_RESULT_BUSY = 0x01;        // Core1の更新と競合、再要求すること
+
 // =============================================================================
 // データ構造体
 // =============================================================================
@@ -67,6 +106,9 @@ constexpr uint8_t CONFIG_RESULT_INVALID_VALUE = 0x02;
 struct MotorCommandRequest {
     float linearX;
     float angularZ;
+    uint32_t timestampUs;  // ホスト側の指令時刻 [us]（hasTimestamp時のみ有効）
+    bool hasTimestamp;     // 12/14バイト版（タイムスタンプ付き）ならtrue
+    uint16_t validityMs;   // 指令の有効期間 [ms]（10/14バイト版のみ、0はデフォルト）
 };
 
 // MOTOR_COMMANDレスポンスのペイロード
@@ -87,11 +129,17 @@ struct VersionResponse {
 struct StatusResponse {
     uint16_t status;
     uint8_t errorCode;
+    uint8_t resetReason;          // 起動の理由（CoreWatchdog::ResetReason）
     uint16_t commErrorCount;
+    uint16_t watchdogResetCount;  // 電源投入からのウォッチドッグによるリセット回数
     uint32_t uptimeMs;
+    uint32_t firstTickUs;         // 起動から最初の制御周期の完了まで [us]（0は未完了）
 };
 
 // GET_CONFIG / SET_CONFIG共通データ
+// 先頭30バイト分（pidKp〜trackWidth）は左右共通の設定、左右別の場合は左側の値。
+// 右側の値は52バイト版で送る（30バイト版のSET_CONFIGでは左と同じ値になる）。
+// 制御周波数は54バイト版で送る（それより短いSET_CONFIGでは変更しない）。
 struct ConfigData {
     float pidKp;
     float pidKi;
@@ -101,6 +149,15 @@ struct ConfigData {
     float gearRatio;
     float wheelDiameter;
     float trackWidth;
+    float pidKpR;          // 右側（52バイト版）
+    float pidKiR;
+    float pidKdR;
+    uint16_t encoderPprR;
+    float gearRatioR;
+    float wheelDiameterR;
+    bool hasPerSide;       // 52バイト版（左右別）ならtrue
+    uint16_t controlRateHz;  // 速度PIDの制御周波数 [Hz]（54バイト版、省略時0）
+    bool hasControlRate;     // 54バイト版ならtrue
 };
 
 // GET_DEBUG_OUTPUTレスポンスのペイロード
@@ -113,6 +170,97 @@ struct DebugOutputResponse {
     float currentRpmR;
     float pwmDutyL;
     float pwmDutyR;
+    float currentRmsL;   // モータ電流RMS [A]（直近の集計窓）
+    float currentRmsR;
+    float currentPeakL;  // モータ電流ピーク [A]（絶対値）
+    float currentPeakR;
+};
+
+// GET_ODOMETRYレスポンスのペイロード
+struct OdometryResponse {
+    float x;              // X座標 [m]（リセット時の位置・向きを原点とする）
+    float y;              // Y座標 [m]
+    float theta;          // 方位 [rad]（-π〜π、正で左旋回）
+    float linearX;        // 並進速度 [m/s]（直近の制御周期）
+    float angularZ;       // 回転速度 [rad/s]
+    uint32_t timestampUs; // 姿勢を積算した制御周期の時刻 [us]（Pico起動からの経過）
+};
+
+// RESET_ODOMETRYリクエストのペイロード（省略時は原点）
+struct ResetOdometryRequest {
+    float x;
+    float y;
+    float theta;
+};
+
+// MOTOR_POSITIONリクエストのペイロード
+struct MotorPositionRequest {
+    int32_t deltaL;    // 左の相対移動量 [カウント]
+    int32_t deltaR;    // 右の相対移動量 [カウント]
+    float maxRpm;      // 最高速度 [RPM]（0または省略時はデフォルト）
+    float maxAccel;    // 最大加速度 [RPM/s]（0または省略時はデフォルト）
+};
+
+// 軌道セグメント（TRAJECTORY_UPLOAD）
+struct TrajectorySegmentData {
+    uint16_t durationMs;  // 継続時間 [ms]
+    uint8_t mode;         // 0=STEP（保持）, 1=RAMP（直前の値から線形に変化）
+    float linearX;        // 並進速度 [m/s]
+    float angularZ;       // 回転速度 [rad/s]
+};
+
+// TRAJECTORY_UPLOADリクエストのペイロード
+struct TrajectoryUploadRequest {
+    uint8_t startIndex;   // 書き込み先頭のセグメント番号（0でアップロード先をクリアしてから書き込み）
+    uint8_t count;        // セグメント数（0〜TRAJECTORY_SEGMENTS_PER_PACKET）
+    TrajectorySegmentData segments[TRAJECTORY_SEGMENTS_PER_PACKET];
+};
+
+// TRAJECTORY_STARTリクエストのペイロード（省略時は即時）
+struct TrajectoryStartRequest {
+    bool queued;          // trueなら実行中の軌道の完了後に連結して開始
+};
+
+// GET_TRAJECTORY_STATUSレスポンスのペイロード
+struct TrajectoryStatusResponse {
+    uint8_t state;          // 0=未実行, 1=実行中, 2=完了, 3=中断
+    uint8_t segmentIndex;   // 実行中のセグメント番号
+    uint8_t loadedCount;    // アップロード先のセグメント数
+    uint8_t queued;         // 開始待ちの軌道があれば1
+    uint32_t elapsedMs;     // 実行中の軌道の経過時間 [ms]
+    uint32_t durationMs;    // 実行中の軌道の合計時間 [ms]
+};
+
+// GET_TIMINGリクエストのペイロード（省略時はリセットなし）
+struct GetTimingRequest {
+    bool reset;             // trueなら応答後に集計をクリア
+};
+
+// 時間 [us] の集計（GET_TIMING）
+struct TimingSummaryData {
+    uint32_t count;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint32_t meanUs;
+    uint32_t bucketOriginUs;   // 先頭ビンの下限（範囲外は両端のビンに含む）
+    uint32_t bucketWidthUs;
+    uint32_t buckets[TIMING_BUCKET_COUNT];
+};
+
+// GET_TIMINGレスポンスのペイロード
+struct TimingResponse {
+    uint32_t nominalPeriodUs;    // 公称の制御周期 [us]
+    uint32_t overrunCount;       // 処理時間が公称周期を超えた回数
+    uint32_t missedTicks;        // 取りこぼした制御周期の回数
+    TimingSummaryData period;    // 実際の周期（前回の開始からの間隔）
+    TimingSummaryData execution; // 処理時間
+    uint32_t xipAccessCount;     // 制御周期の処理中のXIPキャッシュアクセス回数（両コア合計）
+    uint32_t xipHitCount;        // 同ヒット回数（ミス = アクセス - ヒット）
+    uint32_t commandLatencyCount;   // MOTOR_COMMAND受信からPWM更新までの遅延の記録数
+    uint32_t commandLatencyMinUs;
+    uint32_t commandLatencyMaxUs;
+    uint32_t commandLatencyMeanUs;
+    uint32_t outOfCycleCount;    // 周期の途中で指令を適用した回数
 };
 
 // =============================================================================
@@ -135,6 +283,11 @@ struct ParsedRequest {
     union {
         MotorCommandRequest motorCommand;
         ConfigData setConfig;
+        ResetOdometryRequest resetOdometry;
+        MotorPositionRequest motorPosition;
+        TrajectoryUploadRequest trajectoryUpload;
+        TrajectoryStartRequest trajectoryStart;
+        GetTimingRequest getTiming;
     };
 };
 
@@ -179,7 +332,7 @@ uint8_t createVersionResponse(const VersionResponse& data, uint8_t* buffer, size
 uint8_t createStatusResponse(const StatusResponse& data, uint8_t* buffer, size_t bufferSize);
 
 /**
- * GET_CONFIGレスポンス作成
+ * GET_CONFIGレスポンス作成（制御周波数付きの54バイト版、先頭52バイトは従来と同じ配置）
  */
 uint8_t createConfigResponse(const ConfigData& data, uint8_t* buffer, size_t bufferSize);
 
@@ -188,6 +341,66 @@ uint8_t createConfigResponse(const ConfigData& data, uint8_t* buffer, size_t buf
  */
 uint8_t createDebugOutputResponse(const DebugOutputResponse& data, uint8_t* buffer, size_t bufferSize);
 
+/**
+ * GET_ODOMETRYレスポンス作成
+ */
+uint8_t createOdometryResponse(const OdometryResponse& data, uint8_t* buffer, size_t bufferSize);
+
+/**
+ * GET_ODOMETRYの結果コードのみのレスポンス作成（姿勢を読み出せなかった場合）
+ * @param result 結果コード（ODOMETRY_RESULT_*）
+ */
+uint8_t createOdometryResultResponse(uint8_t result, uint8_t* buffer, size_t bufferSize);
+
+/**
+ * RESET_ODOMETRYレスポンス作成
+ * @param result 結果コード（0x00=成功）
+ */
+uint8_t createResetOdometryResponse(uint8_t result, uint8_t* buffer, size_t bufferSize);
+
+/**
+ * MOTOR_POSITIONレスポンス作成
+ * @param result 結果コード（POSITION_RESULT_*）
+ */
+uint8_t createMotorPositionResponse(uint8_t result, uint8_t* buffer, size_t bufferSize);
+
+/**
+ * TRAJECTORY_UPLOADレスポンス作成
+ * @param result 結果コード（TRAJECTORY_RESULT_*）
+ * @param loadedCount アップロード先のセグメント数
+ */
+uint8_t createTrajectoryUploadResponse(uint8_t result, uint8_t loadedCount,
+                                       uint8_t* buffer, size_t bufferSize);
+
+/**
+ * TRAJECTORY_STARTレスポンス作成
+ * @param result 結果コード（TRAJECTORY_RESULT_*）
+ */
+uint8_t createTrajectoryStartResponse(uint8_t result, uint8_t* buffer, size_t bufferSize);
+
+/**
+ * TRAJECTORY_ABORTレスポンス作成
+ * @param result 結果コード（TRAJECTORY_RESULT_*）
+ */
+uint8_t createTrajectoryAbortResponse(uint8_t result, uint8_t* buffer, size_t bufferSize);
+
+/**
+ * GET_TRAJECTORY_STATUSレスポンス作成
+ */
+uint8_t createTrajectoryStatusResponse(const TrajectoryStatusResponse& data,
+                                       uint8_t* buffer, size_t bufferSize);
+
+/**
+ * GET_TIMINGレスポンス作成
+ */
+uint8_t createTimingResponse(const TimingResponse& data, uint8_t* buffer, size_t bufferSize);
+
+/**
+ * GET_TIMINGの結果コードのみのレスポンス作成（集計を読み出せなかった場合）
+ * @param result 結果コード（TIMING_RESULT_*）
+ */
+uint8_t createTimingResultResponse(uint8_t result, uint8_t* buffer, size_t bufferSize);
+
 /**
  * SET_CONFIGレスポンス作成
  * @param result 結果コード（CONFIG_RESULT_*）
@@ -0,0 +1,117 @@
+/**
+ * @file PwmPhase.cpp
+ * @brief 左右モータPWMの位相オフセット 実装
+ */
+
+#include "PwmPhase.h"
+#include <math.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "hardware/pwm.h"
+#endif
+
+// =============================================================================
+// 実機設定
+// =============================================================================
+
+void PwmPhase::apply(uint8_t pinL, uint8_t pinR, float phaseDegrees) {
+#ifdef ARDUINO
+    const uint sliceL = pwm_gpio_to_slice_num(pinL);
+    const uint sliceR = pwm_gpio_to_slice_num(pinR);
+    if (sliceL == sliceR) {
+        return;
+    }
+
+    const uint16_t top = static_cast<uint16_t>(pwm_hw->slice[sliceR].top);
+    const bool phaseCorrect = (pwm_hw->slice[sliceR].csr & PWM_CH0_CSR_PH_CORRECT_BITS) != 0;
+
+    // 停止してカウンタを設定し、同じクロックで同時に起動
+    pwm_set_enabled(sliceL, false);
+    pwm_set_enabled(sliceR, false);
+    pwm_set_counter(sliceL, 0);
+    pwm_set_counter(sliceR, counterOffset(top, phaseCorrect, phaseDegrees));
+    pwm_set_mask_enabled(pwm_hw->en | (1u << sliceL) | (1u << sliceR));
+#else
+    (void)pinL;
+    (void)pinR;
+    (void)phaseDegrees;
+#endif
+}
+
+// =============================================================================
+// 静的ユーティリティ関数
+// =============================================================================
+
+uint32_t PwmPhase::periodTicks(uint16_t top, bool phaseCorrect) {
+    // エッジアライン: 0〜TOP（TOP+1ステップ）、位相補正: 0→TOP→0（各値2回、2×(TOP+1)ステップ）
+    uint32_t ticks = static_cast<uint32_t>(top) + 1u;
+    return phaseCorrect ? 2u * ticks : ticks;
+}
+
+uint16_t PwmPhase::counterOffset(uint16_t top, bool phaseCorrect, float phaseDegrees) {
+    float phase = fmodf(phaseDegrees, 360.0f);
+    if (phase < 0.0f) {
+        phase += 360.0f;
+    }
+
+    if (phaseCorrect) {
+        // 上昇中のカウンタしか設定できないため0〜180°に折り返す
+        if (phase > 180.0f) {
+            phase = 360.0f - phase;
+        }
+        return static_cast<uint16_t>(phase / 180.0f * top + 0.5f);
+    }
+
+    uint32_t ticks = periodTicks(top, false);
+    uint32_t offset = static_cast<uint32_t>(phase / 360.0f * ticks + 0.5f);
+    return static_cast<uint16_t>(offset % ticks);
+}
+
+bool PwmPhase::isOutputHigh(uint32_t tick, uint16_t top, bool phaseCorrect, uint16_t level) {
+    uint32_t ticks = periodTicks(top, phaseCorrect);
+    uint32_t position = tick % ticks;
+
+    uint32_t counter = position;
+    if (phaseCorrect && position > top) {
+        // 下降区間（TOP, TOP-1, ..., 0）
+        counter = 2u * top + 1u - position;
+    }
+    return counter < level;
+}
+
+PwmPhase::BusCurrent PwmPhase::simulateBusCurrent(uint16_t top, bool phaseCorrect,
+                                                  float dutyL, float dutyR,
+                                                  float currentL, float currentR,
+                                                  float phaseDegrees) {
+    uint32_t ticks = periodTicks(top, phaseCorrect);
+    uint32_t levelMax = static_cast<uint32_t>(top) + 1u;
+    uint16_t levelL = static_cast<uint16_t>(dutyL * levelMax + 0.5f);
+    uint16_t levelR = static_cast<uint16_t>(dutyR * levelMax + 0.5f);
+    uint16_t offsetR = counterOffset(top, phaseCorrect, phaseDegrees);
+
+    float sum = 0.0f;
+    float sumSq = 0.0f;
+    float peak = 0.0f;
+    for (uint32_t t = 0; t < ticks; t++) {
+        float bus = 0.0f;
+        if (isOutputHigh(t, top, phaseCorrect, levelL)) {
+            bus += currentL;
+        }
+        if (isOutputHigh(t + offsetR, top, phaseCorrect, levelR)) {
+            bus += currentR;
+        }
+        sum += bus;
+        sumSq += bus * bus;
+        if (bus > peak) {
+            peak = bus;
+        }
+    }
+
+    BusCurrent result;
+    result.mean = sum / ticks;
+    float variance = sumSq / ticks - result.mean * result.mean;
+    result.ripple = variance > 0.0f ? sqrtf(variance) : 0.0f;
+    result.peak = peak;
+    return result;
+}
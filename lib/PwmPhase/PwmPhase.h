@@ -0,0 +1,99 @@
+/**
+ * @file PwmPhase.h
+ * @brief 左右モータPWMの位相オフセット
+ *
+ * 左右のPWMが同じタイミングでONになると、バス電流（入力コンデンサのリップル電流）が
+ * 2モータ分まとめて流れる。右モータのPWMスライスのカウンタ初期値をずらして
+ * 同時に起動し、ON期間を重ならないようにする（180°で最大効果）。
+ *
+ * RP2040のPWMスライスは位相レジスタを持たないため、両スライスを停止して
+ * カウンタ値を設定し、ENレジスタで同時に起動する。
+ * 位相補正モード（センターアライン）ではカウンタ初期値が0〜TOP（上昇中）のため
+ * 設定できる位相は0〜180°（180°はカウンタ=TOPで、半周期より1カウント短い）。
+ * 180°を超える指定は360°-φ（進み/遅れの入れ替え）となり、バス電流波形は同じになる。
+ */
+
+#ifndef PWM_PHASE_H
+#define PWM_PHASE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @class PwmPhase
+ * @brief PWMスライス間の位相設定とバス電流波形の計算
+ *
+ * 使用例（Core1、PWM・CurrentSampler設定後）:
+ * @code
+ * PwmPhase::apply(MOTOR_L_PWM, MOTOR_R_PWM, 180.0f);
+ * @endcode
+ */
+class PwmPhase {
+public:
+    /**
+     * @brief バス電流波形の統計値
+     */
+    struct BusCurrent {
+        float mean;    // 平均電流 [A]
+        float ripple;  // リップル電流（交流分のRMS）[A]
+        float peak;    // ピーク電流 [A]
+    };
+
+    /**
+     * @brief 右スライスの位相を左スライス基準でずらして同時起動（実機のみ）
+     * @param pinL 左モータPWMピン（基準スライス）
+     * @param pinR 右モータPWMピン（同一スライスの場合は何もしない）
+     * @param phaseDegrees 位相オフセット [deg]
+     */
+    static void apply(uint8_t pinL, uint8_t pinR, float phaseDegrees);
+
+    // =========================================================================
+    // 静的ユーティリティ関数（テスト可能なロジック部分）
+    // =========================================================================
+
+    /**
+     * @brief 位相オフセットに対応するカウンタ初期値を計算
+     * @param top PWMカウンタのTOP値
+     * @param phaseCorrect 位相補正モード（カウンタ周期 2×(TOP+1)）か
+     * @param phaseDegrees 位相オフセット [deg]（範囲外は0〜360に正規化）
+     * @return カウンタ初期値（0〜TOP）
+     */
+    static uint16_t counterOffset(uint16_t top, bool phaseCorrect, float phaseDegrees);
+
+    /**
+     * @brief PWM出力がONか（カウンタ位置から判定）
+     * @param tick 周期内の位置（0〜周期-1、カウンタ初期値を含む）
+     * @param top PWMカウンタのTOP値
+     * @param phaseCorrect 位相補正モードか
+     * @param level 比較値（カウンタ < levelでON）
+     * @return ON=true
+     */
+    static bool isOutputHigh(uint32_t tick, uint16_t top, bool phaseCorrect, uint16_t level);
+
+    /**
+     * @brief 左右モータのバス電流波形を1PWM周期分計算
+     *
+     * 各モータの電流はPWM周期内で一定（インダクタンス大）とし、
+     * ON期間だけバスから電流が流れるものとする。
+     *
+     * @param top PWMカウンタのTOP値
+     * @param phaseCorrect 位相補正モードか
+     * @param dutyL 左デューティ（0.0〜1.0）
+     * @param dutyR 右デューティ（0.0〜1.0）
+     * @param currentL 左モータ電流 [A]
+     * @param currentR 右モータ電流 [A]
+     * @param phaseDegrees 右の位相オフセット [deg]
+     * @return バス電流の平均・リップル・ピーク
+     */
+    static BusCurrent simulateBusCurrent(uint16_t top, bool phaseCorrect,
+                                         float dutyL, float dutyR,
+                                         float currentL, float currentR,
+                                         float phaseDegrees);
+
+    /**
+     * @brief 1周期のカウンタステップ数
+     */
+    static uint32_t periodTicks(uint16_t top, bool phaseCorrect);
+};
+
+#endif // PWM_PHASE_H
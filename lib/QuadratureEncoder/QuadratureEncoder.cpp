@@ -5,6 +5,7 @@
  */
 
 #include "QuadratureEncoder.h"
+#include "RamFunc.h"
 
 QuadratureEncoder::QuadratureEncoder(uint8_t pinA, uint8_t pinB, uint16_t ppr)
     : pinA_(pinA), pinB_(pinB), ppr_(ppr), count_(0), prevCount_(0), prevState_(0) {
@@ -24,14 +25,19 @@ void QuadratureEncoder::resetCount() {
     prevCount_ = 0;
 }
 
-float QuadratureEncoder::getRpm(float dt) {
+void QuadratureEncoder::setPpr(uint16_t ppr) {
+    ppr_ = ppr;
+}
+
+// 制御周期ごとに呼ぶためSRAMに配置（RamFunc.h）
+float RAM_FUNC(QuadratureEncoder::getRpm)(float dt) {
     int32_t currentCount = count_;
     int32_t diff = currentCount - prevCount_;
     prevCount_ = currentCount;
     return calculateRpm(diff, ppr_, dt);
 }
 
-float QuadratureEncoder::calculateRpm(int32_t countDiff, uint16_t ppr, float dt) {
+float RAM_FUNC(QuadratureEncoder::calculateRpm)(int32_t countDiff, uint16_t ppr, float dt) {
     // ゼロ除算回避
     if (dt <= 0.0f || ppr == 0) {
         return 0.0f;
@@ -82,7 +88,8 @@ int8_t QuadratureEncoder::decodeState(uint8_t prevState, uint8_t currState, bool
     return delta;
 }
 
-void QuadratureEncoder::handleInterrupt() {
+// 割り込みハンドラもSRAMに配置（実装時はdecodeState()のテーブルもSRAMに置くこと）
+void RAM_FUNC(QuadratureEncoder::handleInterrupt)() {
     // ハードウェア依存: 割り込みハンドラ
     // 実機実装時に追加
 }
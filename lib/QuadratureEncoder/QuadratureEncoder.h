@@ -38,6 +38,12 @@ public:
      */
     void resetCount();
 
+    /**
+     * PPRを変更（SET_CONFIG、次回のgetRpm()から反映）
+     * @param ppr エンコーダのPPR（Pulses Per Revolution）
+     */
+    void setPpr(uint16_t ppr);
+
     /**
      * 現在のRPMを取得
      * @param dt 前回呼び出しからの経過時間[秒]
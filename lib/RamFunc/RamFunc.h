@@ -0,0 +1,45 @@
+/**
+ * @file RamFunc.h
+ * @brief 制御周期のホットパスをSRAMに配置する属性
+ *
+ * RP2040はフラッシュ上のコードをXIPキャッシュ（16KB、両コア共有）経由で実行する。
+ * Core0のUSB・プロトコル処理がキャッシュラインを追い出すと、Core1の制御周期で
+ * キャッシュミス（フラッシュからのQSPI読み出し）が起き、処理時間のばらつきになる。
+ *
+ * 制御周期ごとに呼ぶ関数（エンコーダ読み出し・PID・ドライバ出力）は、
+ * pico-sdkの.time_criticalセクションに配置し、起動時にSRAMへコピーして実行する。
+ *
+ * - RAM_FUNC(name):   通常の関数・メンバ関数（__not_in_flash_func相当）
+ * - RAM_FUNC_INLINE:  テンプレートのメンバ関数
+ *                     GCCはテンプレートの実体（COMDAT）に付けたセクション指定を無視するため、
+ *                     呼び出し側のRAM_FUNC関数に必ずインライン展開させてSRAMに置く
+ *
+ * 実機以外（ネイティブテスト）では何もしない。
+ * SRAMの使用量はビルド後にtools/ram_report.pyが表示する。
+ *
+ * 使用例:
+ * @code
+ * float RAM_FUNC(PidController::compute)(float setpoint, float measured, float dt) { ... }
+ *
+ * // ヘッダ（テンプレート）
+ * RAM_FUNC_INLINE void updateWheels(float dt);
+ *
+ * // 呼び出し側（非テンプレート）
+ * void RAM_FUNC(runWheelControl)(float dt) { motorController.updateWheels(dt); }
+ * @endcode
+ */
+
+#ifndef RAM_FUNC_H
+#define RAM_FUNC_H
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+#define RAM_FUNC(name) __not_in_flash_func(name)
+#define RAM_FUNC_INLINE __attribute__((always_inline)) inline
+#else
+#define RAM_FUNC(name) name
+#define RAM_FUNC_INLINE
+#endif
+
+#endif // RAM_FUNC_H
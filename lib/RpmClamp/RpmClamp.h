@@ -0,0 +1,144 @@
+/**
+ * @file RpmClamp.h
+ * @brief 左右RPMの飽和処理（ファームウェア・ホスト側ツール共通カーネル）
+ *
+ * 回転優先（rotationPriority）:
+ * 左右RPMを並進成分と回転成分に分解し、回転成分を優先して残したまま
+ * 両輪が上限に収まるよう並進成分を削る。
+ *
+ *   vTrans = (R + L) / 2,  vRot = (R - L) / 2
+ *   vRot'   = clamp(vRot, ±max)
+ *   vTrans' = clamp(vTrans, ±(max - |vRot'|))
+ *   L' = vTrans' - vRot',  R' = vTrans' + vRot'
+ *
+ * MotorController（Core1）とMotorLogic（CugoSDK互換）、ホスト側のログ再生で
+ * 同じ結果を得るため、ヘッダオンリーで提供する。
+ *
+ * min/max/absは比較と選択だけの式で書いており、分岐を含まない。
+ * FPUを持つホストではminss/maxss等の選択命令になり、一括版はベクトル化の対象になる。
+ * RP2040（ソフトウェア浮動小数点）では比較がライブラリ呼び出しになるため、
+ * 分岐の有無による差はほとんどない。
+ *
+ * 結果はstd::min/std::maxを使った従来の実装とビット単位で一致する
+ * （NaNの扱いを含め、std::min/std::maxと同じ比較順序にしている）。
+ */
+
+#ifndef RPM_CLAMP_H
+#define RPM_CLAMP_H
+
+#include <stddef.h>
+
+namespace RpmClamp {
+
+// =============================================================================
+// 比較・選択（std::min/std::maxと同じ比較順序）
+// =============================================================================
+
+constexpr float minf(float a, float b) {
+    return (b < a) ? b : a;
+}
+
+constexpr float maxf(float a, float b) {
+    return (a < b) ? b : a;
+}
+
+constexpr float absf(float x) {
+    return (x < 0.0f) ? -x : x;
+}
+
+// =============================================================================
+// スカラー版
+// =============================================================================
+
+// 左右RPMの組
+struct RpmPair {
+    float left;
+    float right;
+};
+
+/**
+ * @brief 回転優先クランプ（constexpr評価可能）
+ * @param rpm 目標RPM
+ * @param maxRpm 上限RPM（正の値）
+ * @return クランプ後のRPM
+ */
+constexpr RpmPair rotationPriority(RpmPair rpm, float maxRpm) {
+    // 回転成分を上限でクランプし、残りを並進成分に割り当てる
+    float vTrans = (rpm.right + rpm.left) / 2.0f;
+    float vRot = (rpm.right - rpm.left) / 2.0f;
+    float clampedVRot = maxf(-maxRpm, minf(maxRpm, vRot));
+    float vTransLimit = maxRpm - absf(clampedVRot);
+    float clampedVTrans = maxf(-vTransLimit, minf(vTransLimit, vTrans));
+    return RpmPair{ clampedVTrans - clampedVRot, clampedVTrans + clampedVRot };
+}
+
+/**
+ * @brief 回転優先クランプ（参照で上書き）
+ */
+inline void rotationPriority(float& leftRpm, float& rightRpm, float maxRpm) {
+    RpmPair clamped = rotationPriority(RpmPair{ leftRpm, rightRpm }, maxRpm);
+    leftRpm = clamped.left;
+    rightRpm = clamped.right;
+}
+
+/**
+ * @brief 曲率保持クランプ（左右を同じ倍率で縮小、constexpr評価可能）
+ * @param rpm 目標RPM
+ * @param maxRpm 上限RPM（正の値）
+ * @return クランプ後のRPM
+ */
+constexpr RpmPair proportional(RpmPair rpm, float maxRpm) {
+    float peak = maxf(absf(rpm.left), absf(rpm.right));
+    float scale = (peak > maxRpm && peak > 0.0f) ? maxRpm / peak : 1.0f;
+    return RpmPair{ rpm.left * scale, rpm.right * scale };
+}
+
+/**
+ * @brief 曲率保持クランプ（参照で上書き）
+ */
+inline void proportional(float& leftRpm, float& rightRpm, float maxRpm) {
+    RpmPair clamped = proportional(RpmPair{ leftRpm, rightRpm }, maxRpm);
+    leftRpm = clamped.left;
+    rightRpm = clamped.right;
+}
+
+// =============================================================================
+// 一括版（ホスト側ログ再生用）
+// =============================================================================
+
+/**
+ * @brief 左右別配列（DifferentialKinematics::calculateBatch()の出力）をその場でクランプ
+ * @param leftRpm 左RPM配列
+ * @param rightRpm 右RPM配列
+ * @param count 要素数
+ * @param maxRpm 上限RPM
+ */
+inline void rotationPriorityBatch(float* leftRpm, float* rightRpm, size_t count, float maxRpm) {
+    for (size_t i = 0; i < count; i++) {
+        RpmPair clamped = rotationPriority(RpmPair{ leftRpm[i], rightRpm[i] }, maxRpm);
+        leftRpm[i] = clamped.left;
+        rightRpm[i] = clamped.right;
+    }
+}
+
+/**
+ * @brief RPMの組の配列をその場でクランプ
+ *
+ * left/rightメンバを持つ任意の構造体（RpmPair、MotorLogicのMotorRPMなど）に使える。
+ *
+ * @param pairs RPMの組の配列
+ * @param count 要素数
+ * @param maxRpm 上限RPM
+ */
+template <typename Pair>
+inline void rotationPriorityBatch(Pair* pairs, size_t count, float maxRpm) {
+    for (size_t i = 0; i < count; i++) {
+        RpmPair clamped = rotationPriority(RpmPair{ pairs[i].left, pairs[i].right }, maxRpm);
+        pairs[i].left = clamped.left;
+        pairs[i].right = clamped.right;
+    }
+}
+
+}  // namespace RpmClamp
+
+#endif  // RPM_CLAMP_H
@@ -0,0 +1,89 @@
+/**
+ * @file SCurveProfile.cpp
+ * @brief 加速度・ジャーク制限付き速度プロファイル 実装
+ */
+
+#include "SCurveProfile.h"
+#include <algorithm>
+#include <cmath>
+
+SCurveProfile::SCurveProfile(float maxAccel, float maxJerk)
+    : maxAccel_(maxAccel)
+    , maxJerk_(maxJerk)
+    , velocity_(0.0f)
+    , accel_(0.0f)
+{
+}
+
+void SCurveProfile::setLimits(float maxAccel, float maxJerk) {
+    maxAccel_ = maxAccel;
+    maxJerk_ = maxJerk;
+}
+
+float SCurveProfile::update(float target, float dt) {
+    // 制限なし、または時間が進んでいない場合
+    if (maxAccel_ <= 0.0f) {
+        velocity_ = target;
+        accel_ = 0.0f;
+        return velocity_;
+    }
+    if (dt <= 0.0f) {
+        return velocity_;
+    }
+
+    float error = target - velocity_;
+
+    if (maxJerk_ <= 0.0f) {
+        // 台形加減速: 加速度のみ制限
+        float maxStep = maxAccel_ * dt;
+        float step = std::max(-maxStep, std::min(maxStep, error));
+        velocity_ += step;
+        accel_ = step / dt;
+        return velocity_;
+    }
+
+    // 目標加速度に向けてジャーク制限付きで加速度を変化させる
+    float desiredAccel = calculateDesiredAccel(error, maxAccel_, maxJerk_);
+    float maxAccelStep = maxJerk_ * dt;
+    accel_ += std::max(-maxAccelStep, std::min(maxAccelStep, desiredAccel - accel_));
+
+    // 速度を積分し、目標を越える場合は目標で止める
+    float next = velocity_ + accel_ * dt;
+    if ((target - next) * error <= 0.0f) {
+        velocity_ = target;
+        accel_ = 0.0f;
+    } else {
+        velocity_ = next;
+    }
+    return velocity_;
+}
+
+void SCurveProfile::reset(float velocity) {
+    velocity_ = velocity;
+    accel_ = 0.0f;
+}
+
+bool SCurveProfile::isEnabled() const {
+    return maxAccel_ > 0.0f;
+}
+
+float SCurveProfile::getVelocity() const {
+    return velocity_;
+}
+
+float SCurveProfile::getAcceleration() const {
+    return accel_;
+}
+
+float SCurveProfile::getMaxAccel() const {
+    return maxAccel_;
+}
+
+float SCurveProfile::getMaxJerk() const {
+    return maxJerk_;
+}
+
+float SCurveProfile::calculateDesiredAccel(float error, float maxAccel, float maxJerk) {
+    float magnitude = std::min(maxAccel, std::sqrt(2.0f * maxJerk * std::fabs(error)));
+    return (error >= 0.0f) ? magnitude : -magnitude;
+}
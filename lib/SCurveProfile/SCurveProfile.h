@@ -0,0 +1,92 @@
+/**
+ * @file SCurveProfile.h
+ * @brief 加速度・ジャーク制限付き速度プロファイル（S字加減速）
+ *
+ * 目標速度がステップ状に変化しても、出力速度は加速度・ジャーク（加速度の変化率）を
+ * 制限して滑らかに追従する。1軸分（並進または回転）を扱う。
+ *
+ * 制御周期ごとに以下を行う:
+ *   1. 目標までの残り速度差 e から、ジャーク上限で加速度を0まで戻して
+ *      ちょうど目標に到達できる加速度 a* = sign(e)·min(aMax, √(2·jMax·|e|)) を求める
+ *   2. 現在の加速度を a* に向けて jMax·dt 以内で変化させる
+ *   3. 速度を積分し、目標を越える場合は目標で止める（オーバーシュートなし）
+ *
+ * 最大加速度が0以下の場合は制限なし（目標をそのまま出力）、
+ * 最大ジャークが0以下の場合は加速度のみ制限（台形加減速）。
+ */
+
+#ifndef SCURVE_PROFILE_H
+#define SCURVE_PROFILE_H
+
+/**
+ * @class SCurveProfile
+ * @brief 1軸分のS字加減速プロファイル
+ *
+ * 使用例（Core1、制御周期ごと）:
+ * @code
+ * SCurveProfile linear(1.0f, 5.0f);   // 1.0 m/s², 5.0 m/s³
+ * float v = linear.update(cmdLinearX, dt);
+ * @endcode
+ */
+class SCurveProfile {
+public:
+    /**
+     * @brief コンストラクタ
+     * @param maxAccel 最大加速度 [単位/s²]（0以下で制限なし）
+     * @param maxJerk 最大ジャーク [単位/s³]（0以下で加速度のみ制限）
+     */
+    SCurveProfile(float maxAccel = 0.0f, float maxJerk = 0.0f);
+
+    /**
+     * @brief 制限値を変更（現在の速度・加速度は維持）
+     */
+    void setLimits(float maxAccel, float maxJerk);
+
+    /**
+     * @brief プロファイルを1周期進める
+     * @param target 目標速度
+     * @param dt 経過時間 [s]
+     * @return 制限後の速度
+     */
+    float update(float target, float dt);
+
+    /**
+     * @brief 速度を指定値にし、加速度を0にする（停止・フェイルセーフ時）
+     */
+    void reset(float velocity = 0.0f);
+
+    /**
+     * @brief 制限が有効か（maxAccel > 0）
+     */
+    bool isEnabled() const;
+
+    float getVelocity() const;
+    float getAcceleration() const;
+    float getMaxAccel() const;
+    float getMaxJerk() const;
+
+    // =========================================================================
+    // 静的ユーティリティ関数（テスト可能なロジック部分）
+    // =========================================================================
+
+    /**
+     * @brief 残り速度差に対する目標加速度
+     *
+     * ジャーク上限で加速度を0まで戻す間に進む速度は a²/(2·jMax) なので、
+     * 速度差 e に対して |a| ≦ √(2·jMax·|e|) であれば目標を越えずに止まれる。
+     *
+     * @param error 目標速度 - 現在速度
+     * @param maxAccel 最大加速度（> 0）
+     * @param maxJerk 最大ジャーク（> 0）
+     * @return 目標加速度
+     */
+    static float calculateDesiredAccel(float error, float maxAccel, float maxJerk);
+
+private:
+    float maxAccel_;
+    float maxJerk_;
+    float velocity_;
+    float accel_;
+};
+
+#endif // SCURVE_PROFILE_H
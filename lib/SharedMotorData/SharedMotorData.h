@@ -2,6 +2,14 @@
 #define SHARED_MOTOR_DATA_H
 
 #include <stdint.h>
+#include <string.h>
+#include "TimingStats.h"
+
+#ifdef ARDUINO
+#include "hardware/sync.h"
+#else
+#include <atomic>
+#endif
 
 // =============================================================================
 // コア間共有データ構造体
@@ -9,8 +17,11 @@
 // Core0（メインコア）とCore1（リアルタイムコア）間でデータを共有するための構造体。
 // 書き込み元を固定することで競合を最小化。
 //
-// CmdVelData:     Core0が書き込み、Core1が読み込み
-// MotorStateData: Core1が書き込み、Core0が読み込み
+// CmdVelData:        Core0が書き込み、Core1が読み込み
+// MotorStateData:    Core1が書き込み、Core0が読み込み
+// TimingData:        Core1が書き込み、Core0が読み込み（シーケンス番号で一貫性を確認）
+// ControlConfigData: Core0が書き込み、Core1が読み込み（同上）
+// OdometryData:      Core1が書き込み、Core0が読み込み（同上）
 //
 // 使用例:
 //   #include "pico/mutex.h"
@@ -49,6 +60,40 @@ struct CmdVelData {
     float linearX;        // 並進速度 [m/s]
     float angularZ;       // 回転速度 [rad/s]
     bool failsafeStop;    // フェイルセーフ停止フラグ（通信途絶時にtrue）
+
+    // タイムスタンプ付き指令（Core0が指令を書き込んでから番号を進め、Core1は番号の変化で受信を検出）
+    uint32_t commandTimestampUs;  // ホスト側の指令時刻 [us]
+    uint32_t commandReceivedUs;   // Core0の受信時刻 [us]
+    bool commandHasTimestamp;     // タイムスタンプ付き指令ならtrue（falseは従来の保持動作）
+    uint16_t commandValidityMs;   // 指令の有効期間 [ms]（0はデフォルト）
+    uint32_t commandSeq;          // 指令受信シーケンス番号
+
+    // オドメトリリセット要求（Core0が姿勢を書き込んでからシーケンス番号を進め、
+    // Core1は前回適用した番号と異なる場合に適用する）
+    float odometryResetX;        // リセット後のX座標 [m]
+    float odometryResetY;        // リセット後のY座標 [m]
+    float odometryResetTheta;    // リセット後の方位 [rad]
+    uint32_t odometryResetSeq;   // リセット要求シーケンス番号
+
+    // 位置制御要求（同様にシーケンス番号の変化で開始、MOTOR_COMMANDの受信で終了）
+    int32_t positionDeltaL;      // 左の相対移動量 [カウント]
+    int32_t positionDeltaR;      // 右の相対移動量 [カウント]
+    float positionMaxRpm;        // 最高速度 [RPM]
+    float positionMaxAccel;      // 最大加速度 [RPM/s]
+    uint32_t positionSeq;        // 位置制御要求シーケンス番号
+
+    // 軌道の開始・中断要求（軌道本体はCore0がアップロードした2面のバッファの一方）
+    uint8_t trajectoryStartBuffer;   // 開始するバッファ番号（0または1）
+    bool trajectoryStartQueued;      // trueなら実行中の軌道の完了後に開始
+    uint32_t trajectoryStartSeq;     // 開始要求シーケンス番号
+    uint32_t trajectoryAbortSeq;     // 中断要求シーケンス番号
+
+    // 制御周期の時間計測のリセット要求（GET_TIMINGのリセット指定）
+    uint32_t timingResetSeq;
+
+    // 制御周波数の変更要求（SET_CONFIG、Core1が周期の終わりに適用）
+    uint16_t controlRateHz;
+    uint32_t controlRateSeq;
 };
 
 // =============================================================================
@@ -60,12 +105,239 @@ struct CmdVelData {
 struct MotorStateData {
     int32_t encoderCountL;   // 左エンコーダ累積カウント
     int32_t encoderCountR;   // 右エンコーダ累積カウント
-    float targetRpmL;        // 目標RPM（左）- cmd_velから計算
-    float targetRpmR;        // 目標RPM（右）- cmd_velから計算
+    float targetRpmL;        // 目標RPM（左）- 加減速プロファイル後のcmd_velから計算
+    float targetRpmR;        // 目標RPM（右）- 加減速プロファイル後のcmd_velから計算
+    float profiledLinearX;   // 加減速プロファイル後の並進速度 [m/s]
+    float profiledAngularZ;  // 加減速プロファイル後の回転速度 [rad/s]
     float currentRpmL;       // 現在RPM（左）- エンコーダから計算
     float currentRpmR;       // 現在RPM（右）- エンコーダから計算
+    float batteryVoltage;    // バス電圧 [V]（フィルタ後）
+    float currentRmsL;       // モータ電流RMS（左）[A]
+    float currentRmsR;       // モータ電流RMS（右）[A]
+    float currentPeakL;      // モータ電流ピーク（左）[A]
+    float currentPeakR;      // モータ電流ピーク（右）[A]
+    uint32_t trajectoryAppliedSeq;   // Core1が処理済みの軌道開始要求シーケンス番号
+    uint8_t trajectoryState;         // TrajectoryPlayer::State
+    uint8_t trajectorySegmentIndex;  // 実行中のセグメント番号
+    uint32_t trajectoryElapsedMs;    // 実行中の軌道の経過時間 [ms]
+    uint32_t trajectoryDurationMs;   // 実行中の軌道の合計時間 [ms]
+    uint16_t statusFlags;    // Core1が検出したProtocol::STATUS_*フラグ
+};
+
+// =============================================================================
+// TimingData - Core1 → Core0（制御周期の時間計測）
+// =============================================================================
+// Core1が制御周期ごとに書き込み、Core0がGET_TIMINGで読み込み
+// 1回の読み書きで揃わない大きさのため、シーケンス番号で一貫性を確認する
+// （書き込み中は奇数。読み込みの前後で同じ偶数なら採用、違えば読み直す）
+// =============================================================================
+struct TimingData {
+    uint32_t seq;                    // シーケンス番号（writeTimingData/readTimingDataのみが操作）
+    uint32_t nominalPeriodUs;        // 公称の制御周期 [us]
+    uint32_t overrunCount;           // 処理時間が公称周期を超えた回数
+    uint32_t missedTicks;            // 取りこぼした制御周期の回数
+    TimingStats::Summary period;     // 実際の周期
+    TimingStats::Summary execution;  // 処理時間
+    uint32_t xipAccessCount;         // 制御周期の処理中のXIPキャッシュアクセス回数（両コア合計）
+    uint32_t xipHitCount;            // 同ヒット回数
+    TimingStats::Summary commandLatency;  // MOTOR_COMMAND受信からPWM（ドライバ出力）更新まで
+    uint32_t outOfCycleCount;        // 周期の途中で指令を適用した回数（ドアベル）
+};
+
+// =============================================================================
+// ControlConfigData - Core0 → Core1（PIDゲイン・ジオメトリ）
+// =============================================================================
+// Core0がSET_CONFIGで書き込み、Core1が制御周期の終わりに読み込んで適用
+// TimingDataと同じくシーケンス番号で一貫性を確認する（書き込み中は奇数）
+// =============================================================================
+struct ControlConfigData {
+    uint32_t seq;            // シーケンス番号（writeControlConfigData/readControlConfigDataのみが操作）
+    float pidKpL;
+    float pidKiL;
+    float pidKdL;
+    float pidKpR;
+    float pidKiR;
+    float pidKdR;
+    uint16_t encoderPprL;
+    uint16_t encoderPprR;
+    float gearRatioL;
+    float gearRatioR;
+    float wheelDiameterL;
+    float wheelDiameterR;
+    float trackWidth;
 };
 
+// =============================================================================
+// OdometryData - Core1 → Core0（オドメトリ）
+// =============================================================================
+// Core1が公開周期ごとに書き込み、Core0がGET_ODOMETRYで読み込み
+// 姿勢・速度・時刻が同じ制御周期のものとなるよう、シーケンス番号で一貫性を確認する
+// =============================================================================
+struct OdometryData {
+    uint32_t seq;            // シーケンス番号（writeOdometryData/readOdometryDataのみが操作）
+    float x;                 // X座標 [m]
+    float y;                 // Y座標 [m]
+    float theta;             // 方位 [rad]
+    float linearX;           // 並進速度 [m/s]
+    float angularZ;          // 回転速度 [rad/s]
+    uint32_t timestampUs;    // オドメトリを積算した制御周期の時刻 [us]
+};
+
+/**
+ * コア間のメモリバリア（コンパイラの並べ替えも防ぐ）
+ */
+inline void sharedDataBarrier() {
+#ifdef ARDUINO
+    __dmb();
+#else
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/**
+ * TimingDataを書き込み（書き込み側のコアは1つのみ）
+ * @param shared 共有データ
+ * @param source 書き込む内容（seqは無視）
+ */
+inline void writeTimingData(TimingData* shared, const TimingData& source) {
+    volatile uint32_t* seq = &shared->seq;
+    uint32_t next = *seq + 1;
+    *seq = next;  // 奇数: 書き込み中
+    sharedDataBarrier();
+    shared->nominalPeriodUs = source.nominalPeriodUs;
+    shared->overrunCount = source.overrunCount;
+    shared->missedTicks = source.missedTicks;
+    shared->period = source.period;
+    shared->execution = source.execution;
+    shared->xipAccessCount = source.xipAccessCount;
+    shared->xipHitCount = source.xipHitCount;
+    shared->commandLatency = source.commandLatency;
+    shared->outOfCycleCount = source.outOfCycleCount;
+    sharedDataBarrier();
+    *seq = next + 1;
+}
+
+/**
+ * TimingDataを読み込み
+ * @param shared 共有データ
+ * @param[out] dest 読み込み先
+ * @param maxAttempts 書き込みと重なった場合の試行回数
+ * @return 一貫した内容を読めた場合true
+ */
+inline bool readTimingData(const TimingData* shared, TimingData* dest, uint8_t maxAttempts) {
+    const volatile uint32_t* seq = &shared->seq;
+    for (uint8_t attempt = 0; attempt < maxAttempts; attempt++) {
+        uint32_t before = *seq;
+        if (before & 1) {
+            continue;
+        }
+        sharedDataBarrier();
+        *dest = *shared;
+        sharedDataBarrier();
+        if (*seq == before) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * ControlConfigDataを書き込み（書き込み側のコアは1つのみ）
+ * @param shared 共有データ
+ * @param source 書き込む内容（seqは無視）
+ */
+inline void writeControlConfigData(ControlConfigData* shared, const ControlConfigData& source) {
+    volatile uint32_t* seq = &shared->seq;
+    uint32_t next = *seq + 1;
+    *seq = next;  // 奇数: 書き込み中
+    sharedDataBarrier();
+    shared->pidKpL = source.pidKpL;
+    shared->pidKiL = source.pidKiL;
+    shared->pidKdL = source.pidKdL;
+    shared->pidKpR = source.pidKpR;
+    shared->pidKiR = source.pidKiR;
+    shared->pidKdR = source.pidKdR;
+    shared->encoderPprL = source.encoderPprL;
+    shared->encoderPprR = source.encoderPprR;
+    shared->gearRatioL = source.gearRatioL;
+    shared->gearRatioR = source.gearRatioR;
+    shared->wheelDiameterL = source.wheelDiameterL;
+    shared->wheelDiameterR = source.wheelDiameterR;
+    shared->trackWidth = source.trackWidth;
+    sharedDataBarrier();
+    *seq = next + 1;
+}
+
+/**
+ * ControlConfigDataを読み込み
+ * @param shared 共有データ
+ * @param[out] dest 読み込み先（seqは読み込んだ内容のシーケンス番号）
+ * @param maxAttempts 書き込みと重なった場合の試行回数
+ * @return 一貫した内容を読めた場合true
+ */
+inline bool readControlConfigData(const ControlConfigData* shared, ControlConfigData* dest,
+                                  uint8_t maxAttempts) {
+    const volatile uint32_t* seq = &shared->seq;
+    for (uint8_t attempt = 0; attempt < maxAttempts; attempt++) {
+        uint32_t before = *seq;
+        if (before & 1) {
+            continue;
+        }
+        sharedDataBarrier();
+        *dest = *shared;
+        sharedDataBarrier();
+        if (*seq == before) {
+            dest->seq = before;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * OdometryDataを書き込み（書き込み側のコアは1つのみ）
+ * @param shared 共有データ
+ * @param source 書き込む内容（seqは無視）
+ */
+inline void writeOdometryData(OdometryData* shared, const OdometryData& source) {
+    volatile uint32_t* seq = &shared->seq;
+    uint32_t next = *seq + 1;
+    *seq = next;  // 奇数: 書き込み中
+    sharedDataBarrier();
+    shared->x = source.x;
+    shared->y = source.y;
+    shared->theta = source.theta;
+    shared->linearX = source.linearX;
+    shared->angularZ = source.angularZ;
+    shared->timestampUs = source.timestampUs;
+    sharedDataBarrier();
+    *seq = next + 1;
+}
+
+/**
+ * OdometryDataを読み込み
+ * @param shared 共有データ
+ * @param[out] dest 読み込み先
+ * @param maxAttempts 書き込みと重なった場合の試行回数
+ * @return 一貫した内容を読めた場合true
+ */
+inline bool readOdometryData(const OdometryData* shared, OdometryData* dest, uint8_t maxAttempts) {
+    const volatile uint32_t* seq = &shared->seq;
+    for (uint8_t attempt = 0; attempt < maxAttempts; attempt++) {
+        uint32_t before = *seq;
+        if (before & 1) {
+            continue;
+        }
+        sharedDataBarrier();
+        *dest = *shared;
+        sharedDataBarrier();
+        if (*seq == before) {
+            return true;
+        }
+    }
+    return false;
+}
+
 // =============================================================================
 // 初期化関数
 // =============================================================================
@@ -78,6 +350,27 @@ inline void initCmdVelData(volatile CmdVelData* data) {
     data->linearX = 0.0f;
     data->angularZ = 0.0f;
     data->failsafeStop = false;
+    data->commandTimestampUs = 0;
+    data->commandReceivedUs = 0;
+    data->commandHasTimestamp = false;
+    data->commandValidityMs = 0;
+    data->commandSeq = 0;
+    data->odometryResetX = 0.0f;
+    data->odometryResetY = 0.0f;
+    data->odometryResetTheta = 0.0f;
+    data->odometryResetSeq = 0;
+    data->positionDeltaL = 0;
+    data->positionDeltaR = 0;
+    data->positionMaxRpm = 0.0f;
+    data->positionMaxAccel = 0.0f;
+    data->positionSeq = 0;
+    data->trajectoryStartBuffer = 0;
+    data->trajectoryStartQueued = false;
+    data->trajectoryStartSeq = 0;
+    data->trajectoryAbortSeq = 0;
+    data->timingResetSeq = 0;
+    data->controlRateHz = 0;
+    data->controlRateSeq = 0;
 }
 
 /**
@@ -89,8 +382,45 @@ inline void initMotorStateData(volatile MotorStateData* data) {
     data->encoderCountR = 0;
     data->targetRpmL = 0.0f;
     data->targetRpmR = 0.0f;
+    data->profiledLinearX = 0.0f;
+    data->profiledAngularZ = 0.0f;
     data->currentRpmL = 0.0f;
     data->currentRpmR = 0.0f;
+    data->batteryVoltage = 0.0f;
+    data->currentRmsL = 0.0f;
+    data->currentRmsR = 0.0f;
+    data->currentPeakL = 0.0f;
+    data->currentPeakR = 0.0f;
+    data->trajectoryAppliedSeq = 0;
+    data->trajectoryState = 0;
+    data->trajectorySegmentIndex = 0;
+    data->trajectoryElapsedMs = 0;
+    data->trajectoryDurationMs = 0;
+    data->statusFlags = 0;
+}
+
+/**
+ * TimingDataを初期値でクリア
+ * @param data 初期化する構造体へのポインタ
+ */
+inline void initTimingData(TimingData* data) {
+    memset(data, 0, sizeof(TimingData));
+}
+
+/**
+ * OdometryDataを初期値でクリア（原点・停止）
+ * @param data 初期化する構造体へのポインタ
+ */
+inline void initOdometryData(OdometryData* data) {
+    memset(data, 0, sizeof(OdometryData));
+}
+
+/**
+ * ControlConfigDataを初期値でクリア（シーケンス番号0は未要求）
+ * @param data 初期化する構造体へのポインタ
+ */
+inline void initControlConfigData(ControlConfigData* data) {
+    memset(data, 0, sizeof(ControlConfigData));
 }
 
 #endif  // SHARED_MOTOR_DATA_H
@@ -0,0 +1,65 @@
+/**
+ * @file StallDetector.cpp
+ * @brief モータのストール（拘束）検出 実装
+ */
+
+#include "StallDetector.h"
+
+StallDetector::StallDetector(float dutyThreshold, float rpmThreshold,
+                             float detectTime, float cooldownTime)
+    : dutyThreshold_(dutyThreshold)
+    , rpmThreshold_(rpmThreshold)
+    , detectTime_(detectTime)
+    , cooldownTime_(cooldownTime)
+    , conditionTime_(0.0f)
+    , stalledTime_(0.0f)
+    , stalled_(false)
+    , eventCount_(0)
+{
+}
+
+bool StallDetector::update(float duty, float rpm, float dt) {
+    if (stalled_) {
+        // 出力停止中: クールダウン後に解除して再判定
+        stalledTime_ += dt;
+        if (stalledTime_ >= cooldownTime_) {
+            reset();
+        }
+        return false;
+    }
+
+    // 条件が途切れたら計測し直し（加速中の一時的な低回転を除外）
+    if (isStallCondition(duty, rpm, dutyThreshold_, rpmThreshold_)) {
+        conditionTime_ += dt;
+    } else {
+        conditionTime_ = 0.0f;
+    }
+
+    if (conditionTime_ >= detectTime_) {
+        stalled_ = true;
+        stalledTime_ = 0.0f;
+        eventCount_++;
+        return true;
+    }
+    return false;
+}
+
+bool StallDetector::isStalled() const {
+    return stalled_;
+}
+
+void StallDetector::reset() {
+    conditionTime_ = 0.0f;
+    stalledTime_ = 0.0f;
+    stalled_ = false;
+}
+
+uint32_t StallDetector::getEventCount() const {
+    return eventCount_;
+}
+
+bool StallDetector::isStallCondition(float duty, float rpm, float dutyThreshold, float rpmThreshold) {
+    float absDuty = duty < 0.0f ? -duty : duty;
+    float absRpm = rpm < 0.0f ? -rpm : rpm;
+    return absDuty >= dutyThreshold && absRpm < rpmThreshold;
+}
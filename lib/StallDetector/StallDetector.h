@@ -0,0 +1,84 @@
+/**
+ * @file StallDetector.h
+ * @brief モータのストール（拘束）検出
+ *
+ * 高デューティなのに回転数がほぼ0の状態が一定時間続いたらストールと判定する。
+ * 加速開始・反転時の一瞬の「高デューティ・低回転」は判定時間で除外する。
+ * ストール中は出力を止め、クールダウン後に自動で判定を解除する
+ * （まだ拘束されていれば再び判定時間後に検出される）。
+ */
+
+#ifndef STALL_DETECTOR_H
+#define STALL_DETECTOR_H
+
+#include <stdint.h>
+
+/**
+ * @class StallDetector
+ * @brief 1モータ分のストール検出
+ *
+ * 使用例（Core1、制御周期ごと）:
+ * @code
+ * StallDetector stall(0.6f, 5.0f, 0.5f, 2.0f);
+ * if (stall.update(driver.getOutputSpeed(), controller.getCurrentRpmL(), dt)) {
+ *     // 新規ストール検出
+ * }
+ * if (stall.isStalled()) { controller.stop(); }
+ * @endcode
+ */
+class StallDetector {
+public:
+    /**
+     * @brief コンストラクタ
+     * @param dutyThreshold ストール判定デューティ（|duty|がこれ以上）
+     * @param rpmThreshold ストール判定回転数（|RPM|がこれ未満）[RPM]
+     * @param detectTime 判定時間（条件の連続時間）[s]
+     * @param cooldownTime 判定解除までの時間 [s]
+     */
+    StallDetector(float dutyThreshold, float rpmThreshold, float detectTime, float cooldownTime);
+
+    /**
+     * @brief 1周期分の判定
+     * @param duty 出力デューティ（-1.0〜1.0）
+     * @param rpm 現在回転数 [RPM]
+     * @param dt 経過時間 [s]
+     * @return 今回新たにストールを検出した場合true
+     */
+    bool update(float duty, float rpm, float dt);
+
+    /**
+     * @brief ストール中（出力停止すべき状態）か
+     */
+    bool isStalled() const;
+
+    /**
+     * @brief 判定状態をリセット（検出回数は保持）
+     */
+    void reset();
+
+    /**
+     * @brief 起動からのストール検出回数
+     */
+    uint32_t getEventCount() const;
+
+    // =========================================================================
+    // 静的ユーティリティ関数（テスト可能なロジック部分）
+    // =========================================================================
+
+    /**
+     * @brief ストール条件（高デューティ・低回転）を満たすか
+     */
+    static bool isStallCondition(float duty, float rpm, float dutyThreshold, float rpmThreshold);
+
+private:
+    float dutyThreshold_;
+    float rpmThreshold_;
+    float detectTime_;
+    float cooldownTime_;
+    float conditionTime_;  // ストール条件の連続時間
+    float stalledTime_;    // ストール判定からの経過時間
+    bool stalled_;
+    uint32_t eventCount_;
+};
+
+#endif // STALL_DETECTOR_H
@@ -0,0 +1,73 @@
+/**
+ * @file ThermalModel.cpp
+ * @brief モータ巻線のI²t熱推定と出力ディレーティング 実装
+ */
+
+#include "ThermalModel.h"
+
+ThermalModel::ThermalModel(float timeConstant, float derateStart, float minScale, float clearLevel)
+    : timeConstant_(timeConstant)
+    , derateStart_(derateStart)
+    , minScale_(minScale)
+    , clearLevel_(clearLevel)
+    , heat_(0.0f)
+    , overTemp_(false)
+{
+}
+
+void ThermalModel::update(float loadRatio, float dt) {
+    heat_ = integrate(heat_, loadRatio, dt, timeConstant_);
+
+    // 過熱判定（ディレーティング開始で立て、clearLevelまで冷えたら解除）
+    if (heat_ >= derateStart_) {
+        overTemp_ = true;
+    } else if (heat_ < clearLevel_) {
+        overTemp_ = false;
+    }
+}
+
+void ThermalModel::reset() {
+    heat_ = 0.0f;
+    overTemp_ = false;
+}
+
+float ThermalModel::getHeat() const {
+    return heat_;
+}
+
+float ThermalModel::getDerating() const {
+    return calculateDerating(heat_, derateStart_, minScale_);
+}
+
+bool ThermalModel::isOverTemp() const {
+    return overTemp_;
+}
+
+float ThermalModel::integrate(float heat, float loadRatio, float dt, float timeConstant) {
+    if (dt <= 0.0f) {
+        return heat;
+    }
+    if (timeConstant <= 0.0f) {
+        // 時定数なし: 即座に飽和値
+        return loadRatio * loadRatio;
+    }
+
+    // 前進オイラー（dt/τが1を超えると発散するため制限）
+    float k = dt / timeConstant;
+    if (k > 1.0f) {
+        k = 1.0f;
+    }
+    return heat + (loadRatio * loadRatio - heat) * k;
+}
+
+float ThermalModel::calculateDerating(float heat, float derateStart, float minScale) {
+    if (heat <= derateStart) {
+        return 1.0f;
+    }
+    if (heat >= 1.0f || derateStart >= 1.0f) {
+        return minScale;
+    }
+
+    float progress = (heat - derateStart) / (1.0f - derateStart);
+    return 1.0f - progress * (1.0f - minScale);
+}
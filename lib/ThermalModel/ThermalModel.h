@@ -0,0 +1,103 @@
+/**
+ * @file ThermalModel.h
+ * @brief モータ巻線のI²t熱推定と出力ディレーティング
+ *
+ * 1次遅れの熱モデルで巻線の発熱を推定する。
+ *   dθ/dt = (r² - θ) / τ    （r = 負荷 / 定格負荷）
+ * θは定格負荷を流し続けたときの飽和温度上昇を1.0とした正規化値。
+ * θがディレーティング開始レベルを超えると過熱と判定し、出力上限を
+ * 徐々に下げる（θ=1.0で最小倍率）。過熱判定は解除レベルまで冷えると解除する。
+ *
+ * 負荷は電流が計測できる場合はRMS電流、できない場合はデューティ
+ * （ストール時の電流 ≒ デューティ × 拘束電流のため安全側の推定）を使う。
+ */
+
+#ifndef THERMAL_MODEL_H
+#define THERMAL_MODEL_H
+
+/**
+ * @class ThermalModel
+ * @brief 1モータ分のI²t熱推定
+ *
+ * 使用例（Core1、制御周期ごと）:
+ * @code
+ * ThermalModel thermal(60.0f, 0.7f, 0.2f, 0.6f);
+ * thermal.update(currentRms / RATED_CURRENT, dt);
+ * controller.setDerating(thermal.getDerating(), ...);
+ * if (thermal.isOverTemp()) { flags |= STATUS_OVERTEMP; }
+ * @endcode
+ */
+class ThermalModel {
+public:
+    /**
+     * @brief コンストラクタ
+     * @param timeConstant 熱時定数 [s]
+     * @param derateStart ディレーティング開始レベル（θ、0.0〜1.0）
+     * @param minScale θ=1.0以上での出力上限倍率（0.0〜1.0）
+     * @param clearLevel 過熱解除レベル（θ、derateStartより小さくすること）
+     */
+    ThermalModel(float timeConstant, float derateStart, float minScale, float clearLevel);
+
+    /**
+     * @brief 熱推定を1周期進める
+     * @param loadRatio 負荷 / 定格負荷（符号は無視）
+     * @param dt 経過時間 [s]
+     */
+    void update(float loadRatio, float dt);
+
+    /**
+     * @brief 推定値をリセット（冷えた状態）
+     */
+    void reset();
+
+    /**
+     * @brief 正規化発熱量θ（1.0 = 過熱しきい値）
+     */
+    float getHeat() const;
+
+    /**
+     * @brief 出力上限倍率（1.0 = 制限なし 〜 minScale）
+     */
+    float getDerating() const;
+
+    /**
+     * @brief 過熱判定（熱保護による出力制限中）
+     */
+    bool isOverTemp() const;
+
+    // =========================================================================
+    // 静的ユーティリティ関数（テスト可能なロジック部分）
+    // =========================================================================
+
+    /**
+     * @brief 熱モデルを1ステップ積分
+     * @param heat 現在のθ
+     * @param loadRatio 負荷 / 定格負荷
+     * @param dt 経過時間 [s]
+     * @param timeConstant 熱時定数 [s]
+     * @return 次のθ
+     */
+    static float integrate(float heat, float loadRatio, float dt, float timeConstant);
+
+    /**
+     * @brief θから出力上限倍率を計算
+     *
+     * derateStart以下で1.0、1.0でminScaleとなるよう線形に下げる。
+     *
+     * @param heat θ
+     * @param derateStart ディレーティング開始レベル
+     * @param minScale 最小倍率
+     * @return 出力上限倍率
+     */
+    static float calculateDerating(float heat, float derateStart, float minScale);
+
+private:
+    float timeConstant_;
+    float derateStart_;
+    float minScale_;
+    float clearLevel_;
+    float heat_;
+    bool overTemp_;
+};
+
+#endif // THERMAL_MODEL_H
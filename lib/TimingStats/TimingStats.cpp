@@ -0,0 +1,72 @@
+/**
+ * @file TimingStats.cpp
+ * @brief 制御周期の時間計測 実装
+ */
+
+#include "TimingStats.h"
+
+TimingStats::TimingStats(uint32_t bucketOriginUs, uint32_t bucketWidthUs)
+    : bucketOriginUs_(bucketOriginUs)
+    , bucketWidthUs_((bucketWidthUs > 0) ? bucketWidthUs : 1)
+{
+    reset();
+}
+
+void TimingStats::record(uint32_t valueUs) {
+    if (count_ == 0 || valueUs < min_) {
+        min_ = valueUs;
+    }
+    if (valueUs > max_) {
+        max_ = valueUs;
+    }
+    count_++;
+    sum_ += valueUs;
+    buckets_[bucketIndex(valueUs, bucketOriginUs_, bucketWidthUs_)]++;
+}
+
+void TimingStats::reset() {
+    count_ = 0;
+    min_ = 0;
+    max_ = 0;
+    sum_ = 0;
+    for (uint8_t i = 0; i < BUCKET_COUNT; i++) {
+        buckets_[i] = 0;
+    }
+}
+
+void TimingStats::setBuckets(uint32_t bucketOriginUs, uint32_t bucketWidthUs) {
+    bucketOriginUs_ = bucketOriginUs;
+    bucketWidthUs_ = (bucketWidthUs > 0) ? bucketWidthUs : 1;
+    reset();
+}
+
+void TimingStats::summarize(Summary& summary) const {
+    summary.count = count_;
+    summary.minUs = getMinUs();
+    summary.maxUs = max_;
+    summary.meanUs = getMeanUs();
+    summary.bucketOriginUs = bucketOriginUs_;
+    summary.bucketWidthUs = bucketWidthUs_;
+    for (uint8_t i = 0; i < BUCKET_COUNT; i++) {
+        summary.buckets[i] = buckets_[i];
+    }
+}
+
+uint32_t TimingStats::getMeanUs() const {
+    if (count_ == 0) {
+        return 0;
+    }
+    return static_cast<uint32_t>(sum_ / count_);
+}
+
+uint32_t TimingStats::getBucket(uint8_t index) const {
+    return (index < BUCKET_COUNT) ? buckets_[index] : 0;
+}
+
+uint8_t TimingStats::bucketIndex(uint32_t valueUs, uint32_t bucketOriginUs, uint32_t bucketWidthUs) {
+    if (valueUs < bucketOriginUs) {
+        return 0;
+    }
+    uint32_t index = (valueUs - bucketOriginUs) / bucketWidthUs;
+    return (index < BUCKET_COUNT) ? static_cast<uint8_t>(index) : BUCKET_COUNT - 1;
+}
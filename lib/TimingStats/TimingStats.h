@@ -0,0 +1,103 @@
+/**
+ * @file TimingStats.h
+ * @brief 制御周期の時間計測（最小・最大・平均とヒストグラム）
+ *
+ * Core1の制御周期ごとに、実際の周期（前回の開始からの間隔）と処理時間を記録する。
+ * 値は固定幅のビンに数え、範囲外は両端のビンに含める。
+ *
+ *   ビン i = clamp((値 - 原点) / ビン幅, 0, BUCKET_COUNT - 1)
+ *
+ * 周期は公称周期を中心に狭いビン幅で（ジッタを見る）、処理時間は0から公称周期までを
+ * 等分する（予算に対する余裕を見る）ように原点とビン幅を選ぶ。
+ */
+
+#ifndef TIMING_STATS_H
+#define TIMING_STATS_H
+
+#include <stdint.h>
+
+/**
+ * @class TimingStats
+ * @brief 時間 [us] の集計
+ *
+ * 使用例（Core1、制御周期ごと）:
+ * @code
+ * TimingStats execStats(0, 625);   // 0〜10msを16分割
+ * uint32_t startUs = micros();
+ * // ... 制御処理 ...
+ * execStats.record(micros() - startUs);
+ * @endcode
+ */
+class TimingStats {
+public:
+    static constexpr uint8_t BUCKET_COUNT = 16;
+
+    // 集計結果（コア間共有・プロトコル送信用のコピー）
+    struct Summary {
+        uint32_t count;
+        uint32_t minUs;          // 記録なしの場合0
+        uint32_t maxUs;
+        uint32_t meanUs;         // 記録なしの場合0
+        uint32_t bucketOriginUs;
+        uint32_t bucketWidthUs;
+        uint32_t buckets[BUCKET_COUNT];
+    };
+
+    /**
+     * @brief コンストラクタ
+     * @param bucketOriginUs 先頭ビンの下限 [us]
+     * @param bucketWidthUs ビン幅 [us]（0は1として扱う）
+     */
+    TimingStats(uint32_t bucketOriginUs, uint32_t bucketWidthUs);
+
+    /**
+     * @brief 1回分の時間を記録
+     * @param valueUs 時間 [us]
+     */
+    void record(uint32_t valueUs);
+
+    /**
+     * @brief 集計をクリア（ビンの設定は維持）
+     */
+    void reset();
+
+    /**
+     * @brief ビンの設定を変更し、集計をクリア（制御周期の変更時）
+     * @param bucketOriginUs 先頭ビンの下限 [us]
+     * @param bucketWidthUs ビン幅 [us]（0は1として扱う）
+     */
+    void setBuckets(uint32_t bucketOriginUs, uint32_t bucketWidthUs);
+
+    /**
+     * @brief 集計結果をコピー
+     * @param[out] summary 集計結果
+     */
+    void summarize(Summary& summary) const;
+
+    uint32_t getCount() const { return count_; }
+    uint32_t getMinUs() const { return (count_ > 0) ? min_ : 0; }
+    uint32_t getMaxUs() const { return max_; }
+    uint32_t getMeanUs() const;
+    uint32_t getBucket(uint8_t index) const;
+
+    /**
+     * @brief 値が入るビン番号（ハードウェア非依存、テスト可能）
+     * @param valueUs 時間 [us]
+     * @param bucketOriginUs 先頭ビンの下限 [us]
+     * @param bucketWidthUs ビン幅 [us]（> 0）
+     * @return ビン番号（0〜BUCKET_COUNT-1、範囲外は両端）
+     */
+    static uint8_t bucketIndex(uint32_t valueUs, uint32_t bucketOriginUs, uint32_t bucketWidthUs);
+
+private:
+    uint32_t bucketOriginUs_;
+    uint32_t bucketWidthUs_;
+
+    uint32_t count_;
+    uint32_t min_;
+    uint32_t max_;
+    uint64_t sum_;
+    uint32_t buckets_[BUCKET_COUNT];
+};
+
+#endif // TIMING_STATS_H
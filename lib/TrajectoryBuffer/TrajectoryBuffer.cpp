@@ -0,0 +1,157 @@
+/**
+ * @file TrajectoryBuffer.cpp
+ * @brief 速度軌道の保持と実行 実装
+ */
+
+#include "TrajectoryBuffer.h"
+#include <cmath>
+
+// =============================================================================
+// TrajectoryBuffer
+// =============================================================================
+
+TrajectoryBuffer::TrajectoryBuffer()
+    : count_(0)
+{
+}
+
+void TrajectoryBuffer::clear() {
+    count_ = 0;
+}
+
+bool TrajectoryBuffer::write(uint8_t index, const Segment& segment) {
+    if (index >= CAPACITY || index > count_) {
+        return false;
+    }
+    if (segment.durationMs == 0 ||
+        (segment.mode != MODE_STEP && segment.mode != MODE_RAMP) ||
+        !std::isfinite(segment.linearX) || !std::isfinite(segment.angularZ)) {
+        return false;
+    }
+
+    segments_[index] = segment;
+    if (index == count_) {
+        count_++;
+    }
+    return true;
+}
+
+uint32_t TrajectoryBuffer::getTotalDurationMs() const {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < count_; i++) {
+        total += segments_[i].durationMs;
+    }
+    return total;
+}
+
+// =============================================================================
+// TrajectoryPlayer
+// =============================================================================
+
+TrajectoryPlayer::TrajectoryPlayer()
+    : buffer_(nullptr)
+    , startUs_(0)
+    , totalUs_(0)
+    , initialLinearX_(0.0f)
+    , initialAngularZ_(0.0f)
+    , cursor_(0)
+    , cursorStartUs_(0)
+    , elapsedUs_(0)
+    , state_(STATE_IDLE)
+{
+}
+
+bool TrajectoryPlayer::start(const TrajectoryBuffer& buffer, uint32_t startUs) {
+    if (buffer.getCount() == 0) {
+        return false;
+    }
+
+    // 実行中なら、切り替え時刻での前の軌道の値からRAMPを始める
+    float linearX = 0.0f;
+    float angularZ = 0.0f;
+    if (state_ == STATE_RUNNING) {
+        uint32_t elapsed = startUs - startUs_;
+        evaluate(elapsed < totalUs_ ? elapsed : totalUs_, linearX, angularZ);
+    }
+
+    buffer_ = &buffer;
+    startUs_ = startUs;
+    totalUs_ = buffer.getTotalDurationMs() * 1000;
+    initialLinearX_ = linearX;
+    initialAngularZ_ = angularZ;
+    cursor_ = 0;
+    cursorStartUs_ = 0;
+    elapsedUs_ = 0;
+    state_ = STATE_RUNNING;
+    return true;
+}
+
+void TrajectoryPlayer::abort() {
+    if (state_ == STATE_RUNNING) {
+        state_ = STATE_ABORTED;
+    }
+}
+
+bool TrajectoryPlayer::update(uint32_t nowUs, float& linearX, float& angularZ) {
+    if (state_ != STATE_RUNNING) {
+        return false;
+    }
+
+    uint32_t elapsed = nowUs - startUs_;
+    if (elapsed >= totalUs_) {
+        // 最後まで実行したら停止
+        elapsedUs_ = totalUs_;
+        linearX = 0.0f;
+        angularZ = 0.0f;
+        state_ = STATE_DONE;
+        return true;
+    }
+
+    elapsedUs_ = elapsed;
+    evaluate(elapsed, linearX, angularZ);
+    return true;
+}
+
+bool TrajectoryPlayer::hasEnded(uint32_t nowUs) const {
+    return state_ == STATE_RUNNING && nowUs - startUs_ >= totalUs_;
+}
+
+void TrajectoryPlayer::evaluate(uint32_t elapsedUs, float& linearX, float& angularZ) {
+    if (elapsedUs < cursorStartUs_) {
+        cursor_ = 0;
+        cursorStartUs_ = 0;
+    }
+
+    // 経過時間を含むセグメントまで進める（最後のセグメントで止める）
+    uint8_t last = buffer_->getCount() - 1;
+    while (cursor_ < last) {
+        uint32_t durationUs = buffer_->getSegment(cursor_).durationMs * 1000UL;
+        if (elapsedUs < cursorStartUs_ + durationUs) {
+            break;
+        }
+        cursorStartUs_ += durationUs;
+        cursor_++;
+    }
+
+    const TrajectoryBuffer::Segment& segment = buffer_->getSegment(cursor_);
+    if (segment.mode != TrajectoryBuffer::MODE_RAMP) {
+        linearX = segment.linearX;
+        angularZ = segment.angularZ;
+        return;
+    }
+
+    // 直前のセグメントの値（先頭は開始時の値）から線形に変化
+    float fromLinearX = initialLinearX_;
+    float fromAngularZ = initialAngularZ_;
+    if (cursor_ > 0) {
+        fromLinearX = buffer_->getSegment(cursor_ - 1).linearX;
+        fromAngularZ = buffer_->getSegment(cursor_ - 1).angularZ;
+    }
+    float ratio = static_cast<float>(elapsedUs - cursorStartUs_) /
+                  (static_cast<float>(segment.durationMs) * 1000.0f);
+    if (ratio > 1.0f) {
+        ratio = 1.0f;
+    }
+    linearX = fromLinearX + (segment.linearX - fromLinearX) * ratio;
+    angularZ = fromAngularZ + (segment.angularZ - fromAngularZ) * ratio;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file TrajectoryBuffer.h
+ * @brief 速度軌道（セグメント列）の保持とCore1での実行
+ *
+ * ホストから (継続時間, 並進速度, 回転速度) のセグメント列をアップロードし、
+ * Core1が制御周期ごとに開始時刻からの経過時間で評価する。
+ * USBの遅延やホストのスケジューリングに依存せず、同じ軌道を同じ時間軸で再現できる。
+ *
+ * セグメントのモード:
+ * - STEP: 継続時間中、指定速度を保持
+ * - RAMP: 直前のセグメントの速度（先頭は開始時の速度）から指定速度まで線形に変化
+ *
+ * タイムスタンプ付きウェイポイント (t_i, v_i) は、継続時間 t_i - t_(i-1) の
+ * RAMPセグメントとして表現できる。
+ *
+ * 時刻はすべてuint32 [us]（約71分でラップアラウンド、差分で扱う）。
+ */
+
+#ifndef TRAJECTORY_BUFFER_H
+#define TRAJECTORY_BUFFER_H
+
+#include <stdint.h>
+
+/**
+ * @class TrajectoryBuffer
+ * @brief セグメント列の保持（アップロード先）
+ *
+ * Core0が書き込み、実行開始後はCore1が読み込む。
+ * 実行中のバッファにCore0が書き込まないよう、2面を交互に使う（ダブルバッファ）。
+ */
+class TrajectoryBuffer {
+public:
+    static constexpr uint8_t CAPACITY = 64;  // 1軌道あたりの最大セグメント数
+
+    enum SegmentMode : uint8_t {
+        MODE_STEP = 0,
+        MODE_RAMP = 1
+    };
+
+    struct Segment {
+        uint16_t durationMs;  // 継続時間 [ms]（1以上）
+        uint8_t mode;         // SegmentMode
+        float linearX;        // 並進速度 [m/s]（RAMPではセグメント終了時の値）
+        float angularZ;       // 回転速度 [rad/s]
+    };
+
+    TrajectoryBuffer();
+
+    /**
+     * @brief 全セグメントを破棄
+     */
+    void clear();
+
+    /**
+     * @brief セグメントを書き込み
+     *
+     * 途中の空きを防ぐため、indexは現在のセグメント数以下に限る
+     * （既存セグメントの上書き、または末尾への追加）。
+     *
+     * @param index 書き込み位置
+     * @param segment セグメント
+     * @return 書き込んだ場合true（位置・継続時間・モード・値が不正な場合false）
+     */
+    bool write(uint8_t index, const Segment& segment);
+
+    uint8_t getCount() const { return count_; }
+    const Segment& getSegment(uint8_t index) const { return segments_[index]; }
+
+    /**
+     * @brief 全セグメントの合計時間 [ms]
+     */
+    uint32_t getTotalDurationMs() const;
+
+private:
+    Segment segments_[CAPACITY];
+    uint8_t count_;
+};
+
+/**
+ * @class TrajectoryPlayer
+ * @brief TrajectoryBufferの実行（Core1）
+ *
+ * 使用例（Core1、制御周期ごと）:
+ * @code
+ * TrajectoryPlayer player;
+ * player.start(buffer, micros());
+ * // 制御周期ごと
+ * if (player.update(micros(), linearX, angularZ)) {
+ *     motorController.setCmdVel(linearX, angularZ);
+ * }
+ * @endcode
+ */
+class TrajectoryPlayer {
+public:
+    enum State : uint8_t {
+        STATE_IDLE = 0,     // 未実行
+        STATE_RUNNING = 1,  // 実行中
+        STATE_DONE = 2,     // 最後まで実行して停止
+        STATE_ABORTED = 3   // 中断
+    };
+
+    TrajectoryPlayer();
+
+    /**
+     * @brief 実行を開始
+     *
+     * 実行中に呼んだ場合は置き換える。RAMPの起点（開始時の速度）は、
+     * 実行中なら開始時刻での前の軌道の値、そうでなければ0とする。
+     * 前の軌道の終了時刻（getEndUs()）を渡すと、経過時間を引き継いで継ぎ目なく連結できる。
+     *
+     * @param buffer 実行するバッファ（実行中は変更しないこと）
+     * @param startUs 開始時刻 [us]（現在時刻以前）
+     * @return 開始した場合true（セグメントがない場合false、状態は変更しない）
+     */
+    bool start(const TrajectoryBuffer& buffer, uint32_t startUs);
+
+    /**
+     * @brief 実行を中断（実行中でなければ何もしない）
+     */
+    void abort();
+
+    /**
+     * @brief 制御周期ごとの評価
+     *
+     * 最後のセグメントを過ぎた周期では速度0を出力してSTATE_DONEになる。
+     *
+     * @param nowUs 現在時刻 [us]
+     * @param[out] linearX 並進速度 [m/s]
+     * @param[out] angularZ 回転速度 [rad/s]
+     * @return 出力した場合true（実行中でない場合false、出力は変更しない）
+     */
+    bool update(uint32_t nowUs, float& linearX, float& angularZ);
+
+    bool isRunning() const { return state_ == STATE_RUNNING; }
+    State getState() const { return state_; }
+
+    /**
+     * @brief 実行中の軌道が指定時刻までに終了しているか
+     */
+    bool hasEnded(uint32_t nowUs) const;
+
+    /**
+     * @brief 実行中の軌道の終了時刻 [us]
+     */
+    uint32_t getEndUs() const { return startUs_ + totalUs_; }
+
+    /**
+     * @brief 実行中（または直前に実行した）軌道の合計時間 [ms]
+     */
+    uint32_t getDurationMs() const { return totalUs_ / 1000; }
+
+    // 直近のupdate()で評価したセグメント番号・経過時間
+    uint8_t getSegmentIndex() const { return cursor_; }
+    uint32_t getElapsedMs() const { return elapsedUs_ / 1000; }
+
+private:
+    /**
+     * @brief 経過時間での速度を評価（経過時間は単調増加で呼ぶこと）
+     */
+    void evaluate(uint32_t elapsedUs, float& linearX, float& angularZ);
+
+    const TrajectoryBuffer* buffer_;
+    uint32_t startUs_;
+    uint32_t totalUs_;
+    float initialLinearX_;     // 先頭RAMPの起点
+    float initialAngularZ_;
+    uint8_t cursor_;           // 評価中のセグメント
+    uint32_t cursorStartUs_;   // 評価中セグメントの開始（経過時間）
+    uint32_t elapsedUs_;
+    State state_;
+};
+
+#endif // TRAJECTORY_BUFFER_H
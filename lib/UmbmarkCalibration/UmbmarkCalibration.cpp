@@ -0,0 +1,204 @@
+/**
+ * @file UmbmarkCalibration.cpp
+ * @brief UMBmarkによる実効ジオメトリ推定 実装
+ */
+
+#include "UmbmarkCalibration.h"
+#include <cmath>
+
+namespace {
+    constexpr double PI = 3.14159265358979323846;
+    constexpr int MAX_ITERATIONS = 50;
+    constexpr double CONVERGENCE_STEP = 1e-12;
+    constexpr double JACOBIAN_STEP = 1e-7;
+
+    /**
+     * 左右の移動量から姿勢を円弧で更新
+     */
+    void advance(double& x, double& y, double& theta,
+                 double distanceL, double distanceR, double trackWidth) {
+        double distance = (distanceL + distanceR) * 0.5;
+        double deltaTheta = (distanceR - distanceL) / trackWidth;
+        if (std::fabs(deltaTheta) < 1e-12) {
+            x += distance * std::cos(theta);
+            y += distance * std::sin(theta);
+        } else {
+            double radius = distance / deltaTheta;
+            x += radius * (std::sin(theta + deltaTheta) - std::sin(theta));
+            y -= radius * (std::cos(theta + deltaTheta) - std::cos(theta));
+        }
+        theta += deltaTheta;
+    }
+
+    /**
+     * 直径比k・トレッド比ebから実際のジオメトリを作成
+     * 平均直径はスケールscale倍、左右は (1∓k) 倍
+     */
+    UmbmarkCalibration::Geometry makeGeometry(double wheelDiameter, double trackWidth,
+                                              double scale, double k, double eb) {
+        UmbmarkCalibration::Geometry g;
+        g.wheelDiameterL = wheelDiameter * scale * (1.0 - k);
+        g.wheelDiameterR = wheelDiameter * scale * (1.0 + k);
+        g.trackWidth = trackWidth * eb;
+        return g;
+    }
+}
+
+UmbmarkCalibration::UmbmarkCalibration(double wheelDiameter, double trackWidth, double sideLength)
+    : wheelDiameter_(wheelDiameter)
+    , trackWidth_(trackWidth)
+    , sideLength_(sideLength)
+    , errorSumX_{0.0, 0.0}
+    , errorSumY_{0.0, 0.0}
+    , runCount_{0, 0}
+    , straightOdomSum_(0.0)
+    , straightMeasuredSum_(0.0)
+{
+}
+
+void UmbmarkCalibration::addStraightRun(double odomDistance, double measuredDistance) {
+    straightOdomSum_ += odomDistance;
+    straightMeasuredSum_ += measuredDistance;
+}
+
+void UmbmarkCalibration::addSquareRun(Direction direction, double odomX, double odomY,
+                                      double measuredX, double measuredY) {
+    errorSumX_[direction] += measuredX - odomX;
+    errorSumY_[direction] += measuredY - odomY;
+    runCount_[direction]++;
+}
+
+double UmbmarkCalibration::getDistanceScale() const {
+    if (straightOdomSum_ <= 0.0 || straightMeasuredSum_ <= 0.0) {
+        return 1.0;
+    }
+    return straightMeasuredSum_ / straightOdomSum_;
+}
+
+size_t UmbmarkCalibration::getRunCount(Direction direction) const {
+    return runCount_[direction];
+}
+
+bool UmbmarkCalibration::solve(Geometry& result) const {
+    if (runCount_[CW] == 0 || runCount_[CCW] == 0 ||
+        wheelDiameter_ <= 0.0 || trackWidth_ <= 0.0 || sideLength_ <= 0.0) {
+        return false;
+    }
+
+    // 方向ごとの誤差の重心
+    const double measured[4] = {
+        errorSumX_[CW] / static_cast<double>(runCount_[CW]),
+        errorSumY_[CW] / static_cast<double>(runCount_[CW]),
+        errorSumX_[CCW] / static_cast<double>(runCount_[CCW]),
+        errorSumY_[CCW] / static_cast<double>(runCount_[CCW])
+    };
+    const double scale = getDistanceScale();
+
+    // 残差（モデル終点 − 実測誤差）
+    auto residual = [&](double k, double eb, double r[4]) {
+        Geometry g = makeGeometry(wheelDiameter_, trackWidth_, scale, k, eb);
+        simulateSquare(sideLength_, wheelDiameter_, trackWidth_, g, CW, r[0], r[1]);
+        simulateSquare(sideLength_, wheelDiameter_, trackWidth_, g, CCW, r[2], r[3]);
+        for (int i = 0; i < 4; i++) {
+            r[i] -= measured[i];
+        }
+    };
+
+    auto squaredNorm = [](const double r[4]) {
+        return r[0] * r[0] + r[1] * r[1] + r[2] * r[2] + r[3] * r[3];
+    };
+
+    // ガウス・ニュートン法（初期値は誤差なし: k=0, eb=1）
+    // 誤差が大きいと非線形性が強いため、残差が減るまでステップを半減する
+    double k = 0.0;
+    double eb = 1.0;
+    double r[4];
+    residual(k, eb, r);
+    double cost = squaredNorm(r);
+    bool converged = false;
+    for (int iter = 0; iter < MAX_ITERATIONS; iter++) {
+        double rk[4];
+        double rb[4];
+        residual(k + JACOBIAN_STEP, eb, rk);
+        residual(k, eb + JACOBIAN_STEP, rb);
+
+        // J^T J と J^T r
+        double a11 = 0.0, a12 = 0.0, a22 = 0.0, g1 = 0.0, g2 = 0.0;
+        for (int i = 0; i < 4; i++) {
+            double jk = (rk[i] - r[i]) / JACOBIAN_STEP;
+            double jb = (rb[i] - r[i]) / JACOBIAN_STEP;
+            a11 += jk * jk;
+            a12 += jk * jb;
+            a22 += jb * jb;
+            g1 += jk * r[i];
+            g2 += jb * r[i];
+        }
+        double det = a11 * a22 - a12 * a12;
+        if (std::fabs(det) < 1e-18) {
+            return false;
+        }
+        double stepK = -(a22 * g1 - a12 * g2) / det;
+        double stepB = -(a11 * g2 - a12 * g1) / det;
+
+        // 直径比は |k|<1、トレッド比は正の範囲に収まり、残差が減るまで半減
+        bool accepted = false;
+        for (int halving = 0; halving < 30; halving++) {
+            double nextK = k + stepK;
+            double nextEb = eb + stepB;
+            if (std::fabs(nextK) < 1.0 && nextEb > 0.0) {
+                double nextR[4];
+                residual(nextK, nextEb, nextR);
+                double nextCost = squaredNorm(nextR);
+                if (nextCost <= cost) {
+                    k = nextK;
+                    eb = nextEb;
+                    cost = nextCost;
+                    for (int i = 0; i < 4; i++) {
+                        r[i] = nextR[i];
+                    }
+                    accepted = true;
+                    break;
+                }
+            }
+            stepK *= 0.5;
+            stepB *= 0.5;
+        }
+        if (!accepted ||
+            (std::fabs(stepK) < CONVERGENCE_STEP && std::fabs(stepB) < CONVERGENCE_STEP)) {
+            // これ以上減らない点を収束とみなす
+            converged = true;
+            break;
+        }
+    }
+    if (!converged) {
+        return false;
+    }
+
+    result = makeGeometry(wheelDiameter_, trackWidth_, scale, k, eb);
+    return true;
+}
+
+void UmbmarkCalibration::simulateSquare(double sideLength, double wheelDiameter, double trackWidth,
+                                        const Geometry& actual, Direction direction,
+                                        double& endX, double& endY) {
+    // オドメトリ上で一辺分進むホイール回転数、90°旋回するホイール回転数（片輪）
+    const double legRevolutions = sideLength / (PI * wheelDiameter);
+    const double turnRevolutions = (PI * 0.5) * trackWidth * 0.5 / (PI * wheelDiameter);
+    const double turnSign = (direction == CCW) ? 1.0 : -1.0;
+
+    double x = 0.0;
+    double y = 0.0;
+    double theta = 0.0;
+    for (int leg = 0; leg < 4; leg++) {
+        advance(x, y, theta,
+                legRevolutions * PI * actual.wheelDiameterL,
+                legRevolutions * PI * actual.wheelDiameterR,
+                actual.trackWidth);
+        advance(x, y, theta,
+                -turnSign * turnRevolutions * PI * actual.wheelDiameterL,
+                turnSign * turnRevolutions * PI * actual.wheelDiameterR,
+                actual.trackWidth);
+    }
+    endX = x;
+    endY = y;
+}
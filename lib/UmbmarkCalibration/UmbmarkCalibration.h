@@ -0,0 +1,133 @@
+/**
+ * @file UmbmarkCalibration.h
+ * @brief UMBmark（双方向正方形走行）による実効ジオメトリの推定
+ *
+ * オドメトリ上で一辺Lの正方形を時計回り（CW）・反時計回り（CCW）に走行し、
+ * 実測した終点とオドメトリの終点の差から、左右の実効ホイール直径と
+ * 実効トレッド幅を求める（Borenstein & Feng の UMBmark）。
+ *
+ * - 左右直径の差: 直進区間が弧になり、CW/CCWで同じ向きに曲がる
+ * - トレッド幅の誤差: 90°旋回の過不足が、CW/CCWで逆向きに現れる
+ * - 平均直径（スケール）: 直進走行の実測距離から求める
+ *
+ * 小角近似の閉形式ではなく、正方形走行の順モデルを2変数（直径比・トレッド比）で
+ * ガウス・ニュートン法により当てはめるため、誤差が大きい場合も1回で収束する。
+ *
+ * ホスト側ツール（tools/calibration）専用。ファームウェアには組み込まない。
+ */
+
+#ifndef UMBMARK_CALIBRATION_H
+#define UMBMARK_CALIBRATION_H
+
+#include <stddef.h>
+
+/**
+ * @class UmbmarkCalibration
+ * @brief UMBmark計測結果の集計と実効ジオメトリの推定
+ *
+ * 使用例:
+ * @code
+ * UmbmarkCalibration calib(0.1, 0.3, 2.0);   // 現在の設定値と正方形の一辺
+ * calib.addStraightRun(2.0, 2.013);           // オドメトリ距離, 実測距離
+ * calib.addSquareRun(UmbmarkCalibration::CW, odomX, odomY, measuredX, measuredY);
+ * calib.addSquareRun(UmbmarkCalibration::CCW, odomX, odomY, measuredX, measuredY);
+ * UmbmarkCalibration::Geometry result;
+ * if (calib.solve(result)) {
+ *     // result.wheelDiameterL / wheelDiameterR / trackWidth
+ * }
+ * @endcode
+ */
+class UmbmarkCalibration {
+public:
+    // 正方形の走行方向
+    enum Direction {
+        CW = 0,   // 時計回り（右旋回）
+        CCW = 1   // 反時計回り（左旋回）
+    };
+
+    // 左右の実効ホイール直径とトレッド幅 [m]
+    struct Geometry {
+        double wheelDiameterL;
+        double wheelDiameterR;
+        double trackWidth;
+    };
+
+    /**
+     * @brief コンストラクタ
+     * @param wheelDiameter 走行時にオドメトリが使っていたホイール直径 [m]
+     * @param trackWidth 走行時にオドメトリが使っていたトレッド幅 [m]
+     * @param sideLength 正方形の一辺 [m]（オドメトリ上の距離）
+     */
+    UmbmarkCalibration(double wheelDiameter, double trackWidth, double sideLength);
+
+    /**
+     * @brief 直進走行の結果を追加（平均直径のスケール推定用）
+     * @param odomDistance オドメトリ上の走行距離 [m]
+     * @param measuredDistance 実測の走行距離 [m]
+     */
+    void addStraightRun(double odomDistance, double measuredDistance);
+
+    /**
+     * @brief 正方形走行の結果を追加
+     *
+     * 座標は走行開始時の姿勢を原点とし、x=前方、y=左方。
+     * 誤差は「実測 − オドメトリ」とし、方向ごとに平均（重心）を使う。
+     *
+     * @param direction 走行方向
+     * @param odomX 終点のオドメトリX [m]
+     * @param odomY 終点のオドメトリY [m]
+     * @param measuredX 終点の実測X [m]
+     * @param measuredY 終点の実測Y [m]
+     */
+    void addSquareRun(Direction direction, double odomX, double odomY,
+                      double measuredX, double measuredY);
+
+    /**
+     * @brief 集計結果から実効ジオメトリを推定
+     * @param[out] result 推定結果
+     * @return CW/CCWの両方の結果があり、収束した場合true
+     */
+    bool solve(Geometry& result) const;
+
+    /**
+     * @brief 直進走行から求めた平均直径の倍率（直進走行がなければ1.0）
+     */
+    double getDistanceScale() const;
+
+    size_t getRunCount(Direction direction) const;
+
+    /**
+     * @brief 正方形走行の順モデル（ハードウェア非依存、テスト可能）
+     *
+     * オドメトリ（直径 wheelDiameter・トレッド trackWidth）上で一辺 sideLength の
+     * 直進と90°その場旋回を4回繰り返したとき、実際のジオメトリで到達する終点を返す。
+     * 直進は左右同じ回転数、旋回は左右逆向きの同じ回転数として円弧で積分する。
+     *
+     * @param sideLength 正方形の一辺 [m]
+     * @param wheelDiameter オドメトリの直径 [m]
+     * @param trackWidth オドメトリのトレッド幅 [m]
+     * @param actual 実際のジオメトリ
+     * @param direction 走行方向
+     * @param[out] endX 終点X [m]
+     * @param[out] endY 終点Y [m]
+     */
+    static void simulateSquare(double sideLength, double wheelDiameter, double trackWidth,
+                               const Geometry& actual, Direction direction,
+                               double& endX, double& endY);
+
+private:
+    double wheelDiameter_;
+    double trackWidth_;
+    double sideLength_;
+
+    // 方向ごとの誤差（実測 − オドメトリ）の合計と回数
+    double errorSumX_[2];
+    double errorSumY_[2];
+    size_t runCount_[2];
+
+    // 直進走行の合計
+    double straightOdomSum_;
+    double straightMeasuredSum_;
+};
+
+#endif // UMBMARK_CALIBRATION_H
@@ -9,13 +9,36 @@
 
 #include <Arduino.h>
 #include <PacketSerial.h>
+#include "hardware/structs/xip_ctrl.h"
 
 #include "main.h"
 #include "Protocol.h"
 #include "MotorController.h"
 #include "QuadratureEncoder.h"
 #include "MotorDriver.h"
+#include "HBridgeDriver.h"
+#include "Ld2Driver.h"
 #include "PidController.h"
+#include "BatteryMonitor.h"
+#include "CurrentSensor.h"
+#include "CurrentSampler.h"
+#include "ThermalModel.h"
+#include "PwmPhase.h"
+#include "StallDetector.h"
+#include "Odometry.h"
+#include "CommandInterpolator.h"
+#include "CommandDeadline.h"
+#include "ControlTimer.h"
+#include "ControlScheduler.h"
+#include "CommandDoorbell.h"
+#include "CoreWatchdog.h"
+#include "TimingStats.h"
+#include "PositionController.h"
+#include "TrajectoryBuffer.h"
+#include "RamFunc.h"
+
+// 基板上でPWMを生成するバックエンド（電流サンプリング・電圧補償が有効）
+#define LOCAL_PWM_BACKEND (MOTOR_BACKEND != MOTOR_BACKEND_LD2)
 
 #ifdef DEBUG_BUILD
 #include "DebugLogger.h"
@@ -28,6 +51,13 @@
 // 共有データ（コア間通信）
 volatile CmdVelData cmdVelData;
 volatile MotorStateData motorStateData;
+TimingData timingData;
+ControlConfigData controlConfigData;
+OdometryData odometryData;
+
+// 起動から最初の制御周期の完了まで [us]（Core1が1回だけ書き込む。0は未完了）
+// Core1はCore0のsetup()より先に動き始めるため、setup()では初期化しない
+volatile uint32_t firstTickUs = 0;
 
 // 設定・ステータス
 RobotConfig config;
@@ -48,20 +78,51 @@ QuadratureEncoder encoderL(
 QuadratureEncoder encoderR(
     HardwareConfig::ENCODER_R_A,
     HardwareConfig::ENCODER_R_B,
-    HardwareConfig::Defaults::ENCODER_PPR
+    HardwareConfig::Defaults::ENCODER_PPR_R
 );
 
 // 右モータは反転（差動二輪のため）
+#if MOTOR_BACKEND == MOTOR_BACKEND_IN1_IN2
+typedef HBridgeDriver ActiveMotorDriver;
+HBridgeDriver driverL(
+    HardwareConfig::MOTOR_L_IN1,
+    HardwareConfig::MOTOR_L_IN2,
+    false,  // 反転なし
+    HBridgeDriver::DECAY_FAST
+);
+HBridgeDriver driverR(
+    HardwareConfig::MOTOR_R_IN1,
+    HardwareConfig::MOTOR_R_IN2,
+    true,   // 反転あり
+    HBridgeDriver::DECAY_FAST
+);
+#elif MOTOR_BACKEND == MOTOR_BACKEND_LD2
+// LD-2は左右の回転方向をドライバ側で合わせるため反転なし
+void writeLd2Frame(const uint8_t* data, size_t length) {
+    Serial2.write(data, length);
+}
+
+typedef Ld2Driver ActiveMotorDriver;
+Ld2Link ld2Link(writeLd2Frame);
+Ld2Driver driverL(ld2Link, Ld2Link::SIDE_L);
+Ld2Driver driverR(ld2Link, Ld2Link::SIDE_R);
+#else
+typedef MotorDriver ActiveMotorDriver;
 MotorDriver driverL(
     HardwareConfig::MOTOR_L_DIR,
     HardwareConfig::MOTOR_L_PWM,
-    false  // 反転なし
+    false,  // 反転なし
+    MotorDriver::DECAY_SIGN_MAGNITUDE_COAST,
+    HardwareConfig::MOTOR_L_BRAKE
 );
 MotorDriver driverR(
     HardwareConfig::MOTOR_R_DIR,
     HardwareConfig::MOTOR_R_PWM,
-    true   // 反転あり
+    true,   // 反転あり
+    MotorDriver::DECAY_SIGN_MAGNITUDE_COAST,
+    HardwareConfig::MOTOR_R_BRAKE
 );
+#endif
 
 PidController pidL(
     HardwareConfig::Defaults::PID_KP,
@@ -69,34 +130,186 @@ PidController pidL(
     HardwareConfig::Defaults::PID_KD
 );
 PidController pidR(
-    HardwareConfig::Defaults::PID_KP,
-    HardwareConfig::Defaults::PID_KI,
-    HardwareConfig::Defaults::PID_KD
+    HardwareConfig::Defaults::PID_KP_R,
+    HardwareConfig::Defaults::PID_KI_R,
+    HardwareConfig::Defaults::PID_KD_R
+);
+
+#if LOCAL_PWM_BACKEND
+// モータ電流センサ（PWM同期ADC + DMA）
+CurrentSensor currentSensorL(
+    HardwareConfig::CURRENT_AMPS_PER_VOLT,
+    HardwareConfig::CURRENT_ZERO_OFFSET_RAW,
+    HardwareConfig::OVERCURRENT_TRIP_AMPS
+);
+CurrentSensor currentSensorR(
+    HardwareConfig::CURRENT_AMPS_PER_VOLT,
+    HardwareConfig::CURRENT_ZERO_OFFSET_RAW,
+    HardwareConfig::OVERCURRENT_TRIP_AMPS
+);
+CurrentSampler currentSampler(
+    currentSensorL, currentSensorR,
+    HardwareConfig::MOTOR_L_PWM, HardwareConfig::MOTOR_R_PWM,
+    HardwareConfig::CURRENT_L_ADC_PIN, HardwareConfig::CURRENT_R_ADC_PIN,
+    HardwareConfig::BATTERY_ADC_PIN
 );
 
-MotorController motorController(
+// バッテリ電圧監視（ADCはCurrentSamplerが占有するため、そのリングから取得）
+uint16_t readBatteryAdc() {
+    return currentSampler.getLatestRaw(CurrentSampler::CHANNEL_BATTERY);
+}
+#else
+// PWM同期サンプリングなし: バス電圧のみ直接読み取り
+uint16_t readBatteryAdc() {
+    return analogRead(HardwareConfig::BATTERY_ADC_PIN);
+}
+#endif
+
+BatteryMonitor batteryMonitor(
+    readBatteryAdc,
+    HardwareConfig::BATTERY_DIVIDER_RATIO,
+    HardwareConfig::BATTERY_LOW_VOLTAGE,
+    HardwareConfig::BATTERY_LOW_HYSTERESIS,
+    HardwareConfig::BATTERY_FILTER_ALPHA
+);
+
+// モータ熱保護（I²t推定）
+ThermalModel thermalL(
+    HardwareConfig::THERMAL_TIME_CONSTANT_S,
+    HardwareConfig::THERMAL_DERATE_START,
+    HardwareConfig::THERMAL_MIN_SCALE,
+    HardwareConfig::THERMAL_CLEAR_LEVEL
+);
+ThermalModel thermalR(
+    HardwareConfig::THERMAL_TIME_CONSTANT_S,
+    HardwareConfig::THERMAL_DERATE_START,
+    HardwareConfig::THERMAL_MIN_SCALE,
+    HardwareConfig::THERMAL_CLEAR_LEVEL
+);
+
+// ストール検出
+StallDetector stallL(
+    HardwareConfig::STALL_DUTY_THRESHOLD,
+    HardwareConfig::STALL_RPM_THRESHOLD,
+    HardwareConfig::STALL_DETECT_TIME_S,
+    HardwareConfig::STALL_COOLDOWN_S
+);
+StallDetector stallR(
+    HardwareConfig::STALL_DUTY_THRESHOLD,
+    HardwareConfig::STALL_RPM_THRESHOLD,
+    HardwareConfig::STALL_DETECT_TIME_S,
+    HardwareConfig::STALL_COOLDOWN_S
+);
+
+MotorControllerT<ActiveMotorDriver> motorController(
     encoderL, encoderR,
     driverL, driverR,
     pidL, pidR,
-    0.1f,   // wheelDiameter [m]
-    0.3f,   // trackWidth [m]
+    HardwareConfig::Defaults::WHEEL_DIAMETER,
+    HardwareConfig::Defaults::TRACK_WIDTH,
     HardwareConfig::Defaults::GEAR_RATIO,
     HardwareConfig::Defaults::MAX_RPM
 );
 
+// タイムスタンプ付き指令の補間（Core1）
+CommandInterpolator commandInterpolator(
+    HardwareConfig::CMD_INTERP_DELAY_US,
+    HardwareConfig::CMD_MAX_EXTRAPOLATION_US
+);
+
+// 制御周波数の上限（RPM指令型はドライバ側で速度制御するため、指令の送信は公開周波数まで）
+constexpr uint16_t CONTROL_RATE_LIMIT_HZ = ActiveMotorDriver::RPM_COMMAND
+    ? HardwareConfig::CONTROL_PUBLISH_RATE_HZ : HardwareConfig::CONTROL_RATE_MAX_HZ;
+
+// マルチレート制御ループの分周（Core1）
+ControlScheduler controlScheduler(
+    HardwareConfig::CONTROL_RATE_DEFAULT_HZ,
+    CONTROL_RATE_LIMIT_HZ,
+    HardwareConfig::CONTROL_PROFILE_RATE_HZ,
+    HardwareConfig::CONTROL_PUBLISH_RATE_HZ
+);
+
+// 制御周期のハードウェアアラーム（Core1）
+ControlTimer controlTimer(controlScheduler.getPeriodUs());
+
+// MOTOR_COMMANDの到着通知（Core0が鳴らし、Core1が周期の途中で指令を適用）
+CommandDoorbell commandDoorbell;
+
+// 周期の途中で指令を適用する際の前回の実行・次の周期からの最小間隔
+// （RPM指令型はドライバへの送信を公開周波数までとするため、次の周期で適用）
+constexpr uint32_t DOORBELL_MIN_INTERVAL_US = ActiveMotorDriver::RPM_COMMAND
+    ? 1000000UL / HardwareConfig::CONTROL_PUBLISH_RATE_HZ
+    : HardwareConfig::COMMAND_DOORBELL_MIN_INTERVAL_US;
+
+// 制御周期の時間計測（Core1、GET_TIMINGで取得。ビンはconfigureTimingStats()で周期に合わせる）
+TimingStats periodStats(0, 1);
+TimingStats execStats(0, 1);
+TimingStats latencyStats(0, 1);  // MOTOR_COMMAND受信からドライバ出力の更新まで
+
+// 速度指令ごとの有効期限（Core1）
+CommandDeadline commandDeadline(
+    HardwareConfig::COMMAND_VALIDITY_DEFAULT_MS,
+    HardwareConfig::COMMAND_VALIDITY_MAX_MS,
+    HardwareConfig::COMMAND_EXPIRED_RAMP_MS
+);
+
+// 位置制御（MOTOR_POSITION、Core1）
+PositionController positionController(
+    HardwareConfig::POSITION_KP,
+    HardwareConfig::Defaults::ENCODER_PPR,
+    HardwareConfig::POSITION_TOLERANCE_COUNTS,
+    HardwareConfig::POSITION_SETTLE_S
+);
+
+// 軌道バッファ（2面を交互に使う。Core0はアップロード先のみ書き込み、
+// Core1は開始要求を処理した後に実行中のバッファのみ読み込む）
+TrajectoryBuffer trajectoryBuffers[2];
+uint8_t trajectoryLoadIndex = 0;  // Core0のアップロード先
+TrajectoryPlayer trajectoryPlayer;
+
+// オドメトリ（Core1が制御周期ごとに積算）
+Odometry odometry(
+    HardwareConfig::Defaults::WHEEL_DIAMETER,
+    HardwareConfig::Defaults::TRACK_WIDTH,
+    HardwareConfig::Defaults::GEAR_RATIO,
+    HardwareConfig::Defaults::ENCODER_PPR
+);
+
+// 両コアの生存監視（Core0が起動時に開始し、Core1が制御周期ごとに更新）
+CoreWatchdog coreWatchdog(
+    HardwareConfig::WATCHDOG_TIMEOUT_MS,
+    HardwareConfig::WATCHDOG_CORE0_MAX_AGE_MS,
+    HardwareConfig::WATCHDOG_CORE1_MAX_AGE_MS
+);
+
 // =============================================================================
 // プロトコルハンドラ
 // =============================================================================
 
+/**
+ * Core0とCore1のステータスフラグを合成
+ */
+uint16_t getStatusFlags() {
+    return systemStatus.flags | motorStateData.statusFlags;
+}
+
 /**
  * MOTOR_COMMANDハンドラ
  */
 void handleMotorCommand(const Protocol::ParsedRequest& req) {
-    // 共有メモリに書き込み
+    // 共有メモリに書き込み（指令を書いてからシーケンス番号を進める）
     cmdVelData.linearX = req.motorCommand.linearX;
     cmdVelData.angularZ = req.motorCommand.angularZ;
+    cmdVelData.commandTimestampUs = req.motorCommand.timestampUs;
+    cmdVelData.commandReceivedUs = micros();
+    cmdVelData.commandHasTimestamp = req.motorCommand.hasTimestamp;
+    cmdVelData.commandValidityMs = req.motorCommand.validityMs;
+    cmdVelData.commandSeq = cmdVelData.commandSeq + 1;
     cmdVelData.failsafeStop = false;
 
+    // 待機中のCore1を起こし、次の制御周期を待たずに指令を適用させる
+    commandDoorbell.ring(cmdVelData.commandSeq);
+
     // フェイルセーフタイマーリセット
     lastCommandTimeMs = millis();
     systemStatus.flags &= ~Protocol::STATUS_FAILSAFE;
@@ -105,7 +318,7 @@ void handleMotorCommand(const Protocol::ParsedRequest& req) {
     Protocol::MotorCommandResponse resp;
     resp.encoderCountL = motorStateData.encoderCountL;
     resp.encoderCountR = motorStateData.encoderCountR;
-    resp.status = systemStatus.flags;
+    resp.status = getStatusFlags();
 
     uint8_t buffer[32];
     uint8_t length = Protocol::createMotorCommandResponse(resp, buffer, sizeof(buffer));
@@ -131,10 +344,13 @@ void handleGetVersion() {
  */
 void handleGetStatus() {
     Protocol::StatusResponse resp;
-    resp.status = systemStatus.flags;
+    resp.status = getStatusFlags();
     resp.errorCode = systemStatus.lastErrorCode;
+    resp.resetReason = coreWatchdog.getResetReason();
     resp.commErrorCount = systemStatus.commErrorCount;
+    resp.watchdogResetCount = coreWatchdog.getWatchdogResetCount();
     resp.uptimeMs = millis();
+    resp.firstTickUs = firstTickUs;
 
     uint8_t buffer[32];
     uint8_t length = Protocol::createStatusResponse(resp, buffer, sizeof(buffer));
@@ -154,17 +370,49 @@ void handleGetConfig() {
     resp.gearRatio = config.gearRatio;
     resp.wheelDiameter = config.wheelDiameter;
     resp.trackWidth = config.trackWidth;
+    resp.pidKpR = config.pidKpR;
+    resp.pidKiR = config.pidKiR;
+    resp.pidKdR = config.pidKdR;
+    resp.encoderPprR = config.encoderPprR;
+    resp.gearRatioR = config.gearRatioR;
+    resp.wheelDiameterR = config.wheelDiameterR;
+    resp.hasPerSide = true;
+    resp.controlRateHz = config.controlRateHz;
+    resp.hasControlRate = true;
 
     uint8_t buffer[64];
     uint8_t length = Protocol::createConfigResponse(resp, buffer, sizeof(buffer));
     packetSerial.send(buffer, length);
 }
 
+/**
+ * SET_CONFIGのジオメトリ（左右別）が正の値か
+ */
+bool isValidGeometry(const Protocol::ConfigData& cfg) {
+    return cfg.encoderPpr > 0 && cfg.encoderPprR > 0 &&
+           cfg.gearRatio > 0.0f && cfg.gearRatioR > 0.0f &&
+           cfg.wheelDiameter > 0.0f && cfg.wheelDiameterR > 0.0f &&
+           cfg.trackWidth > 0.0f;
+}
+
 /**
  * SET_CONFIGハンドラ
  * TODO: ConfigStorage実装後にFlash保存を追加
  */
 void handleSetConfig(const Protocol::ParsedRequest& req) {
+    // 制御周波数は公開周波数（100Hz）の整数倍、上限以下のみ
+    // ジオメトリは正の値のみ（Core1で除数になるため）。不正な場合は何も変更しない
+    if ((req.setConfig.hasControlRate &&
+        !ControlScheduler::isValidRate(req.setConfig.controlRateHz, CONTROL_RATE_LIMIT_HZ,
+                                       HardwareConfig::CONTROL_PUBLISH_RATE_HZ)) ||
+        !isValidGeometry(req.setConfig)) {
+        uint8_t buffer[16];
+        uint8_t length = Protocol::createSetConfigResponse(
+            Protocol::CONFIG_RESULT_INVALID_VALUE, buffer, sizeof(buffer));
+        packetSerial.send(buffer, length);
+        return;
+    }
+
     // 設定値を更新
     config.pidKp = req.setConfig.pidKp;
     config.pidKi = req.setConfig.pidKi;
@@ -174,8 +422,37 @@ void handleSetConfig(const Protocol::ParsedRequest& req) {
     config.gearRatio = req.setConfig.gearRatio;
     config.wheelDiameter = req.setConfig.wheelDiameter;
     config.trackWidth = req.setConfig.trackWidth;
+    // 30バイト版ではパース時に左と同じ値が入る
+    config.pidKpR = req.setConfig.pidKpR;
+    config.pidKiR = req.setConfig.pidKiR;
+    config.pidKdR = req.setConfig.pidKdR;
+    config.encoderPprR = req.setConfig.encoderPprR;
+    config.gearRatioR = req.setConfig.gearRatioR;
+    config.wheelDiameterR = req.setConfig.wheelDiameterR;
+
+    // 制御周波数はCore1が制御周期の終わりに適用（変更時のみ）
+    if (req.setConfig.hasControlRate && req.setConfig.controlRateHz != config.controlRateHz) {
+        config.controlRateHz = req.setConfig.controlRateHz;
+        cmdVelData.controlRateHz = config.controlRateHz;
+        cmdVelData.controlRateSeq = cmdVelData.controlRateSeq + 1;
+    }
 
-    // TODO: PIDゲインをCore1のPIDControllerに反映
+    // PIDゲイン・ジオメトリ（左右別）もCore1が制御周期の終わりに適用
+    ControlConfigData controlConfig;
+    controlConfig.pidKpL = config.pidKp;
+    controlConfig.pidKiL = config.pidKi;
+    controlConfig.pidKdL = config.pidKd;
+    controlConfig.pidKpR = config.pidKpR;
+    controlConfig.pidKiR = config.pidKiR;
+    controlConfig.pidKdR = config.pidKdR;
+    controlConfig.encoderPprL = config.encoderPpr;
+    controlConfig.encoderPprR = config.encoderPprR;
+    controlConfig.gearRatioL = config.gearRatio;
+    controlConfig.gearRatioR = config.gearRatioR;
+    controlConfig.wheelDiameterL = config.wheelDiameter;
+    controlConfig.wheelDiameterR = config.wheelDiameterR;
+    controlConfig.trackWidth = config.trackWidth;
+    writeControlConfigData(&controlConfigData, controlConfig);
 
     uint8_t buffer[16];
     uint8_t length = Protocol::createSetConfigResponse(
@@ -196,12 +473,247 @@ void handleGetDebugOutput() {
     resp.currentRpmR = motorStateData.currentRpmR;
     resp.pwmDutyL = 0.0f;  // TODO: MotorDriverから取得
     resp.pwmDutyR = 0.0f;
+    resp.currentRmsL = motorStateData.currentRmsL;
+    resp.currentRmsR = motorStateData.currentRmsR;
+    resp.currentPeakL = motorStateData.currentPeakL;
+    resp.currentPeakR = motorStateData.currentPeakR;
 
     uint8_t buffer[64];
     uint8_t length = Protocol::createDebugOutputResponse(resp, buffer, sizeof(buffer));
     packetSerial.send(buffer, length);
 }
 
+/**
+ * GET_ODOMETRYハンドラ
+ * Core1の書き込みと重なった場合は読み直す（GET_TIMINGと同様）
+ */
+void handleGetOdometry() {
+    OdometryData odom;
+    if (!readOdometryData(&odometryData, &odom, 8)) {
+        // Core1の更新と競合し続けた場合はBUSYを返す（ホスト側で再要求）
+        uint8_t buffer[16];
+        uint8_t length = Protocol::createOdometryResultResponse(
+            Protocol::ODOMETRY_RESULT_BUSY, buffer, sizeof(buffer));
+        packetSerial.send(buffer, length);
+        return;
+    }
+
+    Protocol::OdometryResponse resp;
+    resp.x = odom.x;
+    resp.y = odom.y;
+    resp.theta = odom.theta;
+    resp.linearX = odom.linearX;
+    resp.angularZ = odom.angularZ;
+    resp.timestampUs = odom.timestampUs;
+
+    uint8_t buffer[32];
+    uint8_t length = Protocol::createOdometryResponse(resp, buffer, sizeof(buffer));
+    packetSerial.send(buffer, length);
+}
+
+/**
+ * RESET_ODOMETRYハンドラ
+ * Core1が次の制御周期で適用する
+ */
+void handleResetOdometry(const Protocol::ParsedRequest& req) {
+    cmdVelData.odometryResetX = req.resetOdometry.x;
+    cmdVelData.odometryResetY = req.resetOdometry.y;
+    cmdVelData.odometryResetTheta = req.resetOdometry.theta;
+    cmdVelData.odometryResetSeq = cmdVelData.odometryResetSeq + 1;
+
+    uint8_t buffer[16];
+    uint8_t length = Protocol::createResetOdometryResponse(0x00, buffer, sizeof(buffer));
+    packetSerial.send(buffer, length);
+}
+
+/**
+ * MOTOR_POSITIONハンドラ
+ * Core1が次の制御周期で開始し、進捗はステータスフラグで通知する
+ */
+void handleMotorPosition(const Protocol::ParsedRequest& req) {
+    float maxRpm = req.motorPosition.maxRpm;
+    float maxAccel = req.motorPosition.maxAccel;
+
+    // 負値・NaNは拒否、0はデフォルト
+    uint8_t result = Protocol::POSITION_RESULT_ACCEPTED;
+    if (!(maxRpm >= 0.0f) || !(maxAccel >= 0.0f)) {
+        result = Protocol::POSITION_RESULT_INVALID_VALUE;
+    } else {
+        cmdVelData.positionDeltaL = req.motorPosition.deltaL;
+        cmdVelData.positionDeltaR = req.motorPosition.deltaR;
+        cmdVelData.positionMaxRpm = (maxRpm > 0.0f) ? maxRpm : HardwareConfig::POSITION_MAX_RPM;
+        cmdVelData.positionMaxAccel = (maxAccel > 0.0f) ? maxAccel : HardwareConfig::POSITION_MAX_ACCEL;
+        cmdVelData.positionSeq = cmdVelData.positionSeq + 1;
+        cmdVelData.failsafeStop = false;
+
+        // フェイルセーフタイマーリセット
+        lastCommandTimeMs = millis();
+        systemStatus.flags &= ~Protocol::STATUS_FAILSAFE;
+    }
+
+    uint8_t buffer[16];
+    uint8_t length = Protocol::createMotorPositionResponse(result, buffer, sizeof(buffer));
+    packetSerial.send(buffer, length);
+}
+
+/**
+ * 軌道の開始要求をCore1が未処理か（処理前はアップロード先を実行中の可能性がある）
+ */
+bool isTrajectoryStartPending() {
+    return cmdVelData.trajectoryStartSeq != motorStateData.trajectoryAppliedSeq;
+}
+
+/**
+ * TRAJECTORY_UPLOADハンドラ
+ */
+void handleTrajectoryUpload(const Protocol::ParsedRequest& req) {
+    TrajectoryBuffer& trajectory = trajectoryBuffers[trajectoryLoadIndex];
+    const Protocol::TrajectoryUploadRequest& upload = req.trajectoryUpload;
+
+    uint8_t result = Protocol::TRAJECTORY_RESULT_ACCEPTED;
+    if (isTrajectoryStartPending()) {
+        result = Protocol::TRAJECTORY_RESULT_BUSY;
+    } else {
+        if (upload.startIndex == 0) {
+            trajectory.clear();
+        }
+        for (uint8_t i = 0; i < upload.count; i++) {
+            uint16_t index = upload.startIndex + i;
+            TrajectoryBuffer::Segment segment;
+            segment.durationMs = upload.segments[i].durationMs;
+            segment.mode = upload.segments[i].mode;
+            segment.linearX = upload.segments[i].linearX;
+            segment.angularZ = upload.segments[i].angularZ;
+            if (index >= TrajectoryBuffer::CAPACITY ||
+                !trajectory.write(static_cast<uint8_t>(index), segment)) {
+                result = Protocol::TRAJECTORY_RESULT_INVALID_VALUE;
+                break;
+            }
+        }
+    }
+
+    uint8_t buffer[16];
+    uint8_t length = Protocol::createTrajectoryUploadResponse(
+        result, trajectory.getCount(), buffer, sizeof(buffer));
+    packetSerial.send(buffer, length);
+}
+
+/**
+ * TRAJECTORY_STARTハンドラ
+ * アップロード先を開始要求に渡し、以降のアップロードはもう一方のバッファに行う
+ */
+void handleTrajectoryStart(const Protocol::ParsedRequest& req) {
+    uint8_t result = Protocol::TRAJECTORY_RESULT_ACCEPTED;
+    if (isTrajectoryStartPending()) {
+        result = Protocol::TRAJECTORY_RESULT_BUSY;
+    } else if (trajectoryBuffers[trajectoryLoadIndex].getCount() == 0) {
+        result = Protocol::TRAJECTORY_RESULT_INVALID_VALUE;
+    } else {
+        // 軌道終了後に以前のMOTOR_COMMANDの速度で走り出さないよう0にする
+        cmdVelData.linearX = 0.0f;
+        cmdVelData.angularZ = 0.0f;
+        cmdVelData.failsafeStop = false;
+        cmdVelData.trajectoryStartBuffer = trajectoryLoadIndex;
+        cmdVelData.trajectoryStartQueued = req.trajectoryStart.queued;
+        cmdVelData.trajectoryStartSeq = cmdVelData.trajectoryStartSeq + 1;
+        trajectoryLoadIndex ^= 1;
+
+        // フェイルセーフタイマーリセット
+        lastCommandTimeMs = millis();
+        systemStatus.flags &= ~Protocol::STATUS_FAILSAFE;
+    }
+
+    uint8_t buffer[16];
+    uint8_t length = Protocol::createTrajectoryStartResponse(result, buffer, sizeof(buffer));
+    packetSerial.send(buffer, length);
+}
+
+/**
+ * TRAJECTORY_ABORTハンドラ
+ * 実行中の軌道と開始待ちの連結軌道を破棄する（Core1が次の制御周期で停止）
+ */
+void handleTrajectoryAbort() {
+    cmdVelData.trajectoryAbortSeq = cmdVelData.trajectoryAbortSeq + 1;
+
+    uint8_t buffer[16];
+    uint8_t length = Protocol::createTrajectoryAbortResponse(
+        Protocol::TRAJECTORY_RESULT_ACCEPTED, buffer, sizeof(buffer));
+    packetSerial.send(buffer, length);
+}
+
+/**
+ * GET_TRAJECTORY_STATUSハンドラ
+ */
+void handleGetTrajectoryStatus() {
+    Protocol::TrajectoryStatusResponse resp;
+    resp.state = motorStateData.trajectoryState;
+    resp.segmentIndex = motorStateData.trajectorySegmentIndex;
+    resp.loadedCount = trajectoryBuffers[trajectoryLoadIndex].getCount();
+    resp.queued = isTrajectoryStartPending() ? 1 : 0;
+    resp.elapsedMs = motorStateData.trajectoryElapsedMs;
+    resp.durationMs = motorStateData.trajectoryDurationMs;
+
+    uint8_t buffer[32];
+    uint8_t length = Protocol::createTrajectoryStatusResponse(resp, buffer, sizeof(buffer));
+    packetSerial.send(buffer, length);
+}
+
+/**
+ * 時間計測の集計をプロトコルの形式にコピー
+ */
+void copyTimingSummary(const TimingStats::Summary& src, Protocol::TimingSummaryData& dst) {
+    static_assert(TimingStats::BUCKET_COUNT == Protocol::TIMING_BUCKET_COUNT,
+                  "TimingStats and GET_TIMING bucket counts must match");
+    dst.count = src.count;
+    dst.minUs = src.minUs;
+    dst.maxUs = src.maxUs;
+    dst.meanUs = src.meanUs;
+    dst.bucketOriginUs = src.bucketOriginUs;
+    dst.bucketWidthUs = src.bucketWidthUs;
+    for (uint8_t i = 0; i < TimingStats::BUCKET_COUNT; i++) {
+        dst.buckets[i] = src.buckets[i];
+    }
+}
+
+/**
+ * GET_TIMINGハンドラ
+ * Core1の書き込みと重なった場合は読み直す（書き込みは数usのため数回で揃う）
+ */
+void handleGetTiming(const Protocol::ParsedRequest& req) {
+    TimingData timing;
+    if (!readTimingData(&timingData, &timing, 8)) {
+        // Core1の更新と競合し続けた場合はBUSYを返す（ホスト側で再要求）
+        uint8_t buffer[16];
+        uint8_t length = Protocol::createTimingResultResponse(
+            Protocol::TIMING_RESULT_BUSY, buffer, sizeof(buffer));
+        packetSerial.send(buffer, length);
+        return;
+    }
+
+    Protocol::TimingResponse resp;
+    resp.nominalPeriodUs = timing.nominalPeriodUs;
+    resp.overrunCount = timing.overrunCount;
+    resp.missedTicks = timing.missedTicks;
+    copyTimingSummary(timing.period, resp.period);
+    copyTimingSummary(timing.execution, resp.execution);
+    resp.xipAccessCount = timing.xipAccessCount;
+    resp.xipHitCount = timing.xipHitCount;
+    resp.commandLatencyCount = timing.commandLatency.count;
+    resp.commandLatencyMinUs = timing.commandLatency.minUs;
+    resp.commandLatencyMaxUs = timing.commandLatency.maxUs;
+    resp.commandLatencyMeanUs = timing.commandLatency.meanUs;
+    resp.outOfCycleCount = timing.outOfCycleCount;
+
+    // 読み出した分をリセット（Core1が次の制御周期でクリア）
+    if (req.getTiming.reset) {
+        cmdVelData.timingResetSeq = cmdVelData.timingResetSeq + 1;
+    }
+
+    uint8_t buffer[220];
+    uint8_t length = Protocol::createTimingResponse(resp, buffer, sizeof(buffer));
+    packetSerial.send(buffer, length);
+}
+
 /**
  * パケット受信コールバック
  */
@@ -247,6 +759,30 @@ void onSerialPacketReceived(const uint8_t* buffer, size_t size) {
         case Protocol::REQUEST_GET_DEBUG_OUTPUT:
             handleGetDebugOutput();
             break;
+        case Protocol::REQUEST_GET_ODOMETRY:
+            handleGetOdometry();
+            break;
+        case Protocol::REQUEST_RESET_ODOMETRY:
+            handleResetOdometry(req);
+            break;
+        case Protocol::REQUEST_MOTOR_POSITION:
+            handleMotorPosition(req);
+            break;
+        case Protocol::REQUEST_TRAJECTORY_UPLOAD:
+            handleTrajectoryUpload(req);
+            break;
+        case Protocol::REQUEST_TRAJECTORY_START:
+            handleTrajectoryStart(req);
+            break;
+        case Protocol::REQUEST_TRAJECTORY_ABORT:
+            handleTrajectoryAbort();
+            break;
+        case Protocol::REQUEST_GET_TRAJECTORY_STATUS:
+            handleGetTrajectoryStatus();
+            break;
+        case Protocol::REQUEST_GET_TIMING:
+            handleGetTiming(req);
+            break;
         default:
             break;
     }
@@ -254,10 +790,19 @@ void onSerialPacketReceived(const uint8_t* buffer, size_t size) {
 
 /**
  * フェイルセーフチェック
+ * 位置制御の移動中・軌道の実行中はホストからの指令が途切れるため、終了（または中断）まで猶予する
+ * 速度指令の期限切れはCore1が制御周期ごとに判定して減速停止するため、
+ * ここはその減速時間の上限を待ってから停止させる予備の判定
  */
 void checkFailsafe() {
+    uint16_t autonomousFlags = Protocol::STATUS_POSITION_ACTIVE | Protocol::STATUS_TRAJECTORY_ACTIVE;
+    if (motorStateData.statusFlags & autonomousFlags) {
+        lastCommandTimeMs = millis();
+        return;
+    }
+
     unsigned long elapsed = millis() - lastCommandTimeMs;
-    if (elapsed > HardwareConfig::FAILSAFE_TIMEOUT_MS) {
+    if (elapsed > HardwareConfig::FAILSAFE_TIMEOUT_MS + HardwareConfig::COMMAND_EXPIRED_RAMP_MS) {
         systemStatus.flags |= Protocol::STATUS_FAILSAFE;
         cmdVelData.linearX = 0.0f;
         cmdVelData.angularZ = 0.0f;
@@ -265,6 +810,16 @@ void checkFailsafe() {
     }
 }
 
+/**
+ * Core1のモータ異常をエラーコードに反映
+ */
+void checkMotorErrors() {
+    uint16_t motorErrors = Protocol::STATUS_MOTOR_L_ERROR | Protocol::STATUS_MOTOR_R_ERROR;
+    if (motorStateData.statusFlags & motorErrors) {
+        systemStatus.lastErrorCode = Protocol::ERROR_MOTOR_STALL;
+    }
+}
+
 // =============================================================================
 // Core0: メインコア（ROS通信）
 // =============================================================================
@@ -273,6 +828,9 @@ void setup() {
     // 共有データ初期化
     initCmdVelData(&cmdVelData);
     initMotorStateData(&motorStateData);
+    initTimingData(&timingData);
+    initControlConfigData(&controlConfigData);
+    initOdometryData(&odometryData);
 
     // PacketSerial初期化
     packetSerial.begin(115200);
@@ -287,11 +845,14 @@ void setup() {
     DEBUG_PRINTLN("Core0: Setup complete");
 #endif
 
-    // Serialバッファをクリア
-    delay(100);
+    // Serialバッファをクリア（起動を待たせないよう、届いている分のみ。
+    // 途中から受信したパケットはCOBSの区切りで読み捨てられる）
     while (Serial.available() > 0) {
         Serial.read();
     }
+
+    // ウォッチドッグ開始（前回のリセット理由を読み出してから）
+    coreWatchdog.begin(millis());
 }
 
 void loop() {
@@ -300,6 +861,7 @@ void loop() {
 
     // PacketSerial更新（受信処理）- 毎ループ実行
     packetSerial.update();
+    coreWatchdog.core0Serviced(millis());
 
     // オーバーフローチェック
     if (packetSerial.overflow()) {
@@ -310,6 +872,8 @@ void loop() {
     if (currentUs - prevTimeUs >= 100000) {
         prevTimeUs = currentUs;
         checkFailsafe();
+        checkMotorErrors();
+        coreWatchdog.checkCore1(millis());
     }
 }
 
@@ -317,61 +881,555 @@ void loop() {
 // Core1: リアルタイムコア（モータ制御）
 // =============================================================================
 
+/**
+ * 時間計測のビンを制御周期に合わせる（集計はクリア）
+ * 周期は公称周期 ± 8ビン、処理時間・指令の遅延は0〜公称周期を16分割
+ */
+void configureTimingStats(uint32_t periodUs) {
+    uint32_t periodBucketUs = periodUs / HardwareConfig::TIMING_PERIOD_BUCKET_DIV;
+    periodStats.setBuckets(periodUs - (TimingStats::BUCKET_COUNT / 2) * periodBucketUs, periodBucketUs);
+    execStats.setBuckets(0, periodUs / HardwareConfig::TIMING_EXEC_BUCKET_DIV);
+    latencyStats.setBuckets(0, periodUs / HardwareConfig::TIMING_EXEC_BUCKET_DIV);
+}
+
+/**
+ * 速度推定・PID・ドライバ出力（毎周期）
+ * updateWheels()はこの関数にインライン展開され、呼び出し先とともにSRAMから実行する（RamFunc.h）
+ */
+void RAM_FUNC(runWheelControl)(float dt) {
+    motorController.updateWheels(dt);
+}
+
 void setup1() {
-    // PID出力リミット設定
-    pidL.setOutputLimits(-1.0f, 1.0f);
-    pidR.setOutputLimits(-1.0f, 1.0f);
+    // PID出力リミット設定（出力はRPM単位、MotorControllerがmaxRpmで正規化する）
+    pidL.setOutputLimits(-HardwareConfig::Defaults::MAX_RPM, HardwareConfig::Defaults::MAX_RPM);
+    pidR.setOutputLimits(-HardwareConfig::Defaults::MAX_RPM, HardwareConfig::Defaults::MAX_RPM);
+
+    // 左右別ジオメトリ（左右で実効直径・減速比・PPRが異なる場合）
+    motorController.setGeometry(
+        HardwareConfig::Defaults::WHEEL_DIAMETER, HardwareConfig::Defaults::WHEEL_DIAMETER_R,
+        HardwareConfig::Defaults::TRACK_WIDTH,
+        HardwareConfig::Defaults::GEAR_RATIO, HardwareConfig::Defaults::GEAR_RATIO_R);
+    odometry.setGeometry(
+        HardwareConfig::Defaults::WHEEL_DIAMETER, HardwareConfig::Defaults::WHEEL_DIAMETER_R,
+        HardwareConfig::Defaults::TRACK_WIDTH,
+        HardwareConfig::Defaults::GEAR_RATIO, HardwareConfig::Defaults::GEAR_RATIO_R,
+        HardwareConfig::Defaults::ENCODER_PPR, HardwareConfig::Defaults::ENCODER_PPR_R);
+    positionController.setParameters(HardwareConfig::POSITION_KP,
+                                     HardwareConfig::Defaults::ENCODER_PPR,
+                                     HardwareConfig::Defaults::ENCODER_PPR_R);
+
+    // 停止・フェイルセーフ時のブレーキ設定
+    motorController.setBrakeOnStop(HardwareConfig::BRAKE_ON_STOP);
+
+    // 上限を越える指令の飽和処理（回転優先 / 曲率保持）
+    motorController.setSaturationMode(HardwareConfig::SATURATION_PRESERVE_CURVATURE
+                                          ? SATURATION_PRESERVE_CURVATURE
+                                          : SATURATION_ROTATION_PRIORITY);
+
+    // 指令のステップ変化でPIDが飽和しないよう加減速を制限
+    motorController.setMotionLimits(
+        HardwareConfig::PROFILE_MAX_LINEAR_ACCEL, HardwareConfig::PROFILE_MAX_LINEAR_JERK,
+        HardwareConfig::PROFILE_MAX_ANGULAR_ACCEL, HardwareConfig::PROFILE_MAX_ANGULAR_JERK);
+
+#if LOCAL_PWM_BACKEND
+    // 電圧補償（公称電圧でのデューティを基準にする）
+    driverL.setNominalVoltage(HardwareConfig::BATTERY_NOMINAL_VOLTAGE);
+    driverR.setNominalVoltage(HardwareConfig::BATTERY_NOMINAL_VOLTAGE);
+#endif
 
     // ハードウェア初期化
     encoderL.begin();
     encoderR.begin();
+#if MOTOR_BACKEND == MOTOR_BACKEND_LD2
+    Serial2.setTX(HardwareConfig::LD2_UART_TX);
+    Serial2.setRX(HardwareConfig::LD2_UART_RX);
+    Serial2.begin(HardwareConfig::LD2_UART_BAUD);
+    ld2Link.begin();
+#endif
     driverL.begin();
     driverR.begin();
 
+#if LOCAL_PWM_BACKEND
+    // 電流・電圧サンプリング開始（PWM設定後に呼ぶこと）
+    currentSampler.begin();
+
+    // 左右のON期間をずらしてバスのリップル電流を低減（位相補正モード設定後に呼ぶこと）
+    PwmPhase::apply(HardwareConfig::MOTOR_L_PWM, HardwareConfig::MOTOR_R_PWM,
+                    HardwareConfig::PWM_PHASE_OFFSET_DEG);
+#else
+    analogReadResolution(12);
+#endif
+
+    // 制御周期の割り込みはCore1で処理する（setup1から開始）
+    configureTimingStats(controlTimer.getPeriodUs());
+    bool timerStarted = controlTimer.begin();
+
 #ifdef DEBUG_BUILD
+    if (!timerStarted) {
+        DEBUG_PRINTLN("Core1: Control timer start failed");
+    }
     DEBUG_PRINTLN("Core1: Setup complete");
+#else
+    (void)timerStarted;
 #endif
 }
 
 void loop1() {
-    static unsigned long prevTimeUs = 0;
+    // 制御周期（制御周波数、デフォルト10ms = 100Hz）のハードウェアアラーム、
+    // またはMOTOR_COMMANDのドアベルまで待機（WFE）
+    uint32_t ticks = controlTimer.wait(commandDoorbell);
+
+    static bool hasPrevTick = false;
+    static unsigned long prevTickUs = 0;         // 前回の実行（定期周期・周期の途中）
+    static unsigned long prevRegularTickUs = 0;  // 前回の定期周期
+    static bool commandPending = false;          // 未処理の指令（ドアベル）
+    if (commandDoorbell.take()) {
+        commandPending = true;
+    }
+    if (ticks == 0) {
+        if (!commandPending) {
+            return;  // タイマを開始できなかった場合、または処理済みの指令の起床アラーム
+        }
+        if (!hasPrevTick ||
+            !CommandDoorbell::canRunOutOfCycle(DOORBELL_MIN_INTERVAL_US, controlTimer.getPeriodUs())) {
+            return;  // 次の周期で指令処理を実行
+        }
+        // 速度推定のdtが短くなりすぎないよう、前回の実行と次の周期の両方から最小間隔を空ける。
+        // 前回の実行から間もない場合は起床アラームを予約してWFEで待ち、
+        // 次の周期が近い場合は通常の周期として処理する
+        unsigned long nowUs = micros();
+        uint32_t delayUs = CommandDoorbell::outOfCycleDelayUs(
+            nowUs - prevTickUs, nowUs - prevRegularTickUs,
+            DOORBELL_MIN_INTERVAL_US, controlTimer.getPeriodUs());
+        if (delayUs != 0) {
+            if (delayUs != CommandDoorbell::DEFER_TO_NEXT_TICK) {
+                controlTimer.wakeAfterUs(delayUs);  // 予約できなければ次の周期で処理
+            }
+            return;
+        }
+    }
+    controlTimer.cancelWake();
     unsigned long currentUs = micros();
 
-    // 制御周期（10ms = 100Hz）
-    if (currentUs - prevTimeUs >= HardwareConfig::CONTROL_PERIOD_US) {
-        float dt = (currentUs - prevTimeUs) / 1000000.0f;
-        prevTimeUs = currentUs;
+    // XIPキャッシュのカウンタ（両コア共通）。処理中のアクセス・ヒット回数を積算する
+    uint32_t xipAccessStart = xip_ctrl_hw->ctr_acc;
+    uint32_t xipHitStart = xip_ctrl_hw->ctr_hit;
+
+    // 今回実行する処理群を決める（速度PIDは毎周期、プロファイル・公開は分周）
+    // 公称周期で積分する（周期を取りこぼした場合はその周期数分）。
+    // 周期の途中で指令が届いた場合は、経過時間で指令処理・PIDを実行する。
+    // 周期の位相は変えない（指令が続いても公開・監視・ウォッチドッグ監視の周期を保つ）
+    static uint32_t outOfCycleCount = 0;
+    bool outOfCycle = (ticks == 0);
+    if (outOfCycle) {
+        controlScheduler.advanceOutOfCycle((currentUs - prevTickUs) * 1e-6f);
+        outOfCycleCount++;
+    } else {
+        controlScheduler.advance(ticks, commandPending);
+    }
+    commandPending = false;
+    float dt = controlScheduler.getDt();
+    bool profileDue = controlScheduler.isProfileDue();
+    bool publishDue = controlScheduler.isPublishDue();
+
+    // 時間計測のリセット要求（Core0のGET_TIMINGで読み出した後）
+    static uint32_t appliedTimingResetSeq = 0;
+    static uint32_t overrunCount = 0;
+    static uint32_t xipAccessCount = 0;
+    static uint32_t xipHitCount = 0;
+    uint32_t timingResetSeq = cmdVelData.timingResetSeq;
+    if (timingResetSeq != appliedTimingResetSeq) {
+        appliedTimingResetSeq = timingResetSeq;
+        periodStats.reset();
+        execStats.reset();
+        latencyStats.reset();
+        overrunCount = 0;
+        xipAccessCount = 0;
+        xipHitCount = 0;
+        outOfCycleCount = 0;
+    }
+
+    // 定期周期の開始時刻の間隔（ジッタ）。初回と周期の途中での実行は記録しない
+    if (!outOfCycle) {
+        if (hasPrevTick) {
+            periodStats.record(currentUs - prevRegularTickUs);
+        }
+        prevRegularTickUs = currentUs;
+    }
+    hasPrevTick = true;
+    prevTickUs = currentUs;
+
+    // -------------------------------------------------------------------------
+    // 監視（公開周波数）: バス電圧・過電流・熱・ストール
+    // -------------------------------------------------------------------------
+    static uint16_t supervisionFlags = 0;
+    static bool overcurrent = false;
+    static bool stalled = false;
+    if (publishDue) {
+        float supervisionDt = controlScheduler.getPublishDt();
+        supervisionFlags = 0;
+
+#if LOCAL_PWM_BACKEND
+        // 電流集計（サンプリング自体はDMA、過電流遮断はPWM割り込みで実施済み）
+        currentSampler.service();
+#endif
+
+        // バス電圧を計測し、デューティ補償に反映
+        batteryMonitor.update();
+#if LOCAL_PWM_BACKEND
+        driverL.setSupplyVoltage(batteryMonitor.getVoltage());
+        driverR.setSupplyVoltage(batteryMonitor.getVoltage());
+#endif
+
+        if (batteryMonitor.isLowVoltage()) {
+            supervisionFlags |= Protocol::STATUS_LOW_VOLTAGE;
+        }
+
+        // 過電流遮断中はクールダウン後に自動復帰
+#if LOCAL_PWM_BACKEND
+        static bool overcurrentHandled = false;
+        static unsigned long overcurrentTimeMs = 0;
+        overcurrent = currentSampler.isTripped();
+        if (overcurrent) {
+            supervisionFlags |= Protocol::STATUS_OVERCURRENT;
+            if (!overcurrentHandled) {
+                overcurrentHandled = true;
+                overcurrentTimeMs = millis();
+            } else if (millis() - overcurrentTimeMs >= HardwareConfig::OVERCURRENT_COOLDOWN_MS) {
+                // 遮断中はstop()でPID・出力を0にしているため、復帰時の突入はない
+                currentSampler.clearTrip();
+                overcurrentHandled = false;
+            }
+        }
+#endif
+
+#if LOCAL_PWM_BACKEND
+        // 巻線の熱推定（RMS電流、センサなしの場合は前周期のデューティを負荷とする）
+        float loadL;
+        float loadR;
+        if (HardwareConfig::CURRENT_SENSOR_INSTALLED) {
+            loadL = currentSensorL.getRmsAmps() / HardwareConfig::THERMAL_RATED_CURRENT;
+            loadR = currentSensorR.getRmsAmps() / HardwareConfig::THERMAL_RATED_CURRENT;
+        } else {
+            loadL = driverL.getOutputSpeed() / HardwareConfig::THERMAL_RATED_DUTY;
+            loadR = driverR.getOutputSpeed() / HardwareConfig::THERMAL_RATED_DUTY;
+        }
+        thermalL.update(loadL, supervisionDt);
+        thermalR.update(loadR, supervisionDt);
+
+        // 発熱に応じて出力上限を下げる
+        motorController.setDerating(thermalL.getDerating(), thermalR.getDerating());
+        if (thermalL.isOverTemp() || thermalR.isOverTemp()) {
+            supervisionFlags |= Protocol::STATUS_OVERTEMP;
+        }
+#endif
+
+        // ストール検出（前周期の出力デューティと今周期の回転数で判定）
+#if LOCAL_PWM_BACKEND
+        bool stallEventL = stallL.update(driverL.getOutputSpeed(), motorController.getCurrentRpmL(), supervisionDt);
+        bool stallEventR = stallR.update(driverR.getOutputSpeed(), motorController.getCurrentRpmR(), supervisionDt);
+#ifdef DEBUG_BUILD
+        if (stallEventL || stallEventR) {
+            DEBUG_PRINTF("Stall detected: L=%d R=%d (events L=%lu R=%lu)\n",
+                stallL.isStalled(), stallR.isStalled(),
+                (unsigned long)stallL.getEventCount(), (unsigned long)stallR.getEventCount());
+        }
+#else
+        (void)stallEventL;
+        (void)stallEventR;
+#endif
+        if (stallL.isStalled()) {
+            supervisionFlags |= Protocol::STATUS_MOTOR_L_ERROR;
+        }
+        if (stallR.isStalled()) {
+            supervisionFlags |= Protocol::STATUS_MOTOR_R_ERROR;
+        }
+        stalled = stallL.isStalled() || stallR.isStalled();
+#else
+        (void)supervisionDt;
+#endif
+    }
+
+    // -------------------------------------------------------------------------
+    // 指令処理・プロファイル・キネマティクス（分周）
+    // -------------------------------------------------------------------------
+    static uint16_t commandFlags = 0;
+    static bool motionStop = false;
+    static uint32_t appliedTrajectoryStartSeq = 0;
+    static bool commandLatencyPending = false;
+    static unsigned long commandReceivedUs = 0;
+    if (profileDue) {
+        float profileDt = controlScheduler.getProfileDt();
+        commandFlags = 0;
 
         // 共有メモリからcmd_velを読み込み
         float linearX = cmdVelData.linearX;
         float angularZ = cmdVelData.angularZ;
         bool failsafe = cmdVelData.failsafeStop;
 
-        // フェイルセーフ時は停止
+        // タイムスタンプ付き指令は直近2指令から補間・外挿（なしの場合は従来どおり保持）
+        static uint32_t appliedCommandSeq = 0;
+        uint32_t commandSeq = cmdVelData.commandSeq;
+        bool commandReceived = (commandSeq != appliedCommandSeq);
+        if (commandReceived) {
+            appliedCommandSeq = commandSeq;
+            commandLatencyPending = true;
+            commandReceivedUs = cmdVelData.commandReceivedUs;
+            positionController.abort();  // 速度指令で位置制御を終了
+            commandDeadline.arm(cmdVelData.commandReceivedUs, cmdVelData.commandValidityMs);
+            if (cmdVelData.commandHasTimestamp) {
+                commandInterpolator.push(cmdVelData.commandTimestampUs,
+                                         cmdVelData.commandReceivedUs,
+                                         linearX, angularZ);
+            } else {
+                commandInterpolator.reset();
+            }
+        }
         if (failsafe) {
-            motorController.stop();
+            commandInterpolator.reset();
+        }
+        commandInterpolator.evaluate(currentUs, linearX, angularZ);
+
+        // 位置制御要求は現在のカウントを起点に開始
+        static uint32_t appliedPositionSeq = 0;
+        uint32_t positionSeq = cmdVelData.positionSeq;
+        bool positionStarted = false;
+        if (positionSeq != appliedPositionSeq) {
+            appliedPositionSeq = positionSeq;
+            positionStarted = positionController.start(motorController.getEncoderCountL(),
+                                     motorController.getEncoderCountR(),
+                                     cmdVelData.positionDeltaL,
+                                     cmdVelData.positionDeltaR,
+                                     cmdVelData.positionMaxRpm,
+                                     cmdVelData.positionMaxAccel);
+            if (positionStarted) {
+                commandDeadline.disarm();
+            }
+        }
+
+        // 軌道の中断（速度指令・位置指令・中断要求・異常停止）。開始待ちの連結軌道も破棄する
+        static uint32_t appliedTrajectoryAbortSeq = 0;
+        uint32_t trajectoryStartSeq = cmdVelData.trajectoryStartSeq;
+        uint32_t trajectoryAbortSeq = cmdVelData.trajectoryAbortSeq;
+        bool trajectoryQueued = cmdVelData.trajectoryStartQueued;
+        bool trajectoryAbort = (trajectoryAbortSeq != appliedTrajectoryAbortSeq);
+        appliedTrajectoryAbortSeq = trajectoryAbortSeq;
+        if (trajectoryAbort || commandReceived || positionStarted || failsafe || overcurrent || stalled) {
+            trajectoryPlayer.abort();
+            if (trajectoryQueued) {
+                appliedTrajectoryStartSeq = trajectoryStartSeq;
+            }
+        }
+
+        // 軌道の開始（即時、または実行中の軌道の終了時刻から連結）
+        if (trajectoryStartSeq != appliedTrajectoryStartSeq &&
+            (!trajectoryQueued || !trajectoryPlayer.isRunning() || trajectoryPlayer.hasEnded(currentUs))) {
+            uint32_t startUs = (trajectoryQueued && trajectoryPlayer.isRunning())
+                ? trajectoryPlayer.getEndUs() : currentUs;
+            appliedTrajectoryStartSeq = trajectoryStartSeq;
+            if (trajectoryPlayer.start(trajectoryBuffers[cmdVelData.trajectoryStartBuffer], startUs)) {
+                positionController.abort();
+                commandInterpolator.reset();
+                commandDeadline.disarm();
+            }
+        }
+
+        // 有効期限切れの速度指令は速度0へ減速（減速時間の上限を過ぎたら停止）
+        CommandDeadline::State deadlineState = commandDeadline.update(currentUs);
+        if (commandDeadline.isExpired()) {
+            commandFlags |= Protocol::STATUS_FAILSAFE;
+            commandInterpolator.reset();
+            linearX = 0.0f;
+            angularZ = 0.0f;
+        }
+        bool deadlineStop = (deadlineState == CommandDeadline::STATE_STOPPED) ||
+            (deadlineState == CommandDeadline::STATE_RAMPING &&
+             motorController.getProfiledLinearX() == 0.0f &&
+             motorController.getProfiledAngularZ() == 0.0f);
+
+        trajectoryPlayer.update(currentUs, linearX, angularZ);
+
+        // フェイルセーフ・過電流遮断・ストール時は停止（片輪の拘束でも旋回しないよう両輪）
+        motionStop = failsafe || overcurrent || stalled || deadlineStop;
+        if (motionStop) {
+            positionController.abort();
+        } else if (positionController.isActive()) {
+            // 位置ループの出力を速度PIDの目標RPMとして渡す
+            float rpmL;
+            float rpmR;
+            positionController.update(motorController.getEncoderCountL(),
+                                      motorController.getEncoderCountR(),
+                                      profileDt, rpmL, rpmR);
+            motorController.setWheelRpm(rpmL, rpmR);
         } else {
-            // cmd_velを設定して制御ループ実行
+            // cmd_velを設定し、加減速プロファイルを進める
             motorController.setCmdVel(linearX, angularZ);
-            motorController.update(dt);
+            motorController.updateProfile(profileDt);
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // 速度推定・PID（毎周期）
+    // -------------------------------------------------------------------------
+    if (motionStop) {
+        motorController.stop();
+    } else {
+        runWheelControl(dt);
+    }
+
+    // 指令の遅延（Core0の受信からドライバ出力の更新まで）
+    if (commandLatencyPending) {
+        commandLatencyPending = false;
+        latencyStats.record(micros() - commandReceivedUs);
+    }
+
+    // -------------------------------------------------------------------------
+    // オドメトリ・共有データの公開（公開周波数）
+    // -------------------------------------------------------------------------
+    if (publishDue) {
+        uint16_t core1Flags = supervisionFlags | commandFlags;
+        if (positionController.isMoving()) {
+            core1Flags |= Protocol::STATUS_POSITION_ACTIVE;
+        } else if (positionController.isReached()) {
+            core1Flags |= Protocol::STATUS_POSITION_REACHED;
+        }
+        if (trajectoryPlayer.isRunning()) {
+            core1Flags |= Protocol::STATUS_TRAJECTORY_ACTIVE;
+        }
+
+        // 左右のカウントを同じ時点で取得し、オドメトリを積算
+        int32_t encoderCountL = motorController.getEncoderCountL();
+        int32_t encoderCountR = motorController.getEncoderCountR();
+
+        static uint32_t appliedOdometryResetSeq = 0;
+        uint32_t odometryResetSeq = cmdVelData.odometryResetSeq;
+        if (odometryResetSeq != appliedOdometryResetSeq) {
+            appliedOdometryResetSeq = odometryResetSeq;
+            odometry.reset(cmdVelData.odometryResetX,
+                           cmdVelData.odometryResetY,
+                           cmdVelData.odometryResetTheta);
         }
+        odometry.update(encoderCountL, encoderCountR, controlScheduler.getPublishDt());
+
+        // 姿勢・速度・時刻はGET_ODOMETRYで揃って読めるようシーケンス番号付きで公開
+        OdometryData odom;
+        odom.x = odometry.getX();
+        odom.y = odometry.getY();
+        odom.theta = odometry.getTheta();
+        odom.linearX = odometry.getLinearX();
+        odom.angularZ = odometry.getAngularZ();
+        odom.timestampUs = currentUs;
+        writeOdometryData(&odometryData, odom);
 
         // 共有メモリに状態を書き込み
-        motorStateData.encoderCountL = motorController.getEncoderCountL();
-        motorStateData.encoderCountR = motorController.getEncoderCountR();
+        motorStateData.encoderCountL = encoderCountL;
+        motorStateData.encoderCountR = encoderCountR;
         motorStateData.targetRpmL = motorController.getTargetRpmL();
         motorStateData.targetRpmR = motorController.getTargetRpmR();
+        motorStateData.profiledLinearX = motorController.getProfiledLinearX();
+        motorStateData.profiledAngularZ = motorController.getProfiledAngularZ();
         motorStateData.currentRpmL = motorController.getCurrentRpmL();
         motorStateData.currentRpmR = motorController.getCurrentRpmR();
+        motorStateData.batteryVoltage = batteryMonitor.getVoltage();
+        motorStateData.trajectoryState = trajectoryPlayer.getState();
+        motorStateData.trajectorySegmentIndex = trajectoryPlayer.getSegmentIndex();
+        motorStateData.trajectoryElapsedMs = trajectoryPlayer.getElapsedMs();
+        motorStateData.trajectoryDurationMs = trajectoryPlayer.getDurationMs();
+        motorStateData.trajectoryAppliedSeq = appliedTrajectoryStartSeq;  // 旧バッファの読み込み終了後に公開
+#if LOCAL_PWM_BACKEND
+        motorStateData.currentRmsL = currentSensorL.getRmsAmps();
+        motorStateData.currentRmsR = currentSensorR.getRmsAmps();
+        motorStateData.currentPeakL = currentSensorL.getPeakAmps();
+        motorStateData.currentPeakR = currentSensorR.getPeakAmps();
+#endif
+        motorStateData.statusFlags = core1Flags;
+    }
+
+    // 処理時間（ここまで。公称周期を超えた場合は次の周期に食い込んでいる）
+    uint32_t execUs = micros() - currentUs;
+    xipAccessCount += xip_ctrl_hw->ctr_acc - xipAccessStart;
+    xipHitCount += xip_ctrl_hw->ctr_hit - xipHitStart;
+    execStats.record(execUs);
+    if (execUs > controlTimer.getPeriodUs()) {
+        overrunCount++;
+    }
+    if (publishDue) {
+        TimingData timing;
+        timing.nominalPeriodUs = controlTimer.getPeriodUs();
+        timing.overrunCount = overrunCount;
+        timing.missedTicks = controlTimer.getMissedTicks();
+        timing.xipAccessCount = xipAccessCount;
+        timing.xipHitCount = xipHitCount;
+        timing.outOfCycleCount = outOfCycleCount;
+        periodStats.summarize(timing.period);
+        execStats.summarize(timing.execution);
+        latencyStats.summarize(timing.commandLatency);
+        writeTimingData(&timingData, timing);
+    }
 
 #ifdef DEBUG_BUILD
-        static int debugCounter = 0;
-        if (++debugCounter >= 100) {  // 1秒ごと
-            DEBUG_PRINTF("RPM: L=%.1f/%.1f R=%.1f/%.1f\n",
-                motorStateData.currentRpmL, motorStateData.targetRpmL,
-                motorStateData.currentRpmR, motorStateData.targetRpmR);
-            debugCounter = 0;
-        }
+    static int debugCounter = 0;
+    if (publishDue && ++debugCounter >= HardwareConfig::CONTROL_PUBLISH_RATE_HZ) {  // 1秒ごと
+        DEBUG_PRINTF("RPM: L=%.1f/%.1f R=%.1f/%.1f\n",
+            motorStateData.currentRpmL, motorStateData.targetRpmL,
+            motorStateData.currentRpmR, motorStateData.targetRpmR);
+#if LOCAL_PWM_BACKEND
+        DEBUG_PRINTF("I[A] rms/peak: L=%.2f/%.2f R=%.2f/%.2f trips=%lu\n",
+            motorStateData.currentRmsL, motorStateData.currentPeakL,
+            motorStateData.currentRmsR, motorStateData.currentPeakR,
+            (unsigned long)currentSampler.getTripCount());
 #endif
+        DEBUG_PRINTF("Tick period [us]: min=%lu max=%lu exec max=%lu overruns=%lu missed=%lu rate=%u Hz\n",
+            (unsigned long)periodStats.getMinUs(), (unsigned long)periodStats.getMaxUs(),
+            (unsigned long)execStats.getMaxUs(), (unsigned long)overrunCount,
+            (unsigned long)controlTimer.getMissedTicks(), (unsigned)controlScheduler.getRateHz());
+        DEBUG_PRINTF("XIP cache (tick): access=%lu miss=%lu\n",
+            (unsigned long)xipAccessCount, (unsigned long)(xipAccessCount - xipHitCount));
+        DEBUG_PRINTF("Command latency [us]: max=%lu mean=%lu out-of-cycle=%lu\n",
+            (unsigned long)latencyStats.getMaxUs(), (unsigned long)latencyStats.getMeanUs(),
+            (unsigned long)outOfCycleCount);
+        debugCounter = 0;
+    }
+#endif
+
+    // 制御周波数の変更（SET_CONFIG）。周期の途中で変えないよう、処理の終わりに適用する
+    static uint32_t appliedControlRateSeq = 0;
+    uint32_t controlRateSeq = cmdVelData.controlRateSeq;
+    if (controlRateSeq != appliedControlRateSeq) {
+        appliedControlRateSeq = controlRateSeq;
+        if (controlScheduler.setRate(cmdVelData.controlRateHz)) {
+            controlTimer.setPeriodUs(controlScheduler.getPeriodUs());
+            configureTimingStats(controlScheduler.getPeriodUs());
+            overrunCount = 0;
+            xipAccessCount = 0;
+            xipHitCount = 0;
+            outOfCycleCount = 0;
+            hasPrevTick = false;
+        }
+    }
+
+    // PIDゲイン・ジオメトリの変更（SET_CONFIG）。書き込み中なら次周期に持ち越す
+    static uint32_t appliedConfigSeq = 0;
+    ControlConfigData pending;
+    if (readControlConfigData(&controlConfigData, &pending, 1) && pending.seq != appliedConfigSeq) {
+        appliedConfigSeq = pending.seq;
+        pidL.setGains(pending.pidKpL, pending.pidKiL, pending.pidKdL);
+        pidR.setGains(pending.pidKpR, pending.pidKiR, pending.pidKdR);
+        encoderL.setPpr(pending.encoderPprL);
+        encoderR.setPpr(pending.encoderPprR);
+        motorController.setGeometry(pending.wheelDiameterL, pending.wheelDiameterR,
+                                    pending.trackWidth, pending.gearRatioL, pending.gearRatioR);
+        odometry.setGeometry(pending.wheelDiameterL, pending.wheelDiameterR, pending.trackWidth,
+                             pending.gearRatioL, pending.gearRatioR,
+                             pending.encoderPprL, pending.encoderPprR);
+        positionController.setParameters(HardwareConfig::POSITION_KP,
+                                         pending.encoderPprL, pending.encoderPprR);
+    }
+
+    // 制御周期の完了（Core0が動いていればウォッチドッグを更新）
+    if (firstTickUs == 0) {
+        firstTickUs = micros();
     }
+    coreWatchdog.core1TickCompleted(millis());
 }
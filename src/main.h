@@ -18,6 +18,9 @@
 
 /**
  * ロボット設定（将来ConfigStorageでFlash保存）
+ *
+ * ゲイン・PPR・減速比・直径は左右別。無印が左側、_Rが右側
+ * （SET_CONFIGの30バイト版では両側に同じ値を設定する）。
  */
 struct RobotConfig {
     float pidKp;
@@ -28,6 +31,13 @@ struct RobotConfig {
     float gearRatio;
     float wheelDiameter;
     float trackWidth;
+    float pidKpR;
+    float pidKiR;
+    float pidKdR;
+    uint16_t encoderPprR;
+    float gearRatioR;
+    float wheelDiameterR;
+    uint16_t controlRateHz;  // 速度PIDの制御周波数 [Hz]
 
     // デフォルト値で初期化
     RobotConfig() :
@@ -37,8 +47,15 @@ struct RobotConfig {
         maxRpm(HardwareConfig::Defaults::MAX_RPM),
         encoderPpr(HardwareConfig::Defaults::ENCODER_PPR),
         gearRatio(HardwareConfig::Defaults::GEAR_RATIO),
-        wheelDiameter(0.1f),   // 100mm
-        trackWidth(0.3f)       // 300mm
+        wheelDiameter(HardwareConfig::Defaults::WHEEL_DIAMETER),
+        trackWidth(HardwareConfig::Defaults::TRACK_WIDTH),
+        pidKpR(HardwareConfig::Defaults::PID_KP_R),
+        pidKiR(HardwareConfig::Defaults::PID_KI_R),
+        pidKdR(HardwareConfig::Defaults::PID_KD_R),
+        encoderPprR(HardwareConfig::Defaults::ENCODER_PPR_R),
+        gearRatioR(HardwareConfig::Defaults::GEAR_RATIO_R),
+        wheelDiameterR(HardwareConfig::Defaults::WHEEL_DIAMETER_R),
+        controlRateHz(HardwareConfig::CONTROL_RATE_DEFAULT_HZ)
     {}
 };
 
@@ -64,6 +81,9 @@ struct SystemStatus {
 // 共有データ（コア間通信）
 extern volatile CmdVelData cmdVelData;
 extern volatile MotorStateData motorStateData;
+extern TimingData timingData;  // readTimingData/writeTimingDataでアクセス
+extern ControlConfigData controlConfigData;  // readControlConfigData/writeControlConfigDataでアクセス
+extern OdometryData odometryData;            // readOdometryData/writeOdometryDataでアクセス
 
 // 設定・ステータス
 extern RobotConfig config;
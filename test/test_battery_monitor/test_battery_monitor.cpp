@@ -0,0 +1,176 @@
+/**
+ * @file test_battery_monitor.cpp
+ * @brief BatteryMonitor ユニットテスト
+ *
+ * ADC読み取り関数を注入してテスト:
+ * - ADC生値→電圧変換
+ * - ローパスフィルタ
+ * - ヒステリシス付き低電圧判定
+ */
+
+#include <unity.h>
+#include "BatteryMonitor.h"
+
+// テスト用パラメータ
+static const float DIVIDER_RATIO = 11.0f;
+static const float LOW_THRESHOLD = 21.0f;
+static const float HYSTERESIS = 0.5f;
+
+// 注入するADCソース
+static uint16_t fakeAdcValue = 0;
+static int fakeAdcReadCount = 0;
+
+static uint16_t fakeReadAdc() {
+    fakeAdcReadCount++;
+    return fakeAdcValue;
+}
+
+// 電圧 → ADC生値（テスト入力作成用）
+static uint16_t voltageToRaw(float voltage) {
+    float pinVoltage = voltage / DIVIDER_RATIO;
+    return static_cast<uint16_t>(pinVoltage / BatteryMonitor::ADC_VREF * BatteryMonitor::ADC_MAX + 0.5f);
+}
+
+void setUp(void) {
+    fakeAdcValue = 0;
+    fakeAdcReadCount = 0;
+}
+
+void tearDown(void) {}
+
+// =============================================================================
+// 電圧変換テスト
+// =============================================================================
+
+void test_rawToVoltage_full_scale(void) {
+    // ADC最大値 = 3.3V × 分圧比
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 36.3f, BatteryMonitor::rawToVoltage(4095, DIVIDER_RATIO));
+}
+
+void test_rawToVoltage_zero(void) {
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, BatteryMonitor::rawToVoltage(0, DIVIDER_RATIO));
+}
+
+void test_rawToVoltage_clamps_over_range(void) {
+    // 12bitを超える値は最大値扱い
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 36.3f, BatteryMonitor::rawToVoltage(5000, DIVIDER_RATIO));
+}
+
+// =============================================================================
+// ADCソース注入テスト
+// =============================================================================
+
+void test_update_reads_injected_adc(void) {
+    BatteryMonitor monitor(fakeReadAdc, DIVIDER_RATIO, LOW_THRESHOLD, HYSTERESIS);
+    fakeAdcValue = voltageToRaw(24.0f);
+
+    TEST_ASSERT_FALSE(monitor.hasSample());
+    monitor.update();
+
+    TEST_ASSERT_EQUAL_INT(1, fakeAdcReadCount);
+    TEST_ASSERT_TRUE(monitor.hasSample());
+    // 初回サンプルでフィルタ初期化
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, 24.0f, monitor.getVoltage());
+}
+
+void test_update_without_source_does_nothing(void) {
+    BatteryMonitor monitor(nullptr, DIVIDER_RATIO, LOW_THRESHOLD, HYSTERESIS);
+    monitor.update();
+
+    TEST_ASSERT_FALSE(monitor.hasSample());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, monitor.getVoltage());
+}
+
+// =============================================================================
+// フィルタテスト
+// =============================================================================
+
+void test_filter_smooths_step(void) {
+    BatteryMonitor monitor(fakeReadAdc, DIVIDER_RATIO, LOW_THRESHOLD, HYSTERESIS, 0.1f);
+    fakeAdcValue = voltageToRaw(24.0f);
+    monitor.update();
+
+    // 1サンプルだけのスパイク（モータ突入電流による電圧降下）
+    fakeAdcValue = voltageToRaw(14.0f);
+    monitor.update();
+
+    // 24 + 0.1 × (14 - 24) = 23.0
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 23.0f, monitor.getVoltage());
+    TEST_ASSERT_FALSE(monitor.isLowVoltage());
+}
+
+void test_filter_converges(void) {
+    BatteryMonitor monitor(fakeReadAdc, DIVIDER_RATIO, LOW_THRESHOLD, HYSTERESIS, 0.1f);
+    fakeAdcValue = voltageToRaw(24.0f);
+    monitor.update();
+
+    fakeAdcValue = voltageToRaw(22.0f);
+    for (int i = 0; i < 100; i++) {
+        monitor.update();
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 22.0f, monitor.getVoltage());
+}
+
+// =============================================================================
+// 低電圧判定テスト（ヒステリシス）
+// =============================================================================
+
+void test_judge_low_voltage_set(void) {
+    TEST_ASSERT_FALSE(BatteryMonitor::judgeLowVoltage(21.1f, false, LOW_THRESHOLD, HYSTERESIS));
+    TEST_ASSERT_TRUE(BatteryMonitor::judgeLowVoltage(20.9f, false, LOW_THRESHOLD, HYSTERESIS));
+}
+
+void test_judge_low_voltage_hysteresis(void) {
+    // 低電圧中はしきい値+ヒステリシスを超えるまで解除しない
+    TEST_ASSERT_TRUE(BatteryMonitor::judgeLowVoltage(21.2f, true, LOW_THRESHOLD, HYSTERESIS));
+    TEST_ASSERT_TRUE(BatteryMonitor::judgeLowVoltage(21.49f, true, LOW_THRESHOLD, HYSTERESIS));
+    TEST_ASSERT_FALSE(BatteryMonitor::judgeLowVoltage(21.51f, true, LOW_THRESHOLD, HYSTERESIS));
+}
+
+void test_low_voltage_no_chatter(void) {
+    // しきい値付近で揺れる電圧でもフラグがばたつかない
+    BatteryMonitor monitor(fakeReadAdc, DIVIDER_RATIO, LOW_THRESHOLD, HYSTERESIS, 1.0f);
+
+    fakeAdcValue = voltageToRaw(20.8f);
+    monitor.update();
+    TEST_ASSERT_TRUE(monitor.isLowVoltage());
+
+    const float wobble[] = {21.1f, 20.9f, 21.3f, 21.0f, 21.2f};
+    for (float v : wobble) {
+        fakeAdcValue = voltageToRaw(v);
+        monitor.update();
+        TEST_ASSERT_TRUE(monitor.isLowVoltage());
+    }
+
+    fakeAdcValue = voltageToRaw(22.0f);
+    monitor.update();
+    TEST_ASSERT_FALSE(monitor.isLowVoltage());
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // 電圧変換テスト
+    RUN_TEST(test_rawToVoltage_full_scale);
+    RUN_TEST(test_rawToVoltage_zero);
+    RUN_TEST(test_rawToVoltage_clamps_over_range);
+
+    // ADCソース注入テスト
+    RUN_TEST(test_update_reads_injected_adc);
+    RUN_TEST(test_update_without_source_does_nothing);
+
+    // フィルタテスト
+    RUN_TEST(test_filter_smooths_step);
+    RUN_TEST(test_filter_converges);
+
+    // 低電圧判定テスト
+    RUN_TEST(test_judge_low_voltage_set);
+    RUN_TEST(test_judge_low_voltage_hysteresis);
+    RUN_TEST(test_low_voltage_no_chatter);
+
+    return UNITY_END();
+}
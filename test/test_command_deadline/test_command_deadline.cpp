@@ -0,0 +1,187 @@
+/**
+ * @file test_command_deadline.cpp
+ * @brief CommandDeadline ユニットテスト
+ *
+ * 指令ごとの有効期限と期限切れ後の減速・停止の状態遷移テスト
+ *
+ * テスト条件:
+ * - デフォルト有効期間 500ms、上限 500ms、減速時間の上限 300ms
+ * - 制御周期 10ms
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include "CommandDeadline.h"
+
+static const uint32_t DEFAULT_MS = 500;
+static const uint32_t MAX_MS = 500;
+static const uint32_t RAMP_MS = 300;
+static const uint32_t PERIOD_US = 10000;
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+/**
+ * 期限切れ（減速中になる）までの制御周期数を数える
+ */
+static int ticksUntilExpired(CommandDeadline& deadline, uint32_t startUs) {
+    for (int tick = 1; tick <= 1000; tick++) {
+        if (deadline.update(startUs + tick * PERIOD_US) != CommandDeadline::STATE_VALID) {
+            return tick;
+        }
+    }
+    return -1;
+}
+
+// =============================================================================
+// 有効期間テスト
+// =============================================================================
+
+/**
+ * @test 指令を受信するまでは期限なし
+ */
+void test_idle_until_armed(void) {
+    CommandDeadline deadline(DEFAULT_MS, MAX_MS, RAMP_MS);
+    TEST_ASSERT_EQUAL(CommandDeadline::STATE_IDLE, deadline.update(10000000));
+    TEST_ASSERT_FALSE(deadline.isExpired());
+}
+
+/**
+ * @test 有効期間0はデフォルト、上限超過は上限に丸める
+ */
+void test_resolve_validity(void) {
+    TEST_ASSERT_EQUAL_UINT32(500, CommandDeadline::resolveValidityMs(0, DEFAULT_MS, MAX_MS));
+    TEST_ASSERT_EQUAL_UINT32(50, CommandDeadline::resolveValidityMs(50, DEFAULT_MS, MAX_MS));
+    TEST_ASSERT_EQUAL_UINT32(500, CommandDeadline::resolveValidityMs(2000, DEFAULT_MS, MAX_MS));
+}
+
+/**
+ * @test 50msの有効期間は制御周期の分解能（6周期目＝60ms）で期限切れ
+ */
+void test_short_validity_expires_at_tick_resolution(void) {
+    CommandDeadline deadline(DEFAULT_MS, MAX_MS, RAMP_MS);
+    deadline.arm(0, 50);
+    TEST_ASSERT_EQUAL_UINT32(50, deadline.getValidityMs());
+    TEST_ASSERT_EQUAL(6, ticksUntilExpired(deadline, 0));
+    TEST_ASSERT_EQUAL(CommandDeadline::STATE_RAMPING, deadline.getState());
+    TEST_ASSERT_TRUE(deadline.isExpired());
+    TEST_ASSERT_EQUAL_UINT32(1, deadline.getExpiredCount());
+}
+
+/**
+ * @test 有効期間を指定しない指令はデフォルト（500ms）
+ */
+void test_default_validity(void) {
+    CommandDeadline deadline(DEFAULT_MS, MAX_MS, RAMP_MS);
+    deadline.arm(0, 0);
+    TEST_ASSERT_EQUAL(51, ticksUntilExpired(deadline, 0));
+}
+
+/**
+ * @test 期限内に次の指令を受信すれば有効のまま
+ */
+void test_rearm_keeps_valid(void) {
+    CommandDeadline deadline(DEFAULT_MS, MAX_MS, RAMP_MS);
+    uint32_t now = 0;
+    for (int i = 0; i < 100; i++) {
+        deadline.arm(now, 50);
+        now += 40000;  // 40ms周期の指令
+        TEST_ASSERT_EQUAL(CommandDeadline::STATE_VALID, deadline.update(now));
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, deadline.getExpiredCount());
+}
+
+// =============================================================================
+// 期限切れ後の遷移テスト
+// =============================================================================
+
+/**
+ * @test 減速時間の上限を超えると停止、新しい指令で有効に戻る
+ */
+void test_ramp_then_stop_then_recover(void) {
+    CommandDeadline deadline(DEFAULT_MS, MAX_MS, RAMP_MS);
+    deadline.arm(0, 100);
+
+    TEST_ASSERT_EQUAL(CommandDeadline::STATE_RAMPING, deadline.update(110000));
+    TEST_ASSERT_EQUAL(CommandDeadline::STATE_RAMPING, deadline.update(400000));
+    TEST_ASSERT_EQUAL(CommandDeadline::STATE_STOPPED, deadline.update(410000));
+    TEST_ASSERT_EQUAL(CommandDeadline::STATE_STOPPED, deadline.update(420000));
+    TEST_ASSERT_EQUAL_UINT32(1, deadline.getExpiredCount());
+
+    deadline.arm(430000, 100);
+    TEST_ASSERT_EQUAL(CommandDeadline::STATE_VALID, deadline.update(440000));
+    TEST_ASSERT_FALSE(deadline.isExpired());
+}
+
+/**
+ * @test 長時間更新がなかった場合は減速を飛ばして停止
+ */
+void test_long_gap_goes_straight_to_stop(void) {
+    CommandDeadline deadline(DEFAULT_MS, MAX_MS, RAMP_MS);
+    deadline.arm(0, 50);
+    TEST_ASSERT_EQUAL(CommandDeadline::STATE_STOPPED, deadline.update(1000000));
+    TEST_ASSERT_EQUAL_UINT32(1, deadline.getExpiredCount());
+}
+
+/**
+ * @test 位置制御・軌道の開始で期限を解除
+ */
+void test_disarm(void) {
+    CommandDeadline deadline(DEFAULT_MS, MAX_MS, RAMP_MS);
+    deadline.arm(0, 50);
+    deadline.disarm();
+    TEST_ASSERT_EQUAL(CommandDeadline::STATE_IDLE, deadline.update(1000000));
+    TEST_ASSERT_EQUAL_UINT32(0, deadline.getExpiredCount());
+}
+
+// =============================================================================
+// 時刻の扱いテスト
+// =============================================================================
+
+/**
+ * @test 受信時刻が現在時刻より後（別コアで受信直後）でも期限切れにしない
+ */
+void test_received_after_now(void) {
+    CommandDeadline deadline(DEFAULT_MS, MAX_MS, RAMP_MS);
+    deadline.arm(1000500, 50);
+    TEST_ASSERT_EQUAL(CommandDeadline::STATE_VALID, deadline.update(1000000));
+}
+
+/**
+ * @test uint32のラップアラウンドを跨いでも正しく判定
+ */
+void test_wraparound(void) {
+    CommandDeadline deadline(DEFAULT_MS, MAX_MS, RAMP_MS);
+    uint32_t start = 0xFFFFFFFFu - 20000;
+    deadline.arm(start, 50);
+    TEST_ASSERT_EQUAL(6, ticksUntilExpired(deadline, start));
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // 有効期間テスト
+    RUN_TEST(test_idle_until_armed);
+    RUN_TEST(test_resolve_validity);
+    RUN_TEST(test_short_validity_expires_at_tick_resolution);
+    RUN_TEST(test_default_validity);
+    RUN_TEST(test_rearm_keeps_valid);
+
+    // 期限切れ後の遷移テスト
+    RUN_TEST(test_ramp_then_stop_then_recover);
+    RUN_TEST(test_long_gap_goes_straight_to_stop);
+    RUN_TEST(test_disarm);
+
+    // 時刻の扱いテスト
+    RUN_TEST(test_received_after_now);
+    RUN_TEST(test_wraparound);
+
+    return UNITY_END();
+}
@@ -0,0 +1,107 @@
+/**
+ * @file test_command_doorbell.cpp
+ * @brief CommandDoorbell ユニットテスト
+ *
+ * 指令到着のドアベル（鳴らす・取り出す）と周期外実行の判定テスト
+ * （コア間FIFOとSEVは実機のみ）
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include "CommandDoorbell.h"
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+// =============================================================================
+// ドアベルテスト
+// =============================================================================
+
+/**
+ * @test 鳴らす前は未処理なし
+ */
+void test_initial_not_pending(void) {
+    CommandDoorbell doorbell;
+    TEST_ASSERT_FALSE(doorbell.isPending());
+    TEST_ASSERT_FALSE(doorbell.take());
+}
+
+/**
+ * @test 鳴らしたら1回だけ取り出せる
+ */
+void test_ring_and_take(void) {
+    CommandDoorbell doorbell;
+    doorbell.ring(7);
+    TEST_ASSERT_TRUE(doorbell.isPending());
+    TEST_ASSERT_TRUE(doorbell.take());
+    TEST_ASSERT_EQUAL_UINT32(7, doorbell.getLastValue());
+    TEST_ASSERT_FALSE(doorbell.isPending());
+    TEST_ASSERT_FALSE(doorbell.take());
+}
+
+/**
+ * @test 取り出す前に複数回鳴らした場合はまとめて1回、値は最後のもの
+ */
+void test_multiple_rings_coalesce(void) {
+    CommandDoorbell doorbell;
+    doorbell.ring(1);
+    doorbell.ring(2);
+    doorbell.ring(3);
+    TEST_ASSERT_TRUE(doorbell.take());
+    TEST_ASSERT_EQUAL_UINT32(3, doorbell.getLastValue());
+    TEST_ASSERT_FALSE(doorbell.take());
+}
+
+// =============================================================================
+// 周期外実行の判定テスト
+// =============================================================================
+
+/**
+ * @test 前後に最小間隔を空けられる制御周期のみ周期の途中で適用
+ */
+void test_can_run_out_of_cycle(void) {
+    TEST_ASSERT_TRUE(CommandDoorbell::canRunOutOfCycle(1000, 10000));   // 100Hz
+    TEST_ASSERT_TRUE(CommandDoorbell::canRunOutOfCycle(1000, 2500));    // 400Hz
+    TEST_ASSERT_FALSE(CommandDoorbell::canRunOutOfCycle(1000, 2000));   // 500Hz
+    TEST_ASSERT_FALSE(CommandDoorbell::canRunOutOfCycle(1000, 1000));   // 1000Hz
+    TEST_ASSERT_FALSE(CommandDoorbell::canRunOutOfCycle(10000, 10000)); // RPM指令型
+}
+
+/**
+ * @test 前回の実行から最小間隔の残りを待ち、次の周期に近い場合は次の周期で適用
+ */
+void test_out_of_cycle_delay(void) {
+    const uint32_t defer = CommandDoorbell::DEFER_TO_NEXT_TICK;
+    // 100Hz、最小間隔1000us
+    TEST_ASSERT_EQUAL_UINT32(0, CommandDoorbell::outOfCycleDelayUs(3000, 3000, 1000, 10000));
+    TEST_ASSERT_EQUAL_UINT32(700, CommandDoorbell::outOfCycleDelayUs(300, 300, 1000, 10000));
+    TEST_ASSERT_EQUAL_UINT32(600, CommandDoorbell::outOfCycleDelayUs(400, 5000, 1000, 10000));
+    // 適用後に次の周期まで最小間隔を空けられない
+    TEST_ASSERT_EQUAL_UINT32(defer, CommandDoorbell::outOfCycleDelayUs(9500, 9500, 1000, 10000));
+    TEST_ASSERT_EQUAL_UINT32(defer, CommandDoorbell::outOfCycleDelayUs(500, 8600, 1000, 10000));
+    // 境界: 適用時点で次の周期までちょうど最小間隔
+    TEST_ASSERT_EQUAL_UINT32(0, CommandDoorbell::outOfCycleDelayUs(9000, 9000, 1000, 10000));
+    TEST_ASSERT_EQUAL_UINT32(500, CommandDoorbell::outOfCycleDelayUs(500, 8500, 1000, 10000));
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // ドアベルテスト
+    RUN_TEST(test_initial_not_pending);
+    RUN_TEST(test_ring_and_take);
+    RUN_TEST(test_multiple_rings_coalesce);
+
+    // 周期外実行の判定テスト
+    RUN_TEST(test_can_run_out_of_cycle);
+    RUN_TEST(test_out_of_cycle_delay);
+
+    return UNITY_END();
+}
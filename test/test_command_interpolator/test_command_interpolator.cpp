@@ -0,0 +1,239 @@
+/**
+ * @file test_command_interpolator.cpp
+ * @brief CommandInterpolator ユニットテスト
+ *
+ * タイムスタンプ付き速度指令の補間・外挿テスト
+ *
+ * テスト条件:
+ * - ホスト時刻 = Pico時刻 - 1000000us（受信遅延は別途指定）
+ * - 指令周期 40ms（25Hz）
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include "CommandInterpolator.h"
+
+static const uint32_t HOST_TO_PICO = 1000000;
+static const uint32_t PERIOD_US = 40000;
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+// =============================================================================
+// 基本動作テスト
+// =============================================================================
+
+/**
+ * @test 指令なしでは評価しない
+ */
+void test_empty_returns_false(void) {
+    CommandInterpolator interp(0, 50000);
+    float linearX = 9.0f;
+    float angularZ = 9.0f;
+
+    TEST_ASSERT_FALSE(interp.evaluate(1000, linearX, angularZ));
+    TEST_ASSERT_EQUAL_FLOAT(9.0f, linearX);
+    TEST_ASSERT_EQUAL(0, interp.getSampleCount());
+}
+
+/**
+ * @test 指令1つでは保持
+ */
+void test_single_sample_holds(void) {
+    CommandInterpolator interp(0, 50000);
+    interp.push(0, HOST_TO_PICO, 0.3f, -0.2f);
+
+    float linearX, angularZ;
+    TEST_ASSERT_TRUE(interp.evaluate(HOST_TO_PICO + 30000, linearX, angularZ));
+    TEST_ASSERT_EQUAL_FLOAT(0.3f, linearX);
+    TEST_ASSERT_EQUAL_FLOAT(-0.2f, angularZ);
+}
+
+/**
+ * @test 遅延なし: 最新指令から傾きを延長（外挿）
+ * 0.0→0.4 を40msで変化 → 最新指令の20ms後は0.6
+ */
+void test_extrapolates_from_latest(void) {
+    CommandInterpolator interp(0, 50000);
+    interp.push(0, HOST_TO_PICO, 0.0f, 0.0f);
+    interp.push(PERIOD_US, HOST_TO_PICO + PERIOD_US, 0.4f, 1.0f);
+
+    float linearX, angularZ;
+    interp.evaluate(HOST_TO_PICO + PERIOD_US + 20000, linearX, angularZ);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.6f, linearX);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 1.5f, angularZ);
+}
+
+/**
+ * @test 外挿時間は上限で打ち切り（以降は保持）
+ */
+void test_extrapolation_is_bounded(void) {
+    CommandInterpolator interp(0, 20000);
+    interp.push(0, HOST_TO_PICO, 0.0f, 0.0f);
+    interp.push(PERIOD_US, HOST_TO_PICO + PERIOD_US, 0.4f, 0.0f);
+
+    float linearX, angularZ;
+    interp.evaluate(HOST_TO_PICO + PERIOD_US + 500000, linearX, angularZ);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.6f, linearX);  // 20ms分のみ
+}
+
+/**
+ * @test 停止指令への段差は外挿しても符号が変わらない
+ * 0.5→0.0（33ms間隔）の後、外挿上限まで逆転指令を出さない
+ */
+void test_step_to_zero_never_changes_sign(void) {
+    const uint32_t span = 33000;
+    const uint32_t offsets[] = {1000, 5000, 30000, 50000, 500000};
+
+    CommandInterpolator interp(0, 50000);
+    interp.push(0, HOST_TO_PICO, 0.5f, -1.0f);
+    interp.push(span, HOST_TO_PICO + span, 0.0f, 0.0f);
+
+    float linearX, angularZ;
+    for (uint32_t offset : offsets) {
+        interp.evaluate(HOST_TO_PICO + span + offset, linearX, angularZ);
+        TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, linearX);
+        TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, angularZ);
+    }
+
+    // 減速指令（0.5→0.2）の延長も0で止まる
+    interp.push(span * 2, HOST_TO_PICO + span * 2, 0.5f, 0.0f);
+    interp.push(span * 3, HOST_TO_PICO + span * 3, 0.2f, 0.0f);
+    for (uint32_t offset : offsets) {
+        interp.evaluate(HOST_TO_PICO + span * 3 + offset, linearX, angularZ);
+        TEST_ASSERT_TRUE(linearX >= 0.0f);
+        TEST_ASSERT_TRUE(linearX <= 0.2f);
+    }
+}
+
+/**
+ * @test 遅延あり: 2指令の間を線形補間
+ * 遅延40ms、最新指令の10ms後 → 評価時刻は2指令の間（古い指令から10ms）
+ */
+void test_interpolates_with_delay(void) {
+    CommandInterpolator interp(PERIOD_US, 50000);
+    interp.push(0, HOST_TO_PICO, 0.0f, 0.0f);
+    interp.push(PERIOD_US, HOST_TO_PICO + PERIOD_US, 0.4f, -0.8f);
+
+    float linearX, angularZ;
+    interp.evaluate(HOST_TO_PICO + PERIOD_US + 10000, linearX, angularZ);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.1f, linearX);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, -0.2f, angularZ);
+
+    // 古い指令より前は古い指令値
+    interp.evaluate(HOST_TO_PICO, linearX, angularZ);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, linearX);
+}
+
+// =============================================================================
+// クロックオフセット推定テスト
+// =============================================================================
+
+/**
+ * @test オフセットは受信遅延が最小のサンプルに合わせる
+ */
+void test_offset_tracks_minimum_latency(void) {
+    CommandInterpolator interp(0, 50000);
+    interp.push(0, HOST_TO_PICO + 3000, 0.0f, 0.0f);                    // 遅延3ms
+    interp.push(PERIOD_US, HOST_TO_PICO + PERIOD_US + 500, 0.0f, 0.0f);  // 遅延0.5ms
+
+    TEST_ASSERT_EQUAL_UINT32(HOST_TO_PICO + 500, interp.getClockOffset());
+
+    // 遅延の大きいサンプルではオフセットはわずかに増えるだけ
+    interp.push(2 * PERIOD_US, HOST_TO_PICO + 2 * PERIOD_US + 8000, 0.0f, 0.0f);
+    uint32_t offset = interp.getClockOffset();
+    TEST_ASSERT_TRUE(offset >= HOST_TO_PICO + 500);
+    TEST_ASSERT_TRUE(offset < HOST_TO_PICO + 600);
+}
+
+/**
+ * @test 受信ジッタがあっても指令の間隔はホスト時刻で決まる
+ * 2つ目の指令が10ms遅れて届いても、外挿はホスト時刻の40ms間隔で計算
+ */
+void test_receive_jitter_does_not_distort_slope(void) {
+    CommandInterpolator interp(0, 100000);
+    interp.push(0, HOST_TO_PICO, 0.0f, 0.0f);
+    interp.push(PERIOD_US, HOST_TO_PICO + PERIOD_US + 10000, 0.4f, 0.0f);
+
+    float linearX, angularZ;
+    // ホスト時刻で最新指令の20ms後（オフセットのドリフト追従分 約50usの誤差を許容）
+    interp.evaluate(HOST_TO_PICO + PERIOD_US + 20000, linearX, angularZ);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.6f, linearX);
+}
+
+// =============================================================================
+// 境界値テスト
+// =============================================================================
+
+/**
+ * @test ホスト時刻が戻ったら古い指令を捨てる
+ */
+void test_host_time_going_back_restarts(void) {
+    CommandInterpolator interp(0, 50000);
+    interp.push(100000, HOST_TO_PICO, 0.0f, 0.0f);
+    interp.push(140000, HOST_TO_PICO + 40000, 0.4f, 0.0f);
+    interp.push(0, HOST_TO_PICO + 80000, 0.2f, 0.0f);  // ホスト再起動
+
+    TEST_ASSERT_EQUAL(1, interp.getSampleCount());
+    float linearX, angularZ;
+    interp.evaluate(HOST_TO_PICO + 100000, linearX, angularZ);
+    TEST_ASSERT_EQUAL_FLOAT(0.2f, linearX);
+}
+
+/**
+ * @test uint32ラップアラウンドを跨いでも補間できる
+ */
+void test_timestamp_wraparound(void) {
+    CommandInterpolator interp(0, 50000);
+    uint32_t host0 = UINT32_MAX - 19999;  // +40msでラップ
+    interp.push(host0, host0 + HOST_TO_PICO, 0.0f, 0.0f);
+    interp.push(host0 + PERIOD_US, host0 + PERIOD_US + HOST_TO_PICO, 0.4f, 0.0f);
+
+    TEST_ASSERT_EQUAL(2, interp.getSampleCount());
+    float linearX, angularZ;
+    interp.evaluate(host0 + PERIOD_US + HOST_TO_PICO + 20000, linearX, angularZ);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.6f, linearX);
+}
+
+/**
+ * @test reset()で保持指令を破棄
+ */
+void test_reset(void) {
+    CommandInterpolator interp(0, 50000);
+    interp.push(0, HOST_TO_PICO, 0.3f, 0.0f);
+    interp.reset();
+
+    float linearX, angularZ;
+    TEST_ASSERT_FALSE(interp.evaluate(HOST_TO_PICO, linearX, angularZ));
+    TEST_ASSERT_EQUAL(0, interp.getSampleCount());
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // 基本動作テスト
+    RUN_TEST(test_empty_returns_false);
+    RUN_TEST(test_single_sample_holds);
+    RUN_TEST(test_extrapolates_from_latest);
+    RUN_TEST(test_extrapolation_is_bounded);
+    RUN_TEST(test_step_to_zero_never_changes_sign);
+    RUN_TEST(test_interpolates_with_delay);
+
+    // クロックオフセット推定テスト
+    RUN_TEST(test_offset_tracks_minimum_latency);
+    RUN_TEST(test_receive_jitter_does_not_distort_slope);
+
+    // 境界値テスト
+    RUN_TEST(test_host_time_going_back_restarts);
+    RUN_TEST(test_timestamp_wraparound);
+    RUN_TEST(test_reset);
+
+    return UNITY_END();
+}
@@ -0,0 +1,269 @@
+/**
+ * @file test_control_scheduler.cpp
+ * @brief ControlScheduler ユニットテスト
+ *
+ * マルチレート制御ループの分周テスト
+ *
+ * テスト条件:
+ * - 制御周波数の上限: 1000Hz
+ * - プロファイル周波数の上限: 250Hz
+ * - 公開周波数: 100Hz
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include "ControlScheduler.h"
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+// =============================================================================
+// 制御周波数の設定テスト
+// =============================================================================
+
+/**
+ * @test 有効な制御周波数（公開周波数の整数倍、上限以下）
+ */
+void test_valid_rate(void) {
+    TEST_ASSERT_TRUE(ControlScheduler::isValidRate(100, 1000, 100));
+    TEST_ASSERT_TRUE(ControlScheduler::isValidRate(300, 1000, 100));
+    TEST_ASSERT_TRUE(ControlScheduler::isValidRate(1000, 1000, 100));
+    TEST_ASSERT_FALSE(ControlScheduler::isValidRate(0, 1000, 100));
+    TEST_ASSERT_FALSE(ControlScheduler::isValidRate(50, 1000, 100));
+    TEST_ASSERT_FALSE(ControlScheduler::isValidRate(150, 1000, 100));
+    TEST_ASSERT_FALSE(ControlScheduler::isValidRate(2000, 1000, 100));
+}
+
+/**
+ * @test 周期と分周比
+ */
+void test_dividers(void) {
+    ControlScheduler scheduler(1000, 1000, 250, 100);
+    TEST_ASSERT_EQUAL_UINT16(1000, scheduler.getRateHz());
+    TEST_ASSERT_EQUAL_UINT32(1000, scheduler.getPeriodUs());
+    TEST_ASSERT_EQUAL_UINT32(4, scheduler.getProfileDivider());
+    TEST_ASSERT_EQUAL_UINT32(10, scheduler.getPublishDivider());
+
+    // 100Hzはすべて毎周期
+    TEST_ASSERT_TRUE(scheduler.setRate(100));
+    TEST_ASSERT_EQUAL_UINT32(10000, scheduler.getPeriodUs());
+    TEST_ASSERT_EQUAL_UINT32(1, scheduler.getProfileDivider());
+    TEST_ASSERT_EQUAL_UINT32(1, scheduler.getPublishDivider());
+
+    // プロファイルは上限以下になるよう切り上げ（300Hz → 150Hz）
+    TEST_ASSERT_TRUE(scheduler.setRate(300));
+    TEST_ASSERT_EQUAL_UINT32(3333, scheduler.getPeriodUs());
+    TEST_ASSERT_EQUAL_UINT32(2, scheduler.getProfileDivider());
+    TEST_ASSERT_EQUAL_UINT32(3, scheduler.getPublishDivider());
+}
+
+/**
+ * @test 無効な制御周波数は変更しない
+ */
+void test_invalid_rate_keeps_current(void) {
+    ControlScheduler scheduler(500, 1000, 250, 100);
+    TEST_ASSERT_FALSE(scheduler.setRate(250));
+    TEST_ASSERT_EQUAL_UINT16(500, scheduler.getRateHz());
+    TEST_ASSERT_EQUAL_UINT32(2000, scheduler.getPeriodUs());
+}
+
+/**
+ * @test コンストラクタの無効な値は公開周波数
+ */
+void test_invalid_initial_rate(void) {
+    ControlScheduler scheduler(2000, 1000, 250, 100);
+    TEST_ASSERT_EQUAL_UINT16(100, scheduler.getRateHz());
+}
+
+// =============================================================================
+// 分周テスト
+// =============================================================================
+
+/**
+ * @test 1000Hzでプロファイルは4周期ごと、公開は10周期ごと
+ */
+void test_schedule_1khz(void) {
+    ControlScheduler scheduler(1000, 1000, 250, 100);
+    uint32_t profileCount = 0;
+    uint32_t publishCount = 0;
+    for (int i = 0; i < 100; i++) {
+        scheduler.advance(1);
+        TEST_ASSERT_FLOAT_WITHIN(1e-7f, 0.001f, scheduler.getDt());
+        if (scheduler.isProfileDue()) {
+            profileCount++;
+            TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.004f, scheduler.getProfileDt());
+        }
+        if (scheduler.isPublishDue()) {
+            publishCount++;
+            TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.01f, scheduler.getPublishDt());
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(25, profileCount);
+    TEST_ASSERT_EQUAL_UINT32(10, publishCount);
+}
+
+/**
+ * @test 最初の周期（と周波数変更後の周期）はすべて実行
+ */
+void test_first_tick_runs_all(void) {
+    ControlScheduler scheduler(1000, 1000, 250, 100);
+    scheduler.advance(1);
+    TEST_ASSERT_TRUE(scheduler.isProfileDue());
+    TEST_ASSERT_TRUE(scheduler.isPublishDue());
+    scheduler.advance(1);
+    TEST_ASSERT_FALSE(scheduler.isProfileDue());
+    TEST_ASSERT_FALSE(scheduler.isPublishDue());
+
+    TEST_ASSERT_TRUE(scheduler.setRate(500));
+    scheduler.advance(1);
+    TEST_ASSERT_TRUE(scheduler.isProfileDue());
+    TEST_ASSERT_TRUE(scheduler.isPublishDue());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.004f, scheduler.getProfileDt());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.01f, scheduler.getPublishDt());
+}
+
+/**
+ * @test 取りこぼした周期は経過時間に含める
+ */
+void test_missed_ticks_accumulate(void) {
+    ControlScheduler scheduler(1000, 1000, 250, 100);
+    scheduler.advance(1);   // 初回（すべて実行）
+    scheduler.advance(2);   // プロファイルまで残り2周期
+    TEST_ASSERT_FALSE(scheduler.isProfileDue());
+    scheduler.advance(5);   // 取りこぼし
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.005f, scheduler.getDt());
+    TEST_ASSERT_TRUE(scheduler.isProfileDue());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.007f, scheduler.getProfileDt());
+    TEST_ASSERT_FALSE(scheduler.isPublishDue());
+    scheduler.advance(3);
+    TEST_ASSERT_TRUE(scheduler.isPublishDue());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.01f, scheduler.getPublishDt());
+}
+
+// =============================================================================
+// 周期外の指令処理テスト
+// =============================================================================
+
+/**
+ * @test 未処理の指令がある周期は分周に関係なくプロファイルを実行
+ */
+void test_force_profile(void) {
+    ControlScheduler scheduler(1000, 1000, 250, 100);
+    scheduler.advance(1);   // 初回（すべて実行）
+    scheduler.advance(1, true);
+    TEST_ASSERT_TRUE(scheduler.isProfileDue());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.001f, scheduler.getProfileDt());
+    TEST_ASSERT_FALSE(scheduler.isPublishDue());
+
+    // 分周はここから数え直す
+    scheduler.advance(3);
+    TEST_ASSERT_FALSE(scheduler.isProfileDue());
+    scheduler.advance(1);
+    TEST_ASSERT_TRUE(scheduler.isProfileDue());
+}
+
+/**
+ * @test 周期の途中: 速度PID・プロファイルを実行、次の定期周期のdtから差し引く
+ */
+void test_out_of_cycle(void) {
+    ControlScheduler scheduler(100, 1000, 250, 100);
+    scheduler.advance(1);
+    scheduler.advanceOutOfCycle(0.004f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.004f, scheduler.getDt());
+    TEST_ASSERT_TRUE(scheduler.isProfileDue());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.004f, scheduler.getProfileDt());
+    TEST_ASSERT_FALSE(scheduler.isPublishDue());
+
+    // タイマの位相はそのままの次の定期周期（周期の途中から6ms後）
+    scheduler.advance(1);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.006f, scheduler.getDt());
+    TEST_ASSERT_TRUE(scheduler.isProfileDue());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.006f, scheduler.getProfileDt());
+    TEST_ASSERT_TRUE(scheduler.isPublishDue());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.01f, scheduler.getPublishDt());
+
+    // 以降は通常どおり
+    scheduler.advance(1);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.01f, scheduler.getDt());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.01f, scheduler.getPublishDt());
+}
+
+/**
+ * @test 指令が制御周期より短い間隔で続いても、公開・監視は毎回の定期周期で実行される
+ * 100Hz、各周期の途中（3ms・7ms）に2回ずつ指令
+ */
+void test_out_of_cycle_faster_than_period(void) {
+    ControlScheduler scheduler(100, 1000, 250, 100);
+    scheduler.advance(1);
+
+    float wheelTime = 0.0f;
+    float profileTime = 0.0f;
+    int publishCount = 0;
+    for (int i = 0; i < 10; i++) {
+        scheduler.advanceOutOfCycle(0.003f);
+        TEST_ASSERT_FALSE(scheduler.isPublishDue());
+        wheelTime += scheduler.getDt();
+        profileTime += scheduler.getProfileDt();
+        scheduler.advanceOutOfCycle(0.004f);
+        TEST_ASSERT_FALSE(scheduler.isPublishDue());
+        wheelTime += scheduler.getDt();
+        profileTime += scheduler.getProfileDt();
+
+        scheduler.advance(1);
+        TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.003f, scheduler.getDt());
+        TEST_ASSERT_TRUE(scheduler.isProfileDue());
+        TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.003f, scheduler.getProfileDt());
+        TEST_ASSERT_TRUE(scheduler.isPublishDue());
+        TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.01f, scheduler.getPublishDt());
+        wheelTime += scheduler.getDt();
+        profileTime += scheduler.getProfileDt();
+        publishCount++;
+    }
+
+    // 速度PID・プロファイルのdtの合計は経過時間と一致
+    TEST_ASSERT_EQUAL(10, publishCount);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.1f, wheelTime);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.1f, profileTime);
+}
+
+/**
+ * @test 分周中の周期外実行は、前回のプロファイル実行からの周期数を含める
+ */
+void test_out_of_cycle_divided(void) {
+    ControlScheduler scheduler(1000, 1000, 250, 100);
+    scheduler.advance(1);   // 初回（すべて実行）
+    scheduler.advance(2);
+    scheduler.advanceOutOfCycle(0.0005f);
+    TEST_ASSERT_TRUE(scheduler.isProfileDue());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0025f, scheduler.getProfileDt());
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // 制御周波数の設定テスト
+    RUN_TEST(test_valid_rate);
+    RUN_TEST(test_dividers);
+    RUN_TEST(test_invalid_rate_keeps_current);
+    RUN_TEST(test_invalid_initial_rate);
+
+    // 分周テスト
+    RUN_TEST(test_schedule_1khz);
+    RUN_TEST(test_first_tick_runs_all);
+    RUN_TEST(test_missed_ticks_accumulate);
+
+    // 周期外の指令処理テスト
+    RUN_TEST(test_force_profile);
+    RUN_TEST(test_out_of_cycle);
+    RUN_TEST(test_out_of_cycle_faster_than_period);
+    RUN_TEST(test_out_of_cycle_divided);
+
+    return UNITY_END();
+}
@@ -0,0 +1,184 @@
+/**
+ * @file test_control_timer.cpp
+ * @brief ControlTimer ユニットテスト
+ *
+ * 周期割り込み（onTick）と経過周期数・取りこぼしの集計テスト
+ * （ハードウェアアラームとWFEは実機のみ）
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include "ControlTimer.h"
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+// =============================================================================
+// 周期の集計テスト
+// =============================================================================
+
+/**
+ * @test 周期が来る前は0
+ */
+void test_no_tick_returns_zero(void) {
+    ControlTimer timer(10000);
+    TEST_ASSERT_TRUE(timer.begin());
+    TEST_ASSERT_EQUAL_UINT32(0, timer.poll());
+    TEST_ASSERT_EQUAL_UINT32(0, timer.getMissedTicks());
+}
+
+/**
+ * @test 1周期ごとに処理すれば1、取りこぼしなし
+ */
+void test_one_tick_per_wait(void) {
+    ControlTimer timer(10000);
+    timer.begin();
+    for (int i = 0; i < 100; i++) {
+        timer.onTick();
+        TEST_ASSERT_EQUAL_UINT32(1, timer.wait());
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, timer.getMissedTicks());
+    TEST_ASSERT_EQUAL_UINT32(100, timer.getTickCount());
+}
+
+/**
+ * @test 処理が周期を超えた場合は経過周期数を返し、取りこぼしを数える
+ */
+void test_overrun_counts_missed_ticks(void) {
+    ControlTimer timer(10000);
+    timer.begin();
+    timer.onTick();
+    timer.onTick();
+    timer.onTick();
+    TEST_ASSERT_EQUAL_UINT32(3, timer.poll());
+    TEST_ASSERT_EQUAL_UINT32(2, timer.getMissedTicks());
+
+    timer.onTick();
+    TEST_ASSERT_EQUAL_UINT32(1, timer.poll());
+    TEST_ASSERT_EQUAL_UINT32(2, timer.getMissedTicks());
+}
+
+/**
+ * @test begin()前の周期は数えない
+ */
+void test_begin_discards_earlier_ticks(void) {
+    ControlTimer timer(10000);
+    timer.onTick();
+    timer.onTick();
+    timer.begin();
+    TEST_ASSERT_EQUAL_UINT32(0, timer.poll());
+    TEST_ASSERT_EQUAL_UINT32(0, timer.getMissedTicks());
+}
+
+/**
+ * @test 公称周期 [s]
+ */
+void test_period_seconds(void) {
+    ControlTimer timer(10000);
+    TEST_ASSERT_EQUAL_UINT32(10000, timer.getPeriodUs());
+    TEST_ASSERT_FLOAT_WITHIN(1e-9f, 0.01f, timer.getPeriodSeconds());
+}
+
+/**
+ * @test 周期の変更（未処理の周期は破棄）
+ */
+void test_set_period(void) {
+    ControlTimer timer(10000);
+    timer.begin();
+    timer.onTick();
+    TEST_ASSERT_TRUE(timer.setPeriodUs(1000));
+    TEST_ASSERT_EQUAL_UINT32(1000, timer.getPeriodUs());
+    TEST_ASSERT_FLOAT_WITHIN(1e-9f, 0.001f, timer.getPeriodSeconds());
+    TEST_ASSERT_EQUAL_UINT32(0, timer.poll());
+
+    timer.onTick();
+    TEST_ASSERT_EQUAL_UINT32(1, timer.poll());
+    TEST_ASSERT_EQUAL_UINT32(0, timer.getMissedTicks());
+}
+
+/**
+ * @test 位相の開始し直し（周期は同じ、未処理の周期は破棄）
+ */
+void test_restart(void) {
+    ControlTimer timer(10000);
+    timer.begin();
+    timer.onTick();
+    TEST_ASSERT_TRUE(timer.restart());
+    TEST_ASSERT_EQUAL_UINT32(10000, timer.getPeriodUs());
+    TEST_ASSERT_EQUAL_UINT32(0, timer.poll());
+    TEST_ASSERT_EQUAL_UINT32(0, timer.getMissedTicks());
+}
+
+// =============================================================================
+// ドアベル・起床アラームテスト
+// =============================================================================
+
+/**
+ * @test ドアベルで起床した場合は0、ドアベルは取り出さない
+ */
+void test_wait_with_doorbell(void) {
+    ControlTimer timer(10000);
+    CommandDoorbell doorbell;
+    timer.begin();
+    doorbell.ring(1);
+    TEST_ASSERT_EQUAL_UINT32(0, timer.wait(doorbell));
+    TEST_ASSERT_TRUE(doorbell.isPending());
+
+    timer.onTick();
+    TEST_ASSERT_EQUAL_UINT32(1, timer.wait(doorbell));
+}
+
+/**
+ * @test 起床アラームでwait()から戻り、起床は1回で解除される
+ */
+void test_wake_after(void) {
+    ControlTimer timer(10000);
+    CommandDoorbell doorbell;
+    timer.begin();
+    TEST_ASSERT_TRUE(timer.wakeAfterUs(500));
+    TEST_ASSERT_FALSE(timer.isWakePending());
+
+    timer.onWake();
+    TEST_ASSERT_TRUE(timer.isWakePending());
+    TEST_ASSERT_EQUAL_UINT32(0, timer.wait(doorbell));
+    TEST_ASSERT_FALSE(timer.isWakePending());
+}
+
+/**
+ * @test 周期で処理した場合は起床の予約を取り消す
+ */
+void test_cancel_wake(void) {
+    ControlTimer timer(10000);
+    timer.begin();
+    timer.wakeAfterUs(500);
+    timer.onWake();
+    timer.cancelWake();
+    TEST_ASSERT_FALSE(timer.isWakePending());
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // 周期の集計テスト
+    RUN_TEST(test_no_tick_returns_zero);
+    RUN_TEST(test_one_tick_per_wait);
+    RUN_TEST(test_overrun_counts_missed_ticks);
+    RUN_TEST(test_begin_discards_earlier_ticks);
+    RUN_TEST(test_period_seconds);
+    RUN_TEST(test_set_period);
+    RUN_TEST(test_restart);
+
+    // ドアベル・起床アラームテスト
+    RUN_TEST(test_wait_with_doorbell);
+    RUN_TEST(test_wake_after);
+    RUN_TEST(test_cancel_wake);
+
+    return UNITY_END();
+}
@@ -0,0 +1,214 @@
+/**
+ * @file test_core_watchdog.cpp
+ * @brief CoreWatchdog ユニットテスト
+ *
+ * ウォッチドッグの更新判定とリセット理由の記録・読み出しのテスト
+ * （ハードウェアウォッチドッグとスクラッチレジスタは実機のみ）
+ *
+ * テスト条件:
+ * - タイムアウト: 200ms
+ * - Core0のUSB処理の間隔の上限: 100ms
+ * - Core1の制御周期の間隔の上限: 50ms
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include "CoreWatchdog.h"
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+// =============================================================================
+// 更新判定テスト
+// =============================================================================
+
+/**
+ * @test 開始前は更新しない
+ */
+void test_not_fed_before_begin(void) {
+    CoreWatchdog watchdog(200, 100, 50);
+    TEST_ASSERT_FALSE(watchdog.core1TickCompleted(10));
+    TEST_ASSERT_FALSE(watchdog.checkCore1(1000));
+    TEST_ASSERT_EQUAL_UINT8(CoreWatchdog::RESET_WATCHDOG, watchdog.getPendingReason());
+}
+
+/**
+ * @test 両コアが動いていれば制御周期ごとに更新
+ */
+void test_fed_when_both_cores_alive(void) {
+    CoreWatchdog watchdog(200, 100, 50);
+    watchdog.begin(1000);
+    for (uint32_t t = 1010; t <= 2000; t += 10) {
+        watchdog.core0Serviced(t - 5);
+        TEST_ASSERT_TRUE(watchdog.core1TickCompleted(t));
+    }
+    TEST_ASSERT_FALSE(watchdog.checkCore1(2000));
+    TEST_ASSERT_EQUAL_UINT8(CoreWatchdog::RESET_WATCHDOG, watchdog.getPendingReason());
+}
+
+/**
+ * @test Core0のUSB処理が止まると更新せず、Core0の停止として記録
+ */
+void test_core0_stall_not_fed(void) {
+    CoreWatchdog watchdog(200, 100, 50);
+    watchdog.begin(1000);
+    watchdog.core0Serviced(1000);
+    TEST_ASSERT_TRUE(watchdog.core1TickCompleted(1100));
+    TEST_ASSERT_FALSE(watchdog.core1TickCompleted(1101));
+    TEST_ASSERT_EQUAL_UINT8(CoreWatchdog::RESET_CORE0_STALL, watchdog.getPendingReason());
+}
+
+/**
+ * @test Core1の制御周期が止まるとCore0がCore1の停止として記録
+ */
+void test_core1_stall_recorded(void) {
+    CoreWatchdog watchdog(200, 100, 50);
+    watchdog.begin(1000);
+    watchdog.core0Serviced(1010);
+    watchdog.core1TickCompleted(1010);
+    TEST_ASSERT_FALSE(watchdog.checkCore1(1060));
+    TEST_ASSERT_TRUE(watchdog.checkCore1(1061));
+    TEST_ASSERT_EQUAL_UINT8(CoreWatchdog::RESET_CORE1_STALL, watchdog.getPendingReason());
+}
+
+/**
+ * @test 先に検出した停止を残す
+ */
+void test_first_stall_kept(void) {
+    CoreWatchdog watchdog(200, 100, 50);
+    watchdog.begin(1000);
+    TEST_ASSERT_TRUE(watchdog.checkCore1(1100));
+    TEST_ASSERT_FALSE(watchdog.core1TickCompleted(1200));
+    TEST_ASSERT_EQUAL_UINT8(CoreWatchdog::RESET_CORE1_STALL, watchdog.getPendingReason());
+}
+
+/**
+ * @test 一時的な遅れから回復したら記録を取り消す
+ */
+void test_recovered_stall_cleared(void) {
+    CoreWatchdog watchdog(200, 100, 50);
+    watchdog.begin(1000);
+    TEST_ASSERT_FALSE(watchdog.core1TickCompleted(1150));
+    TEST_ASSERT_EQUAL_UINT8(CoreWatchdog::RESET_CORE0_STALL, watchdog.getPendingReason());
+
+    watchdog.core0Serviced(1155);
+    TEST_ASSERT_TRUE(watchdog.core1TickCompleted(1160));
+    TEST_ASSERT_EQUAL_UINT8(CoreWatchdog::RESET_WATCHDOG, watchdog.getPendingReason());
+}
+
+/**
+ * @test ホストではリセット理由は電源投入
+ */
+void test_begin_reset_reason(void) {
+    CoreWatchdog watchdog(200, 100, 50);
+    watchdog.begin(0);
+    TEST_ASSERT_EQUAL_UINT8(CoreWatchdog::RESET_POWER_ON, watchdog.getResetReason());
+    TEST_ASSERT_EQUAL_UINT16(0, watchdog.getWatchdogResetCount());
+}
+
+// =============================================================================
+// 生存判定テスト
+// =============================================================================
+
+/**
+ * @test 上限時間以内なら生存
+ */
+void test_is_alive(void) {
+    TEST_ASSERT_TRUE(CoreWatchdog::isAlive(1100, 1000, 100));
+    TEST_ASSERT_FALSE(CoreWatchdog::isAlive(1101, 1000, 100));
+}
+
+/**
+ * @test もう一方のコアが直後に更新した場合（最後の時刻が現在より後）も生存
+ */
+void test_is_alive_last_after_now(void) {
+    TEST_ASSERT_TRUE(CoreWatchdog::isAlive(1000, 1001, 100));
+}
+
+/**
+ * @test millis()のラップアラウンド
+ */
+void test_is_alive_wraparound(void) {
+    TEST_ASSERT_TRUE(CoreWatchdog::isAlive(40, 0xFFFFFFF0u, 100));
+    TEST_ASSERT_FALSE(CoreWatchdog::isAlive(200, 0xFFFFFFF0u, 100));
+}
+
+// =============================================================================
+// リセット理由テスト
+// =============================================================================
+
+/**
+ * @test 電源投入（ウォッチドッグ以外）はスクラッチレジスタに関係なく電源投入
+ */
+void test_decode_power_on(void) {
+    uint32_t scratch = CoreWatchdog::encodeScratch(CoreWatchdog::RESET_CORE1_STALL);
+    TEST_ASSERT_EQUAL_UINT8(CoreWatchdog::RESET_POWER_ON,
+                            CoreWatchdog::decodeResetReason(false, false, scratch));
+    TEST_ASSERT_EQUAL_UINT8(CoreWatchdog::RESET_POWER_ON,
+                            CoreWatchdog::decodeResetReason(false, false, 0));
+}
+
+/**
+ * @test ウォッチドッグは記録した停止側のコア
+ */
+void test_decode_watchdog_stall(void) {
+    TEST_ASSERT_EQUAL_UINT8(CoreWatchdog::RESET_CORE1_STALL,
+        CoreWatchdog::decodeResetReason(true, false,
+            CoreWatchdog::encodeScratch(CoreWatchdog::RESET_CORE1_STALL)));
+    TEST_ASSERT_EQUAL_UINT8(CoreWatchdog::RESET_CORE0_STALL,
+        CoreWatchdog::decodeResetReason(true, false,
+            CoreWatchdog::encodeScratch(CoreWatchdog::RESET_CORE0_STALL)));
+}
+
+/**
+ * @test 記録なし・識別子なしのウォッチドッグは原因不明
+ */
+void test_decode_watchdog_unknown(void) {
+    TEST_ASSERT_EQUAL_UINT8(CoreWatchdog::RESET_WATCHDOG,
+        CoreWatchdog::decodeResetReason(true, false,
+            CoreWatchdog::encodeScratch(CoreWatchdog::RESET_WATCHDOG)));
+    TEST_ASSERT_EQUAL_UINT8(CoreWatchdog::RESET_WATCHDOG,
+                            CoreWatchdog::decodeResetReason(true, false, 0x00000001));
+}
+
+/**
+ * @test ソフトウェアリセット
+ */
+void test_decode_software(void) {
+    TEST_ASSERT_EQUAL_UINT8(CoreWatchdog::RESET_SOFTWARE,
+        CoreWatchdog::decodeResetReason(false, true,
+            CoreWatchdog::encodeScratch(CoreWatchdog::RESET_CORE0_STALL)));
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // 更新判定テスト
+    RUN_TEST(test_not_fed_before_begin);
+    RUN_TEST(test_fed_when_both_cores_alive);
+    RUN_TEST(test_core0_stall_not_fed);
+    RUN_TEST(test_core1_stall_recorded);
+    RUN_TEST(test_first_stall_kept);
+    RUN_TEST(test_recovered_stall_cleared);
+    RUN_TEST(test_begin_reset_reason);
+
+    // 生存判定テスト
+    RUN_TEST(test_is_alive);
+    RUN_TEST(test_is_alive_last_after_now);
+    RUN_TEST(test_is_alive_wraparound);
+
+    // リセット理由テスト
+    RUN_TEST(test_decode_power_on);
+    RUN_TEST(test_decode_watchdog_stall);
+    RUN_TEST(test_decode_watchdog_unknown);
+    RUN_TEST(test_decode_software);
+
+    return UNITY_END();
+}
@@ -0,0 +1,173 @@
+/**
+ * @file test_current_sensor.cpp
+ * @brief CurrentSensor / CurrentSampler ユニットテスト
+ *
+ * ハードウェア非依存のロジック部分のみテスト
+ * - 過電流しきい値（ADC生値の整数比較）
+ * - RMS/ピーク電流の集計
+ * - リングバッファ位置からのチャンネル判定
+ */
+
+#include <unity.h>
+#include "CurrentSensor.h"
+#include "CurrentSampler.h"
+
+// テスト用パラメータ: 10A/V（100mV/A）、中点2048、15Aでトリップ
+static const float AMPS_PER_VOLT = 10.0f;
+static const uint16_t ZERO_OFFSET = 2048;
+static const float TRIP_AMPS = 15.0f;
+
+// 1カウントあたりの電流 [A]
+static const float AMPS_PER_COUNT = AMPS_PER_VOLT * 3.3f / 4095.0f;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// =============================================================================
+// 変換・しきい値テスト
+// =============================================================================
+
+void test_rawToAmps_zero_offset(void) {
+    CurrentSensor sensor(AMPS_PER_VOLT, ZERO_OFFSET, TRIP_AMPS);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, sensor.rawToAmps(ZERO_OFFSET));
+}
+
+void test_rawToAmps_bidirectional(void) {
+    CurrentSensor sensor(AMPS_PER_VOLT, ZERO_OFFSET, TRIP_AMPS);
+    // +0.5V = +5A、-0.5V = -5A
+    uint16_t halfVolt = static_cast<uint16_t>(0.5f / 3.3f * 4095.0f + 0.5f);
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, 5.0f, sensor.rawToAmps(ZERO_OFFSET + halfVolt));
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, -5.0f, sensor.rawToAmps(ZERO_OFFSET - halfVolt));
+}
+
+void test_trip_delta_raw(void) {
+    // 15A / 10A/V = 1.5V → 1.5 / 3.3 × 4095 = 1861
+    TEST_ASSERT_EQUAL_INT32(1861, CurrentSensor::ampsToDeltaRaw(TRIP_AMPS, AMPS_PER_VOLT));
+    TEST_ASSERT_EQUAL_INT32(0, CurrentSensor::ampsToDeltaRaw(TRIP_AMPS, 0.0f));
+}
+
+void test_overcurrent_positive_and_negative(void) {
+    CurrentSensor sensor(AMPS_PER_VOLT, ZERO_OFFSET, TRIP_AMPS);
+    int32_t delta = sensor.getTripDeltaRaw();
+
+    // しきい値ちょうどはトリップしない、超えたらトリップ
+    TEST_ASSERT_FALSE(sensor.isOverCurrentRaw(ZERO_OFFSET + delta));
+    TEST_ASSERT_TRUE(sensor.isOverCurrentRaw(ZERO_OFFSET + delta + 1));
+
+    // 逆方向（回生・逆転）も検出
+    TEST_ASSERT_FALSE(sensor.isOverCurrentRaw(ZERO_OFFSET - delta));
+    TEST_ASSERT_TRUE(sensor.isOverCurrentRaw(ZERO_OFFSET - delta - 1));
+}
+
+void test_normal_current_no_trip(void) {
+    CurrentSensor sensor(AMPS_PER_VOLT, ZERO_OFFSET, TRIP_AMPS);
+    TEST_ASSERT_FALSE(sensor.isOverCurrentRaw(ZERO_OFFSET));
+    TEST_ASSERT_FALSE(sensor.isOverCurrentRaw(ZERO_OFFSET + 500));
+}
+
+// =============================================================================
+// RMS/ピーク集計テスト
+// =============================================================================
+
+void test_window_constant_current(void) {
+    CurrentSensor sensor(AMPS_PER_VOLT, ZERO_OFFSET, TRIP_AMPS);
+    uint16_t samples[8];
+    for (int i = 0; i < 8; i++) {
+        samples[i] = ZERO_OFFSET + 100;
+    }
+    sensor.processWindow(samples, 8);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 100.0f * AMPS_PER_COUNT, sensor.getRmsAmps());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 100.0f * AMPS_PER_COUNT, sensor.getPeakAmps());
+}
+
+void test_window_square_wave(void) {
+    // ±100カウントの矩形波: RMS=100、ピーク=100（平均は0）
+    CurrentSensor sensor(AMPS_PER_VOLT, ZERO_OFFSET, TRIP_AMPS);
+    uint16_t samples[8];
+    for (int i = 0; i < 8; i++) {
+        samples[i] = (i % 2 == 0) ? ZERO_OFFSET + 100 : ZERO_OFFSET - 100;
+    }
+    sensor.processWindow(samples, 8);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 100.0f * AMPS_PER_COUNT, sensor.getRmsAmps());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 100.0f * AMPS_PER_COUNT, sensor.getPeakAmps());
+}
+
+void test_window_peak_spike(void) {
+    // 1サンプルのスパイク: ピークは捉え、RMSは薄まる
+    CurrentSensor sensor(AMPS_PER_VOLT, ZERO_OFFSET, TRIP_AMPS);
+    uint16_t samples[4] = {ZERO_OFFSET, ZERO_OFFSET, ZERO_OFFSET + 400, ZERO_OFFSET};
+    sensor.processWindow(samples, 4);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 200.0f * AMPS_PER_COUNT, sensor.getRmsAmps());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 400.0f * AMPS_PER_COUNT, sensor.getPeakAmps());
+}
+
+void test_window_empty(void) {
+    CurrentSensor sensor(AMPS_PER_VOLT, ZERO_OFFSET, TRIP_AMPS);
+    uint16_t samples[1] = {ZERO_OFFSET + 400};
+    sensor.processWindow(samples, 1);
+    sensor.processWindow(samples, 0);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, sensor.getRmsAmps());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, sensor.getPeakAmps());
+}
+
+// =============================================================================
+// サンプリング・遮断判定テスト
+// =============================================================================
+
+void test_latest_index_wraps(void) {
+    TEST_ASSERT_EQUAL(CurrentSampler::RING_SAMPLES - 1, CurrentSampler::latestIndex(0));
+    TEST_ASSERT_EQUAL(4, CurrentSampler::latestIndex(5));
+}
+
+void test_overcurrent_checks_both_channels(void) {
+    // 毎周期L/R両方を比較する（どちらの過電流でも同じ周期で遮断）
+    CurrentSensor sensorL(AMPS_PER_VOLT, ZERO_OFFSET, TRIP_AMPS);
+    CurrentSensor sensorR(AMPS_PER_VOLT, ZERO_OFFSET, TRIP_AMPS);
+    uint16_t over = static_cast<uint16_t>(ZERO_OFFSET + sensorL.getTripDeltaRaw() + 1);
+
+    TEST_ASSERT_FALSE(CurrentSampler::isOverCurrent(sensorL, sensorR, ZERO_OFFSET, ZERO_OFFSET));
+    TEST_ASSERT_TRUE(CurrentSampler::isOverCurrent(sensorL, sensorR, over, ZERO_OFFSET));
+    TEST_ASSERT_TRUE(CurrentSampler::isOverCurrent(sensorL, sensorR, ZERO_OFFSET, over));
+}
+
+void test_overcurrent_uses_each_sensor_threshold(void) {
+    // 左右で異なるしきい値はそれぞれのセンサで判定する
+    CurrentSensor sensorL(AMPS_PER_VOLT, ZERO_OFFSET, TRIP_AMPS);
+    CurrentSensor sensorR(AMPS_PER_VOLT, ZERO_OFFSET, TRIP_AMPS * 2.0f);
+    uint16_t overL = static_cast<uint16_t>(ZERO_OFFSET + sensorL.getTripDeltaRaw() + 1);
+
+    TEST_ASSERT_FALSE(CurrentSampler::isOverCurrent(sensorL, sensorR, ZERO_OFFSET, overL));
+    TEST_ASSERT_TRUE(CurrentSampler::isOverCurrent(sensorL, sensorR, overL, ZERO_OFFSET));
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // 変換・しきい値テスト
+    RUN_TEST(test_rawToAmps_zero_offset);
+    RUN_TEST(test_rawToAmps_bidirectional);
+    RUN_TEST(test_trip_delta_raw);
+    RUN_TEST(test_overcurrent_positive_and_negative);
+    RUN_TEST(test_normal_current_no_trip);
+
+    // RMS/ピーク集計テスト
+    RUN_TEST(test_window_constant_current);
+    RUN_TEST(test_window_square_wave);
+    RUN_TEST(test_window_peak_spike);
+    RUN_TEST(test_window_empty);
+
+    // サンプリング・遮断判定テスト
+    RUN_TEST(test_latest_index_wraps);
+    RUN_TEST(test_overcurrent_checks_both_channels);
+    RUN_TEST(test_overcurrent_uses_each_sensor_threshold);
+
+    return UNITY_END();
+}
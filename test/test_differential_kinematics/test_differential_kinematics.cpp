@@ -3,6 +3,7 @@
  * @brief DifferentialKinematics ユニットテスト
  *
  * cmd_vel（linear_x, angular_z）から左右ホイールRPMへの変換テスト
+ * および左右ホイールRPMから速度への逆変換テスト、左右別ジオメトリのテスト
  *
  * テスト条件:
  * - wheel_diameter = 0.1m
@@ -171,6 +172,188 @@ void test_wider_track_width(void) {
     TEST_ASSERT_FLOAT_WITHIN(0.1f, 57.3f, rightRpm);
 }
 
+// =============================================================================
+// 逆変換テスト
+// =============================================================================
+
+/**
+ * @test 逆変換: 同じRPMなら直進
+ * 19.0986 RPM × 2 → linear_x=0.1 m/s, angular_z=0
+ */
+void test_inverse_forward(void) {
+    float linearX, angularZ;
+    kinematics.inverse(19.0986f, 19.0986f, linearX, angularZ);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.1f, linearX);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, angularZ);
+}
+
+/**
+ * @test 逆変換: 逆回転なら超信地旋回
+ * 左-28.6 / 右+28.6 RPM → angular_z=1.0 rad/s
+ */
+void test_inverse_rotate_in_place(void) {
+    float linearX, angularZ;
+    kinematics.inverse(-28.6479f, 28.6479f, linearX, angularZ);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, linearX);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, angularZ);
+}
+
+/**
+ * @test 順変換→逆変換で元の速度に戻る
+ */
+void test_inverse_round_trip(void) {
+    DifferentialKinematics k(0.125f, 0.38f, 3.5f);
+    const float cases[][2] = {
+        { 0.3f,  0.0f },
+        { 0.0f, -1.2f },
+        { 0.25f, 0.8f },
+        {-0.4f,  0.3f },
+    };
+
+    for (const auto& c : cases) {
+        float leftRpm, rightRpm, linearX, angularZ;
+        k.calculate(c[0], c[1], leftRpm, rightRpm);
+        k.inverse(leftRpm, rightRpm, linearX, angularZ);
+        TEST_ASSERT_FLOAT_WITHIN(0.0001f, c[0], linearX);
+        TEST_ASSERT_FLOAT_WITHIN(0.0001f, c[1], angularZ);
+    }
+}
+
+// =============================================================================
+// ジオメトリ変更・一括変換テスト
+// =============================================================================
+
+/**
+ * @test setGeometry後は新しい係数で計算される
+ */
+void test_set_geometry_updates_constants(void) {
+    DifferentialKinematics k(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO);
+    k.setGeometry(0.2f, 0.6f, 2.0f);
+
+    float leftRpm, rightRpm;
+    k.calculate(0.1f, 0.0f, leftRpm, rightRpm);
+
+    // 直径2倍で半分、減速比2倍で2倍 → 19.1
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 19.1f, leftRpm);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 19.1f, rightRpm);
+    TEST_ASSERT_EQUAL_FLOAT(0.6f, k.getTrackWidth());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, k.getVelToRpm() * k.getRpmToVel());
+}
+
+/**
+ * @test ジオメトリが0でも非数を出さない
+ */
+void test_zero_geometry_outputs_zero(void) {
+    DifferentialKinematics k(0.0f, 0.0f, 1.0f);
+
+    float leftRpm, rightRpm, linearX, angularZ;
+    k.calculate(0.1f, 1.0f, leftRpm, rightRpm);
+    k.inverse(10.0f, -10.0f, linearX, angularZ);
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, leftRpm);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, rightRpm);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, linearX);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, angularZ);
+}
+
+/**
+ * @test 一括変換は単発変換と同じ結果になる
+ */
+void test_batch_matches_single(void) {
+    const float linearX[] = { 0.1f, -0.2f, 0.0f, 0.35f };
+    const float angularZ[] = { 0.0f, 0.5f, -1.0f, 0.2f };
+    float leftRpm[4], rightRpm[4];
+    float linearOut[4], angularOut[4];
+
+    kinematics.calculateBatch(linearX, angularZ, leftRpm, rightRpm, 4);
+    kinematics.inverseBatch(leftRpm, rightRpm, linearOut, angularOut, 4);
+
+    for (int i = 0; i < 4; i++) {
+        float l, r;
+        kinematics.calculate(linearX[i], angularZ[i], l, r);
+        TEST_ASSERT_EQUAL_FLOAT(l, leftRpm[i]);
+        TEST_ASSERT_EQUAL_FLOAT(r, rightRpm[i]);
+        TEST_ASSERT_FLOAT_WITHIN(0.0001f, linearX[i], linearOut[i]);
+        TEST_ASSERT_FLOAT_WITHIN(0.0001f, angularZ[i], angularOut[i]);
+    }
+}
+
+// =============================================================================
+// 左右別ジオメトリテスト
+// =============================================================================
+
+/**
+ * @test 左右別に同じ値を設定すると左右共通と同じ結果
+ */
+void test_per_side_equal_matches_symmetric(void) {
+    DifferentialKinematics k(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO);
+    k.setGeometry(WHEEL_DIAMETER, WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, GEAR_RATIO);
+
+    float leftRpm, rightRpm, expectedL, expectedR;
+    k.calculate(0.2f, 0.7f, leftRpm, rightRpm);
+    kinematics.calculate(0.2f, 0.7f, expectedL, expectedR);
+    TEST_ASSERT_EQUAL_FLOAT(expectedL, leftRpm);
+    TEST_ASSERT_EQUAL_FLOAT(expectedR, rightRpm);
+}
+
+/**
+ * @test 右ホイールが2%大きい場合、直進の右RPMは2%小さい
+ */
+void test_per_side_wheel_diameter(void) {
+    DifferentialKinematics k(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO);
+    k.setGeometry(WHEEL_DIAMETER, WHEEL_DIAMETER * 1.02f, TRACK_WIDTH, GEAR_RATIO, GEAR_RATIO);
+
+    float leftRpm, rightRpm;
+    k.calculate(0.1f, 0.0f, leftRpm, rightRpm);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 19.10f, leftRpm);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, leftRpm / 1.02f, rightRpm);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.102f, k.getWheelDiameterR());
+
+    // 同じRPMでは右の方が速く進むため左旋回
+    float linearX, angularZ;
+    k.inverse(100.0f, 100.0f, linearX, angularZ);
+    TEST_ASSERT_TRUE(angularZ > 0.0f);
+}
+
+/**
+ * @test 左右の減速比が違っても順変換・逆変換で元に戻る
+ */
+void test_per_side_gear_ratio_round_trip(void) {
+    DifferentialKinematics k(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO);
+    k.setGeometry(0.098f, 0.101f, 0.31f, 2.0f, 2.1f);
+
+    float leftRpm, rightRpm, linearX, angularZ;
+    k.calculate(0.3f, -0.8f, leftRpm, rightRpm);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 1.0f, k.getVelToRpmR() * k.getRpmToVelR());
+    k.inverse(leftRpm, rightRpm, linearX, angularZ);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.3f, linearX);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, -0.8f, angularZ);
+}
+
+/**
+ * @test 左右別ジオメトリでも一括版は単体版と一致
+ */
+void test_per_side_batch_matches_single(void) {
+    DifferentialKinematics k(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO);
+    k.setGeometry(0.098f, 0.101f, 0.31f, 2.0f, 2.1f);
+
+    const float linearX[3] = { 0.1f, -0.2f, 0.0f };
+    const float angularZ[3] = { 0.5f, 0.0f, -1.0f };
+    float leftRpm[3], rightRpm[3], linearOut[3], angularOut[3];
+    k.calculateBatch(linearX, angularZ, leftRpm, rightRpm, 3);
+    k.inverseBatch(leftRpm, rightRpm, linearOut, angularOut, 3);
+    for (int i = 0; i < 3; i++) {
+        float l, r;
+        k.calculate(linearX[i], angularZ[i], l, r);
+        TEST_ASSERT_EQUAL_FLOAT(l, leftRpm[i]);
+        TEST_ASSERT_EQUAL_FLOAT(r, rightRpm[i]);
+        TEST_ASSERT_FLOAT_WITHIN(1e-5f, linearX[i], linearOut[i]);
+        TEST_ASSERT_FLOAT_WITHIN(1e-5f, angularZ[i], angularOut[i]);
+    }
+}
+
 // =============================================================================
 // メイン
 // =============================================================================
@@ -192,5 +375,21 @@ int main(void) {
     RUN_TEST(test_larger_wheel_diameter);
     RUN_TEST(test_wider_track_width);
 
+    // 逆変換テスト
+    RUN_TEST(test_inverse_forward);
+    RUN_TEST(test_inverse_rotate_in_place);
+    RUN_TEST(test_inverse_round_trip);
+
+    // ジオメトリ変更・一括変換テスト
+    RUN_TEST(test_set_geometry_updates_constants);
+    RUN_TEST(test_zero_geometry_outputs_zero);
+    RUN_TEST(test_batch_matches_single);
+
+    // 左右別ジオメトリテスト
+    RUN_TEST(test_per_side_equal_matches_symmetric);
+    RUN_TEST(test_per_side_wheel_diameter);
+    RUN_TEST(test_per_side_gear_ratio_round_trip);
+    RUN_TEST(test_per_side_batch_matches_single);
+
     return UNITY_END();
 }
@@ -0,0 +1,136 @@
+/**
+ * @file test_hbridge_driver.cpp
+ * @brief HBridgeDriver ユニットテスト
+ *
+ * ハードウェア非依存のロジック部分（IN1/IN2デューティ計算）のみテスト
+ */
+
+#include <unity.h>
+#include "HBridgeDriver.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// =============================================================================
+// ファストディケイ
+// =============================================================================
+
+void test_fast_forward(void) {
+    HBridgeDriver::PinOutput out =
+        HBridgeDriver::calculateOutput(0.5f, HBridgeDriver::DECAY_FAST, false);
+    TEST_ASSERT_EQUAL_UINT8(128, out.in1Duty);
+    TEST_ASSERT_EQUAL_UINT8(0, out.in2Duty);
+}
+
+void test_fast_reverse(void) {
+    HBridgeDriver::PinOutput out =
+        HBridgeDriver::calculateOutput(-0.5f, HBridgeDriver::DECAY_FAST, false);
+    TEST_ASSERT_EQUAL_UINT8(0, out.in1Duty);
+    TEST_ASSERT_EQUAL_UINT8(128, out.in2Duty);
+}
+
+void test_fast_zero_is_coast(void) {
+    HBridgeDriver::PinOutput out =
+        HBridgeDriver::calculateOutput(0.0f, HBridgeDriver::DECAY_FAST, false);
+    TEST_ASSERT_EQUAL_UINT8(0, out.in1Duty);
+    TEST_ASSERT_EQUAL_UINT8(0, out.in2Duty);
+}
+
+void test_fast_inverted(void) {
+    HBridgeDriver::PinOutput out =
+        HBridgeDriver::calculateOutput(1.0f, HBridgeDriver::DECAY_FAST, true);
+    TEST_ASSERT_EQUAL_UINT8(0, out.in1Duty);
+    TEST_ASSERT_EQUAL_UINT8(255, out.in2Duty);
+}
+
+// =============================================================================
+// スローディケイ
+// =============================================================================
+
+void test_slow_forward(void) {
+    // IN1=HIGH、IN2はLOW期間が通電（25%通電 → IN2デューティ75%）
+    HBridgeDriver::PinOutput out =
+        HBridgeDriver::calculateOutput(0.25f, HBridgeDriver::DECAY_SLOW, false);
+    TEST_ASSERT_EQUAL_UINT8(255, out.in1Duty);
+    TEST_ASSERT_EQUAL_UINT8(255 - 64, out.in2Duty);
+}
+
+void test_slow_reverse(void) {
+    HBridgeDriver::PinOutput out =
+        HBridgeDriver::calculateOutput(-0.25f, HBridgeDriver::DECAY_SLOW, false);
+    TEST_ASSERT_EQUAL_UINT8(255 - 64, out.in1Duty);
+    TEST_ASSERT_EQUAL_UINT8(255, out.in2Duty);
+}
+
+void test_slow_zero_is_brake(void) {
+    HBridgeDriver::PinOutput out =
+        HBridgeDriver::calculateOutput(0.0f, HBridgeDriver::DECAY_SLOW, false);
+    TEST_ASSERT_EQUAL_UINT8(255, out.in1Duty);
+    TEST_ASSERT_EQUAL_UINT8(255, out.in2Duty);
+}
+
+void test_slow_full_speed(void) {
+    HBridgeDriver::PinOutput out =
+        HBridgeDriver::calculateOutput(1.0f, HBridgeDriver::DECAY_SLOW, false);
+    TEST_ASSERT_EQUAL_UINT8(255, out.in1Duty);
+    TEST_ASSERT_EQUAL_UINT8(0, out.in2Duty);
+}
+
+// =============================================================================
+// 停止・ブレーキ・クランプ
+// =============================================================================
+
+void test_stop_and_brake_output(void) {
+    HBridgeDriver::PinOutput stop = HBridgeDriver::calculateStopOutput();
+    TEST_ASSERT_EQUAL_UINT8(0, stop.in1Duty);
+    TEST_ASSERT_EQUAL_UINT8(0, stop.in2Duty);
+
+    HBridgeDriver::PinOutput brake = HBridgeDriver::calculateBrakeOutput();
+    TEST_ASSERT_EQUAL_UINT8(255, brake.in1Duty);
+    TEST_ASSERT_EQUAL_UINT8(255, brake.in2Duty);
+}
+
+void test_over_range_clamped(void) {
+    HBridgeDriver::PinOutput out =
+        HBridgeDriver::calculateOutput(1.5f, HBridgeDriver::DECAY_FAST, false);
+    TEST_ASSERT_EQUAL_UINT8(255, out.in1Duty);
+    TEST_ASSERT_EQUAL_UINT8(0, out.in2Duty);
+}
+
+void test_voltage_compensation(void) {
+    HBridgeDriver driver(6, 7);
+    driver.setNominalVoltage(24.0f);
+    driver.setSupplyVoltage(20.0f);
+    driver.setSpeed(0.5f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.6f, driver.getOutputSpeed());
+
+    driver.brake();
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, driver.getOutputSpeed());
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // ファストディケイ
+    RUN_TEST(test_fast_forward);
+    RUN_TEST(test_fast_reverse);
+    RUN_TEST(test_fast_zero_is_coast);
+    RUN_TEST(test_fast_inverted);
+
+    // スローディケイ
+    RUN_TEST(test_slow_forward);
+    RUN_TEST(test_slow_reverse);
+    RUN_TEST(test_slow_zero_is_brake);
+    RUN_TEST(test_slow_full_speed);
+
+    // 停止・ブレーキ・クランプ
+    RUN_TEST(test_stop_and_brake_output);
+    RUN_TEST(test_over_range_clamped);
+    RUN_TEST(test_voltage_compensation);
+
+    return UNITY_END();
+}
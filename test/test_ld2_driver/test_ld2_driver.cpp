@@ -0,0 +1,149 @@
+/**
+ * @file test_ld2_driver.cpp
+ * @brief Ld2Link / Ld2Driver ユニットテスト
+ *
+ * - フレーム形式（フレームID・チェックサム）がCugoSDKと一致すること
+ * - 左右の指令が揃った時点で1フレーム送信されること
+ */
+
+#include <unity.h>
+#include <string.h>
+#include "Ld2Driver.h"
+
+// 送信記録
+static uint8_t sentFrames[8][Ld2Link::FRAME_LENGTH];
+static int sentCount = 0;
+
+static void recordWrite(const uint8_t* data, size_t length) {
+    TEST_ASSERT_EQUAL(Ld2Link::FRAME_LENGTH, length);
+    if (sentCount < 8) {
+        memcpy(sentFrames[sentCount], data, length);
+    }
+    sentCount++;
+}
+
+static float frameFloat(const uint8_t* frame, size_t offset) {
+    float value;
+    memcpy(&value, &frame[offset], sizeof(float));
+    return value;
+}
+
+void setUp(void) {
+    sentCount = 0;
+    memset(sentFrames, 0, sizeof(sentFrames));
+}
+
+void tearDown(void) {}
+
+// =============================================================================
+// フレーム作成テスト
+// =============================================================================
+
+void test_build_frame_checksum(void) {
+    uint8_t cmd[Ld2Link::CMD_LENGTH] = {0xFF, 0x02, 1, 2, 3, 4, 5, 6, 7, 8};
+    uint8_t frame[Ld2Link::FRAME_LENGTH];
+    Ld2Link::buildFrame(cmd, 5, frame);
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(cmd, frame, Ld2Link::CMD_LENGTH);
+    TEST_ASSERT_EQUAL_UINT8(5, frame[10]);
+    // (5 + 0xFF + 0x02 + 36) & 0xFF
+    TEST_ASSERT_EQUAL_UINT8((5 + 0xFF + 0x02 + 36) & 0xFF, frame[11]);
+}
+
+void test_build_rpm_command(void) {
+    uint8_t cmd[Ld2Link::CMD_LENGTH];
+    Ld2Link::buildRpmCommand(12.5f, -30.0f, cmd);
+
+    TEST_ASSERT_EQUAL_UINT8(Ld2Link::CMD_HEADER, cmd[0]);
+    TEST_ASSERT_EQUAL_UINT8(Ld2Link::CMD_RPM, cmd[1]);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 12.5f, frameFloat(cmd, 2));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -30.0f, frameFloat(cmd, 6));
+}
+
+void test_begin_sends_cmd_mode(void) {
+    Ld2Link link(recordWrite);
+    link.begin();
+
+    TEST_ASSERT_EQUAL(1, sentCount);
+    TEST_ASSERT_EQUAL_UINT8(Ld2Link::CMD_CONTROL_MODE, sentFrames[0][1]);
+    TEST_ASSERT_EQUAL_UINT8(Ld2Link::CONTROL_MODE_CMD, sentFrames[0][2]);
+    TEST_ASSERT_EQUAL_UINT8(0, sentFrames[0][10]);
+    TEST_ASSERT_EQUAL_UINT8(1, link.getFrameId());
+}
+
+// =============================================================================
+// 左右指令の集約テスト
+// =============================================================================
+
+void test_frame_sent_when_both_sides_set(void) {
+    Ld2Link link(recordWrite);
+    Ld2Driver driverL(link, Ld2Link::SIDE_L);
+    Ld2Driver driverR(link, Ld2Link::SIDE_R);
+
+    driverL.setRpm(40.0f);
+    TEST_ASSERT_EQUAL(0, sentCount);
+
+    driverR.setRpm(-20.0f);
+    TEST_ASSERT_EQUAL(1, sentCount);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 40.0f, frameFloat(sentFrames[0], 2));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -20.0f, frameFloat(sentFrames[0], 6));
+}
+
+void test_frame_id_increments(void) {
+    Ld2Link link(recordWrite);
+    Ld2Driver driverL(link, Ld2Link::SIDE_L);
+    Ld2Driver driverR(link, Ld2Link::SIDE_R);
+
+    driverR.setRpm(1.0f);
+    driverL.setRpm(1.0f);
+    driverL.stop();
+    driverR.stop();
+
+    TEST_ASSERT_EQUAL(2, sentCount);
+    TEST_ASSERT_EQUAL_UINT8(0, sentFrames[0][10]);
+    TEST_ASSERT_EQUAL_UINT8(1, sentFrames[1][10]);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, frameFloat(sentFrames[1], 2));
+}
+
+void test_inverted_side(void) {
+    Ld2Link link(recordWrite);
+    Ld2Driver driverL(link, Ld2Link::SIDE_L);
+    Ld2Driver driverR(link, Ld2Link::SIDE_R, true);
+
+    driverL.setRpm(10.0f);
+    driverR.setRpm(10.0f);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -10.0f, link.getRpm(Ld2Link::SIDE_R));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 10.0f, driverR.getCommandRpm());
+}
+
+void test_null_writer_is_safe(void) {
+    Ld2Link link(nullptr);
+    Ld2Driver driverL(link, Ld2Link::SIDE_L);
+    Ld2Driver driverR(link, Ld2Link::SIDE_R);
+
+    driverL.brake();
+    driverR.brake();
+    TEST_ASSERT_EQUAL_UINT8(1, link.getFrameId());
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // フレーム作成テスト
+    RUN_TEST(test_build_frame_checksum);
+    RUN_TEST(test_build_rpm_command);
+    RUN_TEST(test_begin_sends_cmd_mode);
+
+    // 左右指令の集約テスト
+    RUN_TEST(test_frame_sent_when_both_sides_set);
+    RUN_TEST(test_frame_id_increments);
+    RUN_TEST(test_inverted_side);
+    RUN_TEST(test_null_writer_is_safe);
+
+    return UNITY_END();
+}
@@ -5,10 +5,17 @@
  * ハードウェア非依存のロジック部分のみテスト
  * - setCmdVel()で目標RPMが正しく計算されること
  * - 回転優先クランプが正しく動作すること
+ * - バックエンドポリシー（デューティ出力型/RPM指令型）への出力振り分け
+ * - 加減速プロファイル（S字加減速）経由の目標RPM更新
+ * - 左右RPMの直接指令（位置制御用）
+ * - 左右別ジオメトリ
+ * - 飽和処理モード（回転優先 / 曲率保持）
  */
 
 #include <unity.h>
 #include "MotorController.h"
+#include "ThermalModel.h"
+#include <cmath>
 
 // テスト用のロボットパラメータ
 static const float WHEEL_DIAMETER = 0.1f;  // 100mm
@@ -16,6 +23,28 @@ static const float TRACK_WIDTH = 0.3f;     // 300mm
 static const float GEAR_RATIO = 1.0f;
 static const float MAX_RPM = 200.0f;
 
+// =============================================================================
+// テスト用バックエンド（呼び出しを記録）
+// =============================================================================
+
+struct FakeDutyDriver {
+    static constexpr bool RPM_COMMAND = false;
+    float speed = 0.0f;
+    float rpm = 0.0f;
+    int speedCalls = 0;
+    int rpmCalls = 0;
+    int stopCalls = 0;
+    int brakeCalls = 0;
+    void setSpeed(float s) { speed = s; speedCalls++; }
+    void setRpm(float r) { rpm = r; rpmCalls++; }
+    void stop() { stopCalls++; }
+    void brake() { brakeCalls++; }
+};
+
+struct FakeRpmDriver : FakeDutyDriver {
+    static constexpr bool RPM_COMMAND = true;
+};
+
 void setUp(void) {
 }
 
@@ -214,6 +243,593 @@ void test_initial_target_rpm_zero(void) {
     TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, controller.getTargetRpmR());
 }
 
+// =============================================================================
+// 停止設定テスト
+// =============================================================================
+
+/**
+ * @test ブレーキ停止はデフォルト無効、設定で切り替え可能
+ */
+void test_brake_on_stop_setting(void) {
+    MotorController controller(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+
+    TEST_ASSERT_FALSE(controller.getBrakeOnStop());
+    controller.setBrakeOnStop(true);
+    TEST_ASSERT_TRUE(controller.getBrakeOnStop());
+}
+
+/**
+ * @test stop()で目標RPMが0になる（ハードウェアなしでも安全）
+ */
+void test_stop_clears_target(void) {
+    MotorController controller(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    controller.setBrakeOnStop(true);
+
+    controller.setCmdVel(0.1f, 0.0f);
+    controller.stop();
+
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, controller.getTargetRpmL());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, controller.getTargetRpmR());
+}
+
+// =============================================================================
+// バックエンドポリシーテスト
+// =============================================================================
+
+/**
+ * @test デューティ出力型: PID出力をsetSpeed()で出力
+ */
+void test_duty_backend_uses_pid_and_setSpeed(void) {
+    QuadratureEncoder encoderL(0, 1, 1024);
+    QuadratureEncoder encoderR(2, 3, 1024);
+    FakeDutyDriver driverL;
+    FakeDutyDriver driverR;
+    PidController pidL(1.0f, 0.0f, 0.0f);
+    PidController pidR(1.0f, 0.0f, 0.0f);
+    pidL.setOutputLimits(-MAX_RPM, MAX_RPM);
+    pidR.setOutputLimits(-MAX_RPM, MAX_RPM);
+
+    MotorControllerT<FakeDutyDriver> controller(
+        encoderL, encoderR, driverL, driverR, pidL, pidR,
+        WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+
+    controller.setCmdVel(0.1f, 0.0f);
+    controller.update(0.01f);
+
+    // 偏差19.1RPM × Kp1.0 / MAX_RPM
+    TEST_ASSERT_EQUAL(1, driverL.speedCalls);
+    TEST_ASSERT_EQUAL(0, driverL.rpmCalls);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 19.1f / MAX_RPM, driverL.speed);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 19.1f / MAX_RPM, driverR.speed);
+}
+
+/**
+ * @test RPM指令型: PIDを通さず目標RPMをsetRpm()で出力
+ */
+void test_rpm_backend_passes_target_rpm(void) {
+    QuadratureEncoder encoderL(0, 1, 1024);
+    QuadratureEncoder encoderR(2, 3, 1024);
+    FakeRpmDriver driverL;
+    FakeRpmDriver driverR;
+    PidController pidL(1.0f, 0.0f, 0.0f);
+    PidController pidR(1.0f, 0.0f, 0.0f);
+
+    MotorControllerT<FakeRpmDriver> controller(
+        encoderL, encoderR, driverL, driverR, pidL, pidR,
+        WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+
+    controller.setCmdVel(0.0f, 1.0f);
+    controller.update(0.01f);
+
+    TEST_ASSERT_EQUAL(0, driverL.speedCalls);
+    TEST_ASSERT_EQUAL(1, driverL.rpmCalls);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, controller.getTargetRpmL(), driverL.rpm);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, controller.getTargetRpmR(), driverR.rpm);
+}
+
+/**
+ * @test stop()はブレーキ設定に応じてbrake()/stop()を呼ぶ
+ */
+void test_backend_stop_and_brake(void) {
+    QuadratureEncoder encoderL(0, 1, 1024);
+    QuadratureEncoder encoderR(2, 3, 1024);
+    FakeDutyDriver driverL;
+    FakeDutyDriver driverR;
+    PidController pidL(1.0f, 0.0f, 0.0f);
+    PidController pidR(1.0f, 0.0f, 0.0f);
+
+    MotorControllerT<FakeDutyDriver> controller(
+        encoderL, encoderR, driverL, driverR, pidL, pidR,
+        WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+
+    controller.stop();
+    TEST_ASSERT_EQUAL(1, driverL.stopCalls);
+    TEST_ASSERT_EQUAL(0, driverL.brakeCalls);
+
+    controller.setBrakeOnStop(true);
+    controller.stop();
+    TEST_ASSERT_EQUAL(1, driverR.stopCalls);
+    TEST_ASSERT_EQUAL(1, driverR.brakeCalls);
+}
+
+// =============================================================================
+// 加減速プロファイルテスト
+// =============================================================================
+
+/**
+ * @test プロファイル有効時はsetCmdVel()直後の目標RPMは変わらず、update()ごとに追従
+ */
+void test_profile_ramps_target(void) {
+    MotorController controller(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    controller.setMotionLimits(1.0f, 5.0f, 3.0f, 15.0f);
+    TEST_ASSERT_TRUE(controller.isProfileEnabled());
+
+    controller.setCmdVel(0.1f, 0.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, controller.getTargetRpmL());
+
+    controller.update(0.01f);
+    float first = controller.getTargetRpmL();
+    TEST_ASSERT_TRUE(first > 0.0f);
+    TEST_ASSERT_TRUE(first < 1.0f);
+
+    for (int i = 0; i < 200; i++) {
+        controller.update(0.01f);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 19.1f, controller.getTargetRpmL());
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 19.1f, controller.getTargetRpmR());
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.1f, controller.getProfiledLinearX());
+}
+
+/**
+ * @test プロファイル経由でも回転優先クランプ後の値に収束する
+ */
+void test_profile_keeps_rotation_priority_clamp(void) {
+    MotorController reference(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    reference.setCmdVel(2.0f, 1.5f);
+
+    MotorController controller(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    controller.setMotionLimits(1.0f, 5.0f, 3.0f, 15.0f);
+    controller.setCmdVel(2.0f, 1.5f);
+
+    for (int i = 0; i < 500; i++) {
+        controller.update(0.01f);
+        TEST_ASSERT_TRUE(std::abs(controller.getTargetRpmL()) <= MAX_RPM + 0.01f);
+        TEST_ASSERT_TRUE(std::abs(controller.getTargetRpmR()) <= MAX_RPM + 0.01f);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, reference.getTargetRpmL(), controller.getTargetRpmL());
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, reference.getTargetRpmR(), controller.getTargetRpmR());
+}
+
+/**
+ * @test stop()でプロファイルも停止状態に戻る
+ */
+void test_profile_reset_on_stop(void) {
+    MotorController controller(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    controller.setMotionLimits(1.0f, 5.0f, 3.0f, 15.0f);
+    controller.setCmdVel(0.5f, 0.0f);
+    for (int i = 0; i < 100; i++) {
+        controller.update(0.01f);
+    }
+    TEST_ASSERT_TRUE(controller.getProfiledLinearX() > 0.1f);
+
+    controller.stop();
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, controller.getProfiledLinearX());
+
+    // 再開時は0から加速
+    controller.setCmdVel(0.5f, 0.0f);
+    controller.update(0.01f);
+    TEST_ASSERT_TRUE(controller.getProfiledLinearX() < 0.01f);
+}
+
+/**
+ * @test マルチレート: updateWheels()は目標RPMを変えず、プロファイルはupdateProfile()で進む
+ */
+void test_profile_and_wheels_split(void) {
+    QuadratureEncoder encoderL(0, 1, 1024);
+    QuadratureEncoder encoderR(2, 3, 1024);
+    FakeDutyDriver driverL;
+    FakeDutyDriver driverR;
+    PidController pidL(1.0f, 0.0f, 0.0f);
+    PidController pidR(1.0f, 0.0f, 0.0f);
+    MotorControllerT<FakeDutyDriver> controller(
+        encoderL, encoderR, driverL, driverR, pidL, pidR,
+        WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    controller.setMotionLimits(1.0f, 5.0f, 3.0f, 15.0f);
+
+    MotorController reference(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    reference.setMotionLimits(1.0f, 5.0f, 3.0f, 15.0f);
+
+    controller.setCmdVel(0.1f, 0.0f);
+    reference.setCmdVel(0.1f, 0.0f);
+
+    // 速度PID 1kHz、プロファイル250Hz（4周期ごとに4ms分）
+    for (int i = 0; i < 40; i++) {
+        if (i % 4 == 0) {
+            controller.updateProfile(0.004f);
+            reference.update(0.004f);
+        }
+        float target = controller.getTargetRpmL();
+        controller.updateWheels(0.001f);
+        TEST_ASSERT_EQUAL_FLOAT(target, controller.getTargetRpmL());
+    }
+    TEST_ASSERT_EQUAL(40, driverL.speedCalls);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, reference.getTargetRpmL(), controller.getTargetRpmL());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, reference.getProfiledLinearX(), controller.getProfiledLinearX());
+}
+
+// =============================================================================
+// 左右RPM直接指令テスト
+// =============================================================================
+
+/**
+ * @test setWheelRpm()はキネマティクス・プロファイルを通さずに目標RPMを設定
+ */
+void test_wheel_rpm_bypasses_profile(void) {
+    MotorController controller(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    controller.setMotionLimits(1.0f, 5.0f, 3.0f, 15.0f);
+
+    controller.setWheelRpm(30.0f, -10.0f);
+    controller.update(0.01f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 30.0f, controller.getTargetRpmL());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -10.0f, controller.getTargetRpmR());
+}
+
+/**
+ * @test 上限を越える場合は左右の比率を保って縮小
+ */
+void test_wheel_rpm_scales_to_limit(void) {
+    MotorController controller(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    controller.setWheelRpm(400.0f, 100.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, MAX_RPM, controller.getTargetRpmL());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, MAX_RPM / 4.0f, controller.getTargetRpmR());
+
+    controller.setDerating(0.5f, 1.0f);
+    controller.setWheelRpm(-150.0f, 150.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -100.0f, controller.getTargetRpmL());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 100.0f, controller.getTargetRpmR());
+}
+
+/**
+ * @test setCmdVel()に戻るとプロファイルは直接指令時の速度から再開（段差なし）
+ */
+void test_wheel_rpm_resume_cmd_vel_from_current_speed(void) {
+    MotorController controller(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    controller.setMotionLimits(1.0f, 5.0f, 3.0f, 15.0f);
+
+    // 0.1 m/s 相当の直進（19.1 RPM）
+    controller.setWheelRpm(19.1f, 19.1f);
+    controller.update(0.01f);
+
+    controller.setCmdVel(0.1f, 0.0f);
+    controller.update(0.01f);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 19.1f, controller.getTargetRpmL());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.1f, controller.getProfiledLinearX());
+}
+
+// =============================================================================
+// 左右別ジオメトリテスト
+// =============================================================================
+
+/**
+ * @test 左右別ジオメトリ: 右の直径が大きいと直進の右目標RPMは小さい
+ */
+void test_per_side_geometry(void) {
+    MotorController controller(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    controller.setGeometry(WHEEL_DIAMETER, WHEEL_DIAMETER * 1.03f, TRACK_WIDTH, GEAR_RATIO, GEAR_RATIO);
+    controller.setCmdVel(0.1f, 0.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 19.1f, controller.getTargetRpmL());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, controller.getTargetRpmL() / 1.03f, controller.getTargetRpmR());
+}
+
+// =============================================================================
+// 飽和処理モードテスト
+// =============================================================================
+
+/**
+ * @brief 指令空間を走査し、曲率保持モードの曲率誤差の最大値を返す
+ *
+ * 各指令について目標RPMが上限内であること、縮小倍率が0〜1で
+ * 並進・回転とも同じ倍率であることも確認する。
+ */
+static float sweepCurvatureError(MotorController& controller, float rpmLimit) {
+    DifferentialKinematics kinematics(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO);
+    float maxError = 0.0f;
+    for (int i = -40; i <= 40; i++) {
+        for (int j = -60; j <= 60; j++) {
+            float linearX = 0.05f * static_cast<float>(i);   // ±2.0 m/s
+            float angularZ = 0.25f * static_cast<float>(j);  // ±15 rad/s
+            controller.setCmdVel(linearX, angularZ);
+
+            float rpmL = controller.getTargetRpmL();
+            float rpmR = controller.getTargetRpmR();
+            TEST_ASSERT_TRUE(std::abs(rpmL) <= rpmLimit * 1.0001f);
+            TEST_ASSERT_TRUE(std::abs(rpmR) <= rpmLimit * 1.0001f);
+
+            float linearOut;
+            float angularOut;
+            kinematics.inverse(rpmL, rpmR, linearOut, angularOut);
+
+            // 縮小倍率（大きい方の成分から求める）
+            bool linearDominant = std::abs(linearX) >= std::abs(angularZ) * TRACK_WIDTH / 2.0f;
+            if (linearX == 0.0f && angularZ == 0.0f) {
+                TEST_ASSERT_EQUAL_FLOAT(0.0f, rpmL);
+                continue;
+            }
+            float scale = linearDominant ? linearOut / linearX : angularOut / angularZ;
+            TEST_ASSERT_TRUE(scale > 0.0f && scale <= 1.0001f);
+
+            // 曲率誤差: 出力を同じ倍率で戻したときの元の指令とのずれ（曲率 ω/v の誤差と等価）
+            if (linearX != 0.0f) {
+                float curvatureIn = angularZ / linearX;
+                float curvatureOut = angularOut / linearOut;
+                float error = std::abs(curvatureOut - curvatureIn) / std::max(1.0f, std::abs(curvatureIn));
+                maxError = std::max(maxError, error);
+            } else {
+                // その場旋回は並進0を維持
+                maxError = std::max(maxError, std::abs(linearOut));
+            }
+        }
+    }
+    return maxError;
+}
+
+/**
+ * @test デフォルトは回転優先、設定で切り替え可能
+ */
+void test_saturation_mode_default_and_setter(void) {
+    MotorController controller(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    TEST_ASSERT_EQUAL(SATURATION_ROTATION_PRIORITY, controller.getSaturationMode());
+    controller.setSaturationMode(SATURATION_PRESERVE_CURVATURE);
+    TEST_ASSERT_EQUAL(SATURATION_PRESERVE_CURVATURE, controller.getSaturationMode());
+}
+
+/**
+ * @test 回転優先では上限に当たると曲率が変わる（旋回がきつくなる）
+ */
+void test_saturation_rotation_priority_changes_curvature(void) {
+    MotorController controller(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    DifferentialKinematics kinematics(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO);
+
+    controller.setCmdVel(1.5f, 3.0f);  // 曲率 2.0 [1/m]
+    float linearOut;
+    float angularOut;
+    kinematics.inverse(controller.getTargetRpmL(), controller.getTargetRpmR(), linearOut, angularOut);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 3.0f, angularOut);    // 回転は維持
+    TEST_ASSERT_TRUE(angularOut / linearOut > 2.0f * 1.5f);  // 曲率が大きくなる
+}
+
+/**
+ * @test 曲率保持: 指令空間全体で曲率誤差が十分小さく、上限を越えない
+ */
+void test_saturation_preserve_curvature_sweep(void) {
+    MotorController controller(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    controller.setSaturationMode(SATURATION_PRESERVE_CURVATURE);
+    TEST_ASSERT_TRUE(sweepCurvatureError(controller, MAX_RPM) < 1e-4f);
+
+    // ディレーティング中（上限が下がる）も同様
+    controller.setDerating(0.5f, 0.8f);
+    TEST_ASSERT_TRUE(sweepCurvatureError(controller, MAX_RPM * 0.5f) < 1e-4f);
+}
+
+/**
+ * @test 曲率保持: 上限内の指令はそのまま
+ */
+void test_saturation_preserve_curvature_within_limit(void) {
+    MotorController controller(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    MotorController reference(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    controller.setSaturationMode(SATURATION_PRESERVE_CURVATURE);
+
+    controller.setCmdVel(0.3f, 1.0f);
+    reference.setCmdVel(0.3f, 1.0f);
+    TEST_ASSERT_EQUAL_FLOAT(reference.getTargetRpmL(), controller.getTargetRpmL());
+    TEST_ASSERT_EQUAL_FLOAT(reference.getTargetRpmR(), controller.getTargetRpmR());
+}
+
+/**
+ * @test 曲率保持: 加減速プロファイル経由でも到達速度の曲率は指令と同じ
+ */
+void test_saturation_preserve_curvature_with_profile(void) {
+    MotorController controller(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    controller.setSaturationMode(SATURATION_PRESERVE_CURVATURE);
+    controller.setMotionLimits(2.0f, 0.0f, 6.0f, 0.0f);
+
+    controller.setCmdVel(1.5f, 3.0f);
+    for (int i = 0; i < 300; i++) {
+        controller.update(0.01f);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 2.0f,
+                             controller.getProfiledAngularZ() / controller.getProfiledLinearX());
+    TEST_ASSERT_TRUE(std::abs(controller.getTargetRpmR()) <= MAX_RPM * 1.0001f);
+}
+
+// =============================================================================
+// 片側複数輪（スキッドステア）テスト
+// =============================================================================
+
+/**
+ * @test 4WD・デューティ出力型: 同じ側の全車輪が共通の目標に追従する
+ */
+void test_multi_wheel_duty_all_wheels_follow_side_target(void) {
+    QuadratureEncoder encFL(0, 1, 1024), encRL(2, 3, 1024);
+    QuadratureEncoder encFR(4, 5, 1024), encRR(6, 7, 1024);
+    FakeDutyDriver drvFL, drvRL, drvFR, drvRR;
+    PidController pidFL(1.0f, 0.0f, 0.0f), pidRL(1.0f, 0.0f, 0.0f);
+    PidController pidFR(1.0f, 0.0f, 0.0f), pidRR(1.0f, 0.0f, 0.0f);
+    PidController* pids[] = { &pidFL, &pidRL, &pidFR, &pidRR };
+    for (PidController* pid : pids) {
+        pid->setOutputLimits(-MAX_RPM, MAX_RPM);
+    }
+
+    QuadratureEncoder* encodersL[2] = { &encFL, &encRL };
+    QuadratureEncoder* encodersR[2] = { &encFR, &encRR };
+    FakeDutyDriver* driversL[2] = { &drvFL, &drvRL };
+    FakeDutyDriver* driversR[2] = { &drvFR, &drvRR };
+    PidController* pidsL[2] = { &pidFL, &pidRL };
+    PidController* pidsR[2] = { &pidFR, &pidRR };
+
+    MotorControllerT<FakeDutyDriver, 2> controller(
+        encodersL, encodersR, driversL, driversR, pidsL, pidsR,
+        WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+
+    controller.setCmdVel(0.1f, 0.0f);
+    controller.update(0.01f);
+
+    TEST_ASSERT_EQUAL(1, drvFL.speedCalls);
+    TEST_ASSERT_EQUAL(1, drvRL.speedCalls);
+    TEST_ASSERT_EQUAL(1, drvFR.speedCalls);
+    TEST_ASSERT_EQUAL(1, drvRR.speedCalls);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 19.1f / MAX_RPM, drvFL.speed);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, drvFL.speed, drvRL.speed);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, drvFL.speed, drvFR.speed);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, drvFL.speed, drvRR.speed);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, controller.getWheelRpm(0, 1));
+}
+
+/**
+ * @test 6WD・RPM指令型: 各側3輪に側ごとの目標RPMを出力
+ */
+void test_multi_wheel_rpm_backend_per_side_target(void) {
+    QuadratureEncoder enc[6] = {
+        QuadratureEncoder(0, 1, 1024), QuadratureEncoder(2, 3, 1024),
+        QuadratureEncoder(4, 5, 1024), QuadratureEncoder(6, 7, 1024),
+        QuadratureEncoder(8, 9, 1024), QuadratureEncoder(10, 11, 1024)
+    };
+    FakeRpmDriver drv[6];
+    PidController pid[6] = {
+        PidController(1.0f, 0.0f, 0.0f), PidController(1.0f, 0.0f, 0.0f),
+        PidController(1.0f, 0.0f, 0.0f), PidController(1.0f, 0.0f, 0.0f),
+        PidController(1.0f, 0.0f, 0.0f), PidController(1.0f, 0.0f, 0.0f)
+    };
+
+    QuadratureEncoder* encodersL[3] = { &enc[0], &enc[1], &enc[2] };
+    QuadratureEncoder* encodersR[3] = { &enc[3], &enc[4], &enc[5] };
+    FakeRpmDriver* driversL[3] = { &drv[0], &drv[1], &drv[2] };
+    FakeRpmDriver* driversR[3] = { &drv[3], &drv[4], &drv[5] };
+    PidController* pidsL[3] = { &pid[0], &pid[1], &pid[2] };
+    PidController* pidsR[3] = { &pid[3], &pid[4], &pid[5] };
+
+    MotorControllerT<FakeRpmDriver, 3> controller(
+        encodersL, encodersR, driversL, driversR, pidsL, pidsR,
+        WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+
+    controller.setCmdVel(0.0f, 1.0f);
+    controller.update(0.01f);
+
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL(1, drv[i].rpmCalls);
+        TEST_ASSERT_EQUAL(1, drv[i + 3].rpmCalls);
+        TEST_ASSERT_FLOAT_WITHIN(0.001f, controller.getTargetRpmL(), drv[i].rpm);
+        TEST_ASSERT_FLOAT_WITHIN(0.001f, controller.getTargetRpmR(), drv[i + 3].rpm);
+    }
+    TEST_ASSERT_TRUE(controller.getTargetRpmL() < 0.0f);
+    TEST_ASSERT_TRUE(controller.getTargetRpmR() > 0.0f);
+}
+
+/**
+ * @test 4WD: stop()は全車輪を停止/ブレーキする
+ */
+void test_multi_wheel_stop_all_wheels(void) {
+    QuadratureEncoder encFL(0, 1, 1024), encRL(2, 3, 1024);
+    QuadratureEncoder encFR(4, 5, 1024), encRR(6, 7, 1024);
+    FakeDutyDriver drvFL, drvRL, drvFR, drvRR;
+    PidController pidFL(1.0f, 0.0f, 0.0f), pidRL(1.0f, 0.0f, 0.0f);
+    PidController pidFR(1.0f, 0.0f, 0.0f), pidRR(1.0f, 0.0f, 0.0f);
+
+    QuadratureEncoder* encodersL[2] = { &encFL, &encRL };
+    QuadratureEncoder* encodersR[2] = { &encFR, &encRR };
+    FakeDutyDriver* driversL[2] = { &drvFL, &drvRL };
+    FakeDutyDriver* driversR[2] = { &drvFR, &drvRR };
+    PidController* pidsL[2] = { &pidFL, &pidRL };
+    PidController* pidsR[2] = { &pidFR, &pidRR };
+
+    MotorControllerT<FakeDutyDriver, 2> controller(
+        encodersL, encodersR, driversL, driversR, pidsL, pidsR,
+        WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+
+    controller.setBrakeOnStop(true);
+    controller.stop();
+
+    TEST_ASSERT_EQUAL(1, drvFL.brakeCalls);
+    TEST_ASSERT_EQUAL(1, drvRL.brakeCalls);
+    TEST_ASSERT_EQUAL(1, drvFR.brakeCalls);
+    TEST_ASSERT_EQUAL(1, drvRR.brakeCalls);
+    TEST_ASSERT_EQUAL(0, controller.getEncoderCountL());
+}
+
+/**
+ * @test 配列に未接続（nullptr）の車輪があればハードウェアに出力しない
+ */
+void test_multi_wheel_missing_wheel_disables_output(void) {
+    QuadratureEncoder encFL(0, 1, 1024), encFR(4, 5, 1024), encRR(6, 7, 1024);
+    FakeDutyDriver drvFL, drvRL, drvFR, drvRR;
+    PidController pidFL(1.0f, 0.0f, 0.0f), pidRL(1.0f, 0.0f, 0.0f);
+    PidController pidFR(1.0f, 0.0f, 0.0f), pidRR(1.0f, 0.0f, 0.0f);
+
+    QuadratureEncoder* encodersL[2] = { &encFL, nullptr };
+    QuadratureEncoder* encodersR[2] = { &encFR, &encRR };
+    FakeDutyDriver* driversL[2] = { &drvFL, &drvRL };
+    FakeDutyDriver* driversR[2] = { &drvFR, &drvRR };
+    PidController* pidsL[2] = { &pidFL, &pidRL };
+    PidController* pidsR[2] = { &pidFR, &pidRR };
+
+    MotorControllerT<FakeDutyDriver, 2> controller(
+        encodersL, encodersR, driversL, driversR, pidsL, pidsR,
+        WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+
+    controller.setCmdVel(0.1f, 0.0f);
+    controller.update(0.01f);
+    controller.stop();
+
+    TEST_ASSERT_EQUAL(0, drvFL.speedCalls);
+    TEST_ASSERT_EQUAL(0, drvRR.speedCalls);
+    TEST_ASSERT_EQUAL(0, drvFL.stopCalls);
+}
+
+// =============================================================================
+// ディレーティングテスト
+// =============================================================================
+
+/**
+ * @test 過負荷が続くと熱モデルのディレーティングでPID出力が制限される
+ */
+void test_derating_caps_output_after_sustained_load(void) {
+    QuadratureEncoder encoderL(0, 1, 1024);
+    QuadratureEncoder encoderR(2, 3, 1024);
+    FakeDutyDriver driverL;
+    FakeDutyDriver driverR;
+    PidController pidL(10.0f, 0.0f, 0.0f);
+    PidController pidR(10.0f, 0.0f, 0.0f);
+    pidL.setOutputLimits(-MAX_RPM, MAX_RPM);
+    pidR.setOutputLimits(-MAX_RPM, MAX_RPM);
+
+    MotorControllerT<FakeDutyDriver> controller(
+        encoderL, encoderR, driverL, driverR, pidL, pidR,
+        WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, MAX_RPM);
+    ThermalModel thermalL(1.0f, 0.7f, 0.2f, 0.6f);
+    ThermalModel thermalR(1.0f, 0.7f, 0.2f, 0.6f);
+
+    // 冷えた状態では全開（エンコーダ停止のままなのでPIDは飽和）
+    controller.setCmdVel(0.5f, 0.0f);
+    controller.update(0.01f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, driverL.speed);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, driverR.speed);
+
+    // 定格の2倍の負荷を熱時定数の5倍続ける（main.cppの制御周期処理と同じ順序）
+    for (int i = 0; i < 500; i++) {
+        thermalL.update(2.0f, 0.01f);
+        thermalR.update(1.0f, 0.01f);
+        controller.setDerating(thermalL.getDerating(), thermalR.getDerating());
+        controller.update(0.01f);
+    }
+
+    // 左は最小倍率まで制限、右（θ≒1.0）も最小倍率付近
+    TEST_ASSERT_TRUE(thermalL.isOverTemp());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.2f, controller.getDeratingL());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.2f, driverL.speed);
+    TEST_ASSERT_TRUE(driverR.speed <= thermalR.getDerating() + 0.001f);
+    TEST_ASSERT_TRUE(driverR.speed < 1.0f);
+}
+
 // =============================================================================
 // メイン
 // =============================================================================
@@ -240,5 +856,44 @@ int main(void) {
     // 初期状態テスト
     RUN_TEST(test_initial_target_rpm_zero);
 
+    // 停止設定テスト
+    RUN_TEST(test_brake_on_stop_setting);
+    RUN_TEST(test_stop_clears_target);
+
+    // バックエンドポリシーテスト
+    RUN_TEST(test_duty_backend_uses_pid_and_setSpeed);
+    RUN_TEST(test_rpm_backend_passes_target_rpm);
+    RUN_TEST(test_backend_stop_and_brake);
+
+    // 加減速プロファイルテスト
+    RUN_TEST(test_profile_ramps_target);
+    RUN_TEST(test_profile_keeps_rotation_priority_clamp);
+    RUN_TEST(test_profile_reset_on_stop);
+    RUN_TEST(test_profile_and_wheels_split);
+
+    // 左右RPM直接指令テスト
+    RUN_TEST(test_wheel_rpm_bypasses_profile);
+    RUN_TEST(test_wheel_rpm_scales_to_limit);
+    RUN_TEST(test_wheel_rpm_resume_cmd_vel_from_current_speed);
+
+    // 左右別ジオメトリテスト
+    RUN_TEST(test_per_side_geometry);
+
+    // 飽和処理モードテスト
+    RUN_TEST(test_saturation_mode_default_and_setter);
+    RUN_TEST(test_saturation_rotation_priority_changes_curvature);
+    RUN_TEST(test_saturation_preserve_curvature_sweep);
+    RUN_TEST(test_saturation_preserve_curvature_within_limit);
+    RUN_TEST(test_saturation_preserve_curvature_with_profile);
+
+    // 片側複数輪（スキッドステア）テスト
+    RUN_TEST(test_multi_wheel_duty_all_wheels_follow_side_target);
+    RUN_TEST(test_multi_wheel_rpm_backend_per_side_target);
+    RUN_TEST(test_multi_wheel_stop_all_wheels);
+    RUN_TEST(test_multi_wheel_missing_wheel_disables_output);
+
+    // ディレーティングテスト
+    RUN_TEST(test_derating_caps_output_after_sustained_load);
+
     return UNITY_END();
 }
@@ -5,6 +5,7 @@
  * - 速度値のクランプ（-1.0〜1.0）
  * - PWMデューティサイクル計算
  * - 方向判定
+ * - ディケイモード別のピン出力（速度指令・惰性停止・ブレーキ）
  */
 
 #include <unity.h>
@@ -129,6 +130,199 @@ void test_calculatePwmDuty_quarter_speed(void) {
     TEST_ASSERT_TRUE(duty >= 63 && duty <= 64);
 }
 
+void test_calculatePwmLevel(void) {
+    // TOP=6249（20kHz）: 0 → 0、PWM_MAX → TOP+1（常時HIGH）、中間は比例
+    TEST_ASSERT_EQUAL_UINT32(0, MotorDriver::calculatePwmLevel(0, 6249));
+    TEST_ASSERT_EQUAL_UINT32(6250, MotorDriver::calculatePwmLevel(255, 6249));
+    TEST_ASSERT_EQUAL_UINT32(3137, MotorDriver::calculatePwmLevel(128, 6249));
+
+    // TOP=254（analogWriteRange相当）ではデューティがそのまま比較値
+    TEST_ASSERT_EQUAL_UINT32(100, MotorDriver::calculatePwmLevel(100, 254));
+    TEST_ASSERT_EQUAL_UINT32(255, MotorDriver::calculatePwmLevel(255, 254));
+}
+
+// =============================================================================
+// ディケイモード別ピン出力テスト
+// =============================================================================
+
+void test_output_sign_magnitude_coast_forward(void) {
+    // 惰性モード: DIR=LOW、PWM=デューティ、BRAKE=LOW
+    MotorDriver::PinOutput out = MotorDriver::calculateOutput(
+        0.5f, MotorDriver::DECAY_SIGN_MAGNITUDE_COAST, false);
+    TEST_ASSERT_EQUAL_UINT8(0, out.dirDuty);
+    TEST_ASSERT_EQUAL_UINT8(128, out.pwmDuty);
+    TEST_ASSERT_FALSE(out.brake);
+}
+
+void test_output_sign_magnitude_coast_reverse_inverted(void) {
+    // 逆転+反転フラグ → DIR=LOW（正転側）
+    MotorDriver::PinOutput out = MotorDriver::calculateOutput(
+        -1.0f, MotorDriver::DECAY_SIGN_MAGNITUDE_COAST, true);
+    TEST_ASSERT_EQUAL_UINT8(0, out.dirDuty);
+    TEST_ASSERT_EQUAL_UINT8(255, out.pwmDuty);
+
+    out = MotorDriver::calculateOutput(-1.0f, MotorDriver::DECAY_SIGN_MAGNITUDE_COAST, false);
+    TEST_ASSERT_EQUAL_UINT8(255, out.dirDuty);
+    TEST_ASSERT_EQUAL_UINT8(255, out.pwmDuty);
+}
+
+void test_output_sign_magnitude_brake(void) {
+    // ブレーキモード: 走行中もBRAKE=HIGH（スローディケイ）
+    MotorDriver::PinOutput out = MotorDriver::calculateOutput(
+        -0.25f, MotorDriver::DECAY_SIGN_MAGNITUDE_BRAKE, false);
+    TEST_ASSERT_EQUAL_UINT8(255, out.dirDuty);
+    TEST_ASSERT_EQUAL_UINT8(64, out.pwmDuty);
+    TEST_ASSERT_TRUE(out.brake);
+}
+
+void test_output_locked_antiphase(void) {
+    // ロックドアンチフェーズ: PWMピンは常時イネーブル、DIRピンのデューティで速度
+    MotorDriver::PinOutput out = MotorDriver::calculateOutput(
+        0.0f, MotorDriver::DECAY_LOCKED_ANTIPHASE, false);
+    TEST_ASSERT_EQUAL_UINT8(128, out.dirDuty);
+    TEST_ASSERT_EQUAL_UINT8(255, out.pwmDuty);
+    TEST_ASSERT_FALSE(out.brake);
+
+    out = MotorDriver::calculateOutput(1.0f, MotorDriver::DECAY_LOCKED_ANTIPHASE, false);
+    TEST_ASSERT_EQUAL_UINT8(0, out.dirDuty);
+
+    out = MotorDriver::calculateOutput(-1.0f, MotorDriver::DECAY_LOCKED_ANTIPHASE, false);
+    TEST_ASSERT_EQUAL_UINT8(255, out.dirDuty);
+
+    // 範囲外はクランプ
+    out = MotorDriver::calculateOutput(2.0f, MotorDriver::DECAY_LOCKED_ANTIPHASE, false);
+    TEST_ASSERT_EQUAL_UINT8(0, out.dirDuty);
+}
+
+void test_output_locked_antiphase_inverted(void) {
+    // 反転時は50%を中心に対称
+    MotorDriver::PinOutput out = MotorDriver::calculateOutput(
+        0.5f, MotorDriver::DECAY_LOCKED_ANTIPHASE, true);
+    TEST_ASSERT_EQUAL_UINT8(191, out.dirDuty);
+
+    out = MotorDriver::calculateOutput(0.5f, MotorDriver::DECAY_LOCKED_ANTIPHASE, false);
+    TEST_ASSERT_EQUAL_UINT8(64, out.dirDuty);
+}
+
+void test_stop_output_coasts_in_all_modes(void) {
+    // stop()は全モードでイネーブルを落として惰性停止
+    const MotorDriver::DecayMode modes[] = {
+        MotorDriver::DECAY_SIGN_MAGNITUDE_COAST,
+        MotorDriver::DECAY_SIGN_MAGNITUDE_BRAKE,
+        MotorDriver::DECAY_LOCKED_ANTIPHASE
+    };
+    for (MotorDriver::DecayMode mode : modes) {
+        MotorDriver::PinOutput out = MotorDriver::calculateStopOutput(mode);
+        TEST_ASSERT_EQUAL_UINT8(0, out.pwmDuty);
+        TEST_ASSERT_FALSE(out.brake);
+    }
+}
+
+void test_brake_output_coast_without_brake_pin(void) {
+    // ブレーキ手段なし → 惰性停止と同じ
+    MotorDriver::PinOutput out = MotorDriver::calculateBrakeOutput(
+        MotorDriver::DECAY_SIGN_MAGNITUDE_COAST, false);
+    TEST_ASSERT_EQUAL_UINT8(0, out.pwmDuty);
+    TEST_ASSERT_FALSE(out.brake);
+}
+
+void test_brake_output_coast_with_brake_pin(void) {
+    // BRAKEピンあり → PWM=0 + BRAKE=HIGH
+    MotorDriver::PinOutput out = MotorDriver::calculateBrakeOutput(
+        MotorDriver::DECAY_SIGN_MAGNITUDE_COAST, true);
+    TEST_ASSERT_EQUAL_UINT8(0, out.pwmDuty);
+    TEST_ASSERT_TRUE(out.brake);
+}
+
+void test_brake_output_sign_magnitude_brake(void) {
+    // ブレーキモードはBRAKEピンがなくてもPWM=0で短絡
+    MotorDriver::PinOutput out = MotorDriver::calculateBrakeOutput(
+        MotorDriver::DECAY_SIGN_MAGNITUDE_BRAKE, false);
+    TEST_ASSERT_EQUAL_UINT8(0, out.pwmDuty);
+    TEST_ASSERT_TRUE(out.brake);
+}
+
+void test_brake_output_locked_antiphase(void) {
+    // ロックドアンチフェーズ: 50%デューティで制動
+    MotorDriver::PinOutput out = MotorDriver::calculateBrakeOutput(
+        MotorDriver::DECAY_LOCKED_ANTIPHASE, false);
+    TEST_ASSERT_EQUAL_UINT8(128, out.dirDuty);
+    TEST_ASSERT_EQUAL_UINT8(255, out.pwmDuty);
+}
+
+void test_canBrake_by_configuration(void) {
+    MotorDriver coast(6, 7, false, MotorDriver::DECAY_SIGN_MAGNITUDE_COAST);
+    TEST_ASSERT_FALSE(coast.canBrake());
+
+    MotorDriver coastWithPin(6, 7, false, MotorDriver::DECAY_SIGN_MAGNITUDE_COAST, 10);
+    TEST_ASSERT_TRUE(coastWithPin.canBrake());
+
+    // スローディケイ指定でもBRAKEピンがなければ短絡できない
+    MotorDriver brakeNoPin(6, 7, false, MotorDriver::DECAY_SIGN_MAGNITUDE_BRAKE);
+    TEST_ASSERT_FALSE(brakeNoPin.canBrake());
+
+    MotorDriver brakeWithPin(6, 7, false, MotorDriver::DECAY_SIGN_MAGNITUDE_BRAKE, 10);
+    TEST_ASSERT_TRUE(brakeWithPin.canBrake());
+
+    MotorDriver lap(6, 7, false, MotorDriver::DECAY_LOCKED_ANTIPHASE);
+    TEST_ASSERT_TRUE(lap.canBrake());
+
+    lap.setDecayMode(MotorDriver::DECAY_SIGN_MAGNITUDE_COAST);
+    TEST_ASSERT_EQUAL(MotorDriver::DECAY_SIGN_MAGNITUDE_COAST, lap.getDecayMode());
+    TEST_ASSERT_FALSE(lap.canBrake());
+}
+
+// =============================================================================
+// 電圧補償テスト
+// =============================================================================
+
+void test_voltage_scale_nominal(void) {
+    // 公称電圧と同じなら補償なし
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, MotorDriver::calculateVoltageScale(24.0f, 24.0f));
+}
+
+void test_voltage_scale_sagging_battery(void) {
+    // 電圧低下時はデューティを上げる: 24V / 20V = 1.2
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.2f, MotorDriver::calculateVoltageScale(24.0f, 20.0f));
+    // 満充電時は下げる: 24V / 25.2V
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.952f, MotorDriver::calculateVoltageScale(24.0f, 25.2f));
+}
+
+void test_voltage_scale_disabled_or_invalid(void) {
+    // 公称電圧未設定、電圧未計測は補償なし
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, MotorDriver::calculateVoltageScale(0.0f, 20.0f));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, MotorDriver::calculateVoltageScale(24.0f, 0.0f));
+}
+
+void test_voltage_scale_limited(void) {
+    // 計測異常で過補償しない
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, MotorDriver::VOLTAGE_SCALE_MAX,
+                             MotorDriver::calculateVoltageScale(24.0f, 5.0f));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, MotorDriver::VOLTAGE_SCALE_MIN,
+                             MotorDriver::calculateVoltageScale(24.0f, 100.0f));
+}
+
+void test_setSpeed_applies_voltage_scale(void) {
+    MotorDriver driver(6, 7);
+    driver.setNominalVoltage(24.0f);
+    driver.setSupplyVoltage(20.0f);
+
+    driver.setSpeed(0.5f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.6f, driver.getOutputSpeed());
+
+    // 補償後も-1.0〜1.0にクランプ
+    driver.setSpeed(-0.9f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -1.0f, driver.getOutputSpeed());
+}
+
+void test_setSpeed_without_nominal_voltage(void) {
+    // 公称電圧未設定なら電圧を与えても補償しない
+    MotorDriver driver(6, 7);
+    driver.setSupplyVoltage(20.0f);
+    driver.setSpeed(0.5f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.5f, driver.getOutputSpeed());
+}
+
 // =============================================================================
 // メイン
 // =============================================================================
@@ -158,6 +352,28 @@ int main(int argc, char **argv) {
     RUN_TEST(test_calculatePwmDuty_zero_speed);
     RUN_TEST(test_calculatePwmDuty_half_speed);
     RUN_TEST(test_calculatePwmDuty_quarter_speed);
+    RUN_TEST(test_calculatePwmLevel);
+
+    // ディケイモード別ピン出力テスト
+    RUN_TEST(test_output_sign_magnitude_coast_forward);
+    RUN_TEST(test_output_sign_magnitude_coast_reverse_inverted);
+    RUN_TEST(test_output_sign_magnitude_brake);
+    RUN_TEST(test_output_locked_antiphase);
+    RUN_TEST(test_output_locked_antiphase_inverted);
+    RUN_TEST(test_stop_output_coasts_in_all_modes);
+    RUN_TEST(test_brake_output_coast_without_brake_pin);
+    RUN_TEST(test_brake_output_coast_with_brake_pin);
+    RUN_TEST(test_brake_output_sign_magnitude_brake);
+    RUN_TEST(test_brake_output_locked_antiphase);
+    RUN_TEST(test_canBrake_by_configuration);
+
+    // 電圧補償テスト
+    RUN_TEST(test_voltage_scale_nominal);
+    RUN_TEST(test_voltage_scale_sagging_battery);
+    RUN_TEST(test_voltage_scale_disabled_or_invalid);
+    RUN_TEST(test_voltage_scale_limited);
+    RUN_TEST(test_setSpeed_applies_voltage_scale);
+    RUN_TEST(test_setSpeed_without_nominal_voltage);
 
     return UNITY_END();
 }
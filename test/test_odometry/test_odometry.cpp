@@ -0,0 +1,247 @@
+/**
+ * @file test_odometry.cpp
+ * @brief Odometry ユニットテスト
+ *
+ * エンコーダ累積カウントから姿勢（x, y, θ）・速度（v, ω）を積算するテスト
+ *
+ * テスト条件:
+ * - wheel_diameter = 0.1m（1回転 = π×0.1 ≒ 0.3142m）
+ * - track_width = 0.3m
+ * - gear_ratio = 1.0
+ * - counts_per_rev = 1000
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include "Odometry.h"
+
+static const float WHEEL_DIAMETER = 0.1f;
+static const float TRACK_WIDTH = 0.3f;
+static const float GEAR_RATIO = 1.0f;
+static const uint16_t COUNTS_PER_REV = 1000;
+static const float PI_F = 3.14159265f;
+static const float WHEEL_CIRCUMFERENCE = PI_F * WHEEL_DIAMETER;
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+// =============================================================================
+// 基本動作テスト
+// =============================================================================
+
+/**
+ * @test 初回更新はカウント基準の記録のみ
+ * 起動時のカウントが0でなくても姿勢は原点のまま
+ */
+void test_first_update_only_latches(void) {
+    Odometry odom(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, COUNTS_PER_REV);
+    odom.update(5000, -3000, 0.01f);
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, odom.getX());
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, odom.getY());
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, odom.getTheta());
+}
+
+/**
+ * @test 直進: 左右1回転 → x = π×d
+ */
+void test_straight_forward(void) {
+    Odometry odom(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, COUNTS_PER_REV);
+    odom.update(0, 0, 0.1f);
+    odom.update(1000, 1000, 0.1f);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, WHEEL_CIRCUMFERENCE, odom.getX());
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, odom.getY());
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, odom.getTheta());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, WHEEL_CIRCUMFERENCE / 0.1f, odom.getLinearX());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, odom.getAngularZ());
+}
+
+/**
+ * @test その場旋回: 左-750 / 右+750カウント → θ = π/2
+ * 車輪の弧長 0.75×π×0.1 = π/2 × 0.15
+ */
+void test_rotate_in_place(void) {
+    Odometry odom(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, COUNTS_PER_REV);
+    odom.update(0, 0, 0.5f);
+    odom.update(-750, 750, 0.5f);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, odom.getX());
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, odom.getY());
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, PI_F / 2.0f, odom.getTheta());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, PI_F, odom.getAngularZ());  // π/2 rad / 0.5s
+}
+
+/**
+ * @test 円弧走行: 半径0.3mで1/4周 → (0.3, 0.3, π/2)
+ * 左右カウント比1:3、1周期あたり 10 / 30 カウントを75周期
+ */
+void test_quarter_circle_arc(void) {
+    Odometry odom(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, COUNTS_PER_REV);
+    int32_t countL = 0;
+    int32_t countR = 0;
+    odom.update(countL, countR, 0.01f);
+
+    for (int i = 0; i < 75; i++) {
+        countL += 10;
+        countR += 30;
+        odom.update(countL, countR, 0.01f);
+    }
+
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.3f, odom.getX());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.3f, odom.getY());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, PI_F / 2.0f, odom.getTheta());
+}
+
+/**
+ * @test 1周旋回後もθは -π〜π に収まる
+ */
+void test_theta_wraps_after_full_turn(void) {
+    Odometry odom(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, COUNTS_PER_REV);
+    int32_t countL = 0;
+    int32_t countR = 0;
+    odom.update(countL, countR, 0.01f);
+
+    // 1周期あたりπ/2 × 1/30 rad、120周期で1周
+    for (int i = 0; i < 120; i++) {
+        countL -= 25;
+        countR += 25;
+        odom.update(countL, countR, 0.01f);
+        TEST_ASSERT_TRUE(odom.getTheta() <= PI_F + 0.0001f);
+        TEST_ASSERT_TRUE(odom.getTheta() >= -PI_F - 0.0001f);
+    }
+
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, odom.getTheta());
+}
+
+// =============================================================================
+// 境界値テスト
+// =============================================================================
+
+/**
+ * @test カウントのint32ラップアラウンドを跨いでも差分は正しい
+ */
+void test_count_wraparound(void) {
+    Odometry odom(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, COUNTS_PER_REV);
+    odom.update(INT32_MAX - 499, INT32_MAX - 499, 0.01f);
+    odom.update(INT32_MIN + 500, INT32_MIN + 500, 0.01f);  // +1000カウント
+
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, WHEEL_CIRCUMFERENCE, odom.getX());
+}
+
+/**
+ * @test dt=0では速度を更新しない（ゼロ除算回避）が、姿勢は積算する
+ */
+void test_zero_dt_keeps_velocity(void) {
+    Odometry odom(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, COUNTS_PER_REV);
+    odom.update(0, 0, 0.1f);
+    odom.update(1000, 1000, 0.0f);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, WHEEL_CIRCUMFERENCE, odom.getX());
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, odom.getLinearX());
+}
+
+// =============================================================================
+// リセット・角度正規化テスト
+// =============================================================================
+
+/**
+ * @test リセットは姿勢のみ変更し、カウント基準は維持する
+ */
+void test_reset_keeps_count_reference(void) {
+    Odometry odom(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, COUNTS_PER_REV);
+    odom.update(0, 0, 0.1f);
+    odom.update(1000, 1000, 0.1f);
+
+    odom.reset(1.0f, 2.0f, 0.5f);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, odom.getLinearX());
+
+    // カウント変化なし → 姿勢はリセット値のまま
+    odom.update(1000, 1000, 0.1f);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 1.0f, odom.getX());
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 2.0f, odom.getY());
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.5f, odom.getTheta());
+}
+
+/**
+ * @test 角度正規化
+ */
+void test_normalize_angle(void) {
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.5f, Odometry::normalizeAngle(0.5f));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, -PI_F / 2.0f, Odometry::normalizeAngle(3.0f * PI_F / 2.0f));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, PI_F / 2.0f, Odometry::normalizeAngle(-3.0f * PI_F / 2.0f));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, Odometry::normalizeAngle(1.0f + 4.0f * PI_F));
+}
+
+/**
+ * @test ジオメトリ変更: 減速比2.0ならモータ1回転で半分進む
+ */
+void test_set_geometry(void) {
+    Odometry odom(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, COUNTS_PER_REV);
+    odom.setGeometry(WHEEL_DIAMETER, TRACK_WIDTH, 2.0f, COUNTS_PER_REV);
+    odom.update(0, 0, 0.1f);
+    odom.update(1000, 1000, 0.1f);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, WHEEL_CIRCUMFERENCE / 2.0f, odom.getX());
+}
+
+/**
+ * @test 左右別ジオメトリ: 右の直径が2%大きいと、同じカウントでも左に曲がる
+ */
+void test_set_geometry_per_side_diameter(void) {
+    Odometry odom(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, COUNTS_PER_REV);
+    odom.setGeometry(WHEEL_DIAMETER, WHEEL_DIAMETER * 1.02f, TRACK_WIDTH,
+                     GEAR_RATIO, GEAR_RATIO, COUNTS_PER_REV, COUNTS_PER_REV);
+    odom.update(0, 0, 0.1f);
+    odom.update(1000, 1000, 0.1f);
+
+    // 弧長差 0.02×π×0.1 をトレッド幅で割った回転
+    float expectedTheta = 0.02f * WHEEL_CIRCUMFERENCE / TRACK_WIDTH;
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, expectedTheta, odom.getTheta());
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 1.01f * WHEEL_CIRCUMFERENCE, odom.getLinearX() * 0.1f);
+}
+
+/**
+ * @test 左右別ジオメトリ: エンコーダのカウント数が左右で違っても回転数で換算
+ */
+void test_set_geometry_per_side_ppr(void) {
+    Odometry odom(WHEEL_DIAMETER, TRACK_WIDTH, GEAR_RATIO, COUNTS_PER_REV);
+    odom.setGeometry(WHEEL_DIAMETER, WHEEL_DIAMETER, TRACK_WIDTH,
+                     GEAR_RATIO, GEAR_RATIO, COUNTS_PER_REV, 2 * COUNTS_PER_REV);
+    odom.update(0, 0, 0.1f);
+    odom.update(1000, 2000, 0.1f);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, WHEEL_CIRCUMFERENCE, odom.getX());
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, odom.getTheta());
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // 基本動作テスト
+    RUN_TEST(test_first_update_only_latches);
+    RUN_TEST(test_straight_forward);
+    RUN_TEST(test_rotate_in_place);
+    RUN_TEST(test_quarter_circle_arc);
+    RUN_TEST(test_theta_wraps_after_full_turn);
+
+    // 境界値テスト
+    RUN_TEST(test_count_wraparound);
+    RUN_TEST(test_zero_dt_keeps_velocity);
+
+    // リセット・角度正規化テスト
+    RUN_TEST(test_reset_keeps_count_reference);
+    RUN_TEST(test_normalize_angle);
+    RUN_TEST(test_set_geometry);
+    RUN_TEST(test_set_geometry_per_side_diameter);
+    RUN_TEST(test_set_geometry_per_side_ppr);
+
+    return UNITY_END();
+}
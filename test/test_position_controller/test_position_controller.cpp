@@ -0,0 +1,332 @@
+/**
+ * @file test_position_controller.cpp
+ * @brief PositionController ユニットテスト
+ *
+ * 台形プロファイルの計画・サンプリングと、左右同期の位置ループのテスト
+ *
+ * テスト条件:
+ * - counts_per_rev = 1000（1000カウント/s = 60RPM）
+ * - kp = 4.0 [1/s]
+ * - 許容偏差 5カウント、到着判定 0.1s
+ * - 制御周期 10ms、速度ループは理想追従（目標RPMどおりに回る）と仮定
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <cmath>
+#include "PositionController.h"
+
+static const float KP = 4.0f;
+static const uint16_t COUNTS_PER_REV = 1000;
+static const int32_t TOLERANCE = 5;
+static const float SETTLE_TIME = 0.1f;
+static const float DT = 0.01f;
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+/**
+ * 理想的な速度ループで位置制御を回す
+ * @return 到着までの時間 [s]（maxTime以内に到着しなければ負値）
+ */
+static float runIdealPlant(PositionController& pc, double& posL, double& posR, float maxTime,
+                           float* maxAbsRpmL = nullptr, float* maxAbsRpmR = nullptr) {
+    for (float t = 0.0f; t < maxTime; t += DT) {
+        float rpmL;
+        float rpmR;
+        pc.update(static_cast<int32_t>(std::lround(posL)), static_cast<int32_t>(std::lround(posR)),
+                  DT, rpmL, rpmR);
+        posL += rpmL / 60.0 * COUNTS_PER_REV * DT;
+        posR += rpmR / 60.0 * COUNTS_PER_REV * DT;
+        if (maxAbsRpmL != nullptr && std::fabs(rpmL) > *maxAbsRpmL) {
+            *maxAbsRpmL = std::fabs(rpmL);
+        }
+        if (maxAbsRpmR != nullptr && std::fabs(rpmR) > *maxAbsRpmR) {
+            *maxAbsRpmR = std::fabs(rpmR);
+        }
+        if (pc.isReached()) {
+            return t + DT;
+        }
+    }
+    return -1.0f;
+}
+
+// =============================================================================
+// 台形プロファイルテスト
+// =============================================================================
+
+/**
+ * @test 最高速度に達する距離は台形
+ * 距離1000、最高速度500/s、加速度1000/s² → 加速0.5s、等速1.5s
+ */
+void test_plan_trapezoid(void) {
+    float ta, tc, vp;
+    PositionController::planTrapezoid(1000.0f, 500.0f, 1000.0f, ta, tc, vp);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.5f, ta);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 1.5f, tc);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 500.0f, vp);
+}
+
+/**
+ * @test 短い距離は三角形（最高速度に届かない）
+ * 距離100、加速度1000/s² → 最高速度 √(100×1000) ≒ 316/s
+ */
+void test_plan_triangle(void) {
+    float ta, tc, vp;
+    PositionController::planTrapezoid(100.0f, 500.0f, 1000.0f, ta, tc, vp);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 316.23f, vp);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, tc);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, vp / 1000.0f, ta);
+}
+
+/**
+ * @test 加速度0以下は矩形速度
+ */
+void test_plan_no_accel_limit(void) {
+    float ta, tc, vp;
+    PositionController::planTrapezoid(1000.0f, 500.0f, 0.0f, ta, tc, vp);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, ta);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 2.0f, tc);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 500.0f, vp);
+}
+
+/**
+ * @test サンプリングは連続で、終了時に距離ちょうど・速度0
+ */
+void test_sample_trapezoid_continuity(void) {
+    float ta, tc, vp;
+    PositionController::planTrapezoid(1000.0f, 500.0f, 1000.0f, ta, tc, vp);
+    float prev = 0.0f;
+    float velocity;
+    for (float t = 0.0f; t <= 2.6f; t += 0.001f) {
+        float p = PositionController::sampleTrapezoid(t, 1000.0f, ta, tc, vp, velocity);
+        TEST_ASSERT_TRUE(p >= prev - 0.0001f);
+        TEST_ASSERT_TRUE(p - prev <= vp * 0.001f + 0.01f);
+        TEST_ASSERT_TRUE(velocity <= vp + 0.001f);
+        prev = p;
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1000.0f, prev);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, velocity);
+    // 中間点は距離の半分
+    float mid = PositionController::sampleTrapezoid(ta + tc * 0.5f, 1000.0f, ta, tc, vp, velocity);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 500.0f, mid);
+}
+
+// =============================================================================
+// 位置ループテスト
+// =============================================================================
+
+/**
+ * @test 直進: 両輪が目標に到着し、到着フラグが立つ
+ */
+void test_straight_move_reaches_target(void) {
+    PositionController pc(KP, COUNTS_PER_REV, TOLERANCE, SETTLE_TIME);
+    TEST_ASSERT_TRUE(pc.start(0, 0, 2000, 2000, 60.0f, 120.0f));
+    TEST_ASSERT_TRUE(pc.isMoving());
+
+    double posL = 0.0;
+    double posR = 0.0;
+    float maxRpmL = 0.0f;
+    float t = runIdealPlant(pc, posL, posR, 10.0f, &maxRpmL);
+    TEST_ASSERT_TRUE(t > 0.0f);
+    TEST_ASSERT_TRUE(t >= pc.getDuration());
+    TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, 2000.0, posL);
+    TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, 2000.0, posR);
+    TEST_ASSERT_FALSE(pc.isMoving());
+    TEST_ASSERT_TRUE(pc.isActive());
+    // 最高速度（60RPM）をほぼ越えない
+    TEST_ASSERT_TRUE(maxRpmL <= 61.0f);
+}
+
+/**
+ * @test その場旋回: 左右逆向きに同じ量、同時に到着
+ */
+void test_in_place_turn_is_symmetric(void) {
+    PositionController pc(KP, COUNTS_PER_REV, TOLERANCE, SETTLE_TIME);
+    pc.start(0, 0, -1500, 1500, 60.0f, 120.0f);
+
+    double posL = 0.0;
+    double posR = 0.0;
+    for (int i = 0; i < 150; i++) {
+        float rpmL;
+        float rpmR;
+        pc.update(static_cast<int32_t>(std::lround(posL)), static_cast<int32_t>(std::lround(posR)),
+                  DT, rpmL, rpmR);
+        TEST_ASSERT_FLOAT_WITHIN(0.001f, -rpmR, rpmL);
+        posL += rpmL / 60.0 * COUNTS_PER_REV * DT;
+        posR += rpmR / 60.0 * COUNTS_PER_REV * DT;
+    }
+    TEST_ASSERT_TRUE(runIdealPlant(pc, posL, posR, 10.0f) > 0.0f);
+    TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, -1500.0, posL);
+    TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, 1500.0, posR);
+}
+
+/**
+ * @test 移動量が異なる場合も同じ進捗率（比率を保ったまま同時に到着）
+ */
+void test_unequal_moves_stay_proportional(void) {
+    PositionController pc(KP, COUNTS_PER_REV, TOLERANCE, SETTLE_TIME);
+    pc.start(0, 0, 3000, 1000, 60.0f, 120.0f);
+
+    double posL = 0.0;
+    double posR = 0.0;
+    float maxRpmL = 0.0f;
+    float maxRpmR = 0.0f;
+    float t = runIdealPlant(pc, posL, posR, 10.0f, &maxRpmL, &maxRpmR);
+    TEST_ASSERT_TRUE(t > 0.0f);
+    TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, 3000.0, posL);
+    TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, 1000.0, posR);
+    // 移動量の大きい左が最高速度、右はその1/3
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 60.0f, maxRpmL);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 20.0f, maxRpmR);
+}
+
+/**
+ * @test 外乱で遅れた車輪は位置ループで追いつく
+ */
+void test_position_loop_corrects_lag(void) {
+    PositionController pc(KP, COUNTS_PER_REV, TOLERANCE, SETTLE_TIME);
+    pc.start(0, 0, 2000, 2000, 60.0f, 120.0f);
+
+    double posL = 0.0;
+    double posR = 0.0;
+    // 右輪だけ最初の0.5sは指令の半分しか回らない
+    for (int i = 0; i < 50; i++) {
+        float rpmL;
+        float rpmR;
+        pc.update(static_cast<int32_t>(std::lround(posL)), static_cast<int32_t>(std::lround(posR)),
+                  DT, rpmL, rpmR);
+        posL += rpmL / 60.0 * COUNTS_PER_REV * DT;
+        posR += 0.5 * rpmR / 60.0 * COUNTS_PER_REV * DT;
+    }
+    TEST_ASSERT_TRUE(posR < posL);
+    TEST_ASSERT_TRUE(runIdealPlant(pc, posL, posR, 10.0f) > 0.0f);
+    TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, 2000.0, posR);
+}
+
+/**
+ * @test 開始カウントがint32の上限付近でもラップアラウンドを吸収
+ */
+void test_wraparound_start(void) {
+    PositionController pc(KP, COUNTS_PER_REV, TOLERANCE, SETTLE_TIME);
+    const int32_t start = INT32_MAX - 500;
+    pc.start(start, 0, 1000, 1000, 60.0f, 120.0f);
+
+    double offsetL = 0.0;
+    double posR = 0.0;
+    bool reached = false;
+    for (int i = 0; i < 1000 && !reached; i++) {
+        float rpmL;
+        float rpmR;
+        int32_t countL = static_cast<int32_t>(
+            static_cast<uint32_t>(start) + static_cast<uint32_t>(std::lround(offsetL)));
+        pc.update(countL, static_cast<int32_t>(std::lround(posR)), DT, rpmL, rpmR);
+        offsetL += rpmL / 60.0 * COUNTS_PER_REV * DT;
+        posR += rpmR / 60.0 * COUNTS_PER_REV * DT;
+        reached = pc.isReached();
+    }
+    TEST_ASSERT_TRUE(reached);
+    TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, 1000.0, offsetL);
+}
+
+/**
+ * @test 移動量0は即座に到着（その場で保持）
+ */
+void test_zero_move_holds(void) {
+    PositionController pc(KP, COUNTS_PER_REV, TOLERANCE, SETTLE_TIME);
+    pc.start(100, 200, 0, 0, 60.0f, 120.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, pc.getDuration());
+
+    double posL = 100.0;
+    double posR = 200.0;
+    TEST_ASSERT_TRUE(runIdealPlant(pc, posL, posR, 1.0f) > 0.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.5, 100.0, posL);
+
+    // 押されてずれると戻す
+    float rpmL;
+    float rpmR;
+    pc.update(150, 200, DT, rpmL, rpmR);
+    TEST_ASSERT_TRUE(rpmL < 0.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, rpmR);
+}
+
+/**
+ * @test 不正な最高速度は開始しない、abort()で出力0
+ */
+void test_invalid_start_and_abort(void) {
+    PositionController pc(KP, COUNTS_PER_REV, TOLERANCE, SETTLE_TIME);
+    TEST_ASSERT_FALSE(pc.start(0, 0, 1000, 1000, 0.0f, 120.0f));
+    TEST_ASSERT_FALSE(pc.isActive());
+
+    pc.start(0, 0, 1000, 1000, 60.0f, 120.0f);
+    float rpmL;
+    float rpmR;
+    pc.update(0, 0, DT, rpmL, rpmR);
+    TEST_ASSERT_TRUE(rpmL > 0.0f);
+
+    pc.abort();
+    TEST_ASSERT_FALSE(pc.isActive());
+    TEST_ASSERT_FALSE(pc.isReached());
+    pc.update(0, 0, DT, rpmL, rpmR);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, rpmL);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, rpmR);
+}
+
+/**
+ * @test 左右でカウント数が違う場合は回転数で同期（同じ回転数なら同じRPM）
+ */
+void test_per_side_counts_per_rev(void) {
+    const uint16_t countsPerRevR = 2 * COUNTS_PER_REV;
+    PositionController pc(KP, COUNTS_PER_REV, TOLERANCE, SETTLE_TIME);
+    pc.setParameters(KP, COUNTS_PER_REV, countsPerRevR);
+    pc.start(0, 0, 2000, 4000, 60.0f, 120.0f);  // 左右とも2回転
+
+    double posL = 0.0;
+    double posR = 0.0;
+    float maxRpm = 0.0f;
+    bool reached = false;
+    for (float t = 0.0f; t < 10.0f && !reached; t += DT) {
+        float rpmL;
+        float rpmR;
+        pc.update(static_cast<int32_t>(std::lround(posL)), static_cast<int32_t>(std::lround(posR)),
+                  DT, rpmL, rpmR);
+        TEST_ASSERT_FLOAT_WITHIN(0.5f, rpmL, rpmR);
+        maxRpm = std::fmax(maxRpm, std::fabs(rpmL));
+        posL += rpmL / 60.0 * COUNTS_PER_REV * DT;
+        posR += rpmR / 60.0 * countsPerRevR * DT;
+        reached = pc.isReached();
+    }
+    TEST_ASSERT_TRUE(reached);
+    TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, 2000.0, posL);
+    TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, 4000.0, posR);
+    TEST_ASSERT_TRUE(maxRpm <= 61.0f);
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // 台形プロファイルテスト
+    RUN_TEST(test_plan_trapezoid);
+    RUN_TEST(test_plan_triangle);
+    RUN_TEST(test_plan_no_accel_limit);
+    RUN_TEST(test_sample_trapezoid_continuity);
+
+    // 位置ループテスト
+    RUN_TEST(test_straight_move_reaches_target);
+    RUN_TEST(test_in_place_turn_is_symmetric);
+    RUN_TEST(test_unequal_moves_stay_proportional);
+    RUN_TEST(test_position_loop_corrects_lag);
+    RUN_TEST(test_wraparound_start);
+    RUN_TEST(test_zero_move_holds);
+    RUN_TEST(test_invalid_start_and_abort);
+    RUN_TEST(test_per_side_counts_per_rev);
+
+    return UNITY_END();
+}
@@ -78,6 +78,77 @@ void test_parse_motor_command_request(void) {
     TEST_ASSERT_EQUAL_UINT8(8, req.payloadLength);
     TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.5f, req.motorCommand.linearX);
     TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, req.motorCommand.angularZ);
+    TEST_ASSERT_FALSE(req.motorCommand.hasTimestamp);
+}
+
+void test_parse_motor_command_with_timestamp(void) {
+    // タイムスタンプ付きMOTOR_COMMAND（12バイト版）
+    float linearX = -0.25f;
+    float angularZ = 0.5f;
+    uint32_t timestampUs = 4000000123u;
+    uint8_t payload[12];
+    memcpy(payload, &linearX, 4);
+    memcpy(payload + 4, &angularZ, 4);
+    memcpy(payload + 8, &timestampUs, 4);
+    uint16_t checksum = Protocol::calculateChecksum(payload, 12);
+
+    uint8_t packet[16];
+    packet[0] = Protocol::REQUEST_MOTOR_COMMAND;
+    packet[1] = 12;
+    packet[2] = checksum & 0xFF;
+    packet[3] = (checksum >> 8) & 0xFF;
+    memcpy(packet + 4, payload, 12);
+
+    Protocol::ParsedRequest req;
+    Protocol::ParseResult result = Protocol::parseRequest(packet, 16, req);
+
+    TEST_ASSERT_EQUAL(Protocol::PARSE_OK, result);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -0.25f, req.motorCommand.linearX);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.5f, req.motorCommand.angularZ);
+    TEST_ASSERT_TRUE(req.motorCommand.hasTimestamp);
+    TEST_ASSERT_EQUAL_UINT32(4000000123u, req.motorCommand.timestampUs);
+    TEST_ASSERT_EQUAL_UINT16(0, req.motorCommand.validityMs);
+}
+
+void test_parse_motor_command_with_validity(void) {
+    // 有効期間付きMOTOR_COMMAND（10バイト版: 速度+有効期間）
+    float linearX = 0.3f;
+    float angularZ = -0.1f;
+    uint16_t validityMs = 50;
+    uint8_t payload[14];
+    memcpy(payload, &linearX, 4);
+    memcpy(payload + 4, &angularZ, 4);
+    memcpy(payload + 8, &validityMs, 2);
+    uint16_t checksum = Protocol::calculateChecksum(payload, 10);
+
+    uint8_t packet[18];
+    packet[0] = Protocol::REQUEST_MOTOR_COMMAND;
+    packet[1] = 10;
+    packet[2] = checksum & 0xFF;
+    packet[3] = (checksum >> 8) & 0xFF;
+    memcpy(packet + 4, payload, 10);
+
+    Protocol::ParsedRequest req;
+    TEST_ASSERT_EQUAL(Protocol::PARSE_OK, Protocol::parseRequest(packet, 14, req));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.3f, req.motorCommand.linearX);
+    TEST_ASSERT_FALSE(req.motorCommand.hasTimestamp);
+    TEST_ASSERT_EQUAL_UINT16(50, req.motorCommand.validityMs);
+
+    // 14バイト版: 速度+タイムスタンプ+有効期間
+    uint32_t timestampUs = 123456u;
+    validityMs = 200;
+    memcpy(payload + 8, &timestampUs, 4);
+    memcpy(payload + 12, &validityMs, 2);
+    checksum = Protocol::calculateChecksum(payload, 14);
+    packet[1] = 14;
+    packet[2] = checksum & 0xFF;
+    packet[3] = (checksum >> 8) & 0xFF;
+    memcpy(packet + 4, payload, 14);
+
+    TEST_ASSERT_EQUAL(Protocol::PARSE_OK, Protocol::parseRequest(packet, 18, req));
+    TEST_ASSERT_TRUE(req.motorCommand.hasTimestamp);
+    TEST_ASSERT_EQUAL_UINT32(123456u, req.motorCommand.timestampUs);
+    TEST_ASSERT_EQUAL_UINT16(200, req.motorCommand.validityMs);
 }
 
 void test_parse_get_version_request(void) {
@@ -204,6 +275,292 @@ void test_parse_set_config_request(void) {
     TEST_ASSERT_FLOAT_WITHIN(0.001f, 2.0f, req.setConfig.gearRatio);
     TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.08f, req.setConfig.wheelDiameter);
     TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.25f, req.setConfig.trackWidth);
+
+    // 30バイト版は左右共通（右側は左と同じ値）
+    TEST_ASSERT_FALSE(req.setConfig.hasPerSide);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 2.0f, req.setConfig.pidKpR);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.2f, req.setConfig.pidKiR);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.02f, req.setConfig.pidKdR);
+    TEST_ASSERT_EQUAL_UINT16(512, req.setConfig.encoderPprR);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 2.0f, req.setConfig.gearRatioR);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.08f, req.setConfig.wheelDiameterR);
+}
+
+void test_parse_set_config_request_per_side(void) {
+    // 30バイト版 + 右側22バイト
+    uint8_t payload[52];
+    float pidKp = 2.0f, pidKi = 0.2f, pidKd = 0.02f, maxRpm = 150.0f;
+    float gearRatio = 2.0f, wheelDiameter = 0.08f, trackWidth = 0.25f;
+    float pidKpR = 2.5f, pidKiR = 0.3f, pidKdR = 0.03f, gearRatioR = 2.1f, wheelDiameterR = 0.082f;
+    uint16_t encoderPpr = 512, encoderPprR = 1024;
+    memcpy(payload, &pidKp, 4);
+    memcpy(payload + 4, &pidKi, 4);
+    memcpy(payload + 8, &pidKd, 4);
+    memcpy(payload + 12, &maxRpm, 4);
+    memcpy(payload + 16, &encoderPpr, 2);
+    memcpy(payload + 18, &gearRatio, 4);
+    memcpy(payload + 22, &wheelDiameter, 4);
+    memcpy(payload + 26, &trackWidth, 4);
+    memcpy(payload + 30, &pidKpR, 4);
+    memcpy(payload + 34, &pidKiR, 4);
+    memcpy(payload + 38, &pidKdR, 4);
+    memcpy(payload + 42, &encoderPprR, 2);
+    memcpy(payload + 44, &gearRatioR, 4);
+    memcpy(payload + 48, &wheelDiameterR, 4);
+
+    uint16_t checksum = Protocol::calculateChecksum(payload, 52);
+    uint8_t packet[56];
+    packet[0] = Protocol::REQUEST_SET_CONFIG;
+    packet[1] = 52;
+    packet[2] = checksum & 0xFF;
+    packet[3] = (checksum >> 8) & 0xFF;
+    memcpy(packet + 4, payload, 52);
+
+    Protocol::ParsedRequest req;
+    TEST_ASSERT_EQUAL(Protocol::PARSE_OK, Protocol::parseRequest(packet, 56, req));
+    TEST_ASSERT_TRUE(req.setConfig.hasPerSide);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 2.0f, req.setConfig.pidKp);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.08f, req.setConfig.wheelDiameter);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.25f, req.setConfig.trackWidth);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 2.5f, req.setConfig.pidKpR);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.3f, req.setConfig.pidKiR);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.03f, req.setConfig.pidKdR);
+    TEST_ASSERT_EQUAL_UINT16(1024, req.setConfig.encoderPprR);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 2.1f, req.setConfig.gearRatioR);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.082f, req.setConfig.wheelDiameterR);
+    TEST_ASSERT_FALSE(req.setConfig.hasControlRate);
+    TEST_ASSERT_EQUAL_UINT16(0, req.setConfig.controlRateHz);
+}
+
+void test_parse_set_config_request_with_rate(void) {
+    // 52バイト版 + 制御周波数2バイト
+    uint8_t payload[54];
+    memset(payload, 0, sizeof(payload));
+    float pidKp = 2.0f, pidKpR = 2.5f;
+    uint16_t encoderPpr = 512, encoderPprR = 1024, controlRateHz = 1000;
+    memcpy(payload, &pidKp, 4);
+    memcpy(payload + 16, &encoderPpr, 2);
+    memcpy(payload + 30, &pidKpR, 4);
+    memcpy(payload + 42, &encoderPprR, 2);
+    memcpy(payload + 52, &controlRateHz, 2);
+
+    uint16_t checksum = Protocol::calculateChecksum(payload, 54);
+    uint8_t packet[58];
+    packet[0] = Protocol::REQUEST_SET_CONFIG;
+    packet[1] = 54;
+    packet[2] = checksum & 0xFF;
+    packet[3] = (checksum >> 8) & 0xFF;
+    memcpy(packet + 4, payload, 54);
+
+    Protocol::ParsedRequest req;
+    TEST_ASSERT_EQUAL(Protocol::PARSE_OK, Protocol::parseRequest(packet, 58, req));
+    TEST_ASSERT_TRUE(req.setConfig.hasPerSide);
+    TEST_ASSERT_TRUE(req.setConfig.hasControlRate);
+    TEST_ASSERT_EQUAL_UINT16(1000, req.setConfig.controlRateHz);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 2.0f, req.setConfig.pidKp);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 2.5f, req.setConfig.pidKpR);
+    TEST_ASSERT_EQUAL_UINT16(1024, req.setConfig.encoderPprR);
+}
+
+// ============================================================================
+// RESET_ODOMETRYリクエストパーステスト
+// ============================================================================
+
+void test_parse_reset_odometry_without_pose(void) {
+    uint8_t packet[] = {
+        Protocol::REQUEST_RESET_ODOMETRY,
+        0x00,  // payload_length = 0
+        0x00, 0x00
+    };
+
+    Protocol::ParsedRequest req;
+    Protocol::ParseResult result = Protocol::parseRequest(packet, 4, req);
+
+    TEST_ASSERT_EQUAL(Protocol::PARSE_OK, result);
+    TEST_ASSERT_EQUAL_UINT8(Protocol::REQUEST_RESET_ODOMETRY, req.requestType);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, req.resetOdometry.x);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, req.resetOdometry.y);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, req.resetOdometry.theta);
+}
+
+void test_parse_reset_odometry_with_pose(void) {
+    float x = 1.5f;
+    float y = -2.0f;
+    float theta = 0.75f;
+    uint8_t payload[12];
+    memcpy(payload, &x, 4);
+    memcpy(payload + 4, &y, 4);
+    memcpy(payload + 8, &theta, 4);
+
+    uint16_t checksum = Protocol::calculateChecksum(payload, 12);
+
+    uint8_t packet[16];
+    packet[0] = Protocol::REQUEST_RESET_ODOMETRY;
+    packet[1] = 12;
+    packet[2] = checksum & 0xFF;
+    packet[3] = (checksum >> 8) & 0xFF;
+    memcpy(packet + 4, payload, 12);
+
+    Protocol::ParsedRequest req;
+    Protocol::ParseResult result = Protocol::parseRequest(packet, 16, req);
+
+    TEST_ASSERT_EQUAL(Protocol::PARSE_OK, result);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.5f, req.resetOdometry.x);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -2.0f, req.resetOdometry.y);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.75f, req.resetOdometry.theta);
+}
+
+// ============================================================================
+// MOTOR_POSITIONリクエストパーステスト
+// ============================================================================
+
+void test_parse_motor_position_without_limits(void) {
+    int32_t deltaL = 2048;
+    int32_t deltaR = -2048;
+    uint8_t payload[8];
+    memcpy(payload, &deltaL, 4);
+    memcpy(payload + 4, &deltaR, 4);
+
+    uint16_t checksum = Protocol::calculateChecksum(payload, 8);
+
+    uint8_t packet[12];
+    packet[0] = Protocol::REQUEST_MOTOR_POSITION;
+    packet[1] = 8;
+    packet[2] = checksum & 0xFF;
+    packet[3] = (checksum >> 8) & 0xFF;
+    memcpy(packet + 4, payload, 8);
+
+    Protocol::ParsedRequest req;
+    Protocol::ParseResult result = Protocol::parseRequest(packet, 12, req);
+
+    TEST_ASSERT_EQUAL(Protocol::PARSE_OK, result);
+    TEST_ASSERT_EQUAL_UINT8(Protocol::REQUEST_MOTOR_POSITION, req.requestType);
+    TEST_ASSERT_EQUAL_INT32(2048, req.motorPosition.deltaL);
+    TEST_ASSERT_EQUAL_INT32(-2048, req.motorPosition.deltaR);
+    // 省略時はデフォルト（0）
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, req.motorPosition.maxRpm);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, req.motorPosition.maxAccel);
+}
+
+void test_parse_motor_position_with_limits(void) {
+    int32_t deltaL = 1000;
+    int32_t deltaR = 500;
+    float maxRpm = 30.0f;
+    float maxAccel = 100.0f;
+    uint8_t payload[16];
+    memcpy(payload, &deltaL, 4);
+    memcpy(payload + 4, &deltaR, 4);
+    memcpy(payload + 8, &maxRpm, 4);
+    memcpy(payload + 12, &maxAccel, 4);
+
+    uint16_t checksum = Protocol::calculateChecksum(payload, 16);
+
+    uint8_t packet[20];
+    packet[0] = Protocol::REQUEST_MOTOR_POSITION;
+    packet[1] = 16;
+    packet[2] = checksum & 0xFF;
+    packet[3] = (checksum >> 8) & 0xFF;
+    memcpy(packet + 4, payload, 16);
+
+    Protocol::ParsedRequest req;
+    Protocol::ParseResult result = Protocol::parseRequest(packet, 20, req);
+
+    TEST_ASSERT_EQUAL(Protocol::PARSE_OK, result);
+    TEST_ASSERT_EQUAL_INT32(1000, req.motorPosition.deltaL);
+    TEST_ASSERT_EQUAL_INT32(500, req.motorPosition.deltaR);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 30.0f, req.motorPosition.maxRpm);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 100.0f, req.motorPosition.maxAccel);
+}
+
+// ============================================================================
+// 軌道リクエストパーステスト
+// ============================================================================
+
+void test_parse_trajectory_upload(void) {
+    uint8_t payload[2 + 2 * 12];
+    memset(payload, 0, sizeof(payload));
+    payload[0] = 16;  // start_index
+    payload[1] = 2;   // count
+    uint16_t duration0 = 500;
+    float linear0 = 0.2f;
+    float angular0 = 0.0f;
+    memcpy(payload + 2, &duration0, 2);
+    payload[4] = 0;  // STEP
+    memcpy(payload + 6, &linear0, 4);
+    memcpy(payload + 10, &angular0, 4);
+    uint16_t duration1 = 1200;
+    float linear1 = 0.0f;
+    float angular1 = -0.5f;
+    memcpy(payload + 14, &duration1, 2);
+    payload[16] = 1;  // RAMP
+    memcpy(payload + 18, &linear1, 4);
+    memcpy(payload + 22, &angular1, 4);
+
+    uint16_t checksum = Protocol::calculateChecksum(payload, sizeof(payload));
+
+    uint8_t packet[4 + sizeof(payload)];
+    packet[0] = Protocol::REQUEST_TRAJECTORY_UPLOAD;
+    packet[1] = sizeof(payload);
+    packet[2] = checksum & 0xFF;
+    packet[3] = (checksum >> 8) & 0xFF;
+    memcpy(packet + 4, payload, sizeof(payload));
+
+    Protocol::ParsedRequest req;
+    Protocol::ParseResult result = Protocol::parseRequest(packet, sizeof(packet), req);
+
+    TEST_ASSERT_EQUAL(Protocol::PARSE_OK, result);
+    TEST_ASSERT_EQUAL_UINT8(16, req.trajectoryUpload.startIndex);
+    TEST_ASSERT_EQUAL_UINT8(2, req.trajectoryUpload.count);
+    TEST_ASSERT_EQUAL_UINT16(500, req.trajectoryUpload.segments[0].durationMs);
+    TEST_ASSERT_EQUAL_UINT8(0, req.trajectoryUpload.segments[0].mode);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.2f, req.trajectoryUpload.segments[0].linearX);
+    TEST_ASSERT_EQUAL_UINT16(1200, req.trajectoryUpload.segments[1].durationMs);
+    TEST_ASSERT_EQUAL_UINT8(1, req.trajectoryUpload.segments[1].mode);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -0.5f, req.trajectoryUpload.segments[1].angularZ);
+}
+
+void test_parse_trajectory_upload_size_mismatch(void) {
+    // count=2だがセグメント1つ分のペイロード
+    uint8_t payload[2 + 12];
+    memset(payload, 0, sizeof(payload));
+    payload[1] = 2;
+
+    uint16_t checksum = Protocol::calculateChecksum(payload, sizeof(payload));
+
+    uint8_t packet[4 + sizeof(payload)];
+    packet[0] = Protocol::REQUEST_TRAJECTORY_UPLOAD;
+    packet[1] = sizeof(payload);
+    packet[2] = checksum & 0xFF;
+    packet[3] = (checksum >> 8) & 0xFF;
+    memcpy(packet + 4, payload, sizeof(payload));
+
+    Protocol::ParsedRequest req;
+    TEST_ASSERT_EQUAL(Protocol::PARSE_ERROR_SIZE,
+                      Protocol::parseRequest(packet, sizeof(packet), req));
+}
+
+void test_parse_trajectory_start(void) {
+    // ペイロード省略時は即時開始
+    uint8_t immediate[] = {Protocol::REQUEST_TRAJECTORY_START, 0x00, 0x00, 0x00};
+    Protocol::ParsedRequest req;
+    TEST_ASSERT_EQUAL(Protocol::PARSE_OK, Protocol::parseRequest(immediate, 4, req));
+    TEST_ASSERT_FALSE(req.trajectoryStart.queued);
+
+    uint8_t queued[] = {Protocol::REQUEST_TRAJECTORY_START, 0x01, 0x01, 0x00, 0x01};
+    TEST_ASSERT_EQUAL(Protocol::PARSE_OK, Protocol::parseRequest(queued, 5, req));
+    TEST_ASSERT_TRUE(req.trajectoryStart.queued);
+}
+
+void test_parse_get_timing(void) {
+    // ペイロード省略時はリセットなし
+    uint8_t readOnly[] = {Protocol::REQUEST_GET_TIMING, 0x00, 0x00, 0x00};
+    Protocol::ParsedRequest req;
+    TEST_ASSERT_EQUAL(Protocol::PARSE_OK, Protocol::parseRequest(readOnly, 4, req));
+    TEST_ASSERT_FALSE(req.getTiming.reset);
+
+    uint8_t reset[] = {Protocol::REQUEST_GET_TIMING, 0x01, 0x01, 0x00, 0x01};
+    TEST_ASSERT_EQUAL(Protocol::PARSE_OK, Protocol::parseRequest(reset, 5, req));
+    TEST_ASSERT_TRUE(req.getTiming.reset);
 }
 
 // ============================================================================
@@ -269,36 +626,47 @@ void test_create_status_response(void) {
     Protocol::StatusResponse data;
     data.status = 0x8001;  // CONFIG_MODE | FAILSAFE
     data.errorCode = 0x01;
+    data.resetReason = 1;  // Core1の停止によるウォッチドッグ
     data.commErrorCount = 5;
+    data.watchdogResetCount = 2;
     data.uptimeMs = 123456;
+    data.firstTickUs = 41000;
 
     uint8_t buffer[32];
+    TEST_ASSERT_EQUAL_UINT8(0, Protocol::createStatusResponse(data, buffer, 16));
     uint8_t length = Protocol::createStatusResponse(data, buffer, sizeof(buffer));
 
-    TEST_ASSERT_EQUAL_UINT8(16, length);  // ヘッダ4 + ペイロード12
+    TEST_ASSERT_EQUAL_UINT8(20, length);  // ヘッダ4 + ペイロード16
     TEST_ASSERT_EQUAL_UINT8(Protocol::REQUEST_GET_STATUS, buffer[0]);
-    TEST_ASSERT_EQUAL_UINT8(12, buffer[1]);
+    TEST_ASSERT_EQUAL_UINT8(16, buffer[1]);
 
     // 全フィールド検証
     uint16_t status;
     uint8_t errorCode;
+    uint8_t resetReason;
     uint16_t commErrorCount;
+    uint16_t watchdogResetCount;
     uint32_t uptimeMs;
+    uint32_t firstTickUs;
     memcpy(&status, buffer + 4, 2);
     errorCode = buffer[6];
-    // buffer[7] は reserved
+    resetReason = buffer[7];
     memcpy(&commErrorCount, buffer + 8, 2);
-    // buffer[10-11] は reserved
+    memcpy(&watchdogResetCount, buffer + 10, 2);
     memcpy(&uptimeMs, buffer + 12, 4);
+    memcpy(&firstTickUs, buffer + 16, 4);
 
     TEST_ASSERT_EQUAL_UINT16(0x8001, status);
     TEST_ASSERT_EQUAL_UINT8(0x01, errorCode);
+    TEST_ASSERT_EQUAL_UINT8(1, resetReason);
     TEST_ASSERT_EQUAL_UINT16(5, commErrorCount);
+    TEST_ASSERT_EQUAL_UINT16(2, watchdogResetCount);
     TEST_ASSERT_EQUAL_UINT32(123456, uptimeMs);
+    TEST_ASSERT_EQUAL_UINT32(41000, firstTickUs);
 
     // チェックサム検証
     uint16_t receivedChecksum = buffer[2] | (buffer[3] << 8);
-    uint16_t calculatedChecksum = Protocol::calculateChecksum(buffer + 4, 12);
+    uint16_t calculatedChecksum = Protocol::calculateChecksum(buffer + 4, 16);
     TEST_ASSERT_EQUAL_UINT16(calculatedChecksum, receivedChecksum);
 }
 
@@ -312,13 +680,20 @@ void test_create_config_response(void) {
     data.gearRatio = 1.5f;
     data.wheelDiameter = 0.1f;
     data.trackWidth = 0.3f;
+    data.pidKpR = 1.2f;
+    data.pidKiR = 0.12f;
+    data.pidKdR = 0.012f;
+    data.encoderPprR = 2048;
+    data.gearRatioR = 1.6f;
+    data.wheelDiameterR = 0.102f;
+    data.controlRateHz = 500;
 
     uint8_t buffer[64];
     uint8_t length = Protocol::createConfigResponse(data, buffer, sizeof(buffer));
 
-    TEST_ASSERT_EQUAL_UINT8(34, length);  // ヘッダ4 + ペイロード30
+    TEST_ASSERT_EQUAL_UINT8(58, length);  // ヘッダ4 + ペイロード54（先頭52バイトは従来と同じ配置）
     TEST_ASSERT_EQUAL_UINT8(Protocol::REQUEST_GET_CONFIG, buffer[0]);
-    TEST_ASSERT_EQUAL_UINT8(30, buffer[1]);
+    TEST_ASSERT_EQUAL_UINT8(54, buffer[1]);
 
     // 全フィールド検証
     float pidKp, pidKi, pidKd, maxRpm, gearRatio, wheelDiameter, trackWidth;
@@ -341,9 +716,30 @@ void test_create_config_response(void) {
     TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.1f, wheelDiameter);
     TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.3f, trackWidth);
 
+    // 右側
+    float pidKpR, pidKiR, pidKdR, gearRatioR, wheelDiameterR;
+    uint16_t encoderPprR;
+    memcpy(&pidKpR, buffer + 34, 4);
+    memcpy(&pidKiR, buffer + 38, 4);
+    memcpy(&pidKdR, buffer + 42, 4);
+    memcpy(&encoderPprR, buffer + 46, 2);
+    memcpy(&gearRatioR, buffer + 48, 4);
+    memcpy(&wheelDiameterR, buffer + 52, 4);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.2f, pidKpR);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.12f, pidKiR);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.012f, pidKdR);
+    TEST_ASSERT_EQUAL_UINT16(2048, encoderPprR);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.6f, gearRatioR);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.102f, wheelDiameterR);
+
+    // 制御周波数
+    uint16_t controlRateHz;
+    memcpy(&controlRateHz, buffer + 56, 2);
+    TEST_ASSERT_EQUAL_UINT16(500, controlRateHz);
+
     // チェックサム検証
     uint16_t receivedChecksum = buffer[2] | (buffer[3] << 8);
-    uint16_t calculatedChecksum = Protocol::calculateChecksum(buffer + 4, 30);
+    uint16_t calculatedChecksum = Protocol::calculateChecksum(buffer + 4, 54);
     TEST_ASSERT_EQUAL_UINT16(calculatedChecksum, receivedChecksum);
 }
 
@@ -357,17 +753,22 @@ void test_create_debug_output_response(void) {
     data.currentRpmR = 58.2f;
     data.pwmDutyL = 0.5f;
     data.pwmDutyR = 0.6f;
+    data.currentRmsL = 1.25f;
+    data.currentRmsR = 2.5f;
+    data.currentPeakL = 3.75f;
+    data.currentPeakR = 5.0f;
 
     uint8_t buffer[64];
     uint8_t length = Protocol::createDebugOutputResponse(data, buffer, sizeof(buffer));
 
-    TEST_ASSERT_EQUAL_UINT8(36, length);  // ヘッダ4 + ペイロード32
+    TEST_ASSERT_EQUAL_UINT8(52, length);  // ヘッダ4 + ペイロード48
     TEST_ASSERT_EQUAL_UINT8(Protocol::REQUEST_GET_DEBUG_OUTPUT, buffer[0]);
-    TEST_ASSERT_EQUAL_UINT8(32, buffer[1]);
+    TEST_ASSERT_EQUAL_UINT8(48, buffer[1]);
 
     // 全フィールド検証
     int32_t encL, encR;
     float targetL, targetR, currentL, currentR, pwmL, pwmR;
+    float rmsL, rmsR, peakL, peakR;
     memcpy(&encL, buffer + 4, 4);
     memcpy(&encR, buffer + 8, 4);
     memcpy(&targetL, buffer + 12, 4);
@@ -376,6 +777,10 @@ void test_create_debug_output_response(void) {
     memcpy(&currentR, buffer + 24, 4);
     memcpy(&pwmL, buffer + 28, 4);
     memcpy(&pwmR, buffer + 32, 4);
+    memcpy(&rmsL, buffer + 36, 4);
+    memcpy(&rmsR, buffer + 40, 4);
+    memcpy(&peakL, buffer + 44, 4);
+    memcpy(&peakR, buffer + 48, 4);
 
     TEST_ASSERT_EQUAL_INT32(100, encL);
     TEST_ASSERT_EQUAL_INT32(200, encR);
@@ -385,13 +790,219 @@ void test_create_debug_output_response(void) {
     TEST_ASSERT_FLOAT_WITHIN(0.001f, 58.2f, currentR);
     TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.5f, pwmL);
     TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.6f, pwmR);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.25f, rmsL);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 2.5f, rmsR);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 3.75f, peakL);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 5.0f, peakR);
 
     // チェックサム検証
     uint16_t receivedChecksum = buffer[2] | (buffer[3] << 8);
-    uint16_t calculatedChecksum = Protocol::calculateChecksum(buffer + 4, 32);
+    uint16_t calculatedChecksum = Protocol::calculateChecksum(buffer + 4, 48);
     TEST_ASSERT_EQUAL_UINT16(calculatedChecksum, receivedChecksum);
 }
 
+void test_create_odometry_response(void) {
+    Protocol::OdometryResponse data;
+    data.x = 1.25f;
+    data.y = -0.5f;
+    data.theta = 3.0f;
+    data.linearX = 0.2f;
+    data.angularZ = -0.1f;
+    data.timestampUs = 123456789;
+
+    uint8_t buffer[32];
+    uint8_t length = Protocol::createOdometryResponse(data, buffer, sizeof(buffer));
+
+    TEST_ASSERT_EQUAL_UINT8(28, length);  // ヘッダ4 + ペイロード24
+    TEST_ASSERT_EQUAL_UINT8(Protocol::REQUEST_GET_ODOMETRY, buffer[0]);
+    TEST_ASSERT_EQUAL_UINT8(24, buffer[1]);
+
+    float x, y, theta, linearX, angularZ;
+    uint32_t timestampUs;
+    memcpy(&x, buffer + 4, 4);
+    memcpy(&y, buffer + 8, 4);
+    memcpy(&theta, buffer + 12, 4);
+    memcpy(&linearX, buffer + 16, 4);
+    memcpy(&angularZ, buffer + 20, 4);
+    memcpy(&timestampUs, buffer + 24, 4);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.25f, x);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -0.5f, y);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 3.0f, theta);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.2f, linearX);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -0.1f, angularZ);
+    TEST_ASSERT_EQUAL_UINT32(123456789, timestampUs);
+
+    // チェックサム検証
+    uint16_t receivedChecksum = buffer[2] | (buffer[3] << 8);
+    uint16_t calculatedChecksum = Protocol::calculateChecksum(buffer + 4, 24);
+    TEST_ASSERT_EQUAL_UINT16(calculatedChecksum, receivedChecksum);
+
+    // バッファ不足
+    TEST_ASSERT_EQUAL_UINT8(0, Protocol::createOdometryResponse(data, buffer, 27));
+}
+
+void test_create_reset_odometry_response(void) {
+    uint8_t buffer[16];
+    uint8_t length = Protocol::createResetOdometryResponse(0x00, buffer, sizeof(buffer));
+
+    TEST_ASSERT_EQUAL_UINT8(5, length);  // ヘッダ4 + ペイロード1
+    TEST_ASSERT_EQUAL_UINT8(Protocol::REQUEST_RESET_ODOMETRY, buffer[0]);
+    TEST_ASSERT_EQUAL_UINT8(1, buffer[1]);
+    TEST_ASSERT_EQUAL_UINT8(0x00, buffer[4]);
+}
+
+void test_create_motor_position_response(void) {
+    uint8_t buffer[16];
+    uint8_t length = Protocol::createMotorPositionResponse(
+        Protocol::POSITION_RESULT_INVALID_VALUE, buffer, sizeof(buffer));
+
+    TEST_ASSERT_EQUAL_UINT8(5, length);  // ヘッダ4 + ペイロード1
+    TEST_ASSERT_EQUAL_UINT8(Protocol::REQUEST_MOTOR_POSITION, buffer[0]);
+    TEST_ASSERT_EQUAL_UINT8(1, buffer[1]);
+    TEST_ASSERT_EQUAL_UINT8(0x01, buffer[4]);  // INVALID_VALUE
+}
+
+void test_create_trajectory_upload_response(void) {
+    uint8_t buffer[16];
+    uint8_t length = Protocol::createTrajectoryUploadResponse(
+        Protocol::TRAJECTORY_RESULT_BUSY, 12, buffer, sizeof(buffer));
+
+    TEST_ASSERT_EQUAL_UINT8(6, length);  // ヘッダ4 + ペイロード2
+    TEST_ASSERT_EQUAL_UINT8(Protocol::REQUEST_TRAJECTORY_UPLOAD, buffer[0]);
+    TEST_ASSERT_EQUAL_UINT8(2, buffer[1]);
+    TEST_ASSERT_EQUAL_UINT8(0x02, buffer[4]);  // BUSY
+    TEST_ASSERT_EQUAL_UINT8(12, buffer[5]);
+}
+
+void test_create_trajectory_status_response(void) {
+    Protocol::TrajectoryStatusResponse data;
+    data.state = 1;
+    data.segmentIndex = 3;
+    data.loadedCount = 20;
+    data.queued = 1;
+    data.elapsedMs = 1500;
+    data.durationMs = 4000;
+
+    uint8_t buffer[32];
+    uint8_t length = Protocol::createTrajectoryStatusResponse(data, buffer, sizeof(buffer));
+
+    TEST_ASSERT_EQUAL_UINT8(16, length);  // ヘッダ4 + ペイロード12
+    TEST_ASSERT_EQUAL_UINT8(Protocol::REQUEST_GET_TRAJECTORY_STATUS, buffer[0]);
+    TEST_ASSERT_EQUAL_UINT8(1, buffer[4]);
+    TEST_ASSERT_EQUAL_UINT8(3, buffer[5]);
+    TEST_ASSERT_EQUAL_UINT8(20, buffer[6]);
+    TEST_ASSERT_EQUAL_UINT8(1, buffer[7]);
+    uint32_t elapsedMs;
+    uint32_t durationMs;
+    memcpy(&elapsedMs, buffer + 8, 4);
+    memcpy(&durationMs, buffer + 12, 4);
+    TEST_ASSERT_EQUAL_UINT32(1500, elapsedMs);
+    TEST_ASSERT_EQUAL_UINT32(4000, durationMs);
+
+    // 結果コードのみのレスポンス
+    length = Protocol::createTrajectoryAbortResponse(Protocol::TRAJECTORY_RESULT_ACCEPTED, buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL_UINT8(5, length);
+    TEST_ASSERT_EQUAL_UINT8(Protocol::REQUEST_TRAJECTORY_ABORT, buffer[0]);
+}
+
+void test_create_timing_response(void) {
+    Protocol::TimingResponse data;
+    memset(&data, 0, sizeof(data));
+    data.nominalPeriodUs = 10000;
+    data.overrunCount = 2;
+    data.missedTicks = 1;
+    data.period.count = 100;
+    data.period.minUs = 9950;
+    data.period.maxUs = 10080;
+    data.period.meanUs = 10000;
+    data.period.bucketOriginUs = 9600;
+    data.period.bucketWidthUs = 50;
+    data.period.buckets[8] = 100;
+    data.execution.count = 100;
+    data.execution.maxUs = 12000;
+    data.execution.buckets[15] = 2;
+    data.xipAccessCount = 50000;
+    data.xipHitCount = 49900;
+    data.commandLatencyCount = 40;
+    data.commandLatencyMinUs = 1050;
+    data.commandLatencyMaxUs = 1900;
+    data.commandLatencyMeanUs = 1300;
+    data.outOfCycleCount = 38;
+
+    uint8_t buffer[220];
+    TEST_ASSERT_EQUAL_UINT8(0, Protocol::createTimingResponse(data, buffer, 100));
+    uint8_t length = Protocol::createTimingResponse(data, buffer, sizeof(buffer));
+
+    TEST_ASSERT_EQUAL_UINT8(220, length);  // ヘッダ4 + ペイロード216
+    TEST_ASSERT_EQUAL_UINT8(Protocol::REQUEST_GET_TIMING, buffer[0]);
+    TEST_ASSERT_EQUAL_UINT8(216, buffer[1]);
+    uint16_t checksum = buffer[2] | (buffer[3] << 8);
+    TEST_ASSERT_EQUAL_UINT16(Protocol::calculateChecksum(buffer + 4, 216), checksum);
+
+    uint32_t value;
+    memcpy(&value, buffer + 4, 4);
+    TEST_ASSERT_EQUAL_UINT32(10000, value);
+    memcpy(&value, buffer + 8, 4);
+    TEST_ASSERT_EQUAL_UINT32(2, value);
+    memcpy(&value, buffer + 12, 4);
+    TEST_ASSERT_EQUAL_UINT32(1, value);
+
+    // 周期の集計（オフセット16〜）
+    memcpy(&value, buffer + 16 + 4, 4);
+    TEST_ASSERT_EQUAL_UINT32(9950, value);
+    memcpy(&value, buffer + 16 + 20, 4);
+    TEST_ASSERT_EQUAL_UINT32(50, value);
+    memcpy(&value, buffer + 16 + 24 + 8 * 4, 4);
+    TEST_ASSERT_EQUAL_UINT32(100, value);
+
+    // 処理時間の集計（オフセット104〜）
+    memcpy(&value, buffer + 104 + 8, 4);
+    TEST_ASSERT_EQUAL_UINT32(12000, value);
+    memcpy(&value, buffer + 104 + 24 + 15 * 4, 4);
+    TEST_ASSERT_EQUAL_UINT32(2, value);
+
+    // XIPキャッシュのアクセス・ヒット回数（オフセット192〜）
+    memcpy(&value, buffer + 192, 4);
+    TEST_ASSERT_EQUAL_UINT32(50000, value);
+    memcpy(&value, buffer + 196, 4);
+    TEST_ASSERT_EQUAL_UINT32(49900, value);
+
+    // 指令の遅延と周期外の適用回数（オフセット200〜）
+    memcpy(&value, buffer + 200, 4);
+    TEST_ASSERT_EQUAL_UINT32(40, value);
+    memcpy(&value, buffer + 204, 4);
+    TEST_ASSERT_EQUAL_UINT32(1050, value);
+    memcpy(&value, buffer + 208, 4);
+    TEST_ASSERT_EQUAL_UINT32(1900, value);
+    memcpy(&value, buffer + 212, 4);
+    TEST_ASSERT_EQUAL_UINT32(1300, value);
+    memcpy(&value, buffer + 216, 4);
+    TEST_ASSERT_EQUAL_UINT32(38, value);
+}
+
+void test_create_odometry_result_response(void) {
+    uint8_t buffer[16];
+    uint8_t length = Protocol::createOdometryResultResponse(Protocol::ODOMETRY_RESULT_BUSY, buffer, sizeof(buffer));
+
+    // 姿勢を読み出せなかった場合は結果コードのみ（ペイロード長で通常の応答と区別）
+    TEST_ASSERT_EQUAL_UINT8(5, length);
+    TEST_ASSERT_EQUAL_UINT8(Protocol::REQUEST_GET_ODOMETRY, buffer[0]);
+    TEST_ASSERT_EQUAL_UINT8(1, buffer[1]);
+    TEST_ASSERT_EQUAL_UINT8(Protocol::ODOMETRY_RESULT_BUSY, buffer[4]);
+}
+
+void test_create_timing_result_response(void) {
+    uint8_t buffer[16];
+    uint8_t length = Protocol::createTimingResultResponse(Protocol::TIMING_RESULT_BUSY, buffer, sizeof(buffer));
+
+    // 集計を読み出せなかった場合は結果コードのみ（ペイロード長で通常の応答と区別）
+    TEST_ASSERT_EQUAL_UINT8(5, length);
+    TEST_ASSERT_EQUAL_UINT8(Protocol::REQUEST_GET_TIMING, buffer[0]);
+    TEST_ASSERT_EQUAL_UINT8(1, buffer[1]);
+    TEST_ASSERT_EQUAL_UINT8(Protocol::TIMING_RESULT_BUSY, buffer[4]);
+}
+
 void test_create_set_config_response_success(void) {
     uint8_t buffer[16];
     uint8_t length = Protocol::createSetConfigResponse(Protocol::CONFIG_RESULT_SUCCESS, buffer, sizeof(buffer));
@@ -432,12 +1043,24 @@ int main(void) {
 
     // リクエストパース
     RUN_TEST(test_parse_motor_command_request);
+    RUN_TEST(test_parse_motor_command_with_timestamp);
+    RUN_TEST(test_parse_motor_command_with_validity);
     RUN_TEST(test_parse_get_version_request);
     RUN_TEST(test_parse_invalid_checksum);
     RUN_TEST(test_parse_packet_too_short);
     RUN_TEST(test_parse_payload_length_mismatch);
     RUN_TEST(test_parse_invalid_request_type);
     RUN_TEST(test_parse_set_config_request);
+    RUN_TEST(test_parse_set_config_request_per_side);
+    RUN_TEST(test_parse_set_config_request_with_rate);
+    RUN_TEST(test_parse_reset_odometry_without_pose);
+    RUN_TEST(test_parse_reset_odometry_with_pose);
+    RUN_TEST(test_parse_motor_position_without_limits);
+    RUN_TEST(test_parse_motor_position_with_limits);
+    RUN_TEST(test_parse_trajectory_upload);
+    RUN_TEST(test_parse_trajectory_upload_size_mismatch);
+    RUN_TEST(test_parse_trajectory_start);
+    RUN_TEST(test_parse_get_timing);
 
     // レスポンス作成
     RUN_TEST(test_create_motor_command_response);
@@ -445,6 +1068,14 @@ int main(void) {
     RUN_TEST(test_create_status_response);
     RUN_TEST(test_create_config_response);
     RUN_TEST(test_create_debug_output_response);
+    RUN_TEST(test_create_odometry_response);
+    RUN_TEST(test_create_reset_odometry_response);
+    RUN_TEST(test_create_motor_position_response);
+    RUN_TEST(test_create_trajectory_upload_response);
+    RUN_TEST(test_create_trajectory_status_response);
+    RUN_TEST(test_create_timing_response);
+    RUN_TEST(test_create_odometry_result_response);
+    RUN_TEST(test_create_timing_result_response);
     RUN_TEST(test_create_set_config_response_success);
     RUN_TEST(test_create_set_config_response_error);
 
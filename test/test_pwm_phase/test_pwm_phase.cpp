@@ -0,0 +1,126 @@
+/**
+ * @file test_pwm_phase.cpp
+ * @brief PwmPhase ユニットテスト
+ *
+ * - 位相オフセット → カウンタ初期値の変換
+ * - カウンタ位置からのPWM出力判定（エッジアライン/位相補正）
+ * - 左右合成バス電流波形: 180°オフセットでリップルが低減されること
+ */
+
+#include <unity.h>
+#include "PwmPhase.h"
+
+static const uint16_t TOP = 1000;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// =============================================================================
+// カウンタ初期値テスト
+// =============================================================================
+
+void test_offset_phase_correct(void) {
+    TEST_ASSERT_EQUAL_UINT16(0, PwmPhase::counterOffset(TOP, true, 0.0f));
+    TEST_ASSERT_EQUAL_UINT16(500, PwmPhase::counterOffset(TOP, true, 90.0f));
+    TEST_ASSERT_EQUAL_UINT16(1000, PwmPhase::counterOffset(TOP, true, 180.0f));
+}
+
+void test_offset_phase_correct_folds_over_180(void) {
+    // 270°は90°と同じ波形関係（進み/遅れの入れ替え）
+    TEST_ASSERT_EQUAL_UINT16(500, PwmPhase::counterOffset(TOP, true, 270.0f));
+    TEST_ASSERT_EQUAL_UINT16(500, PwmPhase::counterOffset(TOP, true, -90.0f));
+    TEST_ASSERT_EQUAL_UINT16(0, PwmPhase::counterOffset(TOP, true, 360.0f));
+}
+
+void test_offset_edge_aligned(void) {
+    // 周期 TOP+1 = 1001ステップ
+    TEST_ASSERT_EQUAL_UINT16(0, PwmPhase::counterOffset(TOP, false, 0.0f));
+    TEST_ASSERT_EQUAL_UINT16(501, PwmPhase::counterOffset(TOP, false, 180.0f));
+    TEST_ASSERT_EQUAL_UINT16(751, PwmPhase::counterOffset(TOP, false, 270.0f));
+}
+
+// =============================================================================
+// 出力判定テスト
+// =============================================================================
+
+void test_output_edge_aligned(void) {
+    // level=250: カウンタ0〜249でON
+    TEST_ASSERT_TRUE(PwmPhase::isOutputHigh(0, TOP, false, 250));
+    TEST_ASSERT_TRUE(PwmPhase::isOutputHigh(249, TOP, false, 250));
+    TEST_ASSERT_FALSE(PwmPhase::isOutputHigh(250, TOP, false, 250));
+    TEST_ASSERT_TRUE(PwmPhase::isOutputHigh(1001, TOP, false, 250));  // 次周期
+}
+
+void test_output_phase_correct_centered(void) {
+    // 位相補正: 周期2002ステップ、ON期間はカウンタ0（周期の両端）を中心に対称
+    TEST_ASSERT_TRUE(PwmPhase::isOutputHigh(0, TOP, true, 250));
+    TEST_ASSERT_TRUE(PwmPhase::isOutputHigh(2001, TOP, true, 250));   // 下降中 counter=0
+    TEST_ASSERT_FALSE(PwmPhase::isOutputHigh(1000, TOP, true, 250));  // TOP
+    TEST_ASSERT_FALSE(PwmPhase::isOutputHigh(1751, TOP, true, 250));  // counter=250
+    TEST_ASSERT_TRUE(PwmPhase::isOutputHigh(1752, TOP, true, 250));   // counter=249
+}
+
+// =============================================================================
+// バス電流波形テスト
+// =============================================================================
+
+void test_bus_in_phase_doubles_peak(void) {
+    // 同相・50%デューティ・各5A: 0Aと10Aの矩形波
+    PwmPhase::BusCurrent bus = PwmPhase::simulateBusCurrent(TOP, true, 0.5f, 0.5f, 5.0f, 5.0f, 0.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 5.0f, bus.mean);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 10.0f, bus.peak);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 5.0f, bus.ripple);
+}
+
+void test_bus_180_cancels_ripple_at_half_duty(void) {
+    // 180°・50%: 常にどちらか一方がON → ほぼ5A一定
+    // （カウンタ=TOPは半周期より1カウント短いため、周期あたり2カウントだけ重なり/隙間が残る）
+    PwmPhase::BusCurrent bus = PwmPhase::simulateBusCurrent(TOP, true, 0.5f, 0.5f, 5.0f, 5.0f, 180.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 5.0f, bus.mean);
+    TEST_ASSERT_FLOAT_WITHIN(0.2f, 0.0f, bus.ripple);
+}
+
+void test_bus_180_reduces_ripple_at_low_duty(void) {
+    // 30%: 同相はピーク10A、180°はON期間が重ならずピーク5A
+    PwmPhase::BusCurrent inPhase = PwmPhase::simulateBusCurrent(TOP, true, 0.3f, 0.3f, 5.0f, 5.0f, 0.0f);
+    PwmPhase::BusCurrent shifted = PwmPhase::simulateBusCurrent(TOP, true, 0.3f, 0.3f, 5.0f, 5.0f, 180.0f);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, inPhase.mean, shifted.mean);  // 平均は同じ
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 10.0f, inPhase.peak);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 5.0f, shifted.peak);
+    // 同相: sqrt(0.3×0.7)×10 ≒ 4.58、180°: sqrt(0.6×0.4)×5 ≒ 2.45
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 4.58f, inPhase.ripple);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 2.45f, shifted.ripple);
+}
+
+void test_bus_edge_aligned_180(void) {
+    PwmPhase::BusCurrent inPhase = PwmPhase::simulateBusCurrent(TOP, false, 0.5f, 0.5f, 5.0f, 5.0f, 0.0f);
+    PwmPhase::BusCurrent shifted = PwmPhase::simulateBusCurrent(TOP, false, 0.5f, 0.5f, 5.0f, 5.0f, 180.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 5.0f, inPhase.ripple);
+    TEST_ASSERT_FLOAT_WITHIN(0.2f, 0.0f, shifted.ripple);
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // カウンタ初期値テスト
+    RUN_TEST(test_offset_phase_correct);
+    RUN_TEST(test_offset_phase_correct_folds_over_180);
+    RUN_TEST(test_offset_edge_aligned);
+
+    // 出力判定テスト
+    RUN_TEST(test_output_edge_aligned);
+    RUN_TEST(test_output_phase_correct_centered);
+
+    // バス電流波形テスト
+    RUN_TEST(test_bus_in_phase_doubles_peak);
+    RUN_TEST(test_bus_180_cancels_ripple_at_half_duty);
+    RUN_TEST(test_bus_180_reduces_ripple_at_low_duty);
+    RUN_TEST(test_bus_edge_aligned_180);
+
+    return UNITY_END();
+}
@@ -0,0 +1,196 @@
+/**
+ * @file test_rpm_clamp.cpp
+ * @brief RpmClamp ユニットテスト
+ *
+ * 回転優先クランプのスカラー版・一括版と、std::min/std::maxを使った
+ * 従来の実装とのビット単位の一致、曲率保持クランプを確認する
+ */
+
+#include <unity.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "RpmClamp.h"
+
+static const float MAX_RPM = 130.0f;
+
+/**
+ * 従来の実装（MotorController / MotorLogicにあったもの、比較用）
+ */
+static void legacyClamp(float& leftRpm, float& rightRpm, float maxRpm) {
+    float vTrans = (rightRpm + leftRpm) / 2.0f;
+    float vRot = (rightRpm - leftRpm) / 2.0f;
+    float clampedVRot = std::max(-maxRpm, std::min(maxRpm, vRot));
+    float vTransLimit = maxRpm - std::abs(clampedVRot);
+    float clampedVTrans = std::max(-vTransLimit, std::min(vTransLimit, vTrans));
+    leftRpm = clampedVTrans - clampedVRot;
+    rightRpm = clampedVTrans + clampedVRot;
+}
+
+static bool sameBits(float a, float b) {
+    return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+// constexprで評価できること（コンパイル時チェック）
+constexpr RpmClamp::RpmPair COMPILE_TIME = RpmClamp::rotationPriority(RpmClamp::RpmPair{ 200.0f, 200.0f }, 130.0f);
+static_assert(COMPILE_TIME.left == 130.0f && COMPILE_TIME.right == 130.0f, "constexpr clamp");
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+// =============================================================================
+// スカラー版テスト
+// =============================================================================
+
+/**
+ * @test 上限内はそのまま
+ */
+void test_within_limit_unchanged(void) {
+    RpmClamp::RpmPair result = RpmClamp::rotationPriority(RpmClamp::RpmPair{ 50.0f, -30.0f }, MAX_RPM);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 50.0f, result.left);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -30.0f, result.right);
+}
+
+/**
+ * @test 回転成分を保ったまま並進成分を削る
+ */
+void test_preserves_rotation(void) {
+    float left = 100.0f;
+    float right = 160.0f;  // 並進130・回転30
+    RpmClamp::rotationPriority(left, right, MAX_RPM);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 30.0f, (right - left) / 2.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, MAX_RPM, right);
+}
+
+/**
+ * @test 回転成分だけで上限を越える場合は回転のみ
+ */
+void test_rotation_exceeds_limit(void) {
+    RpmClamp::RpmPair result = RpmClamp::rotationPriority(RpmClamp::RpmPair{ -200.0f, 220.0f }, MAX_RPM);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -MAX_RPM, result.left);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, MAX_RPM, result.right);
+}
+
+/**
+ * @test 従来の実装とビット単位で一致（NaN・無限大を含む）
+ */
+void test_bit_identical_to_legacy(void) {
+    const float values[] = {
+        0.0f, -0.0f, 1.0f, -1.0f, 64.9f, 129.99f, 130.0f, 130.01f, -250.0f, 1000.0f,
+        INFINITY, -INFINITY, NAN
+    };
+    const size_t count = sizeof(values) / sizeof(values[0]);
+    for (size_t i = 0; i < count; i++) {
+        for (size_t j = 0; j < count; j++) {
+            float legacyL = values[i];
+            float legacyR = values[j];
+            legacyClamp(legacyL, legacyR, MAX_RPM);
+
+            float left = values[i];
+            float right = values[j];
+            RpmClamp::rotationPriority(left, right, MAX_RPM);
+
+            TEST_ASSERT_TRUE(sameBits(legacyL, left) || (std::isnan(legacyL) && std::isnan(left)));
+            TEST_ASSERT_TRUE(sameBits(legacyR, right) || (std::isnan(legacyR) && std::isnan(right)));
+        }
+    }
+}
+
+/**
+ * @test 曲率保持: 大きい方を上限に合わせ、左右の比率を保つ
+ */
+void test_proportional_keeps_ratio(void) {
+    RpmClamp::RpmPair result = RpmClamp::proportional(RpmClamp::RpmPair{ 100.0f, 260.0f }, MAX_RPM);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 50.0f, result.left);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, MAX_RPM, result.right);
+
+    float left = -300.0f;
+    float right = 150.0f;
+    RpmClamp::proportional(left, right, MAX_RPM);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -MAX_RPM, left);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 65.0f, right);
+}
+
+/**
+ * @test 曲率保持: 上限内・停止・上限0はそのまま（0除算しない）
+ */
+void test_proportional_within_limit_and_zero(void) {
+    RpmClamp::RpmPair result = RpmClamp::proportional(RpmClamp::RpmPair{ 50.0f, -30.0f }, MAX_RPM);
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, result.left);
+    TEST_ASSERT_EQUAL_FLOAT(-30.0f, result.right);
+
+    result = RpmClamp::proportional(RpmClamp::RpmPair{ 0.0f, 0.0f }, 0.0f);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, result.left);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, result.right);
+}
+
+// =============================================================================
+// 一括版テスト
+// =============================================================================
+
+/**
+ * @test 左右別配列の一括版はスカラー版と一致
+ */
+void test_batch_split_arrays(void) {
+    float left[64];
+    float right[64];
+    for (int i = 0; i < 64; i++) {
+        left[i] = static_cast<float>(i * 7 % 400) - 200.0f;
+        right[i] = static_cast<float>(i * 13 % 400) - 200.0f;
+    }
+    float expectedL[64];
+    float expectedR[64];
+    memcpy(expectedL, left, sizeof(left));
+    memcpy(expectedR, right, sizeof(right));
+    for (int i = 0; i < 64; i++) {
+        RpmClamp::rotationPriority(expectedL[i], expectedR[i], MAX_RPM);
+    }
+
+    RpmClamp::rotationPriorityBatch(left, right, 64, MAX_RPM);
+    for (int i = 0; i < 64; i++) {
+        TEST_ASSERT_EQUAL_FLOAT(expectedL[i], left[i]);
+        TEST_ASSERT_EQUAL_FLOAT(expectedR[i], right[i]);
+    }
+}
+
+/**
+ * @test left/rightメンバを持つ構造体の配列にも使える
+ */
+void test_batch_pairs(void) {
+    struct WheelRpm {
+        float left;
+        float right;
+    };
+    WheelRpm pairs[3] = { { 200.0f, 200.0f }, { -10.0f, 10.0f }, { 100.0f, 160.0f } };
+
+    RpmClamp::rotationPriorityBatch(pairs, 3, MAX_RPM);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, MAX_RPM, pairs[0].left);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -10.0f, pairs[1].left);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 70.0f, pairs[2].left);   // 並進130→100、回転30を維持
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, MAX_RPM, pairs[2].right);
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // スカラー版テスト
+    RUN_TEST(test_within_limit_unchanged);
+    RUN_TEST(test_preserves_rotation);
+    RUN_TEST(test_rotation_exceeds_limit);
+    RUN_TEST(test_bit_identical_to_legacy);
+    RUN_TEST(test_proportional_keeps_ratio);
+    RUN_TEST(test_proportional_within_limit_and_zero);
+
+    // 一括版テスト
+    RUN_TEST(test_batch_split_arrays);
+    RUN_TEST(test_batch_pairs);
+
+    return UNITY_END();
+}
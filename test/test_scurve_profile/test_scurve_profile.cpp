@@ -0,0 +1,221 @@
+/**
+ * @file test_scurve_profile.cpp
+ * @brief SCurveProfile ユニットテスト
+ *
+ * 加速度・ジャーク制限付き速度プロファイルのテスト
+ *
+ * テスト条件:
+ * - max_accel = 1.0 /s²
+ * - max_jerk = 5.0 /s³
+ * - dt = 0.01s（制御周期）
+ */
+
+#include <unity.h>
+#include <algorithm>
+#include <cmath>
+#include "SCurveProfile.h"
+
+static const float MAX_ACCEL = 1.0f;
+static const float MAX_JERK = 5.0f;
+static const float DT = 0.01f;
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+// =============================================================================
+// 制限なし・台形加減速テスト
+// =============================================================================
+
+/**
+ * @test 最大加速度0では目標をそのまま出力
+ */
+void test_disabled_passes_through(void) {
+    SCurveProfile profile;
+
+    TEST_ASSERT_FALSE(profile.isEnabled());
+    TEST_ASSERT_EQUAL_FLOAT(0.8f, profile.update(0.8f, DT));
+    TEST_ASSERT_EQUAL_FLOAT(-0.3f, profile.update(-0.3f, DT));
+}
+
+/**
+ * @test ジャーク0では台形加減速（1周期あたり aMax·dt）
+ */
+void test_trapezoid_when_jerk_zero(void) {
+    SCurveProfile profile(MAX_ACCEL, 0.0f);
+
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.01f, profile.update(1.0f, DT));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.02f, profile.update(1.0f, DT));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, MAX_ACCEL, profile.getAcceleration());
+
+    // 1秒で到達
+    for (int i = 0; i < 100; i++) {
+        profile.update(1.0f, DT);
+    }
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, profile.getVelocity());
+}
+
+// =============================================================================
+// S字加減速テスト
+// =============================================================================
+
+/**
+ * @test 立ち上がりはジャーク制限（加速度が jMax·dt ずつ増える）
+ */
+void test_initial_accel_ramps_with_jerk(void) {
+    SCurveProfile profile(MAX_ACCEL, MAX_JERK);
+
+    profile.update(1.0f, DT);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, MAX_JERK * DT, profile.getAcceleration());
+    profile.update(1.0f, DT);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 2.0f * MAX_JERK * DT, profile.getAcceleration());
+}
+
+/**
+ * @test 加速中は加速度・ジャークとも上限以内、目標を越えない
+ */
+void test_limits_respected_during_step(void) {
+    SCurveProfile profile(MAX_ACCEL, MAX_JERK);
+
+    float prevVelocity = 0.0f;
+    float prevAccel = 0.0f;
+    for (int i = 0; i < 300; i++) {
+        float v = profile.update(1.0f, DT);
+        float a = profile.getAcceleration();
+
+        TEST_ASSERT_TRUE(v <= 1.0f);
+        TEST_ASSERT_TRUE(v >= prevVelocity);
+        TEST_ASSERT_TRUE(std::fabs(a) <= MAX_ACCEL + 1e-5f);
+        // 到達時の加速度0へのスナップ以外はジャーク制限内
+        if (v < 1.0f) {
+            TEST_ASSERT_TRUE(std::fabs(a - prevAccel) <= MAX_JERK * DT + 1e-5f);
+        }
+        prevVelocity = v;
+        prevAccel = a;
+    }
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, profile.getVelocity());
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, profile.getAcceleration());
+}
+
+/**
+ * @test 到達時間は理論値 v/aMax + aMax/jMax に近い
+ * 0→1.0: 1.0/1.0 + 1.0/5.0 = 1.2s
+ */
+void test_reach_time_matches_theory(void) {
+    SCurveProfile profile(MAX_ACCEL, MAX_JERK);
+
+    int ticks = 0;
+    while (profile.update(1.0f, DT) < 1.0f && ticks < 1000) {
+        ticks++;
+    }
+    TEST_ASSERT_INT_WITHIN(5, 120, ticks);
+}
+
+/**
+ * @test 小さなステップでは最大加速度に届かない三角形プロファイル
+ * 0→0.1: 2·√(0.1/5.0) ≒ 0.283s
+ */
+void test_small_step_triangular(void) {
+    SCurveProfile profile(MAX_ACCEL, MAX_JERK);
+
+    float peakAccel = 0.0f;
+    int ticks = 0;
+    while (profile.update(0.1f, DT) < 0.1f && ticks < 1000) {
+        peakAccel = std::max(peakAccel, profile.getAcceleration());
+        ticks++;
+    }
+    TEST_ASSERT_TRUE(peakAccel < MAX_ACCEL);
+    TEST_ASSERT_INT_WITHIN(4, 28, ticks);
+}
+
+/**
+ * @test 加速途中の目標反転でも新しい目標を越えない
+ */
+void test_target_reversal(void) {
+    SCurveProfile profile(MAX_ACCEL, MAX_JERK);
+
+    for (int i = 0; i < 50; i++) {
+        profile.update(1.0f, DT);
+    }
+    TEST_ASSERT_TRUE(profile.getVelocity() > 0.0f);
+
+    float minVelocity = profile.getVelocity();
+    for (int i = 0; i < 400; i++) {
+        float v = profile.update(-0.5f, DT);
+        minVelocity = std::min(minVelocity, v);
+    }
+    TEST_ASSERT_TRUE(minVelocity >= -0.5f);
+    TEST_ASSERT_EQUAL_FLOAT(-0.5f, profile.getVelocity());
+}
+
+// =============================================================================
+// リセット・境界値テスト
+// =============================================================================
+
+/**
+ * @test reset()で速度を指定値、加速度を0にする
+ */
+void test_reset(void) {
+    SCurveProfile profile(MAX_ACCEL, MAX_JERK);
+    for (int i = 0; i < 30; i++) {
+        profile.update(1.0f, DT);
+    }
+
+    profile.reset();
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, profile.getVelocity());
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, profile.getAcceleration());
+
+    profile.reset(0.4f);
+    TEST_ASSERT_EQUAL_FLOAT(0.4f, profile.getVelocity());
+}
+
+/**
+ * @test dt=0では状態を変えない
+ */
+void test_zero_dt_holds(void) {
+    SCurveProfile profile(MAX_ACCEL, MAX_JERK);
+    profile.update(1.0f, DT);
+    float v = profile.getVelocity();
+
+    TEST_ASSERT_EQUAL_FLOAT(v, profile.update(1.0f, 0.0f));
+}
+
+/**
+ * @test 目標加速度の計算
+ */
+void test_calculate_desired_accel(void) {
+    // 大きな速度差では最大加速度
+    TEST_ASSERT_EQUAL_FLOAT(MAX_ACCEL, SCurveProfile::calculateDesiredAccel(1.0f, MAX_ACCEL, MAX_JERK));
+    TEST_ASSERT_EQUAL_FLOAT(-MAX_ACCEL, SCurveProfile::calculateDesiredAccel(-1.0f, MAX_ACCEL, MAX_JERK));
+    // 小さな速度差では √(2·jMax·|e|) = √(2·5·0.001) = 0.1
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.1f, SCurveProfile::calculateDesiredAccel(0.001f, MAX_ACCEL, MAX_JERK));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, SCurveProfile::calculateDesiredAccel(0.0f, MAX_ACCEL, MAX_JERK));
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // 制限なし・台形加減速テスト
+    RUN_TEST(test_disabled_passes_through);
+    RUN_TEST(test_trapezoid_when_jerk_zero);
+
+    // S字加減速テスト
+    RUN_TEST(test_initial_accel_ramps_with_jerk);
+    RUN_TEST(test_limits_respected_during_step);
+    RUN_TEST(test_reach_time_matches_theory);
+    RUN_TEST(test_small_step_triangular);
+    RUN_TEST(test_target_reversal);
+
+    // リセット・境界値テスト
+    RUN_TEST(test_reset);
+    RUN_TEST(test_zero_dt_holds);
+    RUN_TEST(test_calculate_desired_accel);
+
+    return UNITY_END();
+}
@@ -84,6 +84,83 @@ void test_motor_state_data_init_current_rpm_r(void) {
     TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, data.currentRpmR);
 }
 
+void test_motor_state_data_init_profiled_velocity(void) {
+    // 初期化後、プロファイル後の速度は0
+    volatile MotorStateData data;
+    data.profiledLinearX = 0.5f;
+    data.profiledAngularZ = -1.0f;
+    initMotorStateData(&data);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, data.profiledLinearX);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, data.profiledAngularZ);
+}
+
+void test_motor_state_data_init_battery_voltage(void) {
+    // 初期化後、batteryVoltageは0
+    volatile MotorStateData data;
+    data.batteryVoltage = 24.0f;
+    initMotorStateData(&data);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, data.batteryVoltage);
+}
+
+void test_cmd_vel_data_init_command_timestamp(void) {
+    // 初期化後、タイムスタンプなし・受信なし
+    volatile CmdVelData data;
+    data.commandHasTimestamp = true;
+    data.commandSeq = 3;
+    data.commandTimestampUs = 100;
+    data.commandValidityMs = 50;
+    initCmdVelData(&data);
+    TEST_ASSERT_FALSE(data.commandHasTimestamp);
+    TEST_ASSERT_EQUAL_UINT32(0, data.commandSeq);
+    TEST_ASSERT_EQUAL_UINT32(0, data.commandTimestampUs);
+    TEST_ASSERT_EQUAL_UINT16(0, data.commandValidityMs);
+}
+
+void test_cmd_vel_data_init_odometry_reset(void) {
+    // 初期化後、オドメトリリセット要求はなし（シーケンス番号0、原点）
+    volatile CmdVelData data;
+    data.odometryResetSeq = 5;
+    data.odometryResetX = 1.0f;
+    initCmdVelData(&data);
+    TEST_ASSERT_EQUAL_UINT32(0, data.odometryResetSeq);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, data.odometryResetX);
+}
+
+void test_cmd_vel_data_init_position_request(void) {
+    // 初期化後、位置制御要求はなし（シーケンス番号0、移動量0）
+    volatile CmdVelData data;
+    data.positionSeq = 2;
+    data.positionDeltaL = 100;
+    data.positionMaxRpm = 30.0f;
+    initCmdVelData(&data);
+    TEST_ASSERT_EQUAL_UINT32(0, data.positionSeq);
+    TEST_ASSERT_EQUAL_INT32(0, data.positionDeltaL);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, data.positionMaxRpm);
+}
+
+void test_shared_data_init_trajectory(void) {
+    // 初期化後、軌道の開始待ちなし（開始要求と処理済みのシーケンス番号が一致）
+    volatile CmdVelData cmd;
+    volatile MotorStateData state;
+    cmd.trajectoryStartSeq = 4;
+    cmd.trajectoryStartQueued = true;
+    state.trajectoryAppliedSeq = 3;
+    state.trajectoryState = 1;
+    initCmdVelData(&cmd);
+    initMotorStateData(&state);
+    TEST_ASSERT_EQUAL_UINT32(cmd.trajectoryStartSeq, state.trajectoryAppliedSeq);
+    TEST_ASSERT_FALSE(cmd.trajectoryStartQueued);
+    TEST_ASSERT_EQUAL_UINT8(0, state.trajectoryState);
+}
+
+void test_motor_state_data_init_status_flags(void) {
+    // 初期化後、statusFlagsは0
+    volatile MotorStateData data;
+    data.statusFlags = 0xFFFF;
+    initMotorStateData(&data);
+    TEST_ASSERT_EQUAL_UINT16(0, data.statusFlags);
+}
+
 // ============================================================================
 // データ読み書きテスト
 // ============================================================================
@@ -122,6 +199,160 @@ void test_motor_state_data_read_write(void) {
     TEST_ASSERT_FLOAT_WITHIN(0.001f, 148.2f, data.currentRpmR);
 }
 
+// ============================================================================
+// TimingData テスト
+// ============================================================================
+
+void test_timing_data_init(void) {
+    // 初期化後、シーケンス番号・集計とも0
+    TimingData data;
+    data.seq = 5;
+    data.overrunCount = 3;
+    data.period.count = 10;
+    data.execution.buckets[15] = 2;
+    initTimingData(&data);
+    TEST_ASSERT_EQUAL_UINT32(0, data.seq);
+    TEST_ASSERT_EQUAL_UINT32(0, data.overrunCount);
+    TEST_ASSERT_EQUAL_UINT32(0, data.period.count);
+    TEST_ASSERT_EQUAL_UINT32(0, data.execution.buckets[15]);
+}
+
+void test_timing_data_write_read(void) {
+    // 書き込んだ内容を読み込める、シーケンス番号は偶数のまま2進む
+    TimingData shared;
+    initTimingData(&shared);
+    TimingData source;
+    initTimingData(&source);
+    source.nominalPeriodUs = 10000;
+    source.overrunCount = 2;
+    source.missedTicks = 1;
+    source.period.count = 100;
+    source.execution.maxUs = 1234;
+    source.execution.buckets[3] = 7;
+    source.xipAccessCount = 5000;
+    source.xipHitCount = 4990;
+    source.commandLatency.maxUs = 1800;
+    source.outOfCycleCount = 12;
+    writeTimingData(&shared, source);
+    TEST_ASSERT_EQUAL_UINT32(2, shared.seq);
+
+    TimingData dest;
+    TEST_ASSERT_TRUE(readTimingData(&shared, &dest, 4));
+    TEST_ASSERT_EQUAL_UINT32(10000, dest.nominalPeriodUs);
+    TEST_ASSERT_EQUAL_UINT32(2, dest.overrunCount);
+    TEST_ASSERT_EQUAL_UINT32(1, dest.missedTicks);
+    TEST_ASSERT_EQUAL_UINT32(100, dest.period.count);
+    TEST_ASSERT_EQUAL_UINT32(1234, dest.execution.maxUs);
+    TEST_ASSERT_EQUAL_UINT32(7, dest.execution.buckets[3]);
+    TEST_ASSERT_EQUAL_UINT32(5000, dest.xipAccessCount);
+    TEST_ASSERT_EQUAL_UINT32(4990, dest.xipHitCount);
+    TEST_ASSERT_EQUAL_UINT32(1800, dest.commandLatency.maxUs);
+    TEST_ASSERT_EQUAL_UINT32(12, dest.outOfCycleCount);
+}
+
+void test_timing_data_read_during_write(void) {
+    // 書き込み中（シーケンス番号が奇数）は読み込み失敗
+    TimingData shared;
+    initTimingData(&shared);
+    shared.seq = 3;
+    TimingData dest;
+    TEST_ASSERT_FALSE(readTimingData(&shared, &dest, 4));
+}
+
+// ============================================================================
+// OdometryData テスト
+// ============================================================================
+
+void test_odometry_data_init(void) {
+    // 初期化後、オドメトリは原点・停止
+    OdometryData data;
+    data.seq = 4;
+    data.x = 1.0f;
+    data.theta = 2.0f;
+    data.linearX = 0.5f;
+    data.timestampUs = 1234;
+    initOdometryData(&data);
+    TEST_ASSERT_EQUAL_UINT32(0, data.seq);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, data.x);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, data.theta);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, data.linearX);
+    TEST_ASSERT_EQUAL_UINT32(0, data.timestampUs);
+}
+
+void test_odometry_data_write_read(void) {
+    // 姿勢・速度・時刻を揃って読み込める
+    OdometryData shared;
+    initOdometryData(&shared);
+    OdometryData source;
+    source.x = 1.25f;
+    source.y = -0.5f;
+    source.theta = 0.75f;
+    source.linearX = 0.3f;
+    source.angularZ = -0.1f;
+    source.timestampUs = 123456;
+    writeOdometryData(&shared, source);
+    TEST_ASSERT_EQUAL_UINT32(2, shared.seq);
+
+    OdometryData dest;
+    TEST_ASSERT_TRUE(readOdometryData(&shared, &dest, 4));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.25f, dest.x);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -0.5f, dest.y);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.75f, dest.theta);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.3f, dest.linearX);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -0.1f, dest.angularZ);
+    TEST_ASSERT_EQUAL_UINT32(123456, dest.timestampUs);
+}
+
+void test_odometry_data_read_during_write(void) {
+    // 書き込み中（シーケンス番号が奇数）は読み込み失敗（GET_ODOMETRYはBUSYを返す）
+    OdometryData shared;
+    initOdometryData(&shared);
+    shared.seq = 7;
+    OdometryData dest;
+    TEST_ASSERT_FALSE(readOdometryData(&shared, &dest, 4));
+}
+
+// ============================================================================
+// ControlConfigData テスト
+// ============================================================================
+
+void test_control_config_data_write_read(void) {
+    // 書き込んだ内容とシーケンス番号を読み込める
+    ControlConfigData shared;
+    initControlConfigData(&shared);
+    ControlConfigData source;
+    initControlConfigData(&source);
+    source.pidKpL = 1.5f;
+    source.pidKiR = 0.25f;
+    source.encoderPprL = 1024;
+    source.encoderPprR = 2048;
+    source.gearRatioR = 30.0f;
+    source.wheelDiameterL = 0.15f;
+    source.trackWidth = 0.38f;
+    writeControlConfigData(&shared, source);
+    TEST_ASSERT_EQUAL_UINT32(2, shared.seq);
+
+    ControlConfigData dest;
+    TEST_ASSERT_TRUE(readControlConfigData(&shared, &dest, 1));
+    TEST_ASSERT_EQUAL_UINT32(2, dest.seq);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.5f, dest.pidKpL);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.25f, dest.pidKiR);
+    TEST_ASSERT_EQUAL_UINT16(1024, dest.encoderPprL);
+    TEST_ASSERT_EQUAL_UINT16(2048, dest.encoderPprR);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 30.0f, dest.gearRatioR);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.15f, dest.wheelDiameterL);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.38f, dest.trackWidth);
+}
+
+void test_control_config_data_read_during_write(void) {
+    // 書き込み中（シーケンス番号が奇数）は読み込み失敗（Core1は次周期に持ち越す）
+    ControlConfigData shared;
+    initControlConfigData(&shared);
+    shared.seq = 1;
+    ControlConfigData dest;
+    TEST_ASSERT_FALSE(readControlConfigData(&shared, &dest, 1));
+}
+
 // ============================================================================
 // メイン
 // ============================================================================
@@ -141,10 +372,31 @@ int main(void) {
     RUN_TEST(test_motor_state_data_init_target_rpm_r);
     RUN_TEST(test_motor_state_data_init_current_rpm_l);
     RUN_TEST(test_motor_state_data_init_current_rpm_r);
+    RUN_TEST(test_motor_state_data_init_profiled_velocity);
+    RUN_TEST(test_motor_state_data_init_battery_voltage);
+    RUN_TEST(test_motor_state_data_init_status_flags);
+    RUN_TEST(test_cmd_vel_data_init_command_timestamp);
+    RUN_TEST(test_cmd_vel_data_init_odometry_reset);
+    RUN_TEST(test_cmd_vel_data_init_position_request);
+    RUN_TEST(test_shared_data_init_trajectory);
 
     // データ読み書きテスト
     RUN_TEST(test_cmd_vel_data_read_write);
     RUN_TEST(test_motor_state_data_read_write);
 
+    // TimingData テスト
+    RUN_TEST(test_timing_data_init);
+    RUN_TEST(test_timing_data_write_read);
+    RUN_TEST(test_timing_data_read_during_write);
+
+    // OdometryData テスト
+    RUN_TEST(test_odometry_data_init);
+    RUN_TEST(test_odometry_data_write_read);
+    RUN_TEST(test_odometry_data_read_during_write);
+
+    // ControlConfigData テスト
+    RUN_TEST(test_control_config_data_write_read);
+    RUN_TEST(test_control_config_data_read_during_write);
+
     return UNITY_END();
 }
@@ -0,0 +1,204 @@
+/**
+ * @file test_stall_detector.cpp
+ * @brief StallDetector ユニットテスト
+ *
+ * - 拘束時に判定時間後に検出し、クールダウン後に解除すること
+ * - 通常の加速・反転・静止摩擦からの起動で誤検出しないこと
+ *   （1次遅れのモータモデルで回転数を計算）
+ */
+
+#include <unity.h>
+#include "StallDetector.h"
+
+static const float DUTY_THRESHOLD = 0.6f;
+static const float RPM_THRESHOLD = 5.0f;
+static const float DETECT_TIME = 0.5f;
+static const float COOLDOWN_TIME = 2.0f;
+static const float DT = 0.01f;
+
+// モータモデル: 無負荷回転数 = duty × NO_LOAD_RPM、機械時定数 TAU
+static const float NO_LOAD_RPM = 250.0f;
+
+/**
+ * 1次遅れモータモデルを1ステップ進める
+ * @param breakaway 静止摩擦（このデューティ以下では停止から動き出さない）
+ */
+static float stepMotor(float rpm, float duty, float tau, float breakaway) {
+    float absDuty = duty < 0.0f ? -duty : duty;
+    if (rpm == 0.0f && absDuty <= breakaway) {
+        return 0.0f;
+    }
+    return rpm + (duty * NO_LOAD_RPM - rpm) * (DT / tau);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// =============================================================================
+// 判定条件テスト
+// =============================================================================
+
+void test_stall_condition(void) {
+    TEST_ASSERT_TRUE(StallDetector::isStallCondition(0.8f, 0.0f, DUTY_THRESHOLD, RPM_THRESHOLD));
+    TEST_ASSERT_TRUE(StallDetector::isStallCondition(-0.8f, 2.0f, DUTY_THRESHOLD, RPM_THRESHOLD));
+    TEST_ASSERT_TRUE(StallDetector::isStallCondition(0.8f, -4.9f, DUTY_THRESHOLD, RPM_THRESHOLD));
+    TEST_ASSERT_FALSE(StallDetector::isStallCondition(0.5f, 0.0f, DUTY_THRESHOLD, RPM_THRESHOLD));
+    TEST_ASSERT_FALSE(StallDetector::isStallCondition(0.8f, 5.0f, DUTY_THRESHOLD, RPM_THRESHOLD));
+    TEST_ASSERT_FALSE(StallDetector::isStallCondition(0.0f, 0.0f, DUTY_THRESHOLD, RPM_THRESHOLD));
+}
+
+// =============================================================================
+// 拘束検出テスト
+// =============================================================================
+
+void test_detects_stall_after_detect_time(void) {
+    StallDetector stall(DUTY_THRESHOLD, RPM_THRESHOLD, DETECT_TIME, COOLDOWN_TIME);
+
+    int events = 0;
+    int detectTick = -1;
+    for (int tick = 0; tick < 100; tick++) {
+        if (stall.update(1.0f, 0.0f, DT)) {
+            events++;
+            detectTick = tick;
+        }
+    }
+
+    TEST_ASSERT_EQUAL(1, events);
+    TEST_ASSERT_INT_WITHIN(1, 49, detectTick);  // 0.5秒
+    TEST_ASSERT_TRUE(stall.isStalled());
+    TEST_ASSERT_EQUAL_UINT32(1, stall.getEventCount());
+}
+
+void test_cooldown_then_redetect(void) {
+    StallDetector stall(DUTY_THRESHOLD, RPM_THRESHOLD, DETECT_TIME, COOLDOWN_TIME);
+
+    // 検出
+    for (int tick = 0; tick < 60; tick++) {
+        stall.update(1.0f, 0.0f, DT);
+    }
+    TEST_ASSERT_TRUE(stall.isStalled());
+
+    // 停止中（デューティ0）にクールダウン
+    for (int tick = 0; tick < 200; tick++) {
+        stall.update(0.0f, 0.0f, DT);
+    }
+    TEST_ASSERT_FALSE(stall.isStalled());
+
+    // まだ拘束されていれば再検出
+    for (int tick = 0; tick < 60; tick++) {
+        stall.update(1.0f, 0.0f, DT);
+    }
+    TEST_ASSERT_TRUE(stall.isStalled());
+    TEST_ASSERT_EQUAL_UINT32(2, stall.getEventCount());
+}
+
+void test_interrupted_condition_restarts_timer(void) {
+    StallDetector stall(DUTY_THRESHOLD, RPM_THRESHOLD, DETECT_TIME, COOLDOWN_TIME);
+
+    // 0.4秒の条件成立 → 1周期だけ回転 → 0.4秒の条件成立
+    for (int tick = 0; tick < 40; tick++) {
+        stall.update(1.0f, 0.0f, DT);
+    }
+    stall.update(1.0f, 20.0f, DT);
+    for (int tick = 0; tick < 40; tick++) {
+        stall.update(1.0f, 0.0f, DT);
+    }
+
+    TEST_ASSERT_FALSE(stall.isStalled());
+    TEST_ASSERT_EQUAL_UINT32(0, stall.getEventCount());
+}
+
+// =============================================================================
+// 誤検出耐性テスト（モータモデル）
+// =============================================================================
+
+void test_no_false_positive_full_duty_step(void) {
+    // 停止から全速ステップ（PID飽和）、軽負荷
+    StallDetector stall(DUTY_THRESHOLD, RPM_THRESHOLD, DETECT_TIME, COOLDOWN_TIME);
+    float rpm = 0.0f;
+    for (int tick = 0; tick < 300; tick++) {
+        stall.update(1.0f, rpm, DT);
+        rpm = stepMotor(rpm, 1.0f, 0.2f, 0.0f);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, stall.getEventCount());
+}
+
+void test_no_false_positive_heavy_load_breakaway(void) {
+    // 重負荷（時定数1秒）・静止摩擦0.5: PID積分でデューティが0.4秒かけて立ち上がる
+    StallDetector stall(DUTY_THRESHOLD, RPM_THRESHOLD, DETECT_TIME, COOLDOWN_TIME);
+    float rpm = 0.0f;
+    for (int tick = 0; tick < 300; tick++) {
+        float duty = tick * DT / 0.4f;
+        if (duty > 1.0f) {
+            duty = 1.0f;
+        }
+        stall.update(duty, rpm, DT);
+        rpm = stepMotor(rpm, duty, 1.0f, 0.5f);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, stall.getEventCount());
+}
+
+void test_no_false_positive_full_reversal(void) {
+    // 全速前進中に全速後進指令: 0RPMを通過する間だけ条件成立
+    StallDetector stall(DUTY_THRESHOLD, RPM_THRESHOLD, DETECT_TIME, COOLDOWN_TIME);
+    float rpm = NO_LOAD_RPM;
+    for (int tick = 0; tick < 300; tick++) {
+        stall.update(-1.0f, rpm, DT);
+        rpm = stepMotor(rpm, -1.0f, 0.3f, 0.0f);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, stall.getEventCount());
+    TEST_ASSERT_TRUE(rpm < -200.0f);
+}
+
+void test_no_false_positive_low_duty_hold(void) {
+    // 坂道保持など、低デューティで停止している状態は拘束ではない
+    StallDetector stall(DUTY_THRESHOLD, RPM_THRESHOLD, DETECT_TIME, COOLDOWN_TIME);
+    for (int tick = 0; tick < 500; tick++) {
+        stall.update(0.3f, 0.0f, DT);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, stall.getEventCount());
+}
+
+void test_jam_during_motion_detected(void) {
+    // 走行中にクローラが噛み込んで急停止
+    StallDetector stall(DUTY_THRESHOLD, RPM_THRESHOLD, DETECT_TIME, COOLDOWN_TIME);
+    float rpm = 0.0f;
+    int detectTick = -1;
+    for (int tick = 0; tick < 300; tick++) {
+        if (tick == 100) {
+            rpm = 0.0f;  // 噛み込み
+        }
+        bool jammed = tick >= 100;
+        if (stall.update(1.0f, rpm, DT)) {
+            detectTick = tick;
+        }
+        rpm = jammed ? 0.0f : stepMotor(rpm, 1.0f, 0.2f, 0.0f);
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, stall.getEventCount());
+    TEST_ASSERT_INT_WITHIN(1, 149, detectTick);
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // 判定条件テスト
+    RUN_TEST(test_stall_condition);
+
+    // 拘束検出テスト
+    RUN_TEST(test_detects_stall_after_detect_time);
+    RUN_TEST(test_cooldown_then_redetect);
+    RUN_TEST(test_interrupted_condition_restarts_timer);
+
+    // 誤検出耐性テスト
+    RUN_TEST(test_no_false_positive_full_duty_step);
+    RUN_TEST(test_no_false_positive_heavy_load_breakaway);
+    RUN_TEST(test_no_false_positive_full_reversal);
+    RUN_TEST(test_no_false_positive_low_duty_hold);
+    RUN_TEST(test_jam_during_motion_detected);
+
+    return UNITY_END();
+}
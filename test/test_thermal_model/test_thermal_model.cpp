@@ -0,0 +1,222 @@
+/**
+ * @file test_thermal_model.cpp
+ * @brief ThermalModel ユニットテスト
+ *
+ * - I²t積分・ディレーティング曲線・過熱判定のヒステリシス
+ * - ストールシナリオ: エンコーダが回らない状態でPID出力が飽和し続けたとき、
+ *   熱推定によって出力が段階的に絞られ、過熱フラグが立つこと
+ */
+
+#include <unity.h>
+#include "ThermalModel.h"
+#include "MotorController.h"
+
+static const float TAU = 60.0f;
+static const float DERATE_START = 0.7f;
+static const float MIN_SCALE = 0.2f;
+static const float CLEAR_LEVEL = 0.6f;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// =============================================================================
+// 積分テスト
+// =============================================================================
+
+void test_integrate_converges_to_load_squared(void) {
+    float heat = 0.0f;
+    // 時定数の10倍で飽和値r²=0.25にほぼ収束
+    for (int i = 0; i < 60000; i++) {
+        heat = ThermalModel::integrate(heat, 0.5f, 0.01f, TAU);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.25f, heat);
+}
+
+void test_integrate_one_time_constant(void) {
+    float heat = 0.0f;
+    // 定格負荷で1τ経過 → 1 - e^-1 ≒ 0.632
+    for (int i = 0; i < 6000; i++) {
+        heat = ThermalModel::integrate(heat, 1.0f, 0.01f, TAU);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, 0.632f, heat);
+}
+
+void test_integrate_negative_load_heats(void) {
+    // 逆転方向の負荷も発熱する
+    float heat = ThermalModel::integrate(0.0f, -1.0f, 1.0f, 10.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.1f, heat);
+}
+
+void test_integrate_invalid_dt(void) {
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.3f, ThermalModel::integrate(0.3f, 1.0f, 0.0f, TAU));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.3f, ThermalModel::integrate(0.3f, 1.0f, -1.0f, TAU));
+}
+
+// =============================================================================
+// ディレーティング曲線テスト
+// =============================================================================
+
+void test_derating_curve(void) {
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, ThermalModel::calculateDerating(0.0f, DERATE_START, MIN_SCALE));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, ThermalModel::calculateDerating(0.7f, DERATE_START, MIN_SCALE));
+    // 0.7〜1.0の中間で1.0〜0.2の中間
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.6f, ThermalModel::calculateDerating(0.85f, DERATE_START, MIN_SCALE));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, MIN_SCALE, ThermalModel::calculateDerating(1.0f, DERATE_START, MIN_SCALE));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, MIN_SCALE, ThermalModel::calculateDerating(1.5f, DERATE_START, MIN_SCALE));
+}
+
+// =============================================================================
+// 過熱判定テスト
+// =============================================================================
+
+void test_overtemp_hysteresis(void) {
+    ThermalModel thermal(1.0f, DERATE_START, MIN_SCALE, CLEAR_LEVEL);
+
+    // ディレーティング開始レベル未満では立たない
+    thermal.update(0.8f, 1.0f);  // θ=0.64
+    TEST_ASSERT_FALSE(thermal.isOverTemp());
+
+    // 開始レベルで過熱判定
+    thermal.update(0.9f, 1.0f);  // θ=0.81
+    TEST_ASSERT_TRUE(thermal.isOverTemp());
+
+    // 開始レベル未満・解除レベル以上では解除されない
+    thermal.update(0.0f, 0.2f);  // θ≒0.65
+    TEST_ASSERT_TRUE(thermal.getHeat() < DERATE_START);
+    TEST_ASSERT_TRUE(thermal.getHeat() > CLEAR_LEVEL);
+    TEST_ASSERT_TRUE(thermal.isOverTemp());
+
+    // 解除レベル未満で解除
+    thermal.update(0.0f, 0.2f);  // θ≒0.52
+    TEST_ASSERT_TRUE(thermal.getHeat() < CLEAR_LEVEL);
+    TEST_ASSERT_FALSE(thermal.isOverTemp());
+}
+
+void test_reset(void) {
+    ThermalModel thermal(1.0f, DERATE_START, MIN_SCALE, CLEAR_LEVEL);
+    thermal.update(2.0f, 1.0f);
+    thermal.reset();
+
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, thermal.getHeat());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, thermal.getDerating());
+    TEST_ASSERT_FALSE(thermal.isOverTemp());
+}
+
+// =============================================================================
+// ストールシナリオ（MotorController + 熱推定の閉ループ）
+// =============================================================================
+
+// デューティを記録するだけのドライバ（拘束状態のためエンコーダは回らない）
+struct StalledDriver {
+    static constexpr bool RPM_COMMAND = false;
+    float speed = 0.0f;
+    void setSpeed(float s) { speed = s; }
+    void stop() { speed = 0.0f; }
+    void brake() { speed = 0.0f; }
+};
+
+void test_stalled_motor_is_derated_and_flagged(void) {
+    const float maxRpm = 200.0f;
+    const float ratedDuty = 0.5f;
+    const float dt = 0.01f;
+
+    QuadratureEncoder encoderL(0, 1, 1024);
+    QuadratureEncoder encoderR(2, 3, 1024);
+    StalledDriver driverL;
+    StalledDriver driverR;
+    PidController pidL(1.0f, 5.0f, 0.0f);
+    PidController pidR(1.0f, 5.0f, 0.0f);
+    pidL.setOutputLimits(-maxRpm, maxRpm);
+    pidR.setOutputLimits(-maxRpm, maxRpm);
+
+    MotorControllerT<StalledDriver> controller(
+        encoderL, encoderR, driverL, driverR, pidL, pidR,
+        0.1f, 0.3f, 1.0f, maxRpm);
+    ThermalModel thermalL(TAU, DERATE_START, MIN_SCALE, CLEAR_LEVEL);
+    ThermalModel thermalR(TAU, DERATE_START, MIN_SCALE, CLEAR_LEVEL);
+
+    bool sawPartialDerating = false;
+    float firstFlagTime = -1.0f;
+
+    // 全速前進指令のまま拘束（5分間）
+    for (int tick = 0; tick < 30000; tick++) {
+        thermalL.update(driverL.speed / ratedDuty, dt);
+        thermalR.update(driverR.speed / ratedDuty, dt);
+        controller.setDerating(thermalL.getDerating(), thermalR.getDerating());
+
+        controller.setCmdVel(1.0f, 0.0f);
+        controller.update(dt);
+
+        // デューティはディレーティング上限を超えない
+        TEST_ASSERT_TRUE(driverL.speed <= controller.getDeratingL() + 1e-6f);
+
+        float derating = thermalL.getDerating();
+        if (derating < 0.99f && derating > MIN_SCALE + 0.01f) {
+            sawPartialDerating = true;
+        }
+        if (firstFlagTime < 0.0f && thermalL.isOverTemp()) {
+            firstFlagTime = tick * dt;
+        }
+    }
+
+    // 定格の2倍のデューティで加熱し、約ln(4/3.3)×τ≒11秒で過熱フラグ
+    TEST_ASSERT_TRUE(firstFlagTime > 5.0f);
+    TEST_ASSERT_TRUE(firstFlagTime < 20.0f);
+    TEST_ASSERT_TRUE(thermalL.isOverTemp());
+    TEST_ASSERT_TRUE(sawPartialDerating);
+
+    // 発熱と出力制限が釣り合い、推定値はしきい値1.0未満に抑えられる
+    TEST_ASSERT_TRUE(thermalL.getHeat() < 1.0f);
+    TEST_ASSERT_TRUE(driverL.speed < ratedDuty);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, controller.getDeratingL(), driverL.speed);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, controller.getDeratingL() * maxRpm, controller.getTargetRpmL());
+}
+
+void test_stalled_motor_recovers_after_cooling(void) {
+    const float dt = 0.01f;
+    ThermalModel thermal(TAU, DERATE_START, MIN_SCALE, CLEAR_LEVEL);
+
+    // 過熱状態まで加熱
+    while (!thermal.isOverTemp()) {
+        thermal.update(2.0f, dt);
+    }
+
+    // 停止して冷却: 解除レベル未満で復帰
+    int ticks = 0;
+    while (thermal.isOverTemp() && ticks < 100000) {
+        thermal.update(0.0f, dt);
+        ticks++;
+    }
+    TEST_ASSERT_FALSE(thermal.isOverTemp());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, thermal.getDerating());
+
+    // 約ln(0.7/0.6)×τ ≒ 9.2秒
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 9.2f, ticks * dt);
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // 積分テスト
+    RUN_TEST(test_integrate_converges_to_load_squared);
+    RUN_TEST(test_integrate_one_time_constant);
+    RUN_TEST(test_integrate_negative_load_heats);
+    RUN_TEST(test_integrate_invalid_dt);
+
+    // ディレーティング曲線テスト
+    RUN_TEST(test_derating_curve);
+
+    // 過熱判定テスト
+    RUN_TEST(test_overtemp_hysteresis);
+    RUN_TEST(test_reset);
+
+    // ストールシナリオ
+    RUN_TEST(test_stalled_motor_is_derated_and_flagged);
+    RUN_TEST(test_stalled_motor_recovers_after_cooling);
+
+    return UNITY_END();
+}
@@ -0,0 +1,173 @@
+/**
+ * @file test_timing_stats.cpp
+ * @brief TimingStats ユニットテスト
+ *
+ * 制御周期の時間計測（最小・最大・平均とヒストグラム）のテスト
+ *
+ * テスト条件:
+ * - 周期: 原点 9600us、ビン幅 50us（10ms ± 400us）
+ * - 処理時間: 原点 0us、ビン幅 625us（0〜10ms）
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include "TimingStats.h"
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+// =============================================================================
+// 集計テスト
+// =============================================================================
+
+/**
+ * @test 記録なしはすべて0
+ */
+void test_empty(void) {
+    TimingStats stats(0, 625);
+    TimingStats::Summary summary;
+    stats.summarize(summary);
+    TEST_ASSERT_EQUAL_UINT32(0, summary.count);
+    TEST_ASSERT_EQUAL_UINT32(0, summary.minUs);
+    TEST_ASSERT_EQUAL_UINT32(0, summary.maxUs);
+    TEST_ASSERT_EQUAL_UINT32(0, summary.meanUs);
+    for (uint8_t i = 0; i < TimingStats::BUCKET_COUNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, summary.buckets[i]);
+    }
+}
+
+/**
+ * @test 最小・最大・平均
+ */
+void test_min_max_mean(void) {
+    TimingStats stats(0, 625);
+    stats.record(1200);
+    stats.record(800);
+    stats.record(2500);
+    stats.record(1500);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.getCount());
+    TEST_ASSERT_EQUAL_UINT32(800, stats.getMinUs());
+    TEST_ASSERT_EQUAL_UINT32(2500, stats.getMaxUs());
+    TEST_ASSERT_EQUAL_UINT32(1500, stats.getMeanUs());
+}
+
+/**
+ * @test 平均は長時間の記録でも桁あふれしない（100Hzで約5日分相当）
+ */
+void test_mean_no_overflow(void) {
+    TimingStats stats(9600, 50);
+    for (uint32_t i = 0; i < 500000; i++) {
+        stats.record(10000);
+    }
+    TEST_ASSERT_EQUAL_UINT32(10000, stats.getMeanUs());
+}
+
+/**
+ * @test リセットで集計をクリア、ビンの設定は維持
+ */
+void test_reset(void) {
+    TimingStats stats(9600, 50);
+    stats.record(10000);
+    stats.record(12000);
+    stats.reset();
+    TEST_ASSERT_EQUAL_UINT32(0, stats.getCount());
+    TEST_ASSERT_EQUAL_UINT32(0, stats.getMaxUs());
+    TEST_ASSERT_EQUAL_UINT32(0, stats.getBucket(8));
+
+    stats.record(10010);
+    TimingStats::Summary summary;
+    stats.summarize(summary);
+    TEST_ASSERT_EQUAL_UINT32(9600, summary.bucketOriginUs);
+    TEST_ASSERT_EQUAL_UINT32(50, summary.bucketWidthUs);
+    TEST_ASSERT_EQUAL_UINT32(1, summary.buckets[8]);
+    TEST_ASSERT_EQUAL_UINT32(10010, summary.minUs);
+}
+
+/**
+ * @test ビンの設定変更で集計をクリア
+ */
+void test_set_buckets(void) {
+    TimingStats stats(9600, 50);
+    stats.record(10000);
+    stats.setBuckets(960, 5);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.getCount());
+
+    stats.record(1000);
+    TimingStats::Summary summary;
+    stats.summarize(summary);
+    TEST_ASSERT_EQUAL_UINT32(960, summary.bucketOriginUs);
+    TEST_ASSERT_EQUAL_UINT32(5, summary.bucketWidthUs);
+    TEST_ASSERT_EQUAL_UINT32(1, summary.buckets[8]);
+}
+
+// =============================================================================
+// ヒストグラムテスト
+// =============================================================================
+
+/**
+ * @test ビン番号（範囲外は両端）
+ */
+void test_bucket_index(void) {
+    TEST_ASSERT_EQUAL_UINT8(0, TimingStats::bucketIndex(0, 9600, 50));
+    TEST_ASSERT_EQUAL_UINT8(0, TimingStats::bucketIndex(9649, 9600, 50));
+    TEST_ASSERT_EQUAL_UINT8(1, TimingStats::bucketIndex(9650, 9600, 50));
+    TEST_ASSERT_EQUAL_UINT8(8, TimingStats::bucketIndex(10000, 9600, 50));
+    TEST_ASSERT_EQUAL_UINT8(15, TimingStats::bucketIndex(10399, 9600, 50));
+    TEST_ASSERT_EQUAL_UINT8(15, TimingStats::bucketIndex(20000, 9600, 50));
+}
+
+/**
+ * @test 処理時間のヒストグラム（周期超過は最後のビン）
+ */
+void test_histogram_counts(void) {
+    TimingStats stats(0, 625);
+    stats.record(100);     // 0
+    stats.record(700);     // 1
+    stats.record(1000);    // 1
+    stats.record(9999);    // 15
+    stats.record(15000);   // 15（周期超過）
+    TEST_ASSERT_EQUAL_UINT32(1, stats.getBucket(0));
+    TEST_ASSERT_EQUAL_UINT32(2, stats.getBucket(1));
+    TEST_ASSERT_EQUAL_UINT32(2, stats.getBucket(15));
+    TEST_ASSERT_EQUAL_UINT32(0, stats.getBucket(TimingStats::BUCKET_COUNT));
+
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < TimingStats::BUCKET_COUNT; i++) {
+        total += stats.getBucket(i);
+    }
+    TEST_ASSERT_EQUAL_UINT32(stats.getCount(), total);
+}
+
+/**
+ * @test ビン幅0は1として扱う（0除算しない）
+ */
+void test_zero_bucket_width(void) {
+    TimingStats stats(0, 0);
+    stats.record(3);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.getBucket(3));
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // 集計テスト
+    RUN_TEST(test_empty);
+    RUN_TEST(test_min_max_mean);
+    RUN_TEST(test_mean_no_overflow);
+    RUN_TEST(test_reset);
+    RUN_TEST(test_set_buckets);
+
+    // ヒストグラムテスト
+    RUN_TEST(test_bucket_index);
+    RUN_TEST(test_histogram_counts);
+    RUN_TEST(test_zero_bucket_width);
+
+    return UNITY_END();
+}
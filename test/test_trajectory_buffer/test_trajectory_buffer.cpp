@@ -0,0 +1,248 @@
+/**
+ * @file test_trajectory_buffer.cpp
+ * @brief TrajectoryBuffer / TrajectoryPlayer ユニットテスト
+ *
+ * セグメント列の書き込み検証と、経過時間による評価（保持・線形変化・連結）のテスト
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <cmath>
+#include "TrajectoryBuffer.h"
+
+static TrajectoryBuffer::Segment makeSegment(uint16_t durationMs, uint8_t mode,
+                                             float linearX, float angularZ) {
+    TrajectoryBuffer::Segment segment;
+    segment.durationMs = durationMs;
+    segment.mode = mode;
+    segment.linearX = linearX;
+    segment.angularZ = angularZ;
+    return segment;
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+// =============================================================================
+// TrajectoryBuffer テスト
+// =============================================================================
+
+/**
+ * @test 末尾への追加・上書きのみ可能（途中の空きは不可）
+ */
+void test_buffer_write_contiguous(void) {
+    TrajectoryBuffer buffer;
+    TrajectoryBuffer::Segment segment = makeSegment(100, TrajectoryBuffer::MODE_STEP, 0.1f, 0.0f);
+
+    TEST_ASSERT_FALSE(buffer.write(1, segment));
+    TEST_ASSERT_TRUE(buffer.write(0, segment));
+    TEST_ASSERT_TRUE(buffer.write(1, segment));
+    TEST_ASSERT_TRUE(buffer.write(0, segment));  // 上書き
+    TEST_ASSERT_EQUAL_UINT8(2, buffer.getCount());
+    TEST_ASSERT_EQUAL_UINT32(200, buffer.getTotalDurationMs());
+
+    buffer.clear();
+    TEST_ASSERT_EQUAL_UINT8(0, buffer.getCount());
+}
+
+/**
+ * @test 継続時間0・不正モード・NaN・容量超過は拒否
+ */
+void test_buffer_rejects_invalid_segment(void) {
+    TrajectoryBuffer buffer;
+    TEST_ASSERT_FALSE(buffer.write(0, makeSegment(0, TrajectoryBuffer::MODE_STEP, 0.1f, 0.0f)));
+    TEST_ASSERT_FALSE(buffer.write(0, makeSegment(100, 7, 0.1f, 0.0f)));
+    TEST_ASSERT_FALSE(buffer.write(0, makeSegment(100, TrajectoryBuffer::MODE_STEP, NAN, 0.0f)));
+
+    TrajectoryBuffer::Segment segment = makeSegment(10, TrajectoryBuffer::MODE_STEP, 0.1f, 0.0f);
+    for (uint8_t i = 0; i < TrajectoryBuffer::CAPACITY; i++) {
+        TEST_ASSERT_TRUE(buffer.write(i, segment));
+    }
+    TEST_ASSERT_FALSE(buffer.write(TrajectoryBuffer::CAPACITY, segment));
+    TEST_ASSERT_EQUAL_UINT8(TrajectoryBuffer::CAPACITY, buffer.getCount());
+}
+
+// =============================================================================
+// TrajectoryPlayer テスト
+// =============================================================================
+
+/**
+ * @test 空のバッファは開始しない
+ */
+void test_player_empty_buffer(void) {
+    TrajectoryBuffer buffer;
+    TrajectoryPlayer player;
+    float linearX = 9.0f;
+    float angularZ = 9.0f;
+
+    TEST_ASSERT_FALSE(player.start(buffer, 0));
+    TEST_ASSERT_FALSE(player.update(1000, linearX, angularZ));
+    TEST_ASSERT_EQUAL(TrajectoryPlayer::STATE_IDLE, player.getState());
+    TEST_ASSERT_EQUAL_FLOAT(9.0f, linearX);
+}
+
+/**
+ * @test STEPセグメントは継続時間中保持し、終了後の周期で0を出力して完了
+ */
+void test_player_step_segments(void) {
+    TrajectoryBuffer buffer;
+    buffer.write(0, makeSegment(100, TrajectoryBuffer::MODE_STEP, 0.2f, 0.0f));
+    buffer.write(1, makeSegment(50, TrajectoryBuffer::MODE_STEP, 0.0f, 1.0f));
+
+    TrajectoryPlayer player;
+    TEST_ASSERT_TRUE(player.start(buffer, 1000));
+    float linearX;
+    float angularZ;
+
+    TEST_ASSERT_TRUE(player.update(1000 + 99000, linearX, angularZ));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.2f, linearX);
+    TEST_ASSERT_EQUAL_UINT8(0, player.getSegmentIndex());
+
+    TEST_ASSERT_TRUE(player.update(1000 + 100000, linearX, angularZ));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, linearX);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 1.0f, angularZ);
+    TEST_ASSERT_EQUAL_UINT8(1, player.getSegmentIndex());
+    TEST_ASSERT_EQUAL_UINT32(100, player.getElapsedMs());
+
+    TEST_ASSERT_TRUE(player.update(1000 + 150000, linearX, angularZ));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, angularZ);
+    TEST_ASSERT_EQUAL(TrajectoryPlayer::STATE_DONE, player.getState());
+    TEST_ASSERT_FALSE(player.update(1000 + 160000, linearX, angularZ));
+}
+
+/**
+ * @test RAMPセグメント（ウェイポイント）は直前の値から線形に変化
+ */
+void test_player_ramp_segments(void) {
+    TrajectoryBuffer buffer;
+    buffer.write(0, makeSegment(200, TrajectoryBuffer::MODE_RAMP, 0.4f, 0.0f));
+    buffer.write(1, makeSegment(100, TrajectoryBuffer::MODE_RAMP, 0.0f, 2.0f));
+
+    TrajectoryPlayer player;
+    player.start(buffer, 0);
+    float linearX;
+    float angularZ;
+
+    // 先頭は0から
+    player.update(50000, linearX, angularZ);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.1f, linearX);
+
+    // 2つ目はセグメント1の値から
+    player.update(250000, linearX, angularZ);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.2f, linearX);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 1.0f, angularZ);
+}
+
+/**
+ * @test 制御周期がばらついても、同じ時刻では同じ値（経過時間で評価）
+ */
+void test_player_independent_of_tick_jitter(void) {
+    TrajectoryBuffer buffer;
+    buffer.write(0, makeSegment(100, TrajectoryBuffer::MODE_RAMP, 1.0f, 0.0f));
+    buffer.write(1, makeSegment(100, TrajectoryBuffer::MODE_STEP, 0.5f, 0.0f));
+
+    TrajectoryPlayer regular;
+    TrajectoryPlayer jittered;
+    regular.start(buffer, 5000);
+    jittered.start(buffer, 5000);
+
+    float a;
+    float b;
+    float angularZ;
+    for (uint32_t t = 0; t <= 80000; t += 10000) {
+        regular.update(5000 + t, a, angularZ);
+    }
+    jittered.update(5000 + 13000, b, angularZ);
+    jittered.update(5000 + 61000, b, angularZ);
+    jittered.update(5000 + 80000, b, angularZ);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, a, b);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.8f, b);
+}
+
+/**
+ * @test 前の軌道の終了時刻から開始すると、経過時間を引き継いで連結
+ */
+void test_player_chain_at_end_time(void) {
+    TrajectoryBuffer first;
+    TrajectoryBuffer second;
+    first.write(0, makeSegment(100, TrajectoryBuffer::MODE_RAMP, 0.3f, 0.0f));
+    second.write(0, makeSegment(100, TrajectoryBuffer::MODE_RAMP, 0.5f, 0.0f));
+
+    TrajectoryPlayer player;
+    player.start(first, 0);
+    float linearX;
+    float angularZ;
+    player.update(95000, linearX, angularZ);
+
+    // 105ms時点で1本目は終了済み → 終了時刻（100ms）で2本目を開始
+    TEST_ASSERT_TRUE(player.hasEnded(105000));
+    uint32_t endUs = player.getEndUs();
+    TEST_ASSERT_EQUAL_UINT32(100000, endUs);
+    player.start(second, endUs);
+
+    // 2本目のRAMPは1本目の最終値（0.3）から、開始5ms後
+    player.update(105000, linearX, angularZ);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.31f, linearX);
+    TEST_ASSERT_TRUE(player.isRunning());
+}
+
+/**
+ * @test 中断後は出力しない
+ */
+void test_player_abort(void) {
+    TrajectoryBuffer buffer;
+    buffer.write(0, makeSegment(1000, TrajectoryBuffer::MODE_STEP, 0.2f, 0.0f));
+
+    TrajectoryPlayer player;
+    player.start(buffer, 0);
+    player.abort();
+    float linearX = 9.0f;
+    float angularZ = 9.0f;
+    TEST_ASSERT_FALSE(player.update(10000, linearX, angularZ));
+    TEST_ASSERT_EQUAL(TrajectoryPlayer::STATE_ABORTED, player.getState());
+    TEST_ASSERT_EQUAL_FLOAT(9.0f, linearX);
+}
+
+/**
+ * @test 時刻がuint32境界を跨いでも正しく評価
+ */
+void test_player_wraparound(void) {
+    TrajectoryBuffer buffer;
+    buffer.write(0, makeSegment(100, TrajectoryBuffer::MODE_STEP, 0.2f, 0.0f));
+    buffer.write(1, makeSegment(100, TrajectoryBuffer::MODE_STEP, 0.4f, 0.0f));
+
+    TrajectoryPlayer player;
+    uint32_t startUs = 0xFFFFFFFFUL - 50000;
+    player.start(buffer, startUs);
+    float linearX;
+    float angularZ;
+    player.update(startUs + 120000, linearX, angularZ);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.4f, linearX);
+    TEST_ASSERT_TRUE(player.isRunning());
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // TrajectoryBuffer テスト
+    RUN_TEST(test_buffer_write_contiguous);
+    RUN_TEST(test_buffer_rejects_invalid_segment);
+
+    // TrajectoryPlayer テスト
+    RUN_TEST(test_player_empty_buffer);
+    RUN_TEST(test_player_step_segments);
+    RUN_TEST(test_player_ramp_segments);
+    RUN_TEST(test_player_independent_of_tick_jitter);
+    RUN_TEST(test_player_chain_at_end_time);
+    RUN_TEST(test_player_abort);
+    RUN_TEST(test_player_wraparound);
+
+    return UNITY_END();
+}
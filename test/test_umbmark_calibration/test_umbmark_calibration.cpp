@@ -0,0 +1,216 @@
+/**
+ * @file test_umbmark_calibration.cpp
+ * @brief UmbmarkCalibration ユニットテスト
+ *
+ * 正方形走行の順モデルと、CW/CCW終点誤差からの実効ジオメトリ推定のテスト
+ *
+ * テスト条件:
+ * - wheel_diameter = 0.1m（オドメトリの設定値）
+ * - track_width = 0.3m（オドメトリの設定値）
+ * - side_length = 2.0m
+ */
+
+#include <unity.h>
+#include <cmath>
+#include "UmbmarkCalibration.h"
+
+static const double WHEEL_DIAMETER = 0.1;
+static const double TRACK_WIDTH = 0.3;
+static const double SIDE_LENGTH = 2.0;
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+/**
+ * 実際のジオメトリで走行した場合の計測結果を追加（オドメトリ終点は原点）
+ */
+static void addSimulatedRuns(UmbmarkCalibration& calib, const UmbmarkCalibration::Geometry& actual) {
+    double x;
+    double y;
+    UmbmarkCalibration::simulateSquare(SIDE_LENGTH, WHEEL_DIAMETER, TRACK_WIDTH,
+                                       actual, UmbmarkCalibration::CW, x, y);
+    calib.addSquareRun(UmbmarkCalibration::CW, 0.0, 0.0, x, y);
+    UmbmarkCalibration::simulateSquare(SIDE_LENGTH, WHEEL_DIAMETER, TRACK_WIDTH,
+                                       actual, UmbmarkCalibration::CCW, x, y);
+    calib.addSquareRun(UmbmarkCalibration::CCW, 0.0, 0.0, x, y);
+}
+
+// =============================================================================
+// 順モデルテスト
+// =============================================================================
+
+/**
+ * @test 設定値どおりのジオメトリなら原点に戻る
+ */
+void test_simulate_nominal_closes_square(void) {
+    UmbmarkCalibration::Geometry nominal = { WHEEL_DIAMETER, WHEEL_DIAMETER, TRACK_WIDTH };
+    double x;
+    double y;
+    UmbmarkCalibration::simulateSquare(SIDE_LENGTH, WHEEL_DIAMETER, TRACK_WIDTH,
+                                       nominal, UmbmarkCalibration::CW, x, y);
+    TEST_ASSERT_FLOAT_WITHIN(1e-9, 0.0, x);
+    TEST_ASSERT_FLOAT_WITHIN(1e-9, 0.0, y);
+    UmbmarkCalibration::simulateSquare(SIDE_LENGTH, WHEEL_DIAMETER, TRACK_WIDTH,
+                                       nominal, UmbmarkCalibration::CCW, x, y);
+    TEST_ASSERT_FLOAT_WITHIN(1e-9, 0.0, x);
+    TEST_ASSERT_FLOAT_WITHIN(1e-9, 0.0, y);
+}
+
+/**
+ * @test トレッド幅の誤差はCW/CCWで鏡像の終点誤差になる
+ * 旋回の過不足は左右対称なので、CWの終点はCCWの終点をx軸で反転したもの
+ */
+void test_simulate_track_error_is_mirrored(void) {
+    UmbmarkCalibration::Geometry actual = { WHEEL_DIAMETER, WHEEL_DIAMETER, TRACK_WIDTH * 1.02 };
+    double xCw, yCw, xCcw, yCcw;
+    UmbmarkCalibration::simulateSquare(SIDE_LENGTH, WHEEL_DIAMETER, TRACK_WIDTH,
+                                       actual, UmbmarkCalibration::CW, xCw, yCw);
+    UmbmarkCalibration::simulateSquare(SIDE_LENGTH, WHEEL_DIAMETER, TRACK_WIDTH,
+                                       actual, UmbmarkCalibration::CCW, xCcw, yCcw);
+    TEST_ASSERT_FLOAT_WITHIN(1e-9, xCw, xCcw);
+    TEST_ASSERT_FLOAT_WITHIN(1e-9, -yCw, yCcw);
+    TEST_ASSERT_TRUE(std::fabs(yCw) > 0.01);
+}
+
+/**
+ * @test 左右直径の差は直進区間を同じ向きの弧にし、CW/CCWの鏡像関係を崩す
+ */
+void test_simulate_diameter_error_breaks_mirror(void) {
+    UmbmarkCalibration::Geometry actual = { WHEEL_DIAMETER * 0.995, WHEEL_DIAMETER * 1.005, TRACK_WIDTH };
+    double xCw, yCw, xCcw, yCcw;
+    UmbmarkCalibration::simulateSquare(SIDE_LENGTH, WHEEL_DIAMETER, TRACK_WIDTH,
+                                       actual, UmbmarkCalibration::CW, xCw, yCw);
+    UmbmarkCalibration::simulateSquare(SIDE_LENGTH, WHEEL_DIAMETER, TRACK_WIDTH,
+                                       actual, UmbmarkCalibration::CCW, xCcw, yCcw);
+    // 右輪が大きい → 直進区間が左に曲がる: CWは右回りの正方形を外へ、CCWは内へ
+    TEST_ASSERT_TRUE(std::fabs(xCw - xCcw) > 0.1);
+    TEST_ASSERT_TRUE(std::fabs(yCw + yCcw) > 0.1);
+}
+
+// =============================================================================
+// 推定テスト
+// =============================================================================
+
+/**
+ * @test 結果が片方向のみなら推定しない
+ */
+void test_solve_requires_both_directions(void) {
+    UmbmarkCalibration calib(WHEEL_DIAMETER, TRACK_WIDTH, SIDE_LENGTH);
+    calib.addSquareRun(UmbmarkCalibration::CW, 0.0, 0.0, 0.01, 0.02);
+    UmbmarkCalibration::Geometry result;
+    TEST_ASSERT_FALSE(calib.solve(result));
+    TEST_ASSERT_EQUAL(1, calib.getRunCount(UmbmarkCalibration::CW));
+    TEST_ASSERT_EQUAL(0, calib.getRunCount(UmbmarkCalibration::CCW));
+}
+
+/**
+ * @test 誤差なしなら設定値をそのまま返す
+ */
+void test_solve_nominal(void) {
+    UmbmarkCalibration calib(WHEEL_DIAMETER, TRACK_WIDTH, SIDE_LENGTH);
+    calib.addSquareRun(UmbmarkCalibration::CW, 0.0, 0.0, 0.0, 0.0);
+    calib.addSquareRun(UmbmarkCalibration::CCW, 0.0, 0.0, 0.0, 0.0);
+    UmbmarkCalibration::Geometry result;
+    TEST_ASSERT_TRUE(calib.solve(result));
+    TEST_ASSERT_FLOAT_WITHIN(1e-9, WHEEL_DIAMETER, result.wheelDiameterL);
+    TEST_ASSERT_FLOAT_WITHIN(1e-9, WHEEL_DIAMETER, result.wheelDiameterR);
+    TEST_ASSERT_FLOAT_WITHIN(1e-9, TRACK_WIDTH, result.trackWidth);
+}
+
+/**
+ * @test 左右直径差とトレッド誤差を同時に復元
+ */
+void test_solve_recovers_geometry(void) {
+    UmbmarkCalibration::Geometry actual = { 0.0994, 0.1006, 0.315 };
+    UmbmarkCalibration calib(WHEEL_DIAMETER, TRACK_WIDTH, SIDE_LENGTH);
+    addSimulatedRuns(calib, actual);
+
+    UmbmarkCalibration::Geometry result;
+    TEST_ASSERT_TRUE(calib.solve(result));
+    TEST_ASSERT_FLOAT_WITHIN(1e-7, actual.wheelDiameterL, result.wheelDiameterL);
+    TEST_ASSERT_FLOAT_WITHIN(1e-7, actual.wheelDiameterR, result.wheelDiameterR);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, actual.trackWidth, result.trackWidth);
+}
+
+/**
+ * @test クローラのように実効トレッドが大きく異なる場合も収束
+ */
+void test_solve_large_track_error(void) {
+    UmbmarkCalibration::Geometry actual = { 0.1, 0.1, 0.42 };
+    UmbmarkCalibration calib(WHEEL_DIAMETER, TRACK_WIDTH, SIDE_LENGTH);
+    addSimulatedRuns(calib, actual);
+
+    UmbmarkCalibration::Geometry result;
+    TEST_ASSERT_TRUE(calib.solve(result));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, 0.42, result.trackWidth);
+    TEST_ASSERT_FLOAT_WITHIN(1e-7, 0.1, result.wheelDiameterL);
+}
+
+/**
+ * @test 直進走行の実測距離から平均直径を補正
+ */
+void test_straight_run_scales_diameter(void) {
+    UmbmarkCalibration::Geometry actual = { 0.102, 0.102, TRACK_WIDTH * 1.02 };
+    UmbmarkCalibration calib(WHEEL_DIAMETER, TRACK_WIDTH, SIDE_LENGTH);
+    calib.addStraightRun(2.0, 2.04);
+    calib.addStraightRun(2.0, 2.04);
+    addSimulatedRuns(calib, actual);
+
+    TEST_ASSERT_FLOAT_WITHIN(1e-9, 1.02, calib.getDistanceScale());
+    UmbmarkCalibration::Geometry result;
+    TEST_ASSERT_TRUE(calib.solve(result));
+    TEST_ASSERT_FLOAT_WITHIN(1e-7, 0.102, result.wheelDiameterL);
+    TEST_ASSERT_FLOAT_WITHIN(1e-7, 0.102, result.wheelDiameterR);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, actual.trackWidth, result.trackWidth);
+}
+
+/**
+ * @test 誤差は「実測 − オドメトリ」の重心を使う
+ * オドメトリ終点のずれ（停止位置の行き過ぎ）は差し引かれる
+ */
+void test_runs_are_averaged_relative_to_odometry(void) {
+    UmbmarkCalibration::Geometry actual = { 0.0997, 0.1003, 0.31 };
+    double xCw, yCw, xCcw, yCcw;
+    UmbmarkCalibration::simulateSquare(SIDE_LENGTH, WHEEL_DIAMETER, TRACK_WIDTH,
+                                       actual, UmbmarkCalibration::CW, xCw, yCw);
+    UmbmarkCalibration::simulateSquare(SIDE_LENGTH, WHEEL_DIAMETER, TRACK_WIDTH,
+                                       actual, UmbmarkCalibration::CCW, xCcw, yCcw);
+
+    UmbmarkCalibration calib(WHEEL_DIAMETER, TRACK_WIDTH, SIDE_LENGTH);
+    // 実測のばらつき ±0.01m（平均すると打ち消す）とオドメトリ終点のずれ
+    calib.addSquareRun(UmbmarkCalibration::CW, 0.005, 0.0, xCw + 0.015, yCw - 0.01);
+    calib.addSquareRun(UmbmarkCalibration::CW, 0.005, 0.0, xCw - 0.005, yCw + 0.01);
+    calib.addSquareRun(UmbmarkCalibration::CCW, 0.0, -0.002, xCcw, yCcw - 0.002);
+
+    UmbmarkCalibration::Geometry result;
+    TEST_ASSERT_TRUE(calib.solve(result));
+    TEST_ASSERT_FLOAT_WITHIN(1e-7, actual.wheelDiameterL, result.wheelDiameterL);
+    TEST_ASSERT_FLOAT_WITHIN(1e-7, actual.wheelDiameterR, result.wheelDiameterR);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, actual.trackWidth, result.trackWidth);
+}
+
+// =============================================================================
+// メイン
+// =============================================================================
+
+int main(void) {
+    UNITY_BEGIN();
+
+    // 順モデルテスト
+    RUN_TEST(test_simulate_nominal_closes_square);
+    RUN_TEST(test_simulate_track_error_is_mirrored);
+    RUN_TEST(test_simulate_diameter_error_breaks_mirror);
+
+    // 推定テスト
+    RUN_TEST(test_solve_requires_both_directions);
+    RUN_TEST(test_solve_nominal);
+    RUN_TEST(test_solve_recovers_geometry);
+    RUN_TEST(test_solve_large_track_error);
+    RUN_TEST(test_straight_run_scales_diameter);
+    RUN_TEST(test_runs_are_averaged_relative_to_odometry);
+
+    return UNITY_END();
+}
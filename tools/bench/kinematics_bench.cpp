@@ -0,0 +1,104 @@
+/**
+ * @file kinematics_bench.cpp
+ * @brief DifferentialKinematics 変換コストのホスト側ベンチマーク
+ *
+ * 事前計算前の calculate()（毎回 d/2, track/2, 60/(2πr)*gear を計算）と
+ * 現行の calculate() / calculateBatch() の1呼び出しあたりの時間を比較する。
+ *
+ * ビルド・実行（リポジトリルートで）:
+ * @code
+ * g++ -O2 -std=c++17 -Ilib/DifferentialKinematics \
+ *     tools/bench/kinematics_bench.cpp lib/DifferentialKinematics/DifferentialKinematics.cpp \
+ *     -o kinematics_bench && ./kinematics_bench
+ * @endcode
+ *
+ * ホストはハードウェアFPUを持つため、RP2040（ソフトウェア浮動小数点）での
+ * 差はここで得られる比率より大きくなる。
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "DifferentialKinematics.h"
+
+namespace {
+
+constexpr float WHEEL_DIAMETER = 0.1f;
+constexpr float TRACK_WIDTH = 0.38f;
+constexpr float GEAR_RATIO = 1.0f;
+constexpr size_t SAMPLE_COUNT = 4096;
+constexpr int REPEAT = 2000;
+
+/**
+ * 事前計算前の実装（比較用）
+ * コンパイラに定数畳み込みさせないよう、ジオメトリは引数で受ける
+ */
+__attribute__((noinline))
+void legacyCalculate(float wheelDiameter, float trackWidth, float gearRatio,
+                     float linearX, float angularZ, float& leftRpm, float& rightRpm) {
+    constexpr float PI = 3.14159f;
+    float wheelRadius = wheelDiameter / 2.0f;
+    float leftVel = linearX - angularZ * trackWidth / 2.0f;
+    float rightVel = linearX + angularZ * trackWidth / 2.0f;
+    float velToRpm = 60.0f / (2.0f * PI * wheelRadius) * gearRatio;
+    leftRpm = leftVel * velToRpm;
+    rightRpm = rightVel * velToRpm;
+}
+
+template <typename Func>
+double measureNsPerCall(Func func) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < REPEAT; r++) {
+        func();
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    return ns / (static_cast<double>(REPEAT) * SAMPLE_COUNT);
+}
+
+} // namespace
+
+int main() {
+    std::vector<float> linearX(SAMPLE_COUNT), angularZ(SAMPLE_COUNT);
+    std::vector<float> leftRpm(SAMPLE_COUNT), rightRpm(SAMPLE_COUNT);
+    for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+        linearX[i] = 0.5f * static_cast<float>(i % 200) / 200.0f - 0.25f;
+        angularZ[i] = 2.0f * static_cast<float>(i % 97) / 97.0f - 1.0f;
+    }
+
+    // ジオメトリは実行時に決まる値として扱う
+    volatile float d = WHEEL_DIAMETER, t = TRACK_WIDTH, g = GEAR_RATIO;
+    const float wheelDiameter = d, trackWidth = t, gearRatio = g;
+    DifferentialKinematics kinematics(wheelDiameter, trackWidth, gearRatio);
+
+    double legacyNs = measureNsPerCall([&] {
+        for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+            legacyCalculate(wheelDiameter, trackWidth, gearRatio,
+                            linearX[i], angularZ[i], leftRpm[i], rightRpm[i]);
+        }
+    });
+
+    double singleNs = measureNsPerCall([&] {
+        for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+            kinematics.calculate(linearX[i], angularZ[i], leftRpm[i], rightRpm[i]);
+        }
+    });
+
+    double batchNs = measureNsPerCall([&] {
+        kinematics.calculateBatch(linearX.data(), angularZ.data(),
+                                  leftRpm.data(), rightRpm.data(), SAMPLE_COUNT);
+    });
+
+    double inverseNs = measureNsPerCall([&] {
+        kinematics.inverseBatch(leftRpm.data(), rightRpm.data(),
+                                linearX.data(), angularZ.data(), SAMPLE_COUNT);
+    });
+
+    printf("samples=%zu repeat=%d\n", SAMPLE_COUNT, REPEAT);
+    printf("legacy calculate : %6.2f ns/call\n", legacyNs);
+    printf("calculate        : %6.2f ns/call (%.1fx)\n", singleNs, legacyNs / singleNs);
+    printf("calculateBatch   : %6.2f ns/call (%.1fx)\n", batchNs, legacyNs / batchNs);
+    printf("inverseBatch     : %6.2f ns/call\n", inverseNs);
+    return 0;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file rpm_clamp_bench.cpp
+ * @brief 回転優先RPMクランプのホスト側ベンチマーク
+ *
+ * 従来の std::min / std::max 版（MotorController・MotorLogicにあった実装）と、
+ * RpmClamp のスカラー版・一括版（左右別配列 / RPMの組の配列）の1要素あたりの時間を比較する。
+ * 結果が従来版とビット単位で一致することも確認する。
+ *
+ * ビルド・実行（リポジトリルートで）:
+ * @code
+ * g++ -O2 -std=c++17 -Ilib/RpmClamp tools/bench/rpm_clamp_bench.cpp \
+ *     -o rpm_clamp_bench && ./rpm_clamp_bench
+ * @endcode
+ *
+ * 入力の約半数が上限を越えるようにしている（分岐予測が効きにくい条件）。
+ * ホストはハードウェアFPUを持つため、RP2040（ソフトウェア浮動小数点）では
+ * 比較自体がライブラリ呼び出しになり、差はここで得られる比率より小さくなる。
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "RpmClamp.h"
+
+namespace {
+
+constexpr size_t SAMPLE_COUNT = 4096;
+constexpr int REPEAT = 2000;
+
+/**
+ * 従来の実装（比較用）
+ */
+__attribute__((noinline))
+void legacyClamp(float& leftRpm, float& rightRpm, float maxRpm) {
+    float vTrans = (rightRpm + leftRpm) / 2.0f;
+    float vRot = (rightRpm - leftRpm) / 2.0f;
+    float clampedVRot = std::max(-maxRpm, std::min(maxRpm, vRot));
+    float vTransLimit = maxRpm - std::abs(clampedVRot);
+    float clampedVTrans = std::max(-vTransLimit, std::min(vTransLimit, vTrans));
+    leftRpm = clampedVTrans - clampedVRot;
+    rightRpm = clampedVTrans + clampedVRot;
+}
+
+__attribute__((noinline))
+void kernelClamp(float& leftRpm, float& rightRpm, float maxRpm) {
+    RpmClamp::rotationPriority(leftRpm, rightRpm, maxRpm);
+}
+
+template <typename Reset, typename Func>
+double measureNsPerCall(Reset reset, Func func) {
+    double totalNs = 0.0;
+    for (int r = 0; r < REPEAT; r++) {
+        reset();  // その場でクランプするため、毎回入力を戻す（計測から除外）
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto end = std::chrono::steady_clock::now();
+        totalNs += std::chrono::duration<double, std::nano>(end - start).count();
+    }
+    return totalNs / (static_cast<double>(REPEAT) * SAMPLE_COUNT);
+}
+
+} // namespace
+
+int main() {
+    std::vector<float> inputL(SAMPLE_COUNT), inputR(SAMPLE_COUNT);
+    unsigned int seed = 12345;
+    for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+        seed = seed * 1103515245u + 12345u;
+        inputL[i] = static_cast<float>((seed >> 8) % 520) - 260.0f;
+        seed = seed * 1103515245u + 12345u;
+        inputR[i] = static_cast<float>((seed >> 8) % 520) - 260.0f;
+    }
+
+    // 上限は実行時に決まる値として扱う
+    volatile float maxRpmSource = 130.0f;
+    const float maxRpm = maxRpmSource;
+
+    std::vector<float> left(SAMPLE_COUNT), right(SAMPLE_COUNT);
+    std::vector<RpmClamp::RpmPair> pairs(SAMPLE_COUNT);
+    auto resetSplit = [&] {
+        std::memcpy(left.data(), inputL.data(), SAMPLE_COUNT * sizeof(float));
+        std::memcpy(right.data(), inputR.data(), SAMPLE_COUNT * sizeof(float));
+    };
+    auto resetPairs = [&] {
+        for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+            pairs[i] = RpmClamp::RpmPair{ inputL[i], inputR[i] };
+        }
+    };
+
+    // 結果の一致確認
+    std::vector<float> legacyL(inputL), legacyR(inputR);
+    for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+        legacyClamp(legacyL[i], legacyR[i], maxRpm);
+    }
+    resetSplit();
+    RpmClamp::rotationPriorityBatch(left.data(), right.data(), SAMPLE_COUNT, maxRpm);
+    bool identical = std::memcmp(legacyL.data(), left.data(), SAMPLE_COUNT * sizeof(float)) == 0 &&
+                     std::memcmp(legacyR.data(), right.data(), SAMPLE_COUNT * sizeof(float)) == 0;
+
+    double legacyNs = measureNsPerCall(resetSplit, [&] {
+        for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+            legacyClamp(left[i], right[i], maxRpm);
+        }
+    });
+
+    double scalarNs = measureNsPerCall(resetSplit, [&] {
+        for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+            kernelClamp(left[i], right[i], maxRpm);
+        }
+    });
+
+    double splitNs = measureNsPerCall(resetSplit, [&] {
+        RpmClamp::rotationPriorityBatch(left.data(), right.data(), SAMPLE_COUNT, maxRpm);
+    });
+
+    double pairsNs = measureNsPerCall(resetPairs, [&] {
+        RpmClamp::rotationPriorityBatch(pairs.data(), SAMPLE_COUNT, maxRpm);
+    });
+
+    printf("samples=%zu repeat=%d identical=%s\n", SAMPLE_COUNT, REPEAT, identical ? "yes" : "NO");
+    printf("legacy std::min/max   : %6.2f ns/pair\n", legacyNs);
+    printf("RpmClamp scalar       : %6.2f ns/pair (%.1fx)\n", scalarNs, legacyNs / scalarNs);
+    printf("RpmClamp batch (L/R)  : %6.2f ns/pair (%.1fx)\n", splitNs, legacyNs / splitNs);
+    printf("RpmClamp batch (pairs): %6.2f ns/pair (%.1fx)\n", pairsNs, legacyNs / pairsNs);
+    return identical ? 0 : 1;
+}
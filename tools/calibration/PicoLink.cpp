@@ -0,0 +1,333 @@
+/**
+ * @file PicoLink.cpp
+ * @brief ホスト側ツール用のPico通信クライアント 実装
+ */
+
+#include "PicoLink.h"
+
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace {
+    constexpr size_t MAX_PACKET = 64;
+    constexpr int RESPONSE_TIMEOUT_MS = 1000;
+    constexpr int ODOMETRY_BUSY_RETRIES = 3;
+
+    speed_t toSpeed(uint32_t baudrate) {
+        switch (baudrate) {
+            case 9600: return B9600;
+            case 19200: return B19200;
+            case 38400: return B38400;
+            case 57600: return B57600;
+            case 230400: return B230400;
+            case 460800: return B460800;
+            case 921600: return B921600;
+            default: return B115200;
+        }
+    }
+}
+
+// =============================================================================
+// SerialTransport
+// =============================================================================
+
+SerialTransport::SerialTransport()
+    : fd_(-1)
+{
+}
+
+SerialTransport::~SerialTransport() {
+    close();
+}
+
+bool SerialTransport::open(const char* port, uint32_t baudrate) {
+    close();
+    fd_ = ::open(port, O_RDWR | O_NOCTTY);
+    if (fd_ < 0) {
+        return false;
+    }
+
+    termios tio;
+    if (tcgetattr(fd_, &tio) != 0) {
+        close();
+        return false;
+    }
+    cfmakeraw(&tio);
+    tio.c_cflag |= CLOCAL | CREAD;
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+    cfsetispeed(&tio, toSpeed(baudrate));
+    cfsetospeed(&tio, toSpeed(baudrate));
+    if (tcsetattr(fd_, TCSANOW, &tio) != 0) {
+        close();
+        return false;
+    }
+
+    // USB CDCの接続待ち後、起動時の出力を捨てる
+    waitMs(100);
+    tcflush(fd_, TCIFLUSH);
+    return true;
+}
+
+void SerialTransport::close() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+size_t SerialTransport::transact(const uint8_t* request, size_t length,
+                                 uint8_t* response, size_t responseSize) {
+    if (fd_ < 0) {
+        return 0;
+    }
+
+    uint8_t frame[MAX_PACKET + 2];
+    size_t frameLength = cobsEncode(request, length, frame, sizeof(frame) - 1);
+    if (frameLength == 0) {
+        return 0;
+    }
+    frame[frameLength++] = 0x00;
+    if (write(fd_, frame, frameLength) != static_cast<ssize_t>(frameLength)) {
+        return 0;
+    }
+
+    // 区切り（0x00）までを1フレームとして受信
+    uint8_t encoded[MAX_PACKET + 2];
+    size_t received = 0;
+    pollfd pfd = { fd_, POLLIN, 0 };
+    while (poll(&pfd, 1, RESPONSE_TIMEOUT_MS) > 0) {
+        uint8_t byte;
+        if (read(fd_, &byte, 1) != 1) {
+            continue;
+        }
+        if (byte == 0x00) {
+            if (received == 0) {
+                continue;
+            }
+            return cobsDecode(encoded, received, response, responseSize);
+        }
+        if (received >= sizeof(encoded)) {
+            received = 0;  // 長すぎるフレームは捨てて次の区切りから
+            continue;
+        }
+        encoded[received++] = byte;
+    }
+    return 0;
+}
+
+void SerialTransport::waitMs(uint32_t ms) {
+    timespec ts;
+    ts.tv_sec = ms / 1000;
+    ts.tv_nsec = static_cast<long>(ms % 1000) * 1000000L;
+    nanosleep(&ts, nullptr);
+}
+
+size_t SerialTransport::cobsEncode(const uint8_t* data, size_t length, uint8_t* out, size_t outSize) {
+    if (outSize < length + length / 254 + 1) {
+        return 0;
+    }
+    size_t codeIndex = 0;
+    size_t writeIndex = 1;
+    uint8_t code = 1;
+    for (size_t i = 0; i < length; i++) {
+        if (data[i] == 0x00) {
+            out[codeIndex] = code;
+            codeIndex = writeIndex++;
+            code = 1;
+            continue;
+        }
+        out[writeIndex++] = data[i];
+        if (++code == 0xFF) {
+            out[codeIndex] = code;
+            codeIndex = writeIndex++;
+            code = 1;
+        }
+    }
+    out[codeIndex] = code;
+    return writeIndex;
+}
+
+size_t SerialTransport::cobsDecode(const uint8_t* data, size_t length, uint8_t* out, size_t outSize) {
+    size_t readIndex = 0;
+    size_t writeIndex = 0;
+    while (readIndex < length) {
+        uint8_t code = data[readIndex++];
+        if (code == 0x00 || readIndex + code - 1 > length) {
+            return 0;
+        }
+        for (uint8_t i = 1; i < code; i++) {
+            if (writeIndex >= outSize) {
+                return 0;
+            }
+            out[writeIndex++] = data[readIndex++];
+        }
+        if (code != 0xFF && readIndex < length) {
+            if (writeIndex >= outSize) {
+                return 0;
+            }
+            out[writeIndex++] = 0x00;
+        }
+    }
+    return writeIndex;
+}
+
+// =============================================================================
+// PicoLink
+// =============================================================================
+
+PicoLink::PicoLink(PicoTransport& transport)
+    : transport_(transport)
+{
+}
+
+bool PicoLink::motorCommand(float linearX, float angularZ) {
+    uint8_t payload[8];
+    memcpy(payload, &linearX, 4);
+    memcpy(payload + 4, &angularZ, 4);
+    uint8_t response[10];
+    return request(Protocol::REQUEST_MOTOR_COMMAND, payload, sizeof(payload),
+                   response, sizeof(response));
+}
+
+bool PicoLink::getConfig(Protocol::ConfigData& config) {
+    uint8_t response[Protocol::CONFIG_PAYLOAD_SIZE_WITH_RATE];
+    uint8_t length = 0;
+    if (!request(Protocol::REQUEST_GET_CONFIG, nullptr, 0, response,
+                 Protocol::CONFIG_PAYLOAD_SIZE, sizeof(response), length)) {
+        return false;
+    }
+    memcpy(&config.pidKp, response, 4);
+    memcpy(&config.pidKi, response + 4, 4);
+    memcpy(&config.pidKd, response + 8, 4);
+    memcpy(&config.maxRpm, response + 12, 4);
+    memcpy(&config.encoderPpr, response + 16, 2);
+    memcpy(&config.gearRatio, response + 18, 4);
+    memcpy(&config.wheelDiameter, response + 22, 4);
+    memcpy(&config.trackWidth, response + 26, 4);
+    config.hasPerSide = (length >= Protocol::CONFIG_PAYLOAD_SIZE_PER_SIDE);
+    if (config.hasPerSide) {
+        memcpy(&config.pidKpR, response + 30, 4);
+        memcpy(&config.pidKiR, response + 34, 4);
+        memcpy(&config.pidKdR, response + 38, 4);
+        memcpy(&config.encoderPprR, response + 42, 2);
+        memcpy(&config.gearRatioR, response + 44, 4);
+        memcpy(&config.wheelDiameterR, response + 48, 4);
+    } else {
+        config.pidKpR = config.pidKp;
+        config.pidKiR = config.pidKi;
+        config.pidKdR = config.pidKd;
+        config.encoderPprR = config.encoderPpr;
+        config.gearRatioR = config.gearRatio;
+        config.wheelDiameterR = config.wheelDiameter;
+    }
+    config.hasControlRate = (length >= Protocol::CONFIG_PAYLOAD_SIZE_WITH_RATE);
+    config.controlRateHz = 0;
+    if (config.hasControlRate) {
+        memcpy(&config.controlRateHz, response + 52, 2);
+    }
+    return true;
+}
+
+bool PicoLink::setConfig(const Protocol::ConfigData& config, uint8_t& result) {
+    uint8_t payload[Protocol::CONFIG_PAYLOAD_SIZE_PER_SIDE];
+    memcpy(payload, &config.pidKp, 4);
+    memcpy(payload + 4, &config.pidKi, 4);
+    memcpy(payload + 8, &config.pidKd, 4);
+    memcpy(payload + 12, &config.maxRpm, 4);
+    memcpy(payload + 16, &config.encoderPpr, 2);
+    memcpy(payload + 18, &config.gearRatio, 4);
+    memcpy(payload + 22, &config.wheelDiameter, 4);
+    memcpy(payload + 26, &config.trackWidth, 4);
+    uint8_t payloadLength = Protocol::CONFIG_PAYLOAD_SIZE;
+    if (config.hasPerSide) {
+        memcpy(payload + 30, &config.pidKpR, 4);
+        memcpy(payload + 34, &config.pidKiR, 4);
+        memcpy(payload + 38, &config.pidKdR, 4);
+        memcpy(payload + 42, &config.encoderPprR, 2);
+        memcpy(payload + 44, &config.gearRatioR, 4);
+        memcpy(payload + 48, &config.wheelDiameterR, 4);
+        payloadLength = Protocol::CONFIG_PAYLOAD_SIZE_PER_SIDE;
+    }
+    return request(Protocol::REQUEST_SET_CONFIG, payload, payloadLength, &result, 1);
+}
+
+bool PicoLink::getOdometry(Protocol::OdometryResponse& odometry) {
+    uint8_t response[24];
+    uint8_t receivedLength = 0;
+    for (int attempt = 0; attempt < ODOMETRY_BUSY_RETRIES; attempt++) {
+        // Core1の更新と競合した場合は結果コード（BUSY）のみが返るため再要求
+        if (!request(Protocol::REQUEST_GET_ODOMETRY, nullptr, 0, response, 1, sizeof(response),
+                     receivedLength)) {
+            return false;
+        }
+        if (receivedLength != 1 || response[0] != Protocol::ODOMETRY_RESULT_BUSY) {
+            break;
+        }
+    }
+    if (receivedLength < sizeof(response)) {
+        return false;
+    }
+    memcpy(&odometry.x, response, 4);
+    memcpy(&odometry.y, response + 4, 4);
+    memcpy(&odometry.theta, response + 8, 4);
+    memcpy(&odometry.linearX, response + 12, 4);
+    memcpy(&odometry.angularZ, response + 16, 4);
+    memcpy(&odometry.timestampUs, response + 20, 4);
+    return true;
+}
+
+bool PicoLink::resetOdometry() {
+    uint8_t result = 0xFF;
+    return request(Protocol::REQUEST_RESET_ODOMETRY, nullptr, 0, &result, 1) && result == 0x00;
+}
+
+void PicoLink::waitMs(uint32_t ms) {
+    transport_.waitMs(ms);
+}
+
+bool PicoLink::request(uint8_t requestType, const uint8_t* payload, uint8_t payloadLength,
+                       uint8_t* responsePayload, uint8_t expectedLength) {
+    uint8_t receivedLength = 0;
+    return request(requestType, payload, payloadLength, responsePayload,
+                   expectedLength, expectedLength, receivedLength);
+}
+
+bool PicoLink::request(uint8_t requestType, const uint8_t* payload, uint8_t payloadLength,
+                       uint8_t* responsePayload, uint8_t minLength, uint8_t capacity,
+                       uint8_t& receivedLength) {
+    uint8_t packet[MAX_PACKET];
+    uint16_t checksum = Protocol::calculateChecksum(payload, payloadLength);
+    packet[Protocol::HEADER_REQUEST_TYPE] = requestType;
+    packet[Protocol::HEADER_PAYLOAD_LENGTH] = payloadLength;
+    packet[Protocol::HEADER_CHECKSUM_L] = checksum & 0xFF;
+    packet[Protocol::HEADER_CHECKSUM_H] = (checksum >> 8) & 0xFF;
+    if (payloadLength > 0) {
+        memcpy(packet + Protocol::HEADER_SIZE, payload, payloadLength);
+    }
+
+    uint8_t response[MAX_PACKET];
+    size_t length = transport_.transact(packet, Protocol::HEADER_SIZE + payloadLength,
+                                        response, sizeof(response));
+    const uint8_t bodyLength = response[Protocol::HEADER_PAYLOAD_LENGTH];
+    if (length < static_cast<size_t>(Protocol::HEADER_SIZE + minLength) ||
+        length < static_cast<size_t>(Protocol::HEADER_SIZE + bodyLength) ||
+        response[Protocol::HEADER_REQUEST_TYPE] != requestType ||
+        bodyLength < minLength) {
+        return false;
+    }
+
+    const uint8_t* body = response + Protocol::HEADER_SIZE;
+    uint16_t received = response[Protocol::HEADER_CHECKSUM_L] |
+                        (response[Protocol::HEADER_CHECKSUM_H] << 8);
+    if (received != Protocol::calculateChecksum(body, bodyLength)) {
+        return false;
+    }
+    receivedLength = (bodyLength < capacity) ? bodyLength : capacity;
+    memcpy(responsePayload, body, receivedLength);
+    return true;
+}
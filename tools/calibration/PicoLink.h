@@ -0,0 +1,131 @@
+/**
+ * @file PicoLink.h
+ * @brief ホスト側ツール用のPico通信クライアント
+ *
+ * リクエストパケットの作成・レスポンスのパースを行い、
+ * 実機（シリアル + COBS）とネイティブシミュレータ（SimRobot）を同じ手順で扱う。
+ * パケット形式は documents/protocol.md を参照。
+ */
+
+#ifndef PICO_LINK_H
+#define PICO_LINK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "Protocol.h"
+
+/**
+ * @class PicoTransport
+ * @brief パケット単位の送受信（フレーミングは実装側）
+ */
+class PicoTransport {
+public:
+    virtual ~PicoTransport() {}
+
+    /**
+     * @brief リクエストを送信し、レスポンスを受信
+     * @param request リクエストパケット（ヘッダ + ペイロード）
+     * @param length リクエスト長
+     * @param response レスポンス格納先（ヘッダ + ペイロード）
+     * @param responseSize 格納先サイズ
+     * @return レスポンス長（タイムアウト・エラー時は0）
+     */
+    virtual size_t transact(const uint8_t* request, size_t length,
+                            uint8_t* response, size_t responseSize) = 0;
+
+    /**
+     * @brief 指定時間待つ（シミュレータでは模擬時間を進める）
+     */
+    virtual void waitMs(uint32_t ms) = 0;
+};
+
+/**
+ * @class SerialTransport
+ * @brief 実機用（POSIXシリアル + COBSフレーミング、区切りは0x00）
+ */
+class SerialTransport : public PicoTransport {
+public:
+    SerialTransport();
+    ~SerialTransport() override;
+
+    /**
+     * @brief シリアルポートを開く（raw、8N1）
+     * @return 成功時true
+     */
+    bool open(const char* port, uint32_t baudrate);
+    void close();
+
+    size_t transact(const uint8_t* request, size_t length,
+                    uint8_t* response, size_t responseSize) override;
+    void waitMs(uint32_t ms) override;
+
+    /**
+     * @brief COBSエンコード（区切りの0x00は含まない）
+     * @return エンコード後の長さ（バッファ不足時は0）
+     */
+    static size_t cobsEncode(const uint8_t* data, size_t length, uint8_t* out, size_t outSize);
+
+    /**
+     * @brief COBSデコード
+     * @return デコード後の長さ（不正なフレーム・バッファ不足時は0）
+     */
+    static size_t cobsDecode(const uint8_t* data, size_t length, uint8_t* out, size_t outSize);
+
+private:
+    int fd_;
+};
+
+/**
+ * @class PicoLink
+ * @brief リクエスト単位のクライアント
+ */
+class PicoLink {
+public:
+    explicit PicoLink(PicoTransport& transport);
+
+    bool motorCommand(float linearX, float angularZ);
+    /**
+     * @brief GET_CONFIG
+     *
+     * 左右別の項目に対応していないファームウェア（30バイト版）の場合は
+     * 右側に左と同じ値を入れ、hasPerSide=falseとする。
+     */
+    bool getConfig(Protocol::ConfigData& config);
+
+    /**
+     * @brief SET_CONFIG
+     * @param config 設定値（hasPerSideなら52バイト版、そうでなければ30バイト版で送信。
+     *               制御周波数は送らない＝変更しない）
+     * @param[out] result 結果コード（CONFIG_RESULT_*）
+     * @return レスポンスを受信できた場合true
+     */
+    bool setConfig(const Protocol::ConfigData& config, uint8_t& result);
+
+    /**
+     * @brief GET_ODOMETRY（BUSY応答の場合は数回まで再要求）
+     * @param[out] odometry 姿勢・速度
+     * @return 姿勢を受信できた場合true
+     */
+    bool getOdometry(Protocol::OdometryResponse& odometry);
+    bool resetOdometry();
+
+    void waitMs(uint32_t ms);
+
+private:
+    /**
+     * @brief リクエストを送信し、同じタイプ・期待長のレスポンスのペイロードを受け取る
+     */
+    bool request(uint8_t requestType, const uint8_t* payload, uint8_t payloadLength,
+                 uint8_t* responsePayload, uint8_t expectedLength);
+
+    /**
+     * @brief 可変長レスポンス版（minLength以上のペイロードを最大capacityまで受け取る）
+     */
+    bool request(uint8_t requestType, const uint8_t* payload, uint8_t payloadLength,
+                 uint8_t* responsePayload, uint8_t minLength, uint8_t capacity,
+                 uint8_t& receivedLength);
+
+    PicoTransport& transport_;
+};
+
+#endif // PICO_LINK_H
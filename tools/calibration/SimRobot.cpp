@@ -0,0 +1,179 @@
+/**
+ * @file SimRobot.cpp
+ * @brief ネイティブシミュレータ 実装
+ */
+
+#include "SimRobot.h"
+
+#include <algorithm>
+#include <cmath>
+#include "HardwareConfig.h"
+
+namespace {
+    constexpr double PI = 3.14159265358979323846;
+    constexpr uint32_t CONTROL_PERIOD_US = 10000;  // Core1と同じ10ms
+    constexpr double MOTOR_TIME_CONSTANT = 0.05;   // [s]
+}
+
+SimRobot::SimRobot(double wheelDiameterL, double wheelDiameterR, double trackWidth)
+    : wheelDiameterL_(wheelDiameterL)
+    , wheelDiameterR_(wheelDiameterR)
+    , trackWidth_(trackWidth)
+    , config_()
+    , kinematics_(HardwareConfig::Defaults::WHEEL_DIAMETER,
+                  HardwareConfig::Defaults::TRACK_WIDTH,
+                  HardwareConfig::Defaults::GEAR_RATIO)
+    , odometry_(HardwareConfig::Defaults::WHEEL_DIAMETER,
+                HardwareConfig::Defaults::TRACK_WIDTH,
+                HardwareConfig::Defaults::GEAR_RATIO,
+                HardwareConfig::Defaults::ENCODER_PPR)
+    , cmdLinearX_(0.0f)
+    , cmdAngularZ_(0.0f)
+    , lastCommandUs_(0)
+    , rpmL_(0.0)
+    , rpmR_(0.0)
+    , motorRevL_(0.0)
+    , motorRevR_(0.0)
+    , trueX_(0.0)
+    , trueY_(0.0)
+    , trueTheta_(0.0)
+    , nowUs_(0)
+    , pendingUs_(0)
+{
+    config_.pidKp = HardwareConfig::Defaults::PID_KP;
+    config_.pidKi = HardwareConfig::Defaults::PID_KI;
+    config_.pidKd = HardwareConfig::Defaults::PID_KD;
+    config_.maxRpm = HardwareConfig::Defaults::MAX_RPM;
+    config_.encoderPpr = HardwareConfig::Defaults::ENCODER_PPR;
+    config_.gearRatio = HardwareConfig::Defaults::GEAR_RATIO;
+    config_.wheelDiameter = HardwareConfig::Defaults::WHEEL_DIAMETER;
+    config_.trackWidth = HardwareConfig::Defaults::TRACK_WIDTH;
+    config_.pidKpR = HardwareConfig::Defaults::PID_KP_R;
+    config_.pidKiR = HardwareConfig::Defaults::PID_KI_R;
+    config_.pidKdR = HardwareConfig::Defaults::PID_KD_R;
+    config_.encoderPprR = HardwareConfig::Defaults::ENCODER_PPR_R;
+    config_.gearRatioR = HardwareConfig::Defaults::GEAR_RATIO_R;
+    config_.wheelDiameterR = HardwareConfig::Defaults::WHEEL_DIAMETER_R;
+    config_.hasPerSide = true;
+    config_.controlRateHz = HardwareConfig::CONTROL_RATE_DEFAULT_HZ;  // 模擬は10ms固定
+    config_.hasControlRate = true;
+    applyConfig();
+    odometry_.update(0, 0, 0.0f);
+}
+
+size_t SimRobot::transact(const uint8_t* request, size_t length,
+                          uint8_t* response, size_t responseSize) {
+    Protocol::ParsedRequest req;
+    if (Protocol::parseRequest(request, length, req) != Protocol::PARSE_OK) {
+        return 0;
+    }
+
+    switch (req.requestType) {
+        case Protocol::REQUEST_MOTOR_COMMAND: {
+            cmdLinearX_ = req.motorCommand.linearX;
+            cmdAngularZ_ = req.motorCommand.angularZ;
+            lastCommandUs_ = nowUs_;
+            Protocol::MotorCommandResponse resp;
+            resp.encoderCountL = static_cast<int32_t>(std::llround(motorRevL_ * config_.encoderPpr));
+            resp.encoderCountR = static_cast<int32_t>(std::llround(motorRevR_ * config_.encoderPprR));
+            resp.status = 0;
+            return Protocol::createMotorCommandResponse(resp, response, responseSize);
+        }
+        case Protocol::REQUEST_GET_CONFIG:
+            return Protocol::createConfigResponse(config_, response, responseSize);
+        case Protocol::REQUEST_SET_CONFIG: {
+            const Protocol::ConfigData& c = req.setConfig;
+            if (req.payloadLength < Protocol::CONFIG_PAYLOAD_SIZE ||
+                c.wheelDiameter <= 0.0f || c.wheelDiameterR <= 0.0f || c.trackWidth <= 0.0f ||
+                c.gearRatio <= 0.0f || c.gearRatioR <= 0.0f ||
+                c.encoderPpr == 0 || c.encoderPprR == 0) {
+                return Protocol::createSetConfigResponse(
+                    Protocol::CONFIG_RESULT_INVALID_VALUE, response, responseSize);
+            }
+            uint16_t controlRateHz = config_.controlRateHz;
+            config_ = c;
+            config_.controlRateHz = controlRateHz;
+            config_.hasControlRate = true;
+            applyConfig();
+            return Protocol::createSetConfigResponse(
+                Protocol::CONFIG_RESULT_SUCCESS, response, responseSize);
+        }
+        case Protocol::REQUEST_GET_ODOMETRY: {
+            Protocol::OdometryResponse resp;
+            resp.x = odometry_.getX();
+            resp.y = odometry_.getY();
+            resp.theta = odometry_.getTheta();
+            resp.linearX = odometry_.getLinearX();
+            resp.angularZ = odometry_.getAngularZ();
+            resp.timestampUs = static_cast<uint32_t>(nowUs_);
+            return Protocol::createOdometryResponse(resp, response, responseSize);
+        }
+        case Protocol::REQUEST_RESET_ODOMETRY:
+            odometry_.reset(req.resetOdometry.x, req.resetOdometry.y, req.resetOdometry.theta);
+            return Protocol::createResetOdometryResponse(0x00, response, responseSize);
+        default:
+            // キャリブレーションで使わないリクエストは応答しない
+            return 0;
+    }
+}
+
+void SimRobot::waitMs(uint32_t ms) {
+    pendingUs_ += ms * 1000;
+    while (pendingUs_ >= CONTROL_PERIOD_US) {
+        pendingUs_ -= CONTROL_PERIOD_US;
+        nowUs_ += CONTROL_PERIOD_US;
+        step(CONTROL_PERIOD_US * 1e-6);
+    }
+}
+
+void SimRobot::step(double dt) {
+    // フェイルセーフ
+    if (nowUs_ - lastCommandUs_ > HardwareConfig::FAILSAFE_TIMEOUT_MS * 1000ULL) {
+        cmdLinearX_ = 0.0f;
+        cmdAngularZ_ = 0.0f;
+    }
+
+    // 設定値のジオメトリで目標RPMを計算（比率を保ったまま起動時のmaxRpmで制限）
+    const float maxRpm = HardwareConfig::Defaults::MAX_RPM;
+    float targetL;
+    float targetR;
+    kinematics_.calculate(cmdLinearX_, cmdAngularZ_, targetL, targetR);
+    float peak = std::max(std::fabs(targetL), std::fabs(targetR));
+    if (peak > maxRpm && peak > 0.0f) {
+        float scale = maxRpm / peak;
+        targetL *= scale;
+        targetR *= scale;
+    }
+
+    // モータは一次遅れで追従
+    double alpha = 1.0 - std::exp(-dt / MOTOR_TIME_CONSTANT);
+    rpmL_ += (targetL - rpmL_) * alpha;
+    rpmR_ += (targetR - rpmR_) * alpha;
+    double deltaRevL = rpmL_ / 60.0 * dt;
+    double deltaRevR = rpmR_ / 60.0 * dt;
+    motorRevL_ += deltaRevL;
+    motorRevR_ += deltaRevR;
+
+    // 真のジオメトリで移動（円弧）
+    double distanceL = deltaRevL / config_.gearRatio * PI * wheelDiameterL_;
+    double distanceR = deltaRevR / config_.gearRatioR * PI * wheelDiameterR_;
+    double distance = (distanceL + distanceR) * 0.5;
+    double deltaTheta = (distanceR - distanceL) / trackWidth_;
+    double midTheta = trueTheta_ + deltaTheta * 0.5;
+    trueX_ += distance * std::cos(midTheta);
+    trueY_ += distance * std::sin(midTheta);
+    trueTheta_ += deltaTheta;
+
+    // ファームウェアと同じくエンコーダカウントからオドメトリを積算
+    odometry_.update(static_cast<int32_t>(std::llround(motorRevL_ * config_.encoderPpr)),
+                     static_cast<int32_t>(std::llround(motorRevR_ * config_.encoderPprR)),
+                     static_cast<float>(dt));
+}
+
+void SimRobot::applyConfig() {
+    kinematics_.setGeometry(config_.wheelDiameter, config_.wheelDiameterR, config_.trackWidth,
+                            config_.gearRatio, config_.gearRatioR);
+    odometry_.setGeometry(config_.wheelDiameter, config_.wheelDiameterR, config_.trackWidth,
+                          config_.gearRatio, config_.gearRatioR,
+                          config_.encoderPpr, config_.encoderPprR);
+}
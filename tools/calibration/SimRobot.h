@@ -0,0 +1,81 @@
+/**
+ * @file SimRobot.h
+ * @brief ネイティブシミュレータ（ホスト上で動く差動二輪ロボットのモデル）
+ *
+ * ファームウェアと同じ Protocol のパース・レスポンス作成と Odometry の積算を使い、
+ * オドメトリは設定値（GET_CONFIG/SET_CONFIG）のジオメトリで、
+ * 実際の移動は「真の」ジオメトリ（左右直径・トレッド幅）で計算する。
+ * キャリブレーションツールを実機なしで検証するためのもの。
+ *
+ * - 制御周期は Core1 と同じ10ms、モータは一次遅れ（時定数50ms）でRPM指令に追従
+ * - 時間は waitMs() でのみ進む（通信自体は時間を消費しない）
+ * - 通信途絶時のフェイルセーフ（FAILSAFE_TIMEOUT_MS）も模擬する
+ * - SET_CONFIG のジオメトリはファームウェア（Core1が次の制御周期で適用）と同じく
+ *   オドメトリ・キネマティクスへ反映する。max_rpmはファームウェアと同じく起動時の値のまま
+ */
+
+#ifndef SIM_ROBOT_H
+#define SIM_ROBOT_H
+
+#include <stdint.h>
+#include "DifferentialKinematics.h"
+#include "Odometry.h"
+#include "PicoLink.h"
+#include "Protocol.h"
+
+/**
+ * @class SimRobot
+ * @brief プロトコル互換のシミュレータ
+ */
+class SimRobot : public PicoTransport {
+public:
+    /**
+     * @brief コンストラクタ（設定値はファームウェアのデフォルト）
+     * @param wheelDiameterL 左ホイールの真の直径 [m]
+     * @param wheelDiameterR 右ホイールの真の直径 [m]
+     * @param trackWidth 真の（実効）トレッド幅 [m]
+     */
+    SimRobot(double wheelDiameterL, double wheelDiameterR, double trackWidth);
+
+    size_t transact(const uint8_t* request, size_t length,
+                    uint8_t* response, size_t responseSize) override;
+    void waitMs(uint32_t ms) override;
+
+    // --- 真の姿勢（外部計測の代わり、起動時の位置が原点）---
+    double getTrueX() const { return trueX_; }
+    double getTrueY() const { return trueY_; }
+    double getTrueTheta() const { return trueTheta_; }
+
+private:
+    void step(double dt);
+    void applyConfig();
+
+    // 真のジオメトリ
+    double wheelDiameterL_;
+    double wheelDiameterR_;
+    double trackWidth_;
+
+    // ファームウェア側の設定とオドメトリ
+    Protocol::ConfigData config_;
+    DifferentialKinematics kinematics_;
+    Odometry odometry_;
+
+    // 指令とモータ状態
+    float cmdLinearX_;
+    float cmdAngularZ_;
+    uint64_t lastCommandUs_;
+    double rpmL_;
+    double rpmR_;
+    double motorRevL_;
+    double motorRevR_;
+
+    // 真の姿勢
+    double trueX_;
+    double trueY_;
+    double trueTheta_;
+
+    uint64_t nowUs_;
+    uint32_t pendingUs_;
+};
+
+#endif // SIM_ROBOT_H
@@ -0,0 +1,529 @@
+/**
+ * @file umbmark_calibration.cpp
+ * @brief 実効ホイール直径（左右）・トレッド幅のキャリブレーションツール（UMBmark）
+ *
+ * 直進走行と、一辺Lの正方形のCW/CCW走行をプロトコル経由で自動実行し、
+ * 終点の実測値から左右の実効ホイール直径とトレッド幅を推定する。
+ * 走行はオドメトリ（GET_ODOMETRY）で閉ループ制御し、終点の実測は
+ * 実機ではキーボード入力、シミュレータでは真の姿勢を使う。
+ * 計測結果はログに保存でき、ログから推定だけをやり直すこともできる。
+ *
+ * ビルド（リポジトリルートで）:
+ * @code
+ * g++ -O2 -std=c++17 -Ilib/Protocol -Ilib/Odometry -Ilib/DifferentialKinematics \
+ *     -Ilib/HardwareConfig -Ilib/UmbmarkCalibration -Itools/calibration \
+ *     tools/calibration/umbmark_calibration.cpp tools/calibration/PicoLink.cpp \
+ *     tools/calibration/SimRobot.cpp lib/Protocol/Protocol.cpp lib/Odometry/Odometry.cpp \
+ *     lib/DifferentialKinematics/DifferentialKinematics.cpp \
+ *     lib/UmbmarkCalibration/UmbmarkCalibration.cpp -o umbmark_calibration
+ * @endcode
+ *
+ * 使用例:
+ * @code
+ * ./umbmark_calibration --sim --apply                       # シミュレータで推定→反映→再計測
+ * ./umbmark_calibration --port /dev/ttyACM0 --side 2.0 --runs 5 --save-log umbmark.txt
+ * ./umbmark_calibration --log umbmark.txt --port /dev/ttyACM0 --apply
+ * @endcode
+ *
+ * 座標は各走行の開始姿勢を原点とし、x=前方、y=左方 [m]。
+ *
+ * 左右別の設定（52バイトのSET_CONFIG）に対応したファームウェアでは、左右の直径と
+ * トレッド幅を反映する。非対応（30バイト）の場合は左右平均の直径とトレッド幅のみ
+ * 反映し、左右の直径比は推定結果として表示する。
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "HardwareConfig.h"
+#include "PicoLink.h"
+#include "SimRobot.h"
+#include "UmbmarkCalibration.h"
+
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+constexpr uint32_t CONTROL_PERIOD_MS = 10;
+constexpr uint32_t SETTLE_MS = 500;        // 停止後の静定待ち
+constexpr double DISTANCE_TOLERANCE = 0.0005;  // [m]
+constexpr double ANGLE_TOLERANCE = 0.001;      // [rad]
+constexpr double APPROACH_GAIN = 2.0;          // 残り量に対する速度ゲイン [1/s]
+constexpr double MIN_LINEAR_SPEED = 0.02;      // [m/s]
+constexpr double MIN_ANGULAR_SPEED = 0.05;     // [rad/s]
+
+struct Options {
+    bool sim = false;
+    const char* port = nullptr;
+    uint32_t baudrate = 115200;
+    const char* logPath = nullptr;
+    const char* saveLogPath = nullptr;
+    double sideLength = 2.0;
+    int runs = 0;  // 0: シミュレータ1回、実機5回
+    double linearSpeed = 0.2;
+    double angularSpeed = 0.5;
+    bool apply = false;
+    double wheelDiameter = HardwareConfig::Defaults::WHEEL_DIAMETER;
+    double trackWidth = HardwareConfig::Defaults::TRACK_WIDTH;
+    // シミュレータの真のジオメトリ（クローラを想定して実効トレッドを広めに）
+    double simDiameterL = 0.0995;
+    double simDiameterR = 0.1005;
+    double simTrackWidth = 0.36;
+};
+
+/**
+ * 終点の実測（シミュレータは真の姿勢、実機はキーボード入力）
+ */
+class Measurement {
+public:
+    explicit Measurement(const SimRobot* sim) : sim_(sim), x0_(0.0), y0_(0.0), theta0_(0.0) {}
+
+    // 走行開始時の姿勢を記録
+    void begin() {
+        if (sim_ != nullptr) {
+            x0_ = sim_->getTrueX();
+            y0_ = sim_->getTrueY();
+            theta0_ = sim_->getTrueTheta();
+        }
+    }
+
+    // 開始姿勢から見た終点 [m]
+    bool endPoint(double& x, double& y) {
+        if (sim_ != nullptr) {
+            double dx = sim_->getTrueX() - x0_;
+            double dy = sim_->getTrueY() - y0_;
+            x = dx * std::cos(theta0_) + dy * std::sin(theta0_);
+            y = -dx * std::sin(theta0_) + dy * std::cos(theta0_);
+            return true;
+        }
+        printf("  終点の実測値を入力 (x y) [m]: ");
+        fflush(stdout);
+        return scanf("%lf %lf", &x, &y) == 2;
+    }
+
+    bool distance(double& d) {
+        if (sim_ != nullptr) {
+            double x;
+            double y;
+            endPoint(x, y);
+            d = std::hypot(x, y);
+            return true;
+        }
+        printf("  実測の走行距離を入力 [m]: ");
+        fflush(stdout);
+        return scanf("%lf", &d) == 1;
+    }
+
+private:
+    const SimRobot* sim_;
+    double x0_;
+    double y0_;
+    double theta0_;
+};
+
+double normalizeAngle(double angle) {
+    while (angle > PI) angle -= 2.0 * PI;
+    while (angle < -PI) angle += 2.0 * PI;
+    return angle;
+}
+
+double clampMagnitude(double value, double minMagnitude, double maxMagnitude) {
+    double magnitude = std::fmin(maxMagnitude, std::fmax(minMagnitude, std::fabs(value)));
+    return std::copysign(magnitude, value);
+}
+
+/**
+ * 停止指令を送りながら静定を待つ（フェイルセーフに入らないよう送り続ける）
+ */
+bool stopAndSettle(PicoLink& link) {
+    for (uint32_t t = 0; t < SETTLE_MS; t += CONTROL_PERIOD_MS) {
+        if (!link.motorCommand(0.0f, 0.0f)) {
+            return false;
+        }
+        link.waitMs(CONTROL_PERIOD_MS);
+    }
+    return true;
+}
+
+/**
+ * 現在の向きのまま、オドメトリ上で distance [m] 進む
+ */
+bool driveDistance(PicoLink& link, double distance, double speed) {
+    Protocol::OdometryResponse start;
+    if (!link.getOdometry(start)) {
+        return false;
+    }
+    const double c = std::cos(start.theta);
+    const double s = std::sin(start.theta);
+    const uint32_t timeoutMs = static_cast<uint32_t>(distance / MIN_LINEAR_SPEED * 1000.0) + 5000;
+
+    for (uint32_t t = 0; t < timeoutMs; t += CONTROL_PERIOD_MS) {
+        Protocol::OdometryResponse odom;
+        if (!link.getOdometry(odom)) {
+            return false;
+        }
+        double traveled = (odom.x - start.x) * c + (odom.y - start.y) * s;
+        double remaining = distance - traveled;
+        if (remaining <= DISTANCE_TOLERANCE) {
+            return stopAndSettle(link);
+        }
+        double v = clampMagnitude(remaining * APPROACH_GAIN, MIN_LINEAR_SPEED, speed);
+        if (!link.motorCommand(static_cast<float>(v), 0.0f)) {
+            return false;
+        }
+        link.waitMs(CONTROL_PERIOD_MS);
+    }
+    stopAndSettle(link);
+    return false;
+}
+
+/**
+ * オドメトリ上の方位 targetTheta [rad] までその場旋回
+ */
+bool turnTo(PicoLink& link, double targetTheta, double speed) {
+    const uint32_t timeoutMs = static_cast<uint32_t>(PI / MIN_ANGULAR_SPEED * 1000.0) + 5000;
+
+    for (uint32_t t = 0; t < timeoutMs; t += CONTROL_PERIOD_MS) {
+        Protocol::OdometryResponse odom;
+        if (!link.getOdometry(odom)) {
+            return false;
+        }
+        double remaining = normalizeAngle(targetTheta - odom.theta);
+        if (std::fabs(remaining) <= ANGLE_TOLERANCE) {
+            return stopAndSettle(link);
+        }
+        double w = clampMagnitude(remaining * APPROACH_GAIN, MIN_ANGULAR_SPEED, speed);
+        if (!link.motorCommand(0.0f, static_cast<float>(w))) {
+            return false;
+        }
+        link.waitMs(CONTROL_PERIOD_MS);
+    }
+    stopAndSettle(link);
+    return false;
+}
+
+/**
+ * 直進走行1回
+ */
+bool runStraight(PicoLink& link, Measurement& measurement, const Options& opt,
+                 UmbmarkCalibration& calib, FILE* log) {
+    if (!link.resetOdometry()) {
+        return false;
+    }
+    measurement.begin();
+    if (!driveDistance(link, opt.sideLength, opt.linearSpeed)) {
+        return false;
+    }
+    Protocol::OdometryResponse odom;
+    double measured;
+    if (!link.getOdometry(odom) || !measurement.distance(measured)) {
+        return false;
+    }
+    double odomDistance = std::hypot(odom.x, odom.y);
+    calib.addStraightRun(odomDistance, measured);
+    printf("  straight: odom %.4f m, measured %.4f m\n", odomDistance, measured);
+    if (log != nullptr) {
+        fprintf(log, "straight %.6f %.6f\n", odomDistance, measured);
+    }
+    return true;
+}
+
+/**
+ * 正方形走行1回（旋回の目標方位は開始方位からの絶対値で与え、誤差を累積させない）
+ */
+bool runSquare(PicoLink& link, Measurement& measurement, const Options& opt,
+               UmbmarkCalibration::Direction direction, double& errorX, double& errorY,
+               UmbmarkCalibration* calib, FILE* log) {
+    if (!link.resetOdometry()) {
+        return false;
+    }
+    measurement.begin();
+    const double turnSign = (direction == UmbmarkCalibration::CCW) ? 1.0 : -1.0;
+    for (int leg = 0; leg < 4; leg++) {
+        if (!driveDistance(link, opt.sideLength, opt.linearSpeed) ||
+            !turnTo(link, normalizeAngle(turnSign * (leg + 1) * PI * 0.5), opt.angularSpeed)) {
+            return false;
+        }
+    }
+
+    Protocol::OdometryResponse odom;
+    double x;
+    double y;
+    if (!link.getOdometry(odom) || !measurement.endPoint(x, y)) {
+        return false;
+    }
+    errorX = x - odom.x;
+    errorY = y - odom.y;
+    const char* name = (direction == UmbmarkCalibration::CW) ? "cw" : "ccw";
+    printf("  %-3s: odom (%+.4f, %+.4f)  measured (%+.4f, %+.4f)  error %.4f m\n",
+           name, odom.x, odom.y, x, y, std::hypot(errorX, errorY));
+    if (calib != nullptr) {
+        calib->addSquareRun(direction, odom.x, odom.y, x, y);
+    }
+    if (log != nullptr) {
+        fprintf(log, "%s %.6f %.6f %.6f %.6f\n", name, odom.x, odom.y, x, y);
+    }
+    return true;
+}
+
+/**
+ * 計測ログを読み込む（1行1走行、#以降はコメント）
+ *   straight <odom_distance> <measured_distance>
+ *   cw|ccw <odom_x> <odom_y> <measured_x> <measured_y>
+ */
+bool loadLog(const char* path, UmbmarkCalibration& calib) {
+    FILE* fp = fopen(path, "r");
+    if (fp == nullptr) {
+        fprintf(stderr, "ログを開けません: %s\n", path);
+        return false;
+    }
+    char line[256];
+    int lineNumber = 0;
+    bool ok = true;
+    while (fgets(line, sizeof(line), fp) != nullptr) {
+        lineNumber++;
+        char* comment = strchr(line, '#');
+        if (comment != nullptr) {
+            *comment = '\0';
+        }
+        char kind[16];
+        double v[4];
+        int n = sscanf(line, "%15s %lf %lf %lf %lf", kind, &v[0], &v[1], &v[2], &v[3]);
+        if (n <= 0) {
+            continue;
+        }
+        if (strcmp(kind, "straight") == 0 && n == 3) {
+            calib.addStraightRun(v[0], v[1]);
+        } else if (strcmp(kind, "cw") == 0 && n == 5) {
+            calib.addSquareRun(UmbmarkCalibration::CW, v[0], v[1], v[2], v[3]);
+        } else if (strcmp(kind, "ccw") == 0 && n == 5) {
+            calib.addSquareRun(UmbmarkCalibration::CCW, v[0], v[1], v[2], v[3]);
+        } else {
+            fprintf(stderr, "%s:%d: 不正な行\n", path, lineNumber);
+            ok = false;
+        }
+    }
+    fclose(fp);
+    return ok;
+}
+
+void printUsage(const char* argv0) {
+    printf("使用方法: %s (--sim | --port <device>) [オプション]\n"
+           "       %s --log <file> [--sim | --port <device>] [オプション]\n"
+           "\n"
+           "  --sim                 ネイティブシミュレータに接続\n"
+           "  --port <device>       シリアルポート（例: /dev/ttyACM0）\n"
+           "  --baud <rate>         ボーレート（デフォルト: 115200）\n"
+           "  --log <file>          走行せずに計測ログから推定\n"
+           "  --save-log <file>     計測結果をログに保存\n"
+           "  --side <m>            正方形の一辺・直進距離（デフォルト: 2.0）\n"
+           "  --runs <n>            方向ごとの走行回数（デフォルト: シミュレータ1、実機5）\n"
+           "  --speed <m/s>         並進速度（デフォルト: 0.2）\n"
+           "  --turn-speed <rad/s>  旋回速度（デフォルト: 0.5）\n"
+           "  --apply               推定結果をSET_CONFIGで反映\n"
+           "  --wheel-diameter <m>  接続なしで --log を使う場合の設定値\n"
+           "  --track-width <m>     接続なしで --log を使う場合の設定値\n"
+           "  --sim-geometry <dL> <dR> <track>  シミュレータの真のジオメトリ [m]\n",
+           argv0, argv0);
+}
+
+bool parseOptions(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto next = [&](void) -> const char* {
+            return (i + 1 < argc) ? argv[++i] : nullptr;
+        };
+        const char* value = nullptr;
+        if (arg == "--sim") {
+            opt.sim = true;
+        } else if (arg == "--apply") {
+            opt.apply = true;
+        } else if (arg == "--sim-geometry") {
+            if (i + 3 >= argc) return false;
+            opt.simDiameterL = atof(argv[++i]);
+            opt.simDiameterR = atof(argv[++i]);
+            opt.simTrackWidth = atof(argv[++i]);
+        } else if ((value = next()) == nullptr) {
+            return false;
+        } else if (arg == "--port") {
+            opt.port = value;
+        } else if (arg == "--baud") {
+            opt.baudrate = static_cast<uint32_t>(atol(value));
+        } else if (arg == "--log") {
+            opt.logPath = value;
+        } else if (arg == "--save-log") {
+            opt.saveLogPath = value;
+        } else if (arg == "--side") {
+            opt.sideLength = atof(value);
+        } else if (arg == "--runs") {
+            opt.runs = atoi(value);
+        } else if (arg == "--speed") {
+            opt.linearSpeed = atof(value);
+        } else if (arg == "--turn-speed") {
+            opt.angularSpeed = atof(value);
+        } else if (arg == "--wheel-diameter") {
+            opt.wheelDiameter = atof(value);
+        } else if (arg == "--track-width") {
+            opt.trackWidth = atof(value);
+        } else {
+            return false;
+        }
+    }
+    if (opt.sim && opt.port != nullptr) {
+        return false;
+    }
+    if (!opt.sim && opt.port == nullptr && opt.logPath == nullptr) {
+        return false;
+    }
+    return opt.sideLength > 0.0 && opt.linearSpeed > 0.0 && opt.angularSpeed > 0.0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseOptions(argc, argv, opt)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    const bool connected = opt.sim || opt.port != nullptr;
+    const int runs = (opt.runs > 0) ? opt.runs : (opt.sim ? 1 : 5);
+
+    SimRobot sim(opt.simDiameterL, opt.simDiameterR, opt.simTrackWidth);
+    SerialTransport serial;
+    PicoTransport* transport = &sim;
+    if (opt.port != nullptr) {
+        if (!serial.open(opt.port, opt.baudrate)) {
+            fprintf(stderr, "シリアルポートを開けません: %s\n", opt.port);
+            return 1;
+        }
+        transport = &serial;
+    }
+    PicoLink link(*transport);
+    Measurement measurement(opt.sim ? &sim : nullptr);
+
+    // 走行時にオドメトリが使う設定値
+    Protocol::ConfigData config;
+    if (connected) {
+        if (!link.getConfig(config)) {
+            fprintf(stderr, "GET_CONFIGに失敗\n");
+            return 1;
+        }
+        // 左右で設定値が異なる場合は平均を基準にし、反映時に左右の設定値へ比率を掛ける
+        opt.wheelDiameter = (config.wheelDiameter + config.wheelDiameterR) * 0.5;
+        opt.trackWidth = config.trackWidth;
+    }
+    printf("設定値: wheelDiameter=%.5f m, trackWidth=%.5f m, side=%.3f m\n",
+           opt.wheelDiameter, opt.trackWidth, opt.sideLength);
+
+    UmbmarkCalibration calib(opt.wheelDiameter, opt.trackWidth, opt.sideLength);
+    double errorX;
+    double errorY;
+    double errorBefore[2] = {0.0, 0.0};
+
+    if (opt.logPath != nullptr) {
+        if (!loadLog(opt.logPath, calib)) {
+            return 1;
+        }
+    } else {
+        FILE* log = nullptr;
+        if (opt.saveLogPath != nullptr) {
+            log = fopen(opt.saveLogPath, "w");
+            if (log == nullptr) {
+                fprintf(stderr, "ログを作成できません: %s\n", opt.saveLogPath);
+                return 1;
+            }
+            fprintf(log, "# UMBmark wheelDiameter=%.6f trackWidth=%.6f side=%.6f\n",
+                    opt.wheelDiameter, opt.trackWidth, opt.sideLength);
+        }
+        printf("直進走行 × %d\n", runs);
+        for (int i = 0; i < runs; i++) {
+            if (!runStraight(link, measurement, opt, calib, log)) {
+                fprintf(stderr, "直進走行に失敗\n");
+                return 1;
+            }
+        }
+        printf("正方形走行 CW/CCW × %d\n", runs);
+        for (int i = 0; i < runs; i++) {
+            for (int d = 0; d < 2; d++) {
+                auto direction = static_cast<UmbmarkCalibration::Direction>(d);
+                if (!runSquare(link, measurement, opt, direction, errorX, errorY, &calib, log)) {
+                    fprintf(stderr, "正方形走行に失敗\n");
+                    return 1;
+                }
+                errorBefore[d] += std::hypot(errorX, errorY) / runs;
+            }
+        }
+        if (log != nullptr) {
+            fclose(log);
+        }
+    }
+
+    UmbmarkCalibration::Geometry result;
+    if (!calib.solve(result)) {
+        fprintf(stderr, "推定できません（CW/CCW両方の走行結果が必要）\n");
+        return 1;
+    }
+    double meanDiameter = (result.wheelDiameterL + result.wheelDiameterR) * 0.5;
+    printf("\n推定結果:\n");
+    printf("  wheelDiameterL = %.5f m\n", result.wheelDiameterL);
+    printf("  wheelDiameterR = %.5f m  (R/L = %.5f)\n",
+           result.wheelDiameterR, result.wheelDiameterR / result.wheelDiameterL);
+    printf("  wheelDiameter  = %.5f m  (左右平均、設定値の %.4f 倍)\n",
+           meanDiameter, meanDiameter / opt.wheelDiameter);
+    printf("  trackWidth     = %.5f m  (設定値の %.4f 倍)\n",
+           result.trackWidth, result.trackWidth / opt.trackWidth);
+    if (opt.sim) {
+        printf("  (シミュレータの真値: %.5f / %.5f / %.5f m)\n",
+               opt.simDiameterL, opt.simDiameterR, opt.simTrackWidth);
+    }
+
+    if (!opt.apply) {
+        return 0;
+    }
+    if (!connected) {
+        fprintf(stderr, "--apply には --sim または --port が必要\n");
+        return 1;
+    }
+
+    if (config.hasPerSide) {
+        // 左右別の直径とトレッド幅を反映（推定値は基準直径に対する比率として左右の設定値に掛ける）
+        config.wheelDiameter = static_cast<float>(
+            config.wheelDiameter * result.wheelDiameterL / opt.wheelDiameter);
+        config.wheelDiameterR = static_cast<float>(
+            config.wheelDiameterR * result.wheelDiameterR / opt.wheelDiameter);
+    } else {
+        // 左右共通の直径のみ持つファームウェアでは、平均直径とトレッド幅を反映
+        config.wheelDiameter = static_cast<float>(meanDiameter);
+        config.wheelDiameterR = config.wheelDiameter;
+    }
+    config.trackWidth = static_cast<float>(result.trackWidth);
+    uint8_t setResult = 0xFF;
+    if (!link.setConfig(config, setResult) || setResult != Protocol::CONFIG_RESULT_SUCCESS) {
+        fprintf(stderr, "SET_CONFIGに失敗 (result=0x%02X)\n", setResult);
+        return 1;
+    }
+    printf("\nSET_CONFIGで反映: wheelDiameterL=%.5f m, wheelDiameterR=%.5f m, trackWidth=%.5f m\n",
+           config.wheelDiameter, config.wheelDiameterR, config.trackWidth);
+    if (!opt.sim) {
+        // ファームウェアはFlash保存が未実装のため、反映は電源を切るまで
+        printf("注意: 設定はFlashに保存されない（再起動でHardwareConfig::Defaultsに戻る）。\n"
+               "      恒久的に使う場合はHardwareConfig.hのDefaultsを上の値に更新すること\n");
+    }
+
+    // シミュレータでは反映後にもう一度走行して終点誤差を比較
+    if (opt.sim && opt.logPath == nullptr) {
+        printf("反映後の正方形走行:\n");
+        for (int d = 0; d < 2; d++) {
+            auto direction = static_cast<UmbmarkCalibration::Direction>(d);
+            if (!runSquare(link, measurement, opt, direction, errorX, errorY, nullptr, nullptr)) {
+                fprintf(stderr, "正方形走行に失敗\n");
+                return 1;
+            }
+            printf("    終点誤差 %.4f m → %.4f m\n", errorBefore[d], std::hypot(errorX, errorY));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+"""
+SRAM配置関数のサイズレポート
+
+RAM_FUNC（lib/RamFunc/RamFunc.h）で.time_criticalセクションに置いた関数を
+SRAMのアドレス範囲から拾い、関数ごとのサイズと合計を表示する。
+SRAMに置いた分だけ、スタック・ヒープに使える領域が減る。
+
+使用方法:
+    python tools/ram_report.py .pio/build/pico/firmware.elf
+    （platformio.iniのextra_scriptsから、ビルド後にも自動で表示される）
+
+依存ツール:
+    arm-none-eabi-nm, arm-none-eabi-size（PlatformIOのツールチェーンに同梱）
+"""
+
+import subprocess
+import sys
+
+# RP2040のSRAM（264KB）
+SRAM_START = 0x20000000
+SRAM_END = 0x20042000
+
+
+def ram_functions(nm, elf):
+    """SRAM上の関数を (サイズ, 名前) のリストで返す（大きい順）"""
+    output = subprocess.run([nm, '--print-size', '--demangle', elf],
+                            capture_output=True, text=True, check=True).stdout
+    functions = []
+    for line in output.splitlines():
+        fields = line.split(None, 3)
+        if len(fields) < 4:
+            continue
+        address, size, kind, name = fields
+        if kind not in 'tTwW':
+            continue
+        if SRAM_START <= int(address, 16) < SRAM_END:
+            functions.append((int(size, 16), name))
+    return sorted(functions, reverse=True)
+
+
+def report(tool_prefix, elf):
+    """SRAM関数の一覧とRAM全体の使用量を表示"""
+    functions = ram_functions(tool_prefix + 'nm', elf)
+    total = sum(size for size, _ in functions)
+
+    print(f"\n=== SRAM functions (.time_critical): {len(functions)}, {total} bytes ===")
+    for size, name in functions:
+        print(f"  {size:6d}  {name}")
+
+    sections = subprocess.run([tool_prefix + 'size', '-A', elf],
+                              capture_output=True, text=True, check=True).stdout
+    print("\n=== RAM sections ===")
+    for line in sections.splitlines():
+        fields = line.split()
+        if len(fields) == 3 and fields[0] in ('.data', '.bss', '.heap', '.stack_dummy',
+                                              '.stack1_dummy', '.scratch_x', '.scratch_y'):
+            print(f"  {fields[0]:16s} {int(fields[1]):8d} bytes")
+    return total
+
+
+def main(args):
+    if len(args) < 1:
+        print("Usage: python tools/ram_report.py <firmware.elf>")
+        return 1
+    report('arm-none-eabi-', args[0])
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
+elif 'Import' in globals():
+    # PlatformIOのextra_scripts（post）として読み込まれた場合: ビルド後に表示
+    Import('env')  # noqa: F821
+
+    def _report_after_build(source, target, env):
+        cc = env.subst('$CC')
+        prefix = cc[:-len('gcc')] if cc.endswith('gcc') else 'arm-none-eabi-'
+        report(prefix, str(target[0]))
+
+    env.AddPostAction('$BUILD_DIR/${PROGNAME}.elf', _report_after_build)  # noqa: F821
@@ -24,6 +24,14 @@ class PicoProtocol:
     REQUEST_GET_CONFIG = 0x03
     REQUEST_SET_CONFIG = 0x04
     REQUEST_GET_DEBUG_OUTPUT = 0x05
+    REQUEST_GET_ODOMETRY = 0x06
+    REQUEST_RESET_ODOMETRY = 0x07
+    REQUEST_MOTOR_POSITION = 0x08
+    REQUEST_TRAJECTORY_UPLOAD = 0x09
+    REQUEST_TRAJECTORY_START = 0x0A
+    REQUEST_TRAJECTORY_ABORT = 0x0B
+    REQUEST_GET_TRAJECTORY_STATUS = 0x0C
+    REQUEST_GET_TIMING = 0x0D
 
     def __init__(self, port, baudrate=115200):
         self.ser = serial.Serial(port, baudrate, timeout=1.0)
@@ -84,15 +92,20 @@ class PicoProtocol:
         response = self._receive_response()
         if response and len(response) >= 16:
             resp_type, payload_len, checksum = struct.unpack('<BBH', response[:4])
-            status, error_code, _, comm_err, _, _, uptime = struct.unpack(
-                '<HBBHHHI', response[4:16])
-            return {
+            status, error_code, reset_reason, comm_err, watchdog_resets, uptime = struct.unpack(
+                '<HBBHHI', response[4:16])
+            result = {
                 'response_type': resp_type,
                 'status': status,
                 'error_code': error_code,
+                'reset_reason': reset_reason,
                 'comm_error_count': comm_err,
+                'watchdog_reset_count': watchdog_resets,
                 'uptime_ms': uptime
             }
+            if len(response) >= 20:
+                result['first_tick_us'] = struct.unpack('<I', response[16:20])[0]
+            return result
         return None
 
     def get_config(self):
@@ -104,7 +117,7 @@ class PicoProtocol:
             kp, ki, kd, max_rpm = struct.unpack('<ffff', response[4:20])
             ppr, = struct.unpack('<H', response[20:22])
             gear, wheel_d, track_w = struct.unpack('<fff', response[22:34])
-            return {
+            config = {
                 'response_type': resp_type,
                 'pid_kp': kp,
                 'pid_ki': ki,
@@ -115,11 +128,34 @@ class PicoProtocol:
                 'wheel_diameter': wheel_d,
                 'track_width': track_w
             }
+            # 左右別の設定（56バイト版）
+            if len(response) >= 56:
+                kp_r, ki_r, kd_r = struct.unpack('<fff', response[34:46])
+                ppr_r, = struct.unpack('<H', response[46:48])
+                gear_r, wheel_d_r = struct.unpack('<ff', response[48:56])
+                config.update({
+                    'pid_kp_r': kp_r,
+                    'pid_ki_r': ki_r,
+                    'pid_kd_r': kd_r,
+                    'encoder_ppr_r': ppr_r,
+                    'gear_ratio_r': gear_r,
+                    'wheel_diameter_r': wheel_d_r
+                })
+            # 制御周波数（58バイト版）
+            if len(response) >= 58:
+                rate, = struct.unpack('<H', response[56:58])
+                config['control_rate_hz'] = rate
+            return config
         return None
 
-    def motor_command(self, linear_x, angular_z):
-        """MOTOR_COMMAND: 速度指令送信"""
-        payload = struct.pack('<ff', linear_x, angular_z)
+    def motor_command(self, linear_x, angular_z, timestamp_us=None, validity_ms=None):
+        """MOTOR_COMMAND: 速度指令送信（timestamp_us指定時はタイムスタンプ付き、validity_ms指定時は有効期間付き）"""
+        if timestamp_us is None:
+            payload = struct.pack('<ff', linear_x, angular_z)
+        else:
+            payload = struct.pack('<ffI', linear_x, angular_z, timestamp_us & 0xFFFFFFFF)
+        if validity_ms is not None:
+            payload += struct.pack('<H', validity_ms)
         self._send_request(self.REQUEST_MOTOR_COMMAND, payload)
         response = self._receive_response()
         if response and len(response) >= 14:
@@ -142,7 +178,7 @@ class PicoProtocol:
             enc_l, enc_r = struct.unpack('<ii', response[4:12])
             target_l, target_r, current_l, current_r = struct.unpack('<ffff', response[12:28])
             pwm_l, pwm_r = struct.unpack('<ff', response[28:36])
-            return {
+            result = {
                 'response_type': resp_type,
                 'encoder_l': enc_l,
                 'encoder_r': enc_r,
@@ -153,6 +189,148 @@ class PicoProtocol:
                 'pwm_l': pwm_l,
                 'pwm_r': pwm_r
             }
+            # 電流テレメトリ（新ファームウェアのみ）
+            if len(response) >= 52:
+                rms_l, rms_r, peak_l, peak_r = struct.unpack('<ffff', response[36:52])
+                result.update({
+                    'current_rms_l': rms_l,
+                    'current_rms_r': rms_r,
+                    'current_peak_l': peak_l,
+                    'current_peak_r': peak_r
+                })
+            return result
+        return None
+
+    def get_odometry(self):
+        """GET_ODOMETRY: オドメトリ取得"""
+        self._send_request(self.REQUEST_GET_ODOMETRY)
+        response = self._receive_response()
+        if response and len(response) == 5:
+            return {'busy': response[4] == 0x01}  # 姿勢を読み出せなかった（再要求する）
+        if response and len(response) >= 28:
+            resp_type, payload_len, checksum = struct.unpack('<BBH', response[:4])
+            x, y, theta, linear_x, angular_z, timestamp_us = struct.unpack('<fffffI', response[4:28])
+            return {
+                'response_type': resp_type,
+                'x': x,
+                'y': y,
+                'theta': theta,
+                'linear_x': linear_x,
+                'angular_z': angular_z,
+                'timestamp_us': timestamp_us
+            }
+        return None
+
+    def reset_odometry(self, x=0.0, y=0.0, theta=0.0):
+        """RESET_ODOMETRY: オドメトリを指定姿勢にリセット"""
+        payload = struct.pack('<fff', x, y, theta)
+        self._send_request(self.REQUEST_RESET_ODOMETRY, payload)
+        response = self._receive_response()
+        if response and len(response) >= 5:
+            return response[4] == 0x00
+        return False
+
+    def motor_position(self, delta_left, delta_right, max_rpm=0.0, max_accel=0.0):
+        """MOTOR_POSITION: 左右ホイールの相対位置指令（0でデフォルト速度・加速度）"""
+        payload = struct.pack('<iiff', delta_left, delta_right, max_rpm, max_accel)
+        self._send_request(self.REQUEST_MOTOR_POSITION, payload)
+        response = self._receive_response()
+        if response and len(response) >= 5:
+            return response[4] == 0x00
+        return False
+
+    def trajectory_upload(self, segments, start_index=0):
+        """TRAJECTORY_UPLOAD: セグメント列 [(duration_ms, mode, linear_x, angular_z), ...] を書き込み
+
+        16セグメントずつ分割して送る。戻り値は (結果コード, アップロード先のセグメント数)
+        """
+        result = (0x01, 0)
+        for offset in range(0, max(len(segments), 1), 16):
+            chunk = segments[offset:offset + 16]
+            payload = struct.pack('<BB', start_index + offset, len(chunk))
+            for duration_ms, mode, linear_x, angular_z in chunk:
+                payload += struct.pack('<HBxff', duration_ms, mode, linear_x, angular_z)
+            self._send_request(self.REQUEST_TRAJECTORY_UPLOAD, payload)
+            response = self._receive_response()
+            if not response or len(response) < 6:
+                return (0x01, 0)
+            result = (response[4], response[5])
+            if result[0] != 0x00:
+                break
+        return result
+
+    def trajectory_start(self, queued=False):
+        """TRAJECTORY_START: アップロードした軌道を開始（queued=Trueで実行中の軌道の後に連結）"""
+        self._send_request(self.REQUEST_TRAJECTORY_START, struct.pack('<B', 1 if queued else 0))
+        response = self._receive_response()
+        if response and len(response) >= 5:
+            return response[4]
+        return None
+
+    def trajectory_abort(self):
+        """TRAJECTORY_ABORT: 軌道の実行を中断"""
+        self._send_request(self.REQUEST_TRAJECTORY_ABORT)
+        response = self._receive_response()
+        if response and len(response) >= 5:
+            return response[4] == 0x00
+        return False
+
+    def get_trajectory_status(self):
+        """GET_TRAJECTORY_STATUS: 軌道の実行状態取得"""
+        self._send_request(self.REQUEST_GET_TRAJECTORY_STATUS)
+        response = self._receive_response()
+        if response and len(response) >= 16:
+            state, segment, loaded, queued, elapsed, duration = struct.unpack(
+                '<BBBBII', response[4:16])
+            return {
+                'state': state,
+                'segment_index': segment,
+                'loaded_count': loaded,
+                'queued': bool(queued),
+                'elapsed_ms': elapsed,
+                'duration_ms': duration
+            }
+        return None
+
+    def get_timing(self, reset=False):
+        """GET_TIMING: 制御周期の時間計測取得（reset=Trueで応答後にクリア）"""
+        payload = struct.pack('<B', 1) if reset else b''
+        self._send_request(self.REQUEST_GET_TIMING, payload)
+        response = self._receive_response()
+        if response and len(response) == 5:
+            return {'busy': response[4] == 0x01}  # 集計を読み出せなかった（再要求する）
+        if response and len(response) >= 192:
+            nominal, overruns, missed = struct.unpack('<III', response[4:16])
+            result = {
+                'nominal_period_us': nominal,
+                'overrun_count': overruns,
+                'missed_ticks': missed
+            }
+            for name, offset in (('period', 16), ('execution', 104)):
+                fields = struct.unpack('<6I16I', response[offset:offset + 88])
+                result[name] = {
+                    'count': fields[0],
+                    'min_us': fields[1],
+                    'max_us': fields[2],
+                    'mean_us': fields[3],
+                    'bucket_origin_us': fields[4],
+                    'bucket_width_us': fields[5],
+                    'buckets': list(fields[6:])
+                }
+            if len(response) >= 200:
+                xip_access, xip_hit = struct.unpack('<II', response[192:200])
+                result['xip_access_count'] = xip_access
+                result['xip_hit_count'] = xip_hit
+            if len(response) >= 220:
+                count, min_us, max_us, mean_us, out_of_cycle = struct.unpack('<5I', response[200:220])
+                result['command_latency'] = {
+                    'count': count,
+                    'min_us': min_us,
+                    'max_us': max_us,
+                    'mean_us': mean_us
+                }
+                result['out_of_cycle_count'] = out_of_cycle
+            return result
         return None
 
 
@@ -178,6 +356,11 @@ def test_status(pico):
         print(f"  Error Code: 0x{result['error_code']:02X}")
         print(f"  Comm Errors: {result['comm_error_count']}")
         print(f"  Uptime: {result['uptime_ms']} ms")
+        reasons = {0: 'POWER_ON', 1: 'WATCHDOG_CORE1', 2: 'WATCHDOG_CORE0', 3: 'WATCHDOG', 4: 'SOFTWARE'}
+        print(f"  Reset Reason: {reasons.get(result['reset_reason'], result['reset_reason'])}"
+              f" (watchdog resets: {result['watchdog_reset_count']})")
+        if 'first_tick_us' in result:
+            print(f"  First Control Tick: {result['first_tick_us']} us after boot")
         print("  [OK] ステータス取得成功")
         return True
     else:
@@ -196,6 +379,13 @@ def test_config(pico):
         print(f"  Gear Ratio: {result['gear_ratio']}")
         print(f"  Wheel Diameter: {result['wheel_diameter']} m")
         print(f"  Track Width: {result['track_width']} m")
+        if 'pid_kp_r' in result:
+            print(f"  右 PID: Kp={result['pid_kp_r']}, Ki={result['pid_ki_r']}, Kd={result['pid_kd_r']}")
+            print(f"  右 Encoder PPR: {result['encoder_ppr_r']}")
+            print(f"  右 Gear Ratio: {result['gear_ratio_r']}")
+            print(f"  右 Wheel Diameter: {result['wheel_diameter_r']} m")
+        if 'control_rate_hz' in result:
+            print(f"  Control Rate: {result['control_rate_hz']} Hz")
         print("  [OK] 設定取得成功")
         return True
     else:
@@ -227,6 +417,9 @@ def test_debug_output(pico):
         print(f"  Target RPM: L={result['target_rpm_l']:.1f}, R={result['target_rpm_r']:.1f}")
         print(f"  Current RPM: L={result['current_rpm_l']:.1f}, R={result['current_rpm_r']:.1f}")
         print(f"  PWM: L={result['pwm_l']:.2f}, R={result['pwm_r']:.2f}")
+        if 'current_rms_l' in result:
+            print(f"  Current RMS/Peak [A]: L={result['current_rms_l']:.2f}/{result['current_peak_l']:.2f}, "
+                  f"R={result['current_rms_r']:.2f}/{result['current_peak_r']:.2f}")
         print("  [OK] デバッグ出力取得成功")
         return True
     else:
@@ -234,9 +427,63 @@ def test_debug_output(pico):
         return False
 
 
+def test_odometry(pico):
+    """Step 6: GET_ODOMETRY / RESET_ODOMETRYテスト"""
+    print("\n=== Step 6: ODOMETRY ===")
+    if not pico.reset_odometry():
+        print("  [NG] リセット応答なし")
+        return False
+    time.sleep(0.05)  # Core1の次の制御周期で適用される
+    result = pico.get_odometry()
+    if result and 'busy' in result:
+        result = pico.get_odometry()  # Core1の更新と競合した場合は1回だけ再要求
+    if result and 'busy' in result:
+        print("  [NG] BUSY")
+        return False
+    if result:
+        print(f"  Pose: x={result['x']:.3f} m, y={result['y']:.3f} m, theta={result['theta']:.3f} rad")
+        print(f"  Velocity: v={result['linear_x']:.3f} m/s, w={result['angular_z']:.3f} rad/s")
+        print(f"  Timestamp: {result['timestamp_us']} us")
+        print("  [OK] オドメトリ取得成功")
+        return True
+    else:
+        print("  [NG] 応答なし")
+        return False
+
+
+def test_timing(pico):
+    """Step 7: GET_TIMINGテスト"""
+    print("\n=== Step 7: GET_TIMING ===")
+    result = pico.get_timing()
+    if result and 'busy' in result:
+        result = pico.get_timing()  # Core1の更新と競合した場合は1回だけ再要求
+    if result and 'busy' in result:
+        print("  [NG] BUSY")
+        return False
+    if result:
+        print(f"  Nominal period: {result['nominal_period_us']} us")
+        for name in ('period', 'execution'):
+            s = result[name]
+            print(f"  {name}: n={s['count']} min={s['min_us']} max={s['max_us']} mean={s['mean_us']} us")
+            print(f"    buckets (from {s['bucket_origin_us']} us, {s['bucket_width_us']} us each): {s['buckets']}")
+        print(f"  Overruns: {result['overrun_count']}, Missed ticks: {result['missed_ticks']}")
+        if 'xip_access_count' in result:
+            misses = result['xip_access_count'] - result['xip_hit_count']
+            print(f"  XIP cache (during ticks): access={result['xip_access_count']} miss={misses}")
+        if 'command_latency' in result:
+            s = result['command_latency']
+            print(f"  Command latency: n={s['count']} min={s['min_us']} max={s['max_us']} mean={s['mean_us']} us"
+                  f" (out-of-cycle={result['out_of_cycle_count']})")
+        print("  [OK] 時間計測取得成功")
+        return True
+    else:
+        print("  [NG] 応答なし")
+        return False
+
+
 def test_encoder_change(pico):
-    """Step 6: エンコーダ変化テスト（手動）"""
-    print("\n=== Step 6: エンコーダ変化テスト ===")
+    """Step 8: エンコーダ変化テスト（手動）"""
+    print("\n=== Step 8: エンコーダ変化テスト ===")
     print("  エンコーダを手で回してください...")
     print("  5秒間カウントを監視します")
 
@@ -283,6 +530,8 @@ def main():
         test_config(pico)
         test_motor_command_zero(pico)
         test_debug_output(pico)
+        test_odometry(pico)
+        test_timing(pico)
 
         # インタラクティブテスト
         input("\nEnterを押すとエンコーダテストを開始します...")